@@ -17,6 +17,14 @@ static U32 min(const U32 a, const U32 b) {
   return (a < b) ? a : b;
 }
 
+static U32 bigEndianWord(const U8 *const word) {
+  return
+    (static_cast<U32>(word[0]) << 24) |
+    (static_cast<U32>(word[1]) << 16) |
+    (static_cast<U32>(word[2]) << 8) |
+    static_cast<U32>(word[3]);
+}
+
 namespace CFDP {
 
   Checksum ::
@@ -84,8 +92,7 @@ namespace CFDP {
     }
 
     // Add the middle words aligned
-    for ( ; index + 4 <= length; index += 4)
-      addWordAligned(&data[index]);
+    index += this->addWordsAligned(&data[index], length - index);
 
     // Add the last word unaligned if necessary
     if (index < length) {
@@ -99,11 +106,30 @@ namespace CFDP {
 
   }
 
-  void Checksum ::
-    addWordAligned(const U8 *const word)
+  U32 Checksum ::
+    addWordsAligned(
+        const U8 *const words,
+        const U32 length
+    )
   {
-    for (U32 i = 0; i < 4; ++i)
-      addByteAtOffset(word[i], i);
+    // The checksum is the sum of the big-endian words modulo 2^32,
+    // so the words can be summed in any order. Four independent
+    // sums keep the additions from waiting on each other.
+    U32 sum0 = 0;
+    U32 sum1 = 0;
+    U32 sum2 = 0;
+    U32 sum3 = 0;
+    U32 index = 0;
+    for ( ; index + 16 <= length; index += 16) {
+      sum0 += bigEndianWord(&words[index]);
+      sum1 += bigEndianWord(&words[index + 4]);
+      sum2 += bigEndianWord(&words[index + 8]);
+      sum3 += bigEndianWord(&words[index + 12]);
+    }
+    for ( ; index + 4 <= length; index += 4)
+      sum0 += bigEndianWord(&words[index]);
+    this->value += sum0 + sum1 + sum2 + sum3;
+    return index;
   }
   
   void Checksum :: 
@@ -74,9 +74,12 @@ namespace CFDP {
       // Private instance methods 
       // ----------------------------------------------------------------------
 
-      //! Add a four-byte aligned word to the checksum value
-      void addWordAligned(
-          const U8 *const word //! The word
+      //! Add the four-byte aligned words at the start of the data
+      //! to the checksum value
+      //! \return The number of bytes added, a multiple of four
+      U32 addWordsAligned(
+          const U8 *const words, //! The words
+          const U32 length //! The length of the data in bytes
       );
 
       //! Add a four-byte unaligned word to the checksum value
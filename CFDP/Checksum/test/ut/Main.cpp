@@ -2,6 +2,8 @@
 // Main.cpp 
 // ----------------------------------------------------------------------
 
+#include <stdlib.h>
+
 #include "gtest/gtest.h"
 
 #include "CFDP/Checksum/Checksum.hpp"
@@ -49,6 +51,83 @@ TEST(Checksum, ThreePackets) {
   ASSERT_EQ(expectedValue, checksum.getValue());
 }
 
+// Compute the checksum one byte at a time, as described in
+// CFDP 4.1.2: each byte is added at its position in a big-endian word
+static U32 referenceValue(
+    const U8 *const data,
+    const U32 offset,
+    const U32 length
+) {
+  U32 value = 0;
+  for (U32 i = 0; i < length; ++i) {
+    const U32 position = (offset + i) % 4;
+    value += static_cast<U32>(data[i]) << (8*(3-position));
+  }
+  return value;
+}
+
+TEST(Checksum, LongPacket) {
+  U8 longData[1000];
+  for (U32 i = 0; i < sizeof(longData); ++i) {
+    longData[i] = static_cast<U8>(0xFF - i);
+  }
+  for (U32 offset = 0; offset < 4; ++offset) {
+    Checksum checksum;
+    checksum.update(longData, offset, sizeof(longData));
+    ASSERT_EQ(
+        referenceValue(longData, offset, sizeof(longData)),
+        checksum.getValue()
+    );
+  }
+}
+
+TEST(Checksum, RandomPackets) {
+  const U32 dataSize = 4096;
+  const U32 numIterations = 1000;
+  U8 randomData[dataSize];
+  srand(0);
+  for (U32 iteration = 0; iteration < numIterations; ++iteration) {
+    for (U32 i = 0; i < dataSize; ++i) {
+      randomData[i] = static_cast<U8>(rand());
+    }
+    // Split the data into packets of random size, starting at a
+    // random file offset
+    const U32 fileOffset = rand() % 8;
+    Checksum checksum;
+    U32 index = 0;
+    while (index < dataSize) {
+      U32 packetSize = 1 + rand() % 300;
+      if (index + packetSize > dataSize) {
+        packetSize = dataSize - index;
+      }
+      checksum.update(&randomData[index], fileOffset + index, packetSize);
+      index += packetSize;
+    }
+    ASSERT_EQ(
+        referenceValue(randomData, fileOffset, dataSize),
+        checksum.getValue()
+    );
+  }
+}
+
+TEST(Checksum, LargeData) {
+  // Large sums wrap many times. The data starts off a word boundary
+  const U32 dataSize = 1 << 20;
+  const U32 numPasses = 8;
+  U8 *const bigData = new U8[dataSize];
+  for (U32 i = 0; i < dataSize; ++i) {
+    bigData[i] = static_cast<U8>(i * 7);
+  }
+  Checksum checksum;
+  U32 value = 0;
+  for (U32 pass = 0; pass < numPasses; ++pass) {
+    checksum.update(bigData, pass * dataSize + 1, dataSize);
+    value += referenceValue(bigData, pass * dataSize + 1, dataSize);
+  }
+  ASSERT_EQ(value, checksum.getValue());
+  delete[] bigData;
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
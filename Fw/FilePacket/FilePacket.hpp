@@ -133,13 +133,23 @@ namespace Fw {
           //! The destination path
           PathName destinationPath;
 
+          //! The file flags. They are sent only when nonzero, so a packet
+          //! that ends after the destination path has flags 0
+          U8 flags;
+
+          //! The file flags
+          enum {
+            FLAG_COMPRESSED = 0x01 //!< The file data is a Utils::Lz stream
+          };
+
         public:
 
           //! Initialize a StartPacket with sequence number 0
           void initialize(
               const U32 fileSize, //!< The file size
               const char *const sourcePath, //!< The source path
-              const char *const destinationPath //!< The destination path
+              const char *const destinationPath, //!< The destination path
+              const U8 flags = 0 //!< The file flags
           );
 
           //! Compute the buffer size needed to hold this StartPacket
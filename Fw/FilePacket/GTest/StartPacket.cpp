@@ -27,6 +27,7 @@ namespace Fw {
       ASSERT_EQ(expected.fileSize, actual.fileSize);
       PathName::compare(expected.sourcePath, actual.sourcePath);
       PathName::compare(expected.destinationPath, actual.destinationPath);
+      ASSERT_EQ(expected.flags, actual.flags);
     }
 
   }
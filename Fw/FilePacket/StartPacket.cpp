@@ -19,7 +19,8 @@ namespace Fw {
     initialize(
       const U32 fileSize,
       const char *const sourcePath,
-      const char *const destinationPath
+      const char *const destinationPath,
+      const U8 flags
     )
   {
     const FilePacket::Header header = { FilePacket::T_START, 0 };
@@ -27,6 +28,7 @@ namespace Fw {
     this->fileSize = fileSize;
     this->sourcePath.initialize(sourcePath);
     this->destinationPath.initialize(destinationPath);
+    this->flags = flags;
   }
 
   U32 FilePacket::StartPacket ::
@@ -35,7 +37,8 @@ namespace Fw {
     return this->header.bufferSize() +
       sizeof(this->fileSize) +
       this->sourcePath.bufferSize() +
-      this->destinationPath.bufferSize();
+      this->destinationPath.bufferSize() +
+      ((this->flags != 0) ? sizeof(this->flags) : 0);
   }
 
   SerializeStatus FilePacket::StartPacket ::
@@ -75,6 +78,14 @@ namespace Fw {
         return status;
     }
 
+    this->flags = 0;
+    if (serialBuffer.getBuffLeft() > 0) {
+      const SerializeStatus status =
+        serialBuffer.deserialize(this->flags);
+      if (status != FW_SERIALIZE_OK)
+        return status;
+    }
+
     return FW_SERIALIZE_OK;
 
   }
@@ -113,6 +124,14 @@ namespace Fw {
         return status;
     }
 
+    // Packets without flags keep the layout that predates them
+    if (this->flags != 0) {
+      const SerializeStatus status =
+        serialBuffer.serialize(this->flags);
+      if (status != FW_SERIALIZE_OK)
+        return status;
+    }
+
     return FW_SERIALIZE_OK;
 
   }
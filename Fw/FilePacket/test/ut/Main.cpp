@@ -44,7 +44,8 @@ namespace Fw {
     expected.initialize(
         10, // File size
         "source", // Source path
-        "dest" // Destination path
+        "dest", // Destination path
+        FilePacket::StartPacket::FLAG_COMPRESSED // Flags
     );
     const U32 size = expected.bufferSize();
     U8 bytes[size];
@@ -69,6 +70,41 @@ namespace Fw {
     );
   }
 
+  // A start packet without flags has no flags byte
+  TEST(FilePacket, StartPacketNoFlags) {
+    FilePacket::StartPacket expected;
+    expected.initialize(
+        10, // File size
+        "source", // Source path
+        "dest" // Destination path
+    );
+    const U32 size = expected.bufferSize();
+    ASSERT_EQ(
+        expected.header.bufferSize() +
+        sizeof(expected.fileSize) +
+        expected.sourcePath.bufferSize() +
+        expected.destinationPath.bufferSize(),
+        size
+    );
+    U8 bytes[size];
+    Buffer buffer(0, 0, reinterpret_cast<U64>(bytes), size);
+    {
+      const SerializeStatus status = 
+        expected.toBuffer(buffer);
+      ASSERT_EQ(status, FW_SERIALIZE_OK);
+    }
+    FilePacket actual;
+    {
+      const SerializeStatus status = 
+        actual.fromBuffer(buffer);
+      ASSERT_EQ(status, FW_SERIALIZE_OK);
+    }
+    GTest::FilePackets::StartPacket::compare(
+        expected, 
+        actual.asStartPacket()
+    );
+  }
+
   // Serialize and deserialize a data packet
   TEST(FilePacket, DataPacket) {
     FilePacket::DataPacket expected;
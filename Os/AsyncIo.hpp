@@ -0,0 +1,83 @@
+#ifndef _AsyncIo_hpp_
+#define _AsyncIo_hpp_
+
+#include <Fw/Cfg/Config.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/File.hpp>
+
+#define ASYNC_IO_MAX_DEPTH (64) //!< maximum number of requests in flight
+#define ASYNC_IO_MAX_WORKERS (4) //!< maximum number of worker tasks for the thread pool
+
+namespace Os {
+
+    // This class runs reads, writes, and syncs of open Os::File objects asynchronously.
+    // Requests are queued with submit() and may complete in any order; completions are
+    // collected with reap(). On Linux the requests go to an io_uring. When io_uring is not
+    // available, or is not wanted, a pool of worker tasks runs them with the positional
+    // Os::File calls instead. submit() may be called from any task, and reap() from one task.
+
+    class AsyncIo {
+        public:
+
+            typedef enum {
+                READ, //!<  Read into buffer at offset
+                WRITE, //!<  Write buffer at offset
+                FSYNC, //!<  Flush the file to disk
+                NOP, //!<  Do nothing. Completes at once; used to wake a task blocked in reap()
+            } Operation;
+
+            typedef enum {
+                OP_OK, //!<  Operation was successful
+                NOT_STARTED, //!<  start() has not been called or failed
+                QUEUE_FULL, //!<  The maximum number of requests are in flight
+                BAD_REQUEST, //!<  The file is not open or the buffer is invalid
+                OTHER_ERROR, //!<  The backend could not be created
+            } Status;
+
+            typedef enum {
+                NO_BACKEND, //!<  Not started
+                IO_URING, //!<  Linux io_uring
+                THREAD_POOL, //!<  Worker tasks running Os::File calls
+            } Backend;
+
+            typedef struct {
+                Operation operation; //!< the operation
+                File* file; //!< the open file. Must stay open until the request completes. Unused for NOP
+                void* buffer; //!< data to write or space to read into. Unused for FSYNC and NOP
+                NATIVE_INT_TYPE size; //!< bytes to transfer. Unused for FSYNC and NOP
+                U64 offset; //!< file offset of the transfer. Unused for FSYNC and NOP
+                POINTER_CAST context; //!< returned with the completion
+            } Request;
+
+            typedef struct {
+                Request request; //!< the completed request
+                File::Status status; //!< the result of the operation
+                NATIVE_INT_TYPE size; //!< bytes transferred. Short only when a READ reaches the end of the file or the transfer fails
+            } Completion;
+
+            AsyncIo(); //!<  Constructor
+            virtual ~AsyncIo(); //!<  Destructor. Stops if started
+
+            Status start(const char* name, NATIVE_UINT_TYPE depth, NATIVE_UINT_TYPE workers,
+                         NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize,
+                         bool useIoUring = true); //!<  start the backend. depth is the maximum number of requests in flight,
+                                                  //!<  up to ASYNC_IO_MAX_DEPTH. workers is the number of worker tasks if
+                                                  //!<  the thread pool is used, up to ASYNC_IO_MAX_WORKERS
+            void stop(void); //!<  wait for the requests in flight, drop their completions, and release the backend
+
+            Status submit(const Request& request); //!<  queue a request
+            NATIVE_UINT_TYPE reap(Completion* completions, NATIVE_UINT_TYPE maxCompletions, bool wait); //!<  collect up to maxCompletions completions.
+                                                                                                   //!<  If wait is true, blocks for at least one, even when nothing is
+                                                                                                   //!<  in flight; submit a NOP from another task to wake it
+
+            Backend getBackend(void) const; //!<  get the backend in use
+            NATIVE_UINT_TYPE getInFlight(void) const; //!<  get the number of requests submitted and not yet reaped
+
+        private:
+
+            POINTER_CAST m_handle; //!<  Stored handle to the backend state
+    };
+
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef _DirectWriter_hpp_
+#define _DirectWriter_hpp_
+
+#include <Fw/Cfg/Config.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/File.hpp>
+
+#define DIRECT_WRITER_ALIGNMENT (4096) //!< alignment of the staging buffer and of every write offset and size
+#define DIRECT_WRITER_BUFFER_SIZE (16*1024) //!< size of the staging buffer. Must be a multiple of DIRECT_WRITER_ALIGNMENT
+
+namespace Os {
+
+    // This class writes a file opened with Os::File::OPEN_SYNC_DIRECT_WRITE, which bypasses
+    // the page cache and so needs aligned buffers, offsets, and sizes. Data is copied into an
+    // aligned staging buffer and written a full buffer at a time. flush() writes the partial
+    // last block padded with zeros; the block stays staged and is written again as it fills.
+    // close() trims the padding and any preallocated space, leaving exactly the bytes written.
+    // If the file system refuses direct I/O, the file is opened with OPEN_SYNC_WRITE instead.
+
+    class DirectWriter {
+        public:
+
+            DirectWriter(); //!<  Constructor
+            virtual ~DirectWriter(); //!<  Destructor. Closes the file if still open
+
+            File::Status open(const char* fileName, U32 preallocSize = 0); //!<  open and empty the file. preallocSize bytes are reserved on disk
+                                                                          //!<  if the file system allows it, so later writes do not allocate
+            File::Status write(const void * buffer, NATIVE_INT_TYPE &size); //!<  stage size bytes, writing each full staging buffer.
+                                                                          //!<  size is modified to the bytes accepted
+            File::Status writev(const File::IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size); //!<  stage count buffers in order.
+                                                                          //!<  size is set to the total bytes accepted
+            File::Status flush(void); //!<  write the staged bytes to disk, padding the last block
+            File::Status close(void); //!<  flush, trim the file to the bytes written, and close
+
+            bool isOpen(void) const; //!<  whether a file is open
+            bool isDirect(void) const; //!<  whether the file bypasses the page cache
+            U64 getSize(void) const; //!<  get the number of bytes written since open
+
+        private:
+
+            File::Status writeStaged(void); //!<  write the staged bytes and keep the partial last block
+
+            File m_file; //!<  the file
+            U8 m_storage[DIRECT_WRITER_BUFFER_SIZE + DIRECT_WRITER_ALIGNMENT]; //!<  holds the staging buffer at an aligned address
+            U8* m_buffer; //!<  the aligned staging buffer
+            NATIVE_UINT_TYPE m_used; //!<  bytes staged
+            U64 m_offset; //!<  file offset of the start of the staging buffer. Always aligned
+            bool m_dirty; //!<  whether bytes were staged since the last write to disk
+            bool m_direct; //!<  whether the file was opened for direct I/O
+    };
+
+}
+
+#endif
@@ -18,6 +18,7 @@ namespace Os {
                 OPEN_SYNC_WRITE, //!<  Open file for writing; writes don't return until data is on disk
                 OPEN_SYNC_DIRECT_WRITE, //!<  Open file for writing, bypassing all caching. Requires data alignment
                 OPEN_CREATE, //!< Open file for writing and truncates file if it exists, ie same flags as creat()
+                OPEN_CREATE_EXCLUSIVE, //!< Create file for writing; fails with FILE_EXISTS if the file already exists
             } Mode;
 
             typedef enum {
@@ -28,8 +29,15 @@ namespace Os {
                 BAD_SIZE, //!<  Invalid size parameter
                 NOT_OPENED, //!<  file hasn't been opened yet
                 OTHER_ERROR, //!<  A catch-all for other errors. Have to look in implementation-specific code
+                FILE_EXISTS, //!<  File already exists (for OPEN_CREATE_EXCLUSIVE)
             } Status;
 
+            //! A buffer for the scatter-gather calls readv and writev
+            typedef struct {
+                void* buffer; //!< the buffer
+                NATIVE_INT_TYPE size; //!< the size of the buffer in bytes
+            } IoVector;
+
             File(); //!<  Constructor
             virtual ~File(); //!<  Destructor. Will close file if still open
             Status prealloc(NATIVE_INT_TYPE offset, NATIVE_INT_TYPE len);
@@ -41,6 +49,14 @@ namespace Os {
                                                                             // size is modified to actual read size
             Status write(const void * buffer, NATIVE_INT_TYPE &size, bool waitForDone = true); //!<  write size; will return amount written or errno
             Status bulkWrite(const void * buffer, NATIVE_UINT_TYPE &totalSize, NATIVE_INT_TYPE chunkSize); //!<  write size; will return amount written or errno
+            Status readAt(void * buffer, NATIVE_INT_TYPE &size, U64 offset, bool waitForFull = true); //!<  read data starting at offset without moving the file position.
+                                                                            //!<  size is modified to actual read size, which is short at end of file
+            Status writeAt(const void * buffer, NATIVE_INT_TYPE &size, U64 offset, bool waitForDone = true); //!<  write all of size starting at offset without moving the file position.
+                                                                            //!<  size is modified to actual write size
+            Status readv(const IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size, bool waitForFull = true); //!<  read into count buffers in order at the file position.
+                                                                            //!<  size is set to the total read size
+            Status writev(const IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size, bool waitForDone = true); //!<  write all of count buffers in order at the file position.
+                                                                            //!<  size is set to the total write size
 
             void close(void); //!<  close file
 
@@ -52,6 +68,9 @@ namespace Os {
 
         private:
 
+            friend class AsyncIo; //!<  submits requests on the file descriptor
+            friend class DirectWriter; //!<  trims and preallocates the file
+
             NATIVE_INT_TYPE m_fd; //!<  Stored file descriptor
             Mode m_mode; //!<  Stores mode for error checking
             NATIVE_INT_TYPE m_lastError; //!<  stores last error
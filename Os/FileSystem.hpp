@@ -5,7 +5,9 @@
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Types/EightyCharString.hpp>
 
-#define FILE_SYSTEM_CHUNK_SIZE (256)
+#define FILE_SYSTEM_COPY_CHUNK_SIZE (1024*1024) //!< bytes copied between copyFile progress reports
+#define FILE_SYSTEM_COPY_BUFFER_SIZE (4096) //!< stack buffer used by copyFile when the OS cannot copy in the kernel
+#define FILE_SYSTEM_DIRECTORY_BUFFER_SIZE (4096) //!< directory entries read at a time by DirectoryIterator
 
 namespace Os {
 
@@ -32,11 +34,41 @@ namespace Os {
 		Status removeFile(const char* path); //!< removes a file at location path
 		Status moveFile(const char* originPath, const char* destPath); //! moves a file from origin to destination
 		Status copyFile(const char* originPath, const char* destPath); //! copies a file from origin to destination
+
+		typedef void (*CopyProgress)(void* context, U64 bytesCopied, U64 totalBytes); //!< called by copyFile as the copy proceeds
+		Status copyFile(const char* originPath, const char* destPath, CopyProgress progress, void* context); //! copies a file from origin to destination, calling progress (if not NULL) after every FILE_SYSTEM_COPY_CHUNK_SIZE bytes
 		Status getFileSize(const char* path, U64& size); //!< gets the size of the file (in bytes) at location path
+		Status getFileModTime(const char* path, U32& seconds, U32& useconds); //!< gets the last modification time of the file at location path
 		Status getFileCount(const char* directory, U32& fileCount); //!< counts the number of files in the given directory
 		Status changeWorkingDirectory(const char* path); //!<  move current directory to path
 
         Status getFreeSpace(const char* path, U64& totalBytes, U64& freeBytes); //!< get FS free and total space in bytes on filesystem containing path
+
+		typedef enum {
+			ENTRY_FILE, //!< Regular file
+			ENTRY_DIRECTORY, //!< Directory
+			ENTRY_OTHER, //!< Link, device, pipe, or socket
+		} EntryType;
+
+		// Reads a directory one entry at a time into a fixed buffer, so a directory of any size
+		// can be listed without an array sized for all of it. The "." and ".." entries are skipped.
+		class DirectoryIterator {
+			public:
+				DirectoryIterator(); //!< Constructor
+				~DirectoryIterator(); //!< Destructor. Closes the directory if it is open
+				Status open(const char* path); //!< open the directory at location path
+				Status next(const char*& name, EntryType& type); //!< get the next entry. name is NULL after the last one, and is valid until the next call
+				void close(void); //!< close the directory
+				bool isOpen(void) const; //!< whether a directory is open
+			private:
+				DirectoryIterator(const DirectoryIterator&); //!< Not copyable
+				DirectoryIterator& operator=(const DirectoryIterator&); //!< Not copyable
+				NATIVE_INT_TYPE m_fd; //!< Directory descriptor, when entries are read with getdents64
+				void* m_dir; //!< Directory stream, when entries are read with readdir
+				U64 m_buffer[FILE_SYSTEM_DIRECTORY_BUFFER_SIZE / sizeof(U64)]; //!< Entries read from the directory, aligned for the entry headers
+				NATIVE_INT_TYPE m_size; //!< Bytes of entries in the buffer
+				NATIVE_INT_TYPE m_offset; //!< Offset of the next entry in the buffer
+		};
 	}
 
 }
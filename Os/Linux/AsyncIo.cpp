@@ -0,0 +1,600 @@
+#include <Fw/Cfg/Config.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/AsyncIo.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/Queue.hpp>
+#include <Os/Task.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/EightyCharString.hpp>
+
+#include <cerrno>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define ASYNC_IO_URING_AVAILABLE
+#endif
+#endif
+
+#if defined(ASYNC_IO_URING_AVAILABLE)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace Os {
+
+    namespace {
+
+        // Message that tells a worker task to exit
+        const NATIVE_INT_TYPE STOP_WORKER = -1;
+
+        // A request in flight
+        struct Slot {
+            AsyncIo::Request request;
+            File::Status status; // result, for the thread pool
+            NATIVE_INT_TYPE size; // bytes transferred so far
+#if defined(ASYNC_IO_URING_AVAILABLE)
+            struct iovec iov; // the buffer, for io_uring
+            NATIVE_INT_TYPE fd; // the file descriptor, for io_uring
+#endif
+        };
+
+        // The backend state, owned through AsyncIo::m_handle
+        struct State {
+            AsyncIo::Backend backend;
+            NATIVE_UINT_TYPE depth;
+            Mutex lock; // guards the free slots and the submission ring
+            Slot slots[ASYNC_IO_MAX_DEPTH];
+            NATIVE_UINT_TYPE freeSlots[ASYNC_IO_MAX_DEPTH];
+            NATIVE_UINT_TYPE numFree;
+
+            // Thread pool
+            Queue requests; // indices of slots to run
+            Queue completions; // indices of slots that have run
+            Task workers[ASYNC_IO_MAX_WORKERS];
+            NATIVE_UINT_TYPE numWorkers;
+
+#if defined(ASYNC_IO_URING_AVAILABLE)
+            // io_uring
+            int ringFd;
+            void* sqRing;
+            size_t sqRingSize;
+            void* cqRing;
+            size_t cqRingSize;
+            struct io_uring_sqe* sqes;
+            size_t sqesSize;
+            unsigned* sqHead;
+            unsigned* sqTail;
+            unsigned* sqMask;
+            unsigned* sqArray;
+            unsigned* cqHead;
+            unsigned* cqTail;
+            unsigned* cqMask;
+            struct io_uring_cqe* cqes;
+#endif
+        };
+
+        File::Status errorToStatus(int error) {
+            File::Status status = File::OTHER_ERROR;
+            switch (error) {
+                case ENOSPC:
+                case EDQUOT:
+                case EFBIG:
+                    status = File::NO_SPACE;
+                    break;
+                case EACCES:
+                case EPERM:
+                    status = File::NO_PERMISSION;
+                    break;
+                case EBADF:
+                    status = File::NOT_OPENED;
+                    break;
+                case EINVAL:
+                    status = File::BAD_SIZE;
+                    break;
+                default:
+                    status = File::OTHER_ERROR;
+                    break;
+            }
+            return status;
+        }
+
+        NATIVE_UINT_TYPE takeSlot(State& state) {
+            FW_ASSERT(state.numFree > 0);
+            return state.freeSlots[--state.numFree];
+        }
+
+        void releaseSlot(State& state, NATIVE_UINT_TYPE index) {
+            state.lock.lock();
+            FW_ASSERT(state.numFree < state.depth, state.numFree);
+            state.freeSlots[state.numFree++] = index;
+            state.lock.unLock();
+        }
+
+        // ----------------------------------------------------------------------
+        // Thread pool
+        // ----------------------------------------------------------------------
+
+        void runRequest(Slot& slot) {
+            AsyncIo::Request& request = slot.request;
+            slot.size = 0;
+            switch (request.operation) {
+                case AsyncIo::READ:
+                    slot.size = request.size;
+                    slot.status = request.file->readAt(request.buffer, slot.size, request.offset, true);
+                    break;
+                case AsyncIo::WRITE:
+                    slot.size = request.size;
+                    slot.status = request.file->writeAt(request.buffer, slot.size, request.offset, false);
+                    break;
+                case AsyncIo::FSYNC:
+                    slot.status = request.file->flush();
+                    break;
+                case AsyncIo::NOP:
+                    slot.status = File::OP_OK;
+                    break;
+                default:
+                    FW_ASSERT(0, request.operation);
+                    break;
+            }
+        }
+
+        void runWorker(void* ptr) {
+            State* state = static_cast<State*>(ptr);
+            while (true) {
+                NATIVE_INT_TYPE index = STOP_WORKER;
+                NATIVE_INT_TYPE actualSize = 0;
+                NATIVE_INT_TYPE priority = 0;
+                Queue::QueueStatus queueStatus = state->requests.receive(
+                    reinterpret_cast<U8*>(&index), sizeof(index), actualSize, priority, Queue::QUEUE_BLOCKING);
+                FW_ASSERT(Queue::QUEUE_OK == queueStatus, queueStatus);
+                if (STOP_WORKER == index) {
+                    break;
+                }
+                FW_ASSERT(index >= 0 and index < ASYNC_IO_MAX_DEPTH, index);
+                runRequest(state->slots[index]);
+                queueStatus = state->completions.send(
+                    reinterpret_cast<U8*>(&index), sizeof(index), 0, Queue::QUEUE_BLOCKING);
+                FW_ASSERT(Queue::QUEUE_OK == queueStatus, queueStatus);
+            }
+        }
+
+        void stopWorkers(State& state) {
+            for (NATIVE_UINT_TYPE i = 0; i < state.numWorkers; i++) {
+                const NATIVE_INT_TYPE message = STOP_WORKER;
+                const Queue::QueueStatus queueStatus = state.requests.send(
+                    reinterpret_cast<const U8*>(&message), sizeof(message), 0, Queue::QUEUE_BLOCKING);
+                FW_ASSERT(Queue::QUEUE_OK == queueStatus, queueStatus);
+            }
+            for (NATIVE_UINT_TYPE i = 0; i < state.numWorkers; i++) {
+                const Task::TaskStatus taskStatus = state.workers[i].join(NULL);
+                FW_ASSERT(Task::TASK_OK == taskStatus, taskStatus);
+            }
+            state.numWorkers = 0;
+        }
+
+        bool startWorkers(State& state, const char* name, NATIVE_UINT_TYPE workers,
+                          NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize) {
+            if (workers > ASYNC_IO_MAX_WORKERS) {
+                workers = ASYNC_IO_MAX_WORKERS;
+            }
+            if (workers == 0) {
+                workers = 1;
+            }
+
+            char queueName[40];
+            (void) snprintf(queueName, sizeof(queueName), "%s_REQ", name);
+            Queue::QueueStatus queueStatus = state.requests.create(
+                Fw::EightyCharString(queueName), state.depth + workers, sizeof(NATIVE_INT_TYPE));
+            if (Queue::QUEUE_OK != queueStatus) {
+                return false;
+            }
+            (void) snprintf(queueName, sizeof(queueName), "%s_DONE", name);
+            queueStatus = state.completions.create(
+                Fw::EightyCharString(queueName), state.depth, sizeof(NATIVE_INT_TYPE));
+            if (Queue::QUEUE_OK != queueStatus) {
+                return false;
+            }
+
+            state.numWorkers = 0;
+            for (NATIVE_UINT_TYPE i = 0; i < workers; i++) {
+                char taskName[40];
+                (void) snprintf(taskName, sizeof(taskName), "%s_%u", name, static_cast<unsigned int>(i));
+                const Task::TaskStatus taskStatus = state.workers[state.numWorkers].start(
+                    Fw::EightyCharString(taskName), i, priority, stackSize, runWorker, &state);
+                if (Task::TASK_OK == taskStatus) {
+                    state.numWorkers++;
+                }
+            }
+            return (state.numWorkers > 0);
+        }
+
+        // ----------------------------------------------------------------------
+        // io_uring
+        // ----------------------------------------------------------------------
+
+#if defined(ASYNC_IO_URING_AVAILABLE)
+
+        int ringEnter(int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, NULL, 0));
+        }
+
+        bool setupRing(State& state) {
+            struct io_uring_params params;
+            memset(&params, 0, sizeof(params));
+            state.ringFd = static_cast<int>(::syscall(__NR_io_uring_setup, state.depth, &params));
+            if (state.ringFd < 0) {
+                return false;
+            }
+
+            state.sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            state.cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+            const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMmap) {
+                if (state.cqRingSize > state.sqRingSize) {
+                    state.sqRingSize = state.cqRingSize;
+                }
+                state.cqRingSize = state.sqRingSize;
+            }
+
+            state.sqRing = ::mmap(NULL, state.sqRingSize, PROT_READ | PROT_WRITE,
+                                  MAP_SHARED | MAP_POPULATE, state.ringFd, IORING_OFF_SQ_RING);
+            if (MAP_FAILED == state.sqRing) {
+                (void) ::close(state.ringFd);
+                return false;
+            }
+            if (singleMmap) {
+                state.cqRing = state.sqRing;
+            }
+            else {
+                state.cqRing = ::mmap(NULL, state.cqRingSize, PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_POPULATE, state.ringFd, IORING_OFF_CQ_RING);
+                if (MAP_FAILED == state.cqRing) {
+                    (void) ::munmap(state.sqRing, state.sqRingSize);
+                    (void) ::close(state.ringFd);
+                    return false;
+                }
+            }
+            state.sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+            void* sqes = ::mmap(NULL, state.sqesSize, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, state.ringFd, IORING_OFF_SQES);
+            if (MAP_FAILED == sqes) {
+                if (not singleMmap) {
+                    (void) ::munmap(state.cqRing, state.cqRingSize);
+                }
+                (void) ::munmap(state.sqRing, state.sqRingSize);
+                (void) ::close(state.ringFd);
+                return false;
+            }
+            state.sqes = static_cast<struct io_uring_sqe*>(sqes);
+
+            U8* sqRing = static_cast<U8*>(state.sqRing);
+            state.sqHead = reinterpret_cast<unsigned*>(sqRing + params.sq_off.head);
+            state.sqTail = reinterpret_cast<unsigned*>(sqRing + params.sq_off.tail);
+            state.sqMask = reinterpret_cast<unsigned*>(sqRing + params.sq_off.ring_mask);
+            state.sqArray = reinterpret_cast<unsigned*>(sqRing + params.sq_off.array);
+            U8* cqRing = static_cast<U8*>(state.cqRing);
+            state.cqHead = reinterpret_cast<unsigned*>(cqRing + params.cq_off.head);
+            state.cqTail = reinterpret_cast<unsigned*>(cqRing + params.cq_off.tail);
+            state.cqMask = reinterpret_cast<unsigned*>(cqRing + params.cq_off.ring_mask);
+            state.cqes = reinterpret_cast<struct io_uring_cqe*>(cqRing + params.cq_off.cqes);
+            return true;
+        }
+
+        void teardownRing(State& state) {
+            (void) ::munmap(state.sqes, state.sqesSize);
+            if (state.cqRing != state.sqRing) {
+                (void) ::munmap(state.cqRing, state.cqRingSize);
+            }
+            (void) ::munmap(state.sqRing, state.sqRingSize);
+            (void) ::close(state.ringFd);
+        }
+
+        // Queue the request in slot index on file descriptor fd and submit it.
+        // Called with the lock held
+        AsyncIo::Status submitRing(State& state, NATIVE_UINT_TYPE index, NATIVE_INT_TYPE fd) {
+            Slot& slot = state.slots[index];
+            const AsyncIo::Request& request = slot.request;
+
+            const unsigned tail = *state.sqTail;
+            const unsigned entry = tail & *state.sqMask;
+            struct io_uring_sqe* sqe = &state.sqes[entry];
+            memset(sqe, 0, sizeof(*sqe));
+            switch (request.operation) {
+                case AsyncIo::READ:
+                case AsyncIo::WRITE:
+                    // A short transfer is submitted again for the rest
+                    slot.iov.iov_base = static_cast<U8*>(request.buffer) + slot.size;
+                    slot.iov.iov_len = request.size - slot.size;
+                    sqe->opcode = (AsyncIo::READ == request.operation) ? IORING_OP_READV : IORING_OP_WRITEV;
+                    sqe->fd = fd;
+                    sqe->addr = reinterpret_cast<POINTER_CAST>(&slot.iov);
+                    sqe->len = 1;
+                    sqe->off = request.offset + slot.size;
+                    break;
+                case AsyncIo::FSYNC:
+                    sqe->opcode = IORING_OP_FSYNC;
+                    sqe->fd = fd;
+                    break;
+                case AsyncIo::NOP:
+                    sqe->opcode = IORING_OP_NOP;
+                    break;
+                default:
+                    FW_ASSERT(0, request.operation);
+                    break;
+            }
+            sqe->user_data = index;
+            state.sqArray[entry] = entry;
+            __atomic_store_n(state.sqTail, tail + 1, __ATOMIC_RELEASE);
+
+            // Only this entry is waiting, since each submit hands its entry to the kernel
+            int submitted;
+            do {
+                submitted = ringEnter(state.ringFd, 1, 0, 0);
+            } while (submitted < 0 and EINTR == errno);
+            if (submitted == 1) {
+                return AsyncIo::OP_OK;
+            }
+
+            // The kernel took nothing, so take the entry back
+            const int error = (submitted < 0) ? errno : EAGAIN;
+            __atomic_store_n(state.sqTail, tail, __ATOMIC_RELEASE);
+            return (EAGAIN == error or EBUSY == error) ? AsyncIo::QUEUE_FULL : AsyncIo::OTHER_ERROR;
+        }
+
+        // Submit the rest of a short READ or WRITE in slot index, as the positional
+        // Os::File calls of the thread pool do. A READ that transfers nothing is at
+        // the end of the file. Returns whether the request is still in flight
+        bool continueRing(State& state, NATIVE_UINT_TYPE index, int transferred) {
+            Slot& slot = state.slots[index];
+            const AsyncIo::Request& request = slot.request;
+            slot.size += transferred;
+            if ((AsyncIo::READ != request.operation and AsyncIo::WRITE != request.operation) or
+                (0 == transferred) or (slot.size >= request.size)) {
+                return false;
+            }
+            state.lock.lock();
+            const AsyncIo::Status status = submitRing(state, index, slot.fd);
+            state.lock.unLock();
+            return (AsyncIo::OP_OK == status);
+        }
+
+        NATIVE_UINT_TYPE reapRing(State& state, AsyncIo::Completion* completions,
+                                  NATIVE_UINT_TYPE maxCompletions, bool wait) {
+            NATIVE_UINT_TYPE count = 0;
+            while (true) {
+                unsigned head = *state.cqHead;
+                const unsigned tail = __atomic_load_n(state.cqTail, __ATOMIC_ACQUIRE);
+                while ((head != tail) and (count < maxCompletions)) {
+                    const struct io_uring_cqe* cqe = &state.cqes[head & *state.cqMask];
+                    const NATIVE_UINT_TYPE index = static_cast<NATIVE_UINT_TYPE>(cqe->user_data);
+                    FW_ASSERT(index < state.depth, index);
+                    const int result = cqe->res;
+                    ++head;
+                    if ((result > 0) and continueRing(state, index, result)) {
+                        continue;
+                    }
+                    const Slot& slot = state.slots[index];
+                    AsyncIo::Completion& completion = completions[count];
+                    completion.request = slot.request;
+                    completion.size = slot.size;
+                    if (result < 0) {
+                        completion.status = errorToStatus(-result);
+                    }
+                    else if ((result > 0) and (slot.size < slot.request.size) and
+                             (AsyncIo::READ == slot.request.operation or AsyncIo::WRITE == slot.request.operation)) {
+                        // The rest could not be submitted
+                        completion.status = File::OTHER_ERROR;
+                    }
+                    else {
+                        completion.status = File::OP_OK;
+                    }
+                    releaseSlot(state, index);
+                    ++count;
+                }
+                __atomic_store_n(state.cqHead, head, __ATOMIC_RELEASE);
+
+                if ((count > 0) or (not wait)) {
+                    break;
+                }
+                (void) ringEnter(state.ringFd, 0, 1, IORING_ENTER_GETEVENTS);
+            }
+            return count;
+        }
+
+#endif
+
+    }
+
+    AsyncIo::AsyncIo() : m_handle(0) {
+    }
+
+    AsyncIo::~AsyncIo() {
+        this->stop();
+    }
+
+    AsyncIo::Status AsyncIo::start(const char* name, NATIVE_UINT_TYPE depth, NATIVE_UINT_TYPE workers,
+                                   NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize, bool useIoUring) {
+
+        FW_ASSERT(name);
+        FW_ASSERT(0 == this->m_handle);
+        FW_ASSERT(depth > 0 and depth <= ASYNC_IO_MAX_DEPTH, depth);
+
+        State* state = new State;
+        state->backend = NO_BACKEND;
+        state->depth = depth;
+        state->numFree = depth;
+        for (NATIVE_UINT_TYPE i = 0; i < depth; i++) {
+            state->freeSlots[i] = depth - 1 - i;
+        }
+        state->numWorkers = 0;
+
+#if defined(ASYNC_IO_URING_AVAILABLE)
+        if (useIoUring and setupRing(*state)) {
+            state->backend = IO_URING;
+        }
+#endif
+
+        if (NO_BACKEND == state->backend) {
+            if (not startWorkers(*state, name, workers, priority, stackSize)) {
+                delete state;
+                return OTHER_ERROR;
+            }
+            state->backend = THREAD_POOL;
+        }
+
+        this->m_handle = reinterpret_cast<POINTER_CAST>(state);
+        return OP_OK;
+    }
+
+    void AsyncIo::stop(void) {
+
+        if (0 == this->m_handle) {
+            return;
+        }
+        State* state = reinterpret_cast<State*>(this->m_handle);
+
+        // Wait for the requests in flight
+        Completion completions[ASYNC_IO_MAX_DEPTH];
+        while (this->getInFlight() > 0) {
+            (void) this->reap(completions, ASYNC_IO_MAX_DEPTH, true);
+        }
+
+        switch (state->backend) {
+#if defined(ASYNC_IO_URING_AVAILABLE)
+            case IO_URING:
+                teardownRing(*state);
+                break;
+#endif
+            case THREAD_POOL:
+                stopWorkers(*state);
+                break;
+            default:
+                FW_ASSERT(0, state->backend);
+                break;
+        }
+
+        delete state;
+        this->m_handle = 0;
+    }
+
+    AsyncIo::Status AsyncIo::submit(const Request& request) {
+
+        if (0 == this->m_handle) {
+            return NOT_STARTED;
+        }
+        State* state = reinterpret_cast<State*>(this->m_handle);
+
+        // Check the request
+        switch (request.operation) {
+            case READ:
+            case WRITE:
+                if ((request.size < 0) or (NULL == request.buffer and request.size > 0)) {
+                    return BAD_REQUEST;
+                }
+                if ((NULL == request.file) or (File::OPEN_NO_MODE == request.file->m_mode)) {
+                    return BAD_REQUEST;
+                }
+                break;
+            case FSYNC:
+                if ((NULL == request.file) or (File::OPEN_NO_MODE == request.file->m_mode)) {
+                    return BAD_REQUEST;
+                }
+                break;
+            case NOP:
+                break;
+            default:
+                return BAD_REQUEST;
+        }
+
+        state->lock.lock();
+        if (0 == state->numFree) {
+            state->lock.unLock();
+            return QUEUE_FULL;
+        }
+        const NATIVE_UINT_TYPE index = takeSlot(*state);
+        state->slots[index].request = request;
+        state->slots[index].size = 0;
+
+#if defined(ASYNC_IO_URING_AVAILABLE)
+        if (IO_URING == state->backend) {
+            const NATIVE_INT_TYPE fd = (NOP == request.operation) ? -1 : request.file->m_fd;
+            state->slots[index].fd = fd;
+            const Status status = submitRing(*state, index, fd);
+            state->lock.unLock();
+            if (OP_OK != status) {
+                releaseSlot(*state, index);
+            }
+            return status;
+        }
+#endif
+        state->lock.unLock();
+
+        const NATIVE_INT_TYPE message = index;
+        const Queue::QueueStatus queueStatus = state->requests.send(
+            reinterpret_cast<const U8*>(&message), sizeof(message), 0, Queue::QUEUE_BLOCKING);
+        FW_ASSERT(Queue::QUEUE_OK == queueStatus, queueStatus);
+        return OP_OK;
+    }
+
+    NATIVE_UINT_TYPE AsyncIo::reap(Completion* completions, NATIVE_UINT_TYPE maxCompletions, bool wait) {
+
+        FW_ASSERT(completions);
+        if (0 == this->m_handle) {
+            return 0;
+        }
+        State* state = reinterpret_cast<State*>(this->m_handle);
+
+#if defined(ASYNC_IO_URING_AVAILABLE)
+        if (IO_URING == state->backend) {
+            return reapRing(*state, completions, maxCompletions, wait);
+        }
+#endif
+
+        NATIVE_UINT_TYPE count = 0;
+        while (count < maxCompletions) {
+            const bool block = (0 == count) and wait;
+            NATIVE_INT_TYPE index = 0;
+            NATIVE_INT_TYPE actualSize = 0;
+            NATIVE_INT_TYPE priority = 0;
+            const Queue::QueueStatus queueStatus = state->completions.receive(
+                reinterpret_cast<U8*>(&index), sizeof(index), actualSize, priority,
+                block ? Queue::QUEUE_BLOCKING : Queue::QUEUE_NONBLOCKING);
+            if (Queue::QUEUE_NO_MORE_MSGS == queueStatus) {
+                break;
+            }
+            FW_ASSERT(Queue::QUEUE_OK == queueStatus, queueStatus);
+            FW_ASSERT(index >= 0 and index < static_cast<NATIVE_INT_TYPE>(state->depth), index);
+            const Slot& slot = state->slots[index];
+            completions[count].request = slot.request;
+            completions[count].status = slot.status;
+            completions[count].size = slot.size;
+            releaseSlot(*state, index);
+            ++count;
+        }
+        return count;
+    }
+
+    AsyncIo::Backend AsyncIo::getBackend(void) const {
+        if (0 == this->m_handle) {
+            return NO_BACKEND;
+        }
+        return reinterpret_cast<State*>(this->m_handle)->backend;
+    }
+
+    NATIVE_UINT_TYPE AsyncIo::getInFlight(void) const {
+        if (0 == this->m_handle) {
+            return 0;
+        }
+        State* state = reinterpret_cast<State*>(this->m_handle);
+        state->lock.lock();
+        const NATIVE_UINT_TYPE inFlight = state->depth - state->numFree;
+        state->lock.unLock();
+        return inFlight;
+    }
+
+}
@@ -0,0 +1,192 @@
+#include <Fw/Cfg/Config.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/DirectWriter.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace Os {
+
+    namespace {
+
+        NATIVE_UINT_TYPE roundUp(NATIVE_UINT_TYPE size) {
+            return (size + DIRECT_WRITER_ALIGNMENT - 1) & ~static_cast<NATIVE_UINT_TYPE>(DIRECT_WRITER_ALIGNMENT - 1);
+        }
+
+    }
+
+    DirectWriter::DirectWriter() :
+        m_buffer(NULL),
+        m_used(0),
+        m_offset(0),
+        m_dirty(false),
+        m_direct(false) {
+
+        FW_ASSERT(0 == (DIRECT_WRITER_BUFFER_SIZE % DIRECT_WRITER_ALIGNMENT), DIRECT_WRITER_BUFFER_SIZE);
+        const POINTER_CAST address = reinterpret_cast<POINTER_CAST>(this->m_storage);
+        const POINTER_CAST aligned = (address + DIRECT_WRITER_ALIGNMENT - 1) & ~static_cast<POINTER_CAST>(DIRECT_WRITER_ALIGNMENT - 1);
+        this->m_buffer = reinterpret_cast<U8*>(aligned);
+    }
+
+    DirectWriter::~DirectWriter() {
+        (void) this->close();
+    }
+
+    File::Status DirectWriter::open(const char* fileName, U32 preallocSize) {
+
+        FW_ASSERT(fileName);
+        FW_ASSERT(not this->isOpen());
+
+        this->m_direct = true;
+        File::Status status = this->m_file.open(fileName, File::OPEN_SYNC_DIRECT_WRITE);
+        if ((File::OP_OK != status) and (EINVAL == this->m_file.getLastError())) {
+            // The file system does not support O_DIRECT. Keep the block writes and let them go
+            // through the cache
+            this->m_file.close();
+            this->m_direct = false;
+            status = this->m_file.open(fileName, File::OPEN_SYNC_WRITE);
+        }
+        if (File::OP_OK != status) {
+            this->m_file.close();
+            return status;
+        }
+
+        // Writes start at offset zero, so drop what an old file held
+        if (0 != ::ftruncate(this->m_file.m_fd, 0)) {
+            this->m_file.close();
+            return File::OTHER_ERROR;
+        }
+
+        // Reserving the space is only an optimization, so a file system that cannot do it
+        // just allocates as the file grows
+#ifdef __linux__
+        if (preallocSize > 0) {
+            (void) ::posix_fallocate(this->m_file.m_fd, 0, preallocSize);
+        }
+#endif
+
+        this->m_used = 0;
+        this->m_offset = 0;
+        this->m_dirty = false;
+        return File::OP_OK;
+    }
+
+    File::Status DirectWriter::write(const void * buffer, NATIVE_INT_TYPE &size) {
+        File::IoVector vector;
+        vector.buffer = const_cast<void*>(buffer);
+        vector.size = size;
+        return this->writev(&vector, 1, size);
+    }
+
+    File::Status DirectWriter::writev(const File::IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size) {
+
+        FW_ASSERT(vectors);
+        FW_ASSERT(count >= 0, count);
+        size = 0;
+        if (not this->isOpen()) {
+            return File::NOT_OPENED;
+        }
+
+        for (NATIVE_INT_TYPE i = 0; i < count; i++) {
+            FW_ASSERT(vectors[i].size >= 0, vectors[i].size);
+            const U8* data = static_cast<const U8*>(vectors[i].buffer);
+            NATIVE_UINT_TYPE remaining = vectors[i].size;
+            while (remaining > 0) {
+                // A full buffer left by a failed write is retried before more is staged
+                if (DIRECT_WRITER_BUFFER_SIZE == this->m_used) {
+                    const File::Status status = this->writeStaged();
+                    if (File::OP_OK != status) {
+                        return status;
+                    }
+                }
+                NATIVE_UINT_TYPE chunk = DIRECT_WRITER_BUFFER_SIZE - this->m_used;
+                if (chunk > remaining) {
+                    chunk = remaining;
+                }
+                memcpy(this->m_buffer + this->m_used, data, chunk);
+                this->m_used += chunk;
+                this->m_dirty = true;
+                data += chunk;
+                remaining -= chunk;
+                size += chunk;
+            }
+        }
+
+        if (DIRECT_WRITER_BUFFER_SIZE == this->m_used) {
+            return this->writeStaged();
+        }
+        return File::OP_OK;
+    }
+
+    File::Status DirectWriter::flush(void) {
+        if (not this->isOpen()) {
+            return File::NOT_OPENED;
+        }
+        if (not this->m_dirty) {
+            return File::OP_OK;
+        }
+        return this->writeStaged();
+    }
+
+    File::Status DirectWriter::close(void) {
+
+        if (not this->isOpen()) {
+            return File::OP_OK;
+        }
+
+        File::Status status = this->flush();
+
+        // Drop the padding of the last block and any preallocated space
+        if (0 != ::ftruncate(this->m_file.m_fd, this->getSize()) and File::OP_OK == status) {
+            status = File::OTHER_ERROR;
+        }
+
+        this->m_file.close();
+        this->m_used = 0;
+        this->m_offset = 0;
+        this->m_dirty = false;
+        return status;
+    }
+
+    bool DirectWriter::isOpen(void) const {
+        return (File::OPEN_NO_MODE != this->m_file.m_mode);
+    }
+
+    bool DirectWriter::isDirect(void) const {
+        return this->isOpen() and this->m_direct;
+    }
+
+    U64 DirectWriter::getSize(void) const {
+        return this->m_offset + this->m_used;
+    }
+
+    File::Status DirectWriter::writeStaged(void) {
+
+        // Pad the last block, which O_DIRECT requires to be whole
+        const NATIVE_UINT_TYPE padded = roundUp(this->m_used);
+        memset(this->m_buffer + this->m_used, 0, padded - this->m_used);
+
+        NATIVE_INT_TYPE size = padded;
+        const File::Status status = this->m_file.writeAt(this->m_buffer, size, this->m_offset);
+        if (File::OP_OK != status) {
+            return status;
+        }
+        FW_ASSERT(static_cast<NATIVE_UINT_TYPE>(size) == padded, size, padded);
+        this->m_dirty = false;
+
+        // Whole blocks are done. A partial last block moves to the front of the buffer and
+        // is written again, in place, as it fills
+        const NATIVE_UINT_TYPE tail = this->m_used % DIRECT_WRITER_ALIGNMENT;
+        const NATIVE_UINT_TYPE whole = this->m_used - tail;
+        if ((whole > 0) and (tail > 0)) {
+            memcpy(this->m_buffer, this->m_buffer + whole, tail);
+        }
+        this->m_offset += whole;
+        this->m_used = tail;
+        return File::OP_OK;
+    }
+
+}
@@ -18,6 +18,7 @@ extern "C" {
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/uio.h>
 #include <limits>
 #include <string.h>
 #include <stdio.h>
@@ -25,6 +26,9 @@ extern "C" {
 //#define DEBUG_PRINT(x,...) printf(x,##__VA_ARGS__); fflush(stdout)
 #define DEBUG_PRINT(x,...)
 
+// Number of IoVectors passed to the kernel per readv or writev call
+#define FILE_IO_VECTOR_BATCH 16
+
 namespace Os {
 
     File::File() :m_fd(-1),m_mode(OPEN_NO_MODE),m_lastError(0) {
@@ -62,6 +66,9 @@ namespace Os {
             case OPEN_CREATE:
                 flags = O_WRONLY | O_CREAT | O_TRUNC;
                 break;
+            case OPEN_CREATE_EXCLUSIVE:
+                flags = O_WRONLY | O_CREAT | O_EXCL;
+                break;
             default:
                 FW_ASSERT(0,(NATIVE_INT_TYPE)mode);
                 break;
@@ -87,6 +94,9 @@ namespace Os {
                 case EACCES:
                     stat = NO_PERMISSION;
                     break;
+                case EEXIST:
+                    stat = FILE_EXISTS;
+                    break;
                 default:
                     stat = OTHER_ERROR;
                     break;
@@ -340,6 +350,223 @@ namespace Os {
         return OP_OK;
     }
 
+    File::Status File::readAt(void * buffer, NATIVE_INT_TYPE &size, U64 offset, bool waitForFull) {
+
+        FW_ASSERT(buffer);
+        FW_ASSERT(size >= 0, size);
+
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            size = 0;
+            return NOT_OPENED;
+        }
+
+        Status stat = OP_OK;
+        U8* charPtr = static_cast<U8*>(buffer);
+        NATIVE_INT_TYPE accSize = 0; // accumulated size
+
+        while (accSize < size) {
+            const ssize_t readSize = ::pread(this->m_fd, &charPtr[accSize],
+                                             size - accSize, offset + accSize);
+            if (-1 == readSize) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                this->m_lastError = errno;
+                stat = OTHER_ERROR;
+                break;
+            }
+            if (0 == readSize) { // end of file
+                break;
+            }
+            accSize += readSize;
+            if (not waitForFull) {
+                break;
+            }
+        }
+
+        size = accSize;
+
+        return stat;
+    }
+
+    File::Status File::writeAt(const void * buffer, NATIVE_INT_TYPE &size, U64 offset, bool waitForDone) {
+
+        FW_ASSERT(buffer);
+        FW_ASSERT(size >= 0, size);
+
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            size = 0;
+            return NOT_OPENED;
+        }
+
+        Status stat = OP_OK;
+        const U8* charPtr = static_cast<const U8*>(buffer);
+        NATIVE_INT_TYPE accSize = 0; // accumulated size
+
+        while (accSize < size) {
+            const ssize_t writeSize = ::pwrite(this->m_fd, &charPtr[accSize],
+                                               size - accSize, offset + accSize);
+            if (-1 == writeSize) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                stat = (ENOSPC == errno) ? NO_SPACE : OTHER_ERROR;
+                this->m_lastError = errno;
+                break;
+            }
+            accSize += writeSize;
+        }
+
+#ifdef __linux__
+        if ((OPEN_SYNC_DIRECT_WRITE != this->m_mode) && (waitForDone) && (accSize > 0)) {
+            sync_file_range(this->m_fd, offset, accSize,
+                            SYNC_FILE_RANGE_WAIT_BEFORE
+                            | SYNC_FILE_RANGE_WRITE
+                            | SYNC_FILE_RANGE_WAIT_AFTER);
+        }
+#endif
+
+        size = accSize;
+
+        return stat;
+    }
+
+    // Fill iov with the part of vectors that has not been transferred yet,
+    // starting skip bytes into vectors[index]. Empty vectors are left out, so
+    // that a transfer of zero bytes means end of file. Returns the number of entries filled.
+    static NATIVE_INT_TYPE fillIoVectors(struct iovec* iov, const File::IoVector* vectors,
+                                         NATIVE_INT_TYPE count, NATIVE_INT_TYPE index,
+                                         NATIVE_INT_TYPE skip) {
+        NATIVE_INT_TYPE filled = 0;
+        for (; (index < count) and (filled < FILE_IO_VECTOR_BATCH); ++index) {
+            FW_ASSERT(vectors[index].size >= skip, vectors[index].size, skip);
+            if (vectors[index].size > skip) {
+                iov[filled].iov_base = static_cast<U8*>(vectors[index].buffer) + skip;
+                iov[filled].iov_len = vectors[index].size - skip;
+                ++filled;
+            }
+            skip = 0;
+        }
+        return filled;
+    }
+
+    // Advance index and skip past transferred bytes of vectors
+    static void advanceIoVectors(const File::IoVector* vectors, NATIVE_INT_TYPE count,
+                                 NATIVE_INT_TYPE transferred, NATIVE_INT_TYPE& index,
+                                 NATIVE_INT_TYPE& skip) {
+        while ((index < count) and (transferred >= vectors[index].size - skip)) {
+            transferred -= vectors[index].size - skip;
+            skip = 0;
+            ++index;
+        }
+        skip += transferred;
+    }
+
+    // Sum the vector sizes
+    static NATIVE_INT_TYPE totalIoVectorSize(const File::IoVector* vectors, NATIVE_INT_TYPE count) {
+        NATIVE_INT_TYPE total = 0;
+        for (NATIVE_INT_TYPE i = 0; i < count; ++i) {
+            FW_ASSERT(vectors[i].buffer != NULL or vectors[i].size == 0, i);
+            FW_ASSERT(vectors[i].size >= 0, vectors[i].size);
+            total += vectors[i].size;
+        }
+        return total;
+    }
+
+    File::Status File::readv(const IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size, bool waitForFull) {
+
+        FW_ASSERT(vectors);
+        FW_ASSERT(count >= 0, count);
+
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            size = 0;
+            return NOT_OPENED;
+        }
+
+        const NATIVE_INT_TYPE total = totalIoVectorSize(vectors, count);
+        Status stat = OP_OK;
+        struct iovec iov[FILE_IO_VECTOR_BATCH];
+        NATIVE_INT_TYPE index = 0;
+        NATIVE_INT_TYPE skip = 0;
+        NATIVE_INT_TYPE accSize = 0; // accumulated size
+
+        while (accSize < total) {
+            const NATIVE_INT_TYPE filled = fillIoVectors(iov, vectors, count, index, skip);
+            const ssize_t readSize = ::readv(this->m_fd, iov, filled);
+            if (-1 == readSize) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                this->m_lastError = errno;
+                stat = OTHER_ERROR;
+                break;
+            }
+            if (0 == readSize) { // end of file
+                break;
+            }
+            accSize += readSize;
+            advanceIoVectors(vectors, count, readSize, index, skip);
+            if (not waitForFull) {
+                break;
+            }
+        }
+
+        size = accSize;
+
+        return stat;
+    }
+
+    File::Status File::writev(const IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size, bool waitForDone) {
+
+        FW_ASSERT(vectors);
+        FW_ASSERT(count >= 0, count);
+
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            size = 0;
+            return NOT_OPENED;
+        }
+
+        const NATIVE_INT_TYPE total = totalIoVectorSize(vectors, count);
+        Status stat = OP_OK;
+        struct iovec iov[FILE_IO_VECTOR_BATCH];
+        NATIVE_INT_TYPE index = 0;
+        NATIVE_INT_TYPE skip = 0;
+        NATIVE_INT_TYPE accSize = 0; // accumulated size
+
+        while (accSize < total) {
+            const NATIVE_INT_TYPE filled = fillIoVectors(iov, vectors, count, index, skip);
+            const ssize_t writeSize = ::writev(this->m_fd, iov, filled);
+            if (-1 == writeSize) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                stat = (ENOSPC == errno) ? NO_SPACE : OTHER_ERROR;
+                this->m_lastError = errno;
+                break;
+            }
+            accSize += writeSize;
+            advanceIoVectors(vectors, count, writeSize, index, skip);
+        }
+
+#ifdef __linux__
+        if ((OPEN_SYNC_DIRECT_WRITE != this->m_mode) && (waitForDone) && (accSize > 0)) {
+            NATIVE_UINT_TYPE position = lseek(this->m_fd, 0, SEEK_CUR);
+            sync_file_range(this->m_fd, position - accSize, accSize,
+                            SYNC_FILE_RANGE_WAIT_BEFORE
+                            | SYNC_FILE_RANGE_WRITE
+                            | SYNC_FILE_RANGE_WAIT_AFTER);
+        }
+#endif
+
+        size = accSize;
+
+        return stat;
+    }
+
     File::Status File::flush() {
         // make sure it has been opened
         if (OPEN_NO_MODE == this->m_mode) {
@@ -12,6 +12,19 @@
 #include <string.h>
 #include <limits>
 #include <sys/statvfs.h>
+#include <fcntl.h>
+
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#define SENDFILE_AVAILABLE
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define COPY_FILE_RANGE_AVAILABLE
+#endif
+#include <sys/syscall.h>
+#if defined(SYS_getdents64)
+#define GETDENTS64_AVAILABLE
+#endif
+#endif
 
 namespace Os {
 
@@ -256,56 +269,106 @@ namespace Os {
 
 		} // end moveFile
 
-		Status handleFileError(File::Status fileStatus) {
+		Status handleCopyError(int error) {
 			Status fileSystemStatus = OTHER_ERROR;
 
-			switch(fileStatus) {
-				case File::NO_SPACE:
+			switch(error) {
+				case ENOSPC:
+				case EDQUOT:
+				case EFBIG:
 					fileSystemStatus = NO_SPACE;
 					break;
-				case File::NO_PERMISSION:
+				case EACCES:
+				case EPERM:
+				case EROFS:
 					fileSystemStatus = NO_PERMISSION;
 					break;
-				case File::DOESNT_EXIST:
+				case ENOENT:
+				case ELOOP:
+				case ENAMETOOLONG:
 					fileSystemStatus = INVALID_PATH;
 					break;
+				case ENOTDIR:
+					fileSystemStatus = NOT_DIR;
+					break;
+				case EISDIR:
+					fileSystemStatus = IS_DIR;
+					break;
+				case EMFILE:
+				case ENFILE:
+					fileSystemStatus = FILE_LIMIT;
+					break;
 				default:
 					fileSystemStatus = OTHER_ERROR;
 			}
 			return fileSystemStatus;
-		} // end handleFileError
+		} // end handleCopyError
+
+		// Copy up to length bytes from the current position of source to the current position
+		// of destination. Uses copy_file_range or sendfile so the data stays in the kernel,
+		// and falls back to read and write through a buffer when neither applies to the files.
+		// Returns the number of bytes copied, 0 at the end of the source, or -1 with errno set.
+		ssize_t copyChunk(int source, int destination, size_t length, bool& useKernelCopy) {
+#if defined(COPY_FILE_RANGE_AVAILABLE) || defined(SENDFILE_AVAILABLE)
+			if (useKernelCopy) {
+				ssize_t copied = -1;
+#if defined(COPY_FILE_RANGE_AVAILABLE)
+				copied = ::copy_file_range(source, NULL, destination, NULL, length, 0);
+				if (copied >= 0) {
+					return copied;
+				}
+#endif
+#if defined(SENDFILE_AVAILABLE)
+				copied = ::sendfile(destination, source, NULL, length);
+				if (copied >= 0) {
+					return copied;
+				}
+#endif
+				// Fall back only if the kernel cannot copy between these files:
+				if (copied < 0 && errno != ENOSYS && errno != EXDEV &&
+					errno != EINVAL && errno != EOPNOTSUPP) {
+					return -1;
+				}
+				useKernelCopy = false;
+			}
+#endif
 
-		Status copyFile(const char* originPath, const char* destPath) {
-			U8 fileBuffer[FILE_SYSTEM_CHUNK_SIZE];
+			U8 buffer[FILE_SYSTEM_COPY_BUFFER_SIZE];
+			if (length > sizeof(buffer)) {
+				length = sizeof(buffer);
+			}
+			ssize_t readSize;
+			do {
+				readSize = ::read(source, buffer, length);
+			} while (readSize < 0 && errno == EINTR);
+			if (readSize <= 0) {
+				return readSize;
+			}
+			ssize_t written = 0;
+			while (written < readSize) {
+				const ssize_t writeSize = ::write(destination, &buffer[written], readSize - written);
+				if (writeSize < 0) {
+					if (errno == EINTR) {
+						continue;
+					}
+					return -1;
+				}
+				written += writeSize;
+			}
+			return readSize;
+		} // end copyChunk
 
-			FileSystem::Status fs_status;
-			struct stat file_info;
-			File::Status file_status;
+		Status copyFile(const char* originPath, const char* destPath) {
+			return copyFile(originPath, destPath, NULL, NULL);
+		} // end copyFile
 
-			U64 fileSize = 0;
-			NATIVE_INT_TYPE chunkSize;
+		Status copyFile(const char* originPath, const char* destPath,
+				CopyProgress progress, void* context) {
 
-			File source;
-			File destination;
+			struct stat file_info;
 
 			if(::stat(originPath, &file_info) == -1) {
-				switch (errno) {
-					case EACCES:
-						fs_status = NO_PERMISSION;
-						break;
-					case ELOOP:
-					case ENOENT:
-					case ENAMETOOLONG:
-						fs_status = INVALID_PATH;
-						break;
-					case ENOTDIR:
-						fs_status = NOT_DIR;
-						break;
-					default:
-						fs_status = OTHER_ERROR;
-						break;
-				}
-				return fs_status;
+				return handleCopyError(errno);
 			}
 
 			// Make sure the origin is a regular file
@@ -313,50 +376,51 @@ namespace Os {
 				return INVALID_PATH;
 			}
 
-			// Get the file size:
-			fs_status = FileSystem::getFileSize(originPath, fileSize); //!< gets the size of the file (in bytes) at location path
-			if(FileSystem::OP_OK != fs_status) {
-				return fs_status;
-			}
+			const U64 fileSize = file_info.st_size;
 
-			file_status = source.open(originPath, File::OPEN_READ);
-			if(file_status != File::OP_OK) {
-				return handleFileError(file_status);
+			const int source = ::open(originPath, O_RDONLY);
+			if (source == -1) {
+				return handleCopyError(errno);
 			}
 
-			file_status = destination.open(destPath, File::OPEN_WRITE);
-			if(file_status != File::OP_OK) {
-				return handleFileError(file_status);
+			const int destination = ::open(destPath, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+			if (destination == -1) {
+				const int error = errno;
+				(void) ::close(source);
+				return handleCopyError(error);
 			}
 
-			// Set loop limit
-			const U64 copyLoopLimit = (((U64)fileSize/FILE_SYSTEM_CHUNK_SIZE)) + 2;
-
-			U64 loopCounter = 0;
-			while(loopCounter < copyLoopLimit) {
-				chunkSize = FILE_SYSTEM_CHUNK_SIZE;
-				file_status = source.read(&fileBuffer, chunkSize, false);
-				if(file_status != File::OP_OK) {
-					return handleFileError(file_status);
+			// Copy in chunks of FILE_SYSTEM_COPY_CHUNK_SIZE so progress can be reported.
+			// Stop at the size seen at the start, in case the source is still growing.
+			Status status = OP_OK;
+			bool useKernelCopy = true;
+			U64 copied = 0;
+			while (copied < fileSize) {
+				U64 length = fileSize - copied;
+				if (length > FILE_SYSTEM_COPY_CHUNK_SIZE) {
+					length = FILE_SYSTEM_COPY_CHUNK_SIZE;
 				}
-
-				if(chunkSize == 0) {
-					//file has been successfully copied
+				const ssize_t chunkSize = copyChunk(source, destination, length, useKernelCopy);
+				if (chunkSize < 0) {
+					status = handleCopyError(errno);
 					break;
 				}
-
-				file_status = destination.write(fileBuffer, chunkSize, true);
-				if(file_status != File::OP_OK) {
-					return handleFileError(file_status);
+				if (chunkSize == 0) {
+					// The source was truncated during the copy
+					break;
+				}
+				copied += chunkSize;
+				if (progress != NULL) {
+					progress(context, copied, fileSize);
 				}
-				loopCounter++;
 			}
-			FW_ASSERT(loopCounter < copyLoopLimit);
 
-			(void) source.close();
-			(void) destination.close();
+			(void) ::close(source);
+			if (::close(destination) == -1 && status == OP_OK) {
+				status = handleCopyError(errno);
+			}
 
-			return FileSystem::OP_OK;
+			return status;
 		} // end copyFile
 
 		Status getFileSize(const char* path, U64& size) {
@@ -389,6 +453,43 @@ namespace Os {
 			return fileStat;
 		} // end getFileSize
 
+		Status getFileModTime(const char* path, U32& seconds, U32& useconds) {
+
+			Status fileStat = OP_OK;
+			struct stat fileStatStruct;
+
+			if(::stat(path, &fileStatStruct) == -1) {
+				switch (errno) {
+					case EACCES:
+						fileStat = NO_PERMISSION;
+						break;
+					case ELOOP:
+					case ENOENT:
+					case ENAMETOOLONG:
+						fileStat = INVALID_PATH;
+						break;
+					case ENOTDIR:
+						fileStat = NOT_DIR;
+						break;
+					default:
+						fileStat = OTHER_ERROR;
+						break;
+				}
+				return fileStat;
+			}
+
+			seconds = fileStatStruct.st_mtime;
+#if defined(__APPLE__)
+			useconds = fileStatStruct.st_mtimespec.tv_nsec / 1000;
+#elif defined(__VXWORKS__)
+			useconds = 0;
+#else
+			useconds = fileStatStruct.st_mtim.tv_nsec / 1000;
+#endif
+
+			return fileStat;
+		} // end getFileModTime
+
 		Status changeWorkingDirectory(const char* path) {
 
 			Status stat = OP_OK;
@@ -506,6 +607,178 @@ namespace Os {
 			return dirStat;
 		} //end getFileCount
 
+#if defined(GETDENTS64_AVAILABLE)
+		// Layout of the entries returned by getdents64. The C library does not declare it.
+		struct LinuxDirent64 {
+			U64 d_ino;
+			U64 d_off;
+			unsigned short d_reclen;
+			unsigned char d_type;
+			char d_name[1];
+		};
+#endif
+
+		Status handleDirectoryError(int error) {
+			Status dirStat = OTHER_ERROR;
+
+			switch (error) {
+				case EACCES:
+					dirStat = NO_PERMISSION;
+					break;
+				case ENOENT:
+				case ELOOP:
+				case ENAMETOOLONG:
+					dirStat = INVALID_PATH;
+					break;
+				case ENOTDIR:
+					dirStat = NOT_DIR;
+					break;
+				case EMFILE:
+				case ENFILE:
+					dirStat = FILE_LIMIT;
+					break;
+				default:
+					dirStat = OTHER_ERROR;
+					break;
+			}
+			return dirStat;
+		} // end handleDirectoryError
+
+		// Get the type of a directory entry. Some file systems leave the type unknown,
+		// so then it is looked up relative to the open directory.
+		EntryType directoryEntryType(int directory, const char* name, unsigned char type) {
+			switch (type) {
+				case DT_REG:
+					return ENTRY_FILE;
+				case DT_DIR:
+					return ENTRY_DIRECTORY;
+				case DT_UNKNOWN:
+					break;
+				default:
+					return ENTRY_OTHER;
+			}
+#if defined(AT_SYMLINK_NOFOLLOW)
+			struct stat info;
+			if (::fstatat(directory, name, &info, AT_SYMLINK_NOFOLLOW) == 0) {
+				if (S_ISREG(info.st_mode)) {
+					return ENTRY_FILE;
+				}
+				if (S_ISDIR(info.st_mode)) {
+					return ENTRY_DIRECTORY;
+				}
+			}
+#endif
+			return ENTRY_OTHER;
+		} // end directoryEntryType
+
+		bool isDotEntry(const char* name) {
+			return (name[0] == '.') &&
+				((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0')));
+		} // end isDotEntry
+
+		DirectoryIterator::DirectoryIterator() :
+			m_fd(-1),
+			m_dir(NULL),
+			m_size(0),
+			m_offset(0)
+		{
+		}
+
+		DirectoryIterator::~DirectoryIterator() {
+			this->close();
+		}
+
+		Status DirectoryIterator::open(const char* path) {
+			FW_ASSERT(path != NULL);
+
+			this->close();
+			this->m_size = 0;
+			this->m_offset = 0;
+
+#if defined(GETDENTS64_AVAILABLE)
+			const int fd = ::open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+			if (fd == -1) {
+				return handleDirectoryError(errno);
+			}
+			this->m_fd = fd;
+#else
+			DIR* dir = ::opendir(path);
+			if (dir == NULL) {
+				return handleDirectoryError(errno);
+			}
+			this->m_dir = dir;
+#endif
+			return OP_OK;
+		} // end DirectoryIterator::open
+
+		Status DirectoryIterator::next(const char*& name, EntryType& type) {
+			name = NULL;
+			type = ENTRY_OTHER;
+
+#if defined(GETDENTS64_AVAILABLE)
+			FW_ASSERT(this->m_fd != -1);
+			while (true) {
+				// Read the next batch of entries once the buffer is used up
+				if (this->m_offset >= this->m_size) {
+					long size;
+					do {
+						size = ::syscall(SYS_getdents64, this->m_fd, this->m_buffer, sizeof(this->m_buffer));
+					} while (size < 0 && errno == EINTR);
+					if (size < 0) {
+						return handleDirectoryError(errno);
+					}
+					if (size == 0) {
+						// No more entries
+						return OP_OK;
+					}
+					this->m_size = size;
+					this->m_offset = 0;
+				}
+
+				const LinuxDirent64* entry = reinterpret_cast<const LinuxDirent64*>(
+					reinterpret_cast<const U8*>(this->m_buffer) + this->m_offset);
+				FW_ASSERT(entry->d_reclen > 0);
+				this->m_offset += entry->d_reclen;
+				if (!isDotEntry(entry->d_name)) {
+					name = entry->d_name;
+					type = directoryEntryType(this->m_fd, entry->d_name, entry->d_type);
+					return OP_OK;
+				}
+			}
+#else
+			FW_ASSERT(this->m_dir != NULL);
+			DIR* dir = static_cast<DIR*>(this->m_dir);
+			while (true) {
+				// Set errno to 0 so we know why readdir returned NULL
+				errno = 0;
+				struct dirent* entry = ::readdir(dir);
+				if (entry == NULL) {
+					return (errno == 0) ? OP_OK : handleDirectoryError(errno);
+				}
+				if (!isDotEntry(entry->d_name)) {
+					name = entry->d_name;
+					type = directoryEntryType(::dirfd(dir), entry->d_name, entry->d_type);
+					return OP_OK;
+				}
+			}
+#endif
+		} // end DirectoryIterator::next
+
+		void DirectoryIterator::close(void) {
+			if (this->m_fd != -1) {
+				(void) ::close(this->m_fd);
+				this->m_fd = -1;
+			}
+			if (this->m_dir != NULL) {
+				(void) ::closedir(static_cast<DIR*>(this->m_dir));
+				this->m_dir = NULL;
+			}
+		} // end DirectoryIterator::close
+
+		bool DirectoryIterator::isOpen(void) const {
+			return (this->m_fd != -1) || (this->m_dir != NULL);
+		} // end DirectoryIterator::isOpen
+
 	} // end FileSystem namespace
 
 } // end Os namespace
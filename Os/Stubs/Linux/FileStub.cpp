@@ -111,6 +111,9 @@ namespace Os {
             case OPEN_CREATE:
                 flags = O_WRONLY | O_CREAT | O_TRUNC;
                 break;
+            case OPEN_CREATE_EXCLUSIVE:
+                flags = O_WRONLY | O_CREAT | O_EXCL;
+                break;
             default:
                 FW_ASSERT(0,(NATIVE_INT_TYPE)mode);
                 break;
@@ -136,6 +139,9 @@ namespace Os {
                 case EACCES:
                     stat = NO_PERMISSION;
                     break;
+                case EEXIST:
+                    stat = FILE_EXISTS;
+                    break;
                 default:
                     stat = OTHER_ERROR;
                     break;
@@ -384,6 +390,127 @@ namespace Os {
         return OP_OK;
     }
 
+    File::Status File::readAt(void * buffer, NATIVE_INT_TYPE &size, U64 offset, bool waitForFull) {
+
+        FW_ASSERT(buffer);
+
+        if (readInterceptor) {
+            File::Status stat;
+            if (not readInterceptor(stat,buffer,size,waitForFull,readInterceptorPtr)) {
+                return stat;
+            }
+        }
+
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            size = 0;
+            return NOT_OPENED;
+        }
+
+        Status stat = OP_OK;
+        NATIVE_INT_TYPE accSize = 0; // accumulated size
+        while (accSize < size) {
+            const ssize_t readSize = ::pread(this->m_fd, static_cast<U8*>(buffer) + accSize,
+                                             size - accSize, offset + accSize);
+            if (-1 == readSize) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                this->m_lastError = errno;
+                stat = OTHER_ERROR;
+                break;
+            }
+            if ((0 == readSize) or (not waitForFull)) {
+                accSize += readSize;
+                break;
+            }
+            accSize += readSize;
+        }
+        size = accSize;
+
+        return stat;
+    }
+
+    File::Status File::writeAt(const void * buffer, NATIVE_INT_TYPE &size, U64 offset, bool waitForDone) {
+
+        if (writeInterceptor) {
+            File::Status stat;
+            if (not writeInterceptor(stat,buffer,size,waitForDone,writeInterceptorPtr)) {
+                return stat;
+            }
+        }
+
+        // make sure it has been opened
+        if (OPEN_NO_MODE == this->m_mode) {
+            size = 0;
+            return NOT_OPENED;
+        }
+
+        Status stat = OP_OK;
+        NATIVE_INT_TYPE accSize = 0; // accumulated size
+        while (accSize < size) {
+            const ssize_t writeSize = ::pwrite(this->m_fd, static_cast<const U8*>(buffer) + accSize,
+                                               size - accSize, offset + accSize);
+            if (-1 == writeSize) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                stat = (ENOSPC == errno) ? NO_SPACE : OTHER_ERROR;
+                this->m_lastError = errno;
+                break;
+            }
+            accSize += writeSize;
+        }
+        size = accSize;
+
+        return stat;
+    }
+
+    // The stub vectored calls go through read and write one buffer at a time,
+    // so the read and write interceptors see every buffer
+
+    File::Status File::readv(const IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size, bool waitForFull) {
+
+        FW_ASSERT(vectors);
+
+        Status stat = OP_OK;
+        size = 0;
+        for (NATIVE_INT_TYPE i = 0; i < count; ++i) {
+            if (0 == vectors[i].size) {
+                continue;
+            }
+            NATIVE_INT_TYPE readSize = vectors[i].size;
+            stat = this->read(vectors[i].buffer, readSize, waitForFull);
+            size += readSize;
+            if ((stat != OP_OK) or (readSize != vectors[i].size)) {
+                break;
+            }
+        }
+
+        return stat;
+    }
+
+    File::Status File::writev(const IoVector* vectors, NATIVE_INT_TYPE count, NATIVE_INT_TYPE &size, bool waitForDone) {
+
+        FW_ASSERT(vectors);
+
+        Status stat = OP_OK;
+        size = 0;
+        for (NATIVE_INT_TYPE i = 0; i < count; ++i) {
+            if (0 == vectors[i].size) {
+                continue;
+            }
+            NATIVE_INT_TYPE writeSize = vectors[i].size;
+            stat = this->write(vectors[i].buffer, writeSize, waitForDone);
+            size += writeSize;
+            if ((stat != OP_OK) or (writeSize != vectors[i].size)) {
+                break;
+            }
+        }
+
+        return stat;
+    }
+
     File::Status File::flush() {
         // make sure it has been opened
         if (OPEN_NO_MODE == this->m_mode) {
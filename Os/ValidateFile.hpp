@@ -14,7 +14,9 @@
 #define _ValidateFile_hpp_
 
 #define VFILE_HASH_CHUNK_SIZE (256)
+#define VFILE_BATCH_MAX_WORKERS (4)
 
+#include <Fw/Types/BasicTypes.hpp>
 #include <Utils/Hash/HashBuffer.hpp>
 
 namespace Os {
@@ -58,6 +60,46 @@ namespace Os {
         Status createValidation(const char* fileName, const char* hashFileName);   //!< Create a validation of the file 'fileName' and store it in
                                                                                              //!< in a file 'hashFileName'
 
+        // Store a hash the caller computed, for example incrementally while writing the file,
+        // so the file does not have to be read back.
+        Status writeValidation(const char* hashFileName, const Utils::HashBuffer &hashBuffer); //!< Store the hash 'hashBuffer' of a file
+                                                                                             //!< in a file 'hashFileName'
+
+        // The functions above read the file VFILE_HASH_CHUNK_SIZE bytes at a time from a
+        // buffer on the stack. These read the file through a caller-supplied buffer, so
+        // large files take one read per readBufferSize bytes.
+        Status validate(const char* fileName, const char* hashFileName,
+                        Utils::HashBuffer &hashBuffer,
+                        U8* readBuffer, NATIVE_UINT_TYPE readBufferSize); //!< Validate the contents of a file 'fileName' against its hash
+
+        Status createValidation(const char* fileName, const char* hashFileName,
+                                Utils::HashBuffer &hashBuffer,
+                                U8* readBuffer, NATIVE_UINT_TYPE readBufferSize); //!< Create a validation of the file 'fileName'
+
+        // One file of a batch. The batch functions set the status.
+        typedef struct {
+            const char* fileName; //!< The file to hash
+            const char* hashFileName; //!< The file holding the hash
+            Status status; //!< The result for this file
+        } BatchEntry;
+
+        // Validate the files of a batch, or create their validations, on up to numWorkers
+        // tasks (at most VFILE_BATCH_MAX_WORKERS). The calling task is one of the workers,
+        // and the others are started with the given priority and stack size and joined before
+        // returning. If a worker task cannot be started, the remaining workers take its files.
+        // readBuffer is divided equally among the workers.
+        // Returns VALIDATION_OK if every file passed, otherwise the status of the first file
+        // that did not.
+        Status validateBatch(BatchEntry* entries, NATIVE_UINT_TYPE numEntries,
+                             NATIVE_UINT_TYPE numWorkers,
+                             U8* readBuffer, NATIVE_UINT_TYPE readBufferSize,
+                             NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize); //!< Validate many files against their hashes
+
+        Status createValidationBatch(BatchEntry* entries, NATIVE_UINT_TYPE numEntries,
+                                     NATIVE_UINT_TYPE numWorkers,
+                                     U8* readBuffer, NATIVE_UINT_TYPE readBufferSize,
+                                     NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize); //!< Create validations of many files
+
     }
 }
 
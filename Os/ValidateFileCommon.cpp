@@ -2,10 +2,19 @@
 #include <Os/File.hpp>
 #include <Utils/Hash/Hash.hpp>
 #include <Os/FileSystem.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/Task.hpp>
+#include <Fw/Types/EightyCharString.hpp>
+
+#include <stdio.h>
 
 namespace Os {
 
-    File::Status computeHash(const char* fileName, Utils::HashBuffer &hashBuffer) {
+    File::Status computeHash(const char* fileName, Utils::HashBuffer &hashBuffer,
+                             U8* buffer, NATIVE_UINT_TYPE bufferSize) {
+
+        FW_ASSERT(buffer);
+        FW_ASSERT(bufferSize > 0);
 
         File::Status status;
 
@@ -23,18 +32,17 @@ namespace Os {
         if( FileSystem::OP_OK != fs_status ) {
             return File::BAD_SIZE;
         }
-        const NATIVE_INT_TYPE max_itr = fileSize/VFILE_HASH_CHUNK_SIZE + 1;
+        const NATIVE_INT_TYPE max_itr = fileSize/bufferSize + 1;
         
         // Read all data from file and update hash:
         Utils::Hash hash;
         hash.init();
-        U8 buffer[VFILE_HASH_CHUNK_SIZE];
         NATIVE_INT_TYPE size;
         NATIVE_INT_TYPE cnt = 0;
         while( cnt <= max_itr ) {
             // Read out chunk from file:
-            size = sizeof(buffer);
-            status = file.read(&buffer, size, false);
+            size = bufferSize;
+            status = file.read(buffer, size, false);
             if( File::OP_OK != status ) {
                 return status;
             }
@@ -43,7 +51,7 @@ namespace Os {
               break;
             }
             // Add chunk to hash calculation:
-            hash.update(&buffer, size);
+            hash.update(buffer, size);
             cnt++;
         }
         file.close();
@@ -137,6 +145,7 @@ namespace Os {
                     case File::NOT_OPENED:
                         return ValidateFile::OTHER_ERROR;
                     case File::OTHER_ERROR:
+                    case File::FILE_EXISTS:
                         return ValidateFile::OTHER_ERROR;
                     default:
                         FW_ASSERT(0, status);
@@ -157,6 +166,7 @@ namespace Os {
                     case File::NOT_OPENED:
                         return ValidateFile::OTHER_ERROR;
                     case File::OTHER_ERROR:
+                    case File::FILE_EXISTS:
                         return ValidateFile::OTHER_ERROR;
                     default:
                         FW_ASSERT(0, status);
@@ -175,6 +185,12 @@ namespace Os {
     }
 
     ValidateFile::Status ValidateFile::validate(const char* fileName, const char* hashFileName, Utils::HashBuffer &hashBuffer) {
+        U8 buffer[VFILE_HASH_CHUNK_SIZE];
+        return validate(fileName, hashFileName, hashBuffer, buffer, sizeof(buffer));
+    }
+
+    ValidateFile::Status ValidateFile::validate(const char* fileName, const char* hashFileName, Utils::HashBuffer &hashBuffer,
+                                                U8* readBuffer, NATIVE_UINT_TYPE readBufferSize) {
 
         File::Status status;
 
@@ -187,7 +203,7 @@ namespace Os {
         
         // Compute the file's hash:
         Utils::HashBuffer computedHash;
-        status = computeHash(fileName, computedHash);
+        status = computeHash(fileName, computedHash, readBuffer, readBufferSize);
         if( File::OP_OK != status ) {
             return translateStatus(status, FileType);
         }
@@ -203,11 +219,17 @@ namespace Os {
     }
 
     ValidateFile::Status ValidateFile::createValidation(const char* fileName, const char* hashFileName, Utils::HashBuffer &hashBuffer) {
+        U8 buffer[VFILE_HASH_CHUNK_SIZE];
+        return createValidation(fileName, hashFileName, hashBuffer, buffer, sizeof(buffer));
+    }
+
+    ValidateFile::Status ValidateFile::createValidation(const char* fileName, const char* hashFileName, Utils::HashBuffer &hashBuffer,
+                                                        U8* readBuffer, NATIVE_UINT_TYPE readBufferSize) {
 
         File::Status status;
 
         // Compute the file's hash:
-        status = computeHash(fileName, hashBuffer);
+        status = computeHash(fileName, hashBuffer, readBuffer, readBufferSize);
         if( File::OP_OK != status ) {
             return translateStatus(status, FileType);
         }
@@ -225,4 +247,131 @@ namespace Os {
         return createValidation(fileName, hashFileName, hashBuffer);
     }
 
+    ValidateFile::Status ValidateFile::writeValidation(const char* hashFileName, const Utils::HashBuffer &hashBuffer) {
+        File::Status status = writeHash(hashFileName, hashBuffer);
+        if( File::OP_OK != status ) {
+            return translateStatus(status, HashFileType);
+        }
+
+        return ValidateFile::VALIDATION_OK;
+    }
+
+    // Shared state of a batch and the per-worker context:
+    struct Batch {
+        ValidateFile::BatchEntry* entries;
+        NATIVE_UINT_TYPE numEntries;
+        bool create;
+        NATIVE_UINT_TYPE next; //!< The next entry to take, guarded by mutex
+        Mutex mutex;
+    };
+
+    struct BatchWorker {
+        Batch* batch;
+        U8* readBuffer;
+        NATIVE_UINT_TYPE readBufferSize;
+    };
+
+    void runBatchWorker(void* ptr) {
+        FW_ASSERT(ptr);
+        BatchWorker* worker = static_cast<BatchWorker*>(ptr);
+        Batch* batch = worker->batch;
+        while( true ) {
+            // Take the next entry:
+            batch->mutex.lock();
+            const NATIVE_UINT_TYPE index = batch->next;
+            if( index < batch->numEntries ) {
+                batch->next++;
+            }
+            batch->mutex.unLock();
+            if( index >= batch->numEntries ) {
+                break;
+            }
+
+            ValidateFile::BatchEntry& entry = batch->entries[index];
+            Utils::HashBuffer hashBuffer;
+            if( batch->create ) {
+                entry.status = ValidateFile::createValidation(entry.fileName, entry.hashFileName, hashBuffer,
+                                                              worker->readBuffer, worker->readBufferSize);
+            } else {
+                entry.status = ValidateFile::validate(entry.fileName, entry.hashFileName, hashBuffer,
+                                                      worker->readBuffer, worker->readBufferSize);
+            }
+        }
+    }
+
+    ValidateFile::Status runBatch(ValidateFile::BatchEntry* entries, NATIVE_UINT_TYPE numEntries, bool create,
+                                  NATIVE_UINT_TYPE numWorkers, U8* readBuffer, NATIVE_UINT_TYPE readBufferSize,
+                                  NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize) {
+
+        FW_ASSERT(entries or numEntries == 0);
+        FW_ASSERT(readBuffer);
+
+        // Use no more workers than files, and give each worker a slice of the buffer:
+        if( numWorkers > VFILE_BATCH_MAX_WORKERS ) {
+            numWorkers = VFILE_BATCH_MAX_WORKERS;
+        }
+        if( numWorkers > numEntries ) {
+            numWorkers = numEntries;
+        }
+        if( numWorkers == 0 ) {
+            numWorkers = 1;
+        }
+        const NATIVE_UINT_TYPE sliceSize = readBufferSize / numWorkers;
+        FW_ASSERT(sliceSize > 0, readBufferSize, numWorkers);
+
+        Batch batch;
+        batch.entries = entries;
+        batch.numEntries = numEntries;
+        batch.create = create;
+        batch.next = 0;
+
+        BatchWorker workers[VFILE_BATCH_MAX_WORKERS];
+        for( NATIVE_UINT_TYPE i = 0; i < numWorkers; i++ ) {
+            workers[i].batch = &batch;
+            workers[i].readBuffer = &readBuffer[i * sliceSize];
+            workers[i].readBufferSize = sliceSize;
+        }
+
+        // Start the helper tasks. Worker 0 runs on the calling task:
+        Task tasks[VFILE_BATCH_MAX_WORKERS];
+        bool started[VFILE_BATCH_MAX_WORKERS] = { false };
+        for( NATIVE_UINT_TYPE i = 1; i < numWorkers; i++ ) {
+            char name[20];
+            (void) snprintf(name, sizeof(name), "VFILE_%u", static_cast<unsigned int>(i));
+            Fw::EightyCharString taskName(name);
+            const Task::TaskStatus taskStatus = tasks[i].start(taskName, i, priority, stackSize,
+                                                               runBatchWorker, &workers[i]);
+            started[i] = (Task::TASK_OK == taskStatus);
+        }
+        runBatchWorker(&workers[0]);
+        for( NATIVE_UINT_TYPE i = 1; i < numWorkers; i++ ) {
+            if( started[i] ) {
+                const Task::TaskStatus taskStatus = tasks[i].join(NULL);
+                FW_ASSERT(Task::TASK_OK == taskStatus, taskStatus);
+            }
+        }
+
+        // Report the first failure:
+        for( NATIVE_UINT_TYPE i = 0; i < numEntries; i++ ) {
+            if( ValidateFile::VALIDATION_OK != entries[i].status ) {
+                return entries[i].status;
+            }
+        }
+        return ValidateFile::VALIDATION_OK;
+    }
+
+    ValidateFile::Status ValidateFile::validateBatch(BatchEntry* entries, NATIVE_UINT_TYPE numEntries,
+                                                     NATIVE_UINT_TYPE numWorkers,
+                                                     U8* readBuffer, NATIVE_UINT_TYPE readBufferSize,
+                                                     NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize) {
+        return runBatch(entries, numEntries, false, numWorkers, readBuffer, readBufferSize, priority, stackSize);
+    }
+
+    ValidateFile::Status ValidateFile::createValidationBatch(BatchEntry* entries, NATIVE_UINT_TYPE numEntries,
+                                                             NATIVE_UINT_TYPE numWorkers,
+                                                             U8* readBuffer, NATIVE_UINT_TYPE readBufferSize,
+                                                             NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize) {
+        return runBatch(entries, numEntries, true, numWorkers, readBuffer, readBufferSize, priority, stackSize);
+    }
+
 }
@@ -39,6 +39,12 @@ namespace Os {
       //! \return Status
       Os::ValidateFile::Status createHashFile(void);
 
+      //! Create the hash file from a hash computed while the file was written
+      //! \return Status
+      Os::ValidateFile::Status createHashFile(
+          const Utils::HashBuffer& hashBuffer //!< The hash of the file
+      );
+
     public:
 
       //! Get the file name
@@ -27,6 +27,8 @@ HDR = 			Queue.hpp \
 				WatchdogTimer.hpp \
 				Mutex.hpp \
 				File.hpp \
+				AsyncIo.hpp \
+				DirectWriter.hpp \
 				ValidateFile.hpp \
 				FileSystem.hpp \
 				LocklessQueue.hpp \
@@ -38,6 +40,8 @@ SRC_LINUX=      Posix/IPCQueue.cpp \
                 Pthreads/PriorityBufferQueue.cpp \
                 Pthreads/MaxHeap/MaxHeap.cpp \
 				Linux/File.cpp \
+				Linux/AsyncIo.cpp \
+				Linux/DirectWriter.cpp \
 				Posix/Task.cpp \
 				LogPrintf.cpp \
 				Linux/InterruptLock.cpp \
@@ -54,6 +58,8 @@ SRC_DARWIN =    MacOs/IPCQueueStub.cpp \ # NOTE(mereweth) - provide a stub that
                 Pthreads/PriorityBufferQueue.cpp \
                 Pthreads/MaxHeap/MaxHeap.cpp \
 				Linux/File.cpp \
+				Linux/AsyncIo.cpp \
+				Linux/DirectWriter.cpp \
 				Posix/Task.cpp \
 				LogPrintf.cpp \
 				Linux/WatchdogTimer.cpp \
@@ -69,6 +75,8 @@ SRC_CYGWIN =    Pthreads/Queue.cpp \
                 Pthreads/PriorityBufferQueue.cpp \
                 Pthreads/MaxHeap/MaxHeap.cpp \
 				Linux/File.cpp \
+				Linux/AsyncIo.cpp \
+				Linux/DirectWriter.cpp \
 				Posix/Task.cpp \
 				LogPrintf.cpp \
 				Linux/InterruptLock.cpp \
@@ -83,6 +91,8 @@ SRC_RASPIAN =   Pthreads/Queue.cpp \
                 Pthreads/PriorityBufferQueue.cpp \
                 Pthreads/MaxHeap/MaxHeap.cpp \
 				Linux/File.cpp \
+				Linux/AsyncIo.cpp \
+				Linux/DirectWriter.cpp \
 				Posix/Task.cpp \
 				LogPrintf.cpp \
 				Linux/InterruptLock.cpp \
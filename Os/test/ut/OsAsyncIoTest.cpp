@@ -0,0 +1,180 @@
+#include <Os/AsyncIo.hpp>
+#include <Os/File.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+
+    const NATIVE_INT_TYPE BLOCK_SIZE = 512;
+    const NATIVE_UINT_TYPE NUM_BLOCKS = 32;
+    const NATIVE_UINT_TYPE DEPTH = 8;
+
+    U8 writeData[NUM_BLOCKS][BLOCK_SIZE];
+    U8 readData[NUM_BLOCKS][BLOCK_SIZE];
+
+    // Collect completions until none are in flight, checking each one
+    NATIVE_UINT_TYPE drain(Os::AsyncIo& asyncIo, Os::AsyncIo::Operation operation) {
+        Os::AsyncIo::Completion completions[DEPTH];
+        NATIVE_UINT_TYPE total = 0;
+        while (asyncIo.getInFlight() > 0) {
+            const NATIVE_UINT_TYPE count = asyncIo.reap(completions, DEPTH, true);
+            FW_ASSERT(count > 0);
+            for (NATIVE_UINT_TYPE i = 0; i < count; i++) {
+                FW_ASSERT(completions[i].request.operation == operation, completions[i].request.operation);
+                FW_ASSERT(completions[i].status == Os::File::OP_OK, completions[i].status);
+                if (operation == Os::AsyncIo::READ or operation == Os::AsyncIo::WRITE) {
+                    FW_ASSERT(completions[i].size == BLOCK_SIZE, completions[i].size);
+                }
+            }
+            total += count;
+        }
+        return total;
+    }
+
+    // Run every block through the queue, keeping up to DEPTH requests in flight
+    void transferBlocks(Os::AsyncIo& asyncIo, Os::File& file, Os::AsyncIo::Operation operation) {
+        Os::AsyncIo::Completion completions[DEPTH];
+        NATIVE_UINT_TYPE completed = 0;
+        NATIVE_UINT_TYPE block = 0;
+        while (completed < NUM_BLOCKS) {
+            // Submit in reverse order, so the file is not written front to back
+            while (block < NUM_BLOCKS and asyncIo.getInFlight() < DEPTH) {
+                const NATIVE_UINT_TYPE index = NUM_BLOCKS - 1 - block;
+                Os::AsyncIo::Request request;
+                request.operation = operation;
+                request.file = &file;
+                request.buffer = (operation == Os::AsyncIo::WRITE) ? writeData[index] : readData[index];
+                request.size = BLOCK_SIZE;
+                request.offset = index * BLOCK_SIZE;
+                request.context = index;
+                const Os::AsyncIo::Status status = asyncIo.submit(request);
+                FW_ASSERT(status == Os::AsyncIo::OP_OK, status);
+                block++;
+            }
+            const NATIVE_UINT_TYPE count = asyncIo.reap(completions, DEPTH, true);
+            FW_ASSERT(count > 0);
+            for (NATIVE_UINT_TYPE i = 0; i < count; i++) {
+                FW_ASSERT(completions[i].status == Os::File::OP_OK, completions[i].status);
+                FW_ASSERT(completions[i].size == BLOCK_SIZE, completions[i].size);
+                FW_ASSERT(completions[i].request.context < NUM_BLOCKS, completions[i].request.context);
+            }
+            completed += count;
+        }
+        FW_ASSERT(asyncIo.getInFlight() == 0, asyncIo.getInFlight());
+    }
+
+    void testBackend(bool useIoUring) {
+
+        const char test_file_name[] = "test_async_io";
+        Os::AsyncIo asyncIo;
+        Os::File file;
+        Os::AsyncIo::Request request;
+        memset(&request, 0, sizeof(request));
+
+        // Nothing can be submitted before start
+        request.operation = Os::AsyncIo::NOP;
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::NOT_STARTED);
+
+        FW_ASSERT(asyncIo.start("ASYNCIO", DEPTH, 2, 0, 0, useIoUring) == Os::AsyncIo::OP_OK);
+        printf("Async I/O backend: %s\n",
+               (asyncIo.getBackend() == Os::AsyncIo::IO_URING) ? "io_uring" : "thread pool");
+        if (not useIoUring) {
+            FW_ASSERT(asyncIo.getBackend() == Os::AsyncIo::THREAD_POOL, asyncIo.getBackend());
+        }
+
+        // A closed file is refused
+        request.operation = Os::AsyncIo::WRITE;
+        request.file = &file;
+        request.buffer = writeData[0];
+        request.size = BLOCK_SIZE;
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::BAD_REQUEST);
+
+        for (NATIVE_UINT_TYPE i = 0; i < NUM_BLOCKS; i++) {
+            for (NATIVE_INT_TYPE j = 0; j < BLOCK_SIZE; j++) {
+                writeData[i][j] = static_cast<U8>(i * 7 + j);
+            }
+        }
+        memset(readData, 0, sizeof(readData));
+
+        printf("Writing %u blocks to (%s).\n", NUM_BLOCKS, test_file_name);
+        FW_ASSERT(file.open(test_file_name, Os::File::OPEN_CREATE) == Os::File::OP_OK);
+        transferBlocks(asyncIo, file, Os::AsyncIo::WRITE);
+        request.operation = Os::AsyncIo::FSYNC;
+        request.file = &file;
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::OP_OK);
+        FW_ASSERT(drain(asyncIo, Os::AsyncIo::FSYNC) == 1);
+        file.close();
+
+        printf("Reading %u blocks from (%s).\n", NUM_BLOCKS, test_file_name);
+        FW_ASSERT(file.open(test_file_name, Os::File::OPEN_READ) == Os::File::OP_OK);
+        transferBlocks(asyncIo, file, Os::AsyncIo::READ);
+        FW_ASSERT(memcmp(readData, writeData, sizeof(readData)) == 0);
+
+        // A read at the end of the file is short
+        request.operation = Os::AsyncIo::READ;
+        request.buffer = readData[0];
+        request.size = BLOCK_SIZE;
+        request.offset = (NUM_BLOCKS - 1) * BLOCK_SIZE + 100;
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::OP_OK);
+        Os::AsyncIo::Completion completion;
+        FW_ASSERT(asyncIo.reap(&completion, 1, true) == 1);
+        FW_ASSERT(completion.status == Os::File::OP_OK, completion.status);
+        FW_ASSERT(completion.size == BLOCK_SIZE - 100, completion.size);
+
+        // A read past the end of the file transfers nothing
+        request.offset = NUM_BLOCKS * BLOCK_SIZE + 100;
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::OP_OK);
+        FW_ASSERT(asyncIo.reap(&completion, 1, true) == 1);
+        FW_ASSERT(completion.status == Os::File::OP_OK, completion.status);
+        FW_ASSERT(completion.size == 0, completion.size);
+
+        // A read of the whole file completes in full
+        memset(readData, 0, sizeof(readData));
+        request.buffer = readData;
+        request.size = sizeof(readData);
+        request.offset = 0;
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::OP_OK);
+        FW_ASSERT(asyncIo.reap(&completion, 1, true) == 1);
+        FW_ASSERT(completion.status == Os::File::OP_OK, completion.status);
+        FW_ASSERT(completion.size == static_cast<NATIVE_INT_TYPE>(sizeof(readData)), completion.size);
+        FW_ASSERT(memcmp(readData, writeData, sizeof(readData)) == 0);
+        request.buffer = readData[0];
+        request.size = BLOCK_SIZE;
+
+        // No more than DEPTH requests may be in flight
+        printf("Filling the queue.\n");
+        request.operation = Os::AsyncIo::NOP;
+        for (NATIVE_UINT_TYPE i = 0; i < DEPTH; i++) {
+            request.context = i;
+            FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::OP_OK);
+        }
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::QUEUE_FULL);
+        FW_ASSERT(drain(asyncIo, Os::AsyncIo::NOP) == DEPTH);
+
+        // Polling with nothing in flight returns at once
+        FW_ASSERT(asyncIo.reap(&completion, 1, false) == 0);
+
+        // Stopping waits for the requests in flight
+        request.operation = Os::AsyncIo::READ;
+        request.offset = 0;
+        FW_ASSERT(asyncIo.submit(request) == Os::AsyncIo::OP_OK);
+        asyncIo.stop();
+        FW_ASSERT(asyncIo.getBackend() == Os::AsyncIo::NO_BACKEND);
+        FW_ASSERT(asyncIo.getInFlight() == 0);
+        file.close();
+
+        FW_ASSERT(::remove(test_file_name) == 0);
+    }
+
+}
+
+extern "C" {
+    void asyncIoTest(void);
+}
+
+void asyncIoTest(void) {
+    testBackend(true);
+    testBackend(false);
+}
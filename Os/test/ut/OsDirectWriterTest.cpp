@@ -0,0 +1,102 @@
+#include <Os/DirectWriter.hpp>
+#include <Os/File.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+namespace {
+
+    const NATIVE_UINT_TYPE TOTAL_SIZE = 3 * DIRECT_WRITER_BUFFER_SIZE + 1000;
+
+    U8 data[TOTAL_SIZE];
+    U8 check[TOTAL_SIZE];
+
+    U64 sizeOnDisk(const char* fileName) {
+        struct stat info;
+        FW_ASSERT(::stat(fileName, &info) == 0);
+        return info.st_size;
+    }
+
+    // Read the file back and compare the first size bytes with the data
+    void checkContents(const char* fileName, NATIVE_UINT_TYPE size) {
+        Os::File file;
+        FW_ASSERT(file.open(fileName, Os::File::OPEN_READ) == Os::File::OP_OK);
+        NATIVE_INT_TYPE readSize = size;
+        FW_ASSERT(file.read(check, readSize) == Os::File::OP_OK);
+        FW_ASSERT(readSize == static_cast<NATIVE_INT_TYPE>(size), readSize, size);
+        FW_ASSERT(memcmp(check, data, size) == 0);
+        file.close();
+    }
+
+}
+
+extern "C" {
+    void directWriterTest(void);
+}
+
+void directWriterTest(void) {
+
+    const char test_file_name[] = "test_direct_writer";
+    Os::DirectWriter writer;
+    NATIVE_INT_TYPE size;
+
+    for (NATIVE_UINT_TYPE i = 0; i < TOTAL_SIZE; i++) {
+        data[i] = static_cast<U8>(i * 7 + (i >> 8));
+    }
+
+    // Nothing can be written before the file is open
+    size = 1;
+    FW_ASSERT(writer.write(data, size) == Os::File::NOT_OPENED);
+    FW_ASSERT(size == 0, size);
+
+    printf("Writing records to (%s) with direct I/O.\n", test_file_name);
+    FW_ASSERT(writer.open(test_file_name, 1024 * 1024) == Os::File::OP_OK);
+    printf("Direct I/O is %s.\n", writer.isDirect() ? "on" : "off");
+
+    // Records of odd sizes, some split across the staging buffer
+    NATIVE_UINT_TYPE written = 0;
+    NATIVE_UINT_TYPE record = 1;
+    while (written + record <= DIRECT_WRITER_BUFFER_SIZE + 100) {
+        size = record;
+        FW_ASSERT(writer.write(&data[written], size) == Os::File::OP_OK);
+        FW_ASSERT(size == static_cast<NATIVE_INT_TYPE>(record), size, record);
+        written += record;
+        record = record * 3 + 1;
+    }
+    FW_ASSERT(writer.getSize() == written);
+
+    // Flushing writes the partial last block padded; the data read back is intact
+    FW_ASSERT(writer.flush() == Os::File::OP_OK);
+    FW_ASSERT(sizeOnDisk(test_file_name) >= written);
+    checkContents(test_file_name, written);
+
+    // More data completes the flushed block in place
+    Os::File::IoVector vectors[3];
+    vectors[0].buffer = &data[written];
+    vectors[0].size = 10;
+    vectors[1].buffer = &data[written + 10];
+    vectors[1].size = 0;
+    vectors[2].buffer = &data[written + 10];
+    vectors[2].size = TOTAL_SIZE - written - 10;
+    FW_ASSERT(writer.writev(vectors, 3, size) == Os::File::OP_OK);
+    FW_ASSERT(size == static_cast<NATIVE_INT_TYPE>(TOTAL_SIZE - written), size);
+    FW_ASSERT(writer.getSize() == TOTAL_SIZE);
+
+    // Closing trims the padding and the preallocated space
+    FW_ASSERT(writer.close() == Os::File::OP_OK);
+    FW_ASSERT(not writer.isOpen());
+    FW_ASSERT(sizeOnDisk(test_file_name) == TOTAL_SIZE);
+    checkContents(test_file_name, TOTAL_SIZE);
+
+    // Opening again starts an empty file
+    FW_ASSERT(writer.open(test_file_name) == Os::File::OP_OK);
+    size = 5;
+    FW_ASSERT(writer.write(data, size) == Os::File::OP_OK);
+    FW_ASSERT(writer.close() == Os::File::OP_OK);
+    FW_ASSERT(sizeOnDisk(test_file_name) == 5);
+    checkContents(test_file_name, 5);
+
+    FW_ASSERT(::remove(test_file_name) == 0);
+}
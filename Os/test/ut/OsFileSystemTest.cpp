@@ -176,10 +176,167 @@ void testTestFileSystem() {
 	printf("Current dir: %s\n", dir_buff);
 }
 
+struct CopyProgressRecord {
+	U32 calls;
+	U64 lastBytes;
+	U64 totalBytes;
+};
+
+void copyProgress(void* context, U64 bytesCopied, U64 totalBytes) {
+	CopyProgressRecord* record = static_cast<CopyProgressRecord*>(context);
+	FW_ASSERT(bytesCopied > record->lastBytes);
+	FW_ASSERT(bytesCopied <= totalBytes);
+	++record->calls;
+	record->lastBytes = bytesCopied;
+	record->totalBytes = totalBytes;
+}
+
+void testCopyFileProgress() {
+
+	Os::FileSystem::Status file_sys_status;
+	Os::File test_file;
+	const char test_file_name1[] = "test_copy_file1";
+	const char test_file_name2[] = "test_copy_file2";
+	struct stat info;
+	U8 block[1000];
+	U8 check_block[sizeof(block)];
+	// Enough blocks to span more than two progress chunks
+	const U32 num_blocks = (2 * FILE_SYSTEM_COPY_CHUNK_SIZE) / sizeof(block) + 1;
+
+	printf("Creating test file (%s) of %u bytes\n", test_file_name1,
+		static_cast<unsigned int>(num_blocks * sizeof(block)));
+	FW_ASSERT(test_file.open(test_file_name1, Os::File::OPEN_WRITE) == Os::File::OP_OK);
+	for (U32 blockNum = 0; blockNum < num_blocks; ++blockNum) {
+		for (U32 i = 0; i < sizeof(block); ++i) {
+			block[i] = static_cast<U8>(blockNum + i);
+		}
+		NATIVE_INT_TYPE size = sizeof(block);
+		FW_ASSERT(test_file.write(block, size, true) == Os::File::OP_OK);
+	}
+	test_file.close();
+
+	// Give the destination a longer stale file, which the copy must replace
+	FW_ASSERT(test_file.open(test_file_name2, Os::File::OPEN_WRITE) == Os::File::OP_OK);
+	for (U32 blockNum = 0; blockNum < num_blocks + 1; ++blockNum) {
+		NATIVE_INT_TYPE size = sizeof(block);
+		FW_ASSERT(test_file.write(block, size, true) == Os::File::OP_OK);
+	}
+	test_file.close();
+
+	printf("Copying file (%s) to (%s) with progress.\n", test_file_name1, test_file_name2);
+	CopyProgressRecord record = {0, 0, 0};
+	if ((file_sys_status = Os::FileSystem::copyFile(test_file_name1, test_file_name2,
+			copyProgress, &record)) != Os::FileSystem::OP_OK) {
+		printf("\tFailed to copy file (%s) to (%s)\n", test_file_name1, test_file_name2);
+		printf("\tReturn status: %d\n", file_sys_status);
+		FW_ASSERT(0);
+	}
+	FW_ASSERT(record.calls >= 3, record.calls);
+	FW_ASSERT(record.lastBytes == num_blocks * sizeof(block));
+	FW_ASSERT(record.totalBytes == num_blocks * sizeof(block));
+	FW_ASSERT(stat(test_file_name2, &info) == 0);
+	FW_ASSERT(static_cast<U64>(info.st_size) == num_blocks * sizeof(block));
+
+	// Read the copy back and check every block
+	FW_ASSERT(test_file.open(test_file_name2, Os::File::OPEN_READ) == Os::File::OP_OK);
+	for (U32 blockNum = 0; blockNum < num_blocks; ++blockNum) {
+		for (U32 i = 0; i < sizeof(block); ++i) {
+			block[i] = static_cast<U8>(blockNum + i);
+		}
+		NATIVE_INT_TYPE size = sizeof(check_block);
+		FW_ASSERT(test_file.read(check_block, size, true) == Os::File::OP_OK);
+		FW_ASSERT(size == sizeof(check_block), size);
+		FW_ASSERT(memcmp(block, check_block, sizeof(block)) == 0, blockNum);
+	}
+	test_file.close();
+
+	printf("Copying a missing file.\n");
+	file_sys_status = Os::FileSystem::copyFile("test_copy_missing", test_file_name2);
+	FW_ASSERT(file_sys_status == Os::FileSystem::INVALID_PATH, file_sys_status);
+
+	FW_ASSERT(Os::FileSystem::removeFile(test_file_name1) == Os::FileSystem::OP_OK);
+	FW_ASSERT(Os::FileSystem::removeFile(test_file_name2) == Os::FileSystem::OP_OK);
+}
+
+void testDirectoryIterator() {
+
+	Os::FileSystem::Status file_sys_status;
+	Os::File test_file;
+	const char test_dir[] = "./test_iterator_dir";
+	const char test_sub_dir[] = "./test_iterator_dir/sub_dir";
+	// Enough files to need many reads of the entry buffer
+	const U32 num_files = 3000;
+	static bool seen[num_files];
+	char file_name[80];
+
+	printf("Creating directory (%s) with %u files\n", test_dir,
+		static_cast<unsigned int>(num_files));
+	FW_ASSERT(Os::FileSystem::createDirectory(test_dir) == Os::FileSystem::OP_OK);
+	FW_ASSERT(Os::FileSystem::createDirectory(test_sub_dir) == Os::FileSystem::OP_OK);
+	for (U32 i = 0; i < num_files; ++i) {
+		(void) snprintf(file_name, sizeof(file_name), "%s/file_%u", test_dir, static_cast<unsigned int>(i));
+		FW_ASSERT(test_file.open(file_name, Os::File::OPEN_WRITE) == Os::File::OP_OK);
+		test_file.close();
+		seen[i] = false;
+	}
+
+	printf("Iterating over directory (%s)\n", test_dir);
+	Os::FileSystem::DirectoryIterator iterator;
+	FW_ASSERT(!iterator.isOpen());
+	file_sys_status = iterator.open(test_dir);
+	FW_ASSERT(file_sys_status == Os::FileSystem::OP_OK, file_sys_status);
+	FW_ASSERT(iterator.isOpen());
+	U32 files = 0;
+	U32 dirs = 0;
+	while (true) {
+		const char* name = NULL;
+		Os::FileSystem::EntryType type = Os::FileSystem::ENTRY_OTHER;
+		file_sys_status = iterator.next(name, type);
+		FW_ASSERT(file_sys_status == Os::FileSystem::OP_OK, file_sys_status);
+		if (name == NULL) {
+			break;
+		}
+		FW_ASSERT(strcmp(name, ".") != 0 && strcmp(name, "..") != 0);
+		if (type == Os::FileSystem::ENTRY_DIRECTORY) {
+			FW_ASSERT(strcmp(name, "sub_dir") == 0);
+			++dirs;
+			continue;
+		}
+		FW_ASSERT(type == Os::FileSystem::ENTRY_FILE, type);
+		unsigned int index = num_files;
+		FW_ASSERT(sscanf(name, "file_%u", &index) == 1);
+		FW_ASSERT(index < num_files, index);
+		FW_ASSERT(!seen[index], index);
+		seen[index] = true;
+		++files;
+	}
+	FW_ASSERT(files == num_files, files);
+	FW_ASSERT(dirs == 1, dirs);
+	iterator.close();
+	FW_ASSERT(!iterator.isOpen());
+
+	printf("Opening a missing directory and a file\n");
+	file_sys_status = iterator.open("./test_iterator_missing");
+	FW_ASSERT(file_sys_status == Os::FileSystem::INVALID_PATH, file_sys_status);
+	(void) snprintf(file_name, sizeof(file_name), "%s/file_0", test_dir);
+	file_sys_status = iterator.open(file_name);
+	FW_ASSERT(file_sys_status == Os::FileSystem::NOT_DIR, file_sys_status);
+	FW_ASSERT(!iterator.isOpen());
+
+	for (U32 i = 0; i < num_files; ++i) {
+		(void) snprintf(file_name, sizeof(file_name), "%s/file_%u", test_dir, static_cast<unsigned int>(i));
+		FW_ASSERT(Os::FileSystem::removeFile(file_name) == Os::FileSystem::OP_OK);
+	}
+	FW_ASSERT(Os::FileSystem::removeDirectory(test_sub_dir) == Os::FileSystem::OP_OK);
+	FW_ASSERT(Os::FileSystem::removeDirectory(test_dir) == Os::FileSystem::OP_OK);
+}
+
 extern "C" {
     void fileSystemTest(void);
 }
 
 void fileSystemTest(void) {
+    testCopyFileProgress();
+    testDirectoryIterator();
     testTestFileSystem(); 
 }
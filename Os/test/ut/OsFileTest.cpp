@@ -0,0 +1,170 @@
+#include <Os/File.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <stdio.h>
+#include <string.h>
+
+void testFilePositionalIo() {
+
+	Os::File test_file;
+	Os::File::Status file_status;
+	const char test_file_name[] = "test_file_positional";
+	const char head[] = "0123456789";
+	const char tail[] = "abcdefghij";
+	char buf[32];
+	NATIVE_INT_TYPE size;
+
+	printf("Writing to (%s) at offsets.\n", test_file_name);
+	FW_ASSERT(test_file.open(test_file_name, Os::File::OPEN_CREATE) == Os::File::OP_OK);
+	// Write the tail first, leaving a hole for the head
+	size = sizeof(tail);
+	file_status = test_file.writeAt(tail, size, sizeof(head));
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == sizeof(tail), size);
+	size = sizeof(head);
+	file_status = test_file.writeAt(head, size, 0);
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == sizeof(head), size);
+	// The file position is unchanged, so a plain write lands at the start
+	size = 1;
+	FW_ASSERT(test_file.write("X", size) == Os::File::OP_OK);
+	test_file.close();
+
+	printf("Reading (%s) at offsets.\n", test_file_name);
+	FW_ASSERT(test_file.open(test_file_name, Os::File::OPEN_READ) == Os::File::OP_OK);
+	size = sizeof(tail);
+	file_status = test_file.readAt(buf, size, sizeof(head));
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == sizeof(tail), size);
+	FW_ASSERT(memcmp(buf, tail, sizeof(tail)) == 0);
+	size = 4;
+	file_status = test_file.readAt(buf, size, 1);
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == 4, size);
+	FW_ASSERT(memcmp(buf, &head[1], 4) == 0);
+	// A read past the end of the file is short
+	size = sizeof(buf);
+	file_status = test_file.readAt(buf, size, sizeof(head) + 5);
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == sizeof(tail) - 5, size);
+	// The file position is still at the start
+	size = 1;
+	FW_ASSERT(test_file.read(buf, size) == Os::File::OP_OK);
+	FW_ASSERT(size == 1 and buf[0] == 'X', size);
+	test_file.close();
+
+	FW_ASSERT(::remove(test_file_name) == 0);
+}
+
+void testFileVectoredIo() {
+
+	Os::File test_file;
+	Os::File::Status file_status;
+	const char test_file_name[] = "test_file_vectored";
+	// More buffers than are passed to the kernel in one call
+	const NATIVE_INT_TYPE num_vectors = 40;
+	U8 data[num_vectors][num_vectors];
+	U8 check[num_vectors][num_vectors];
+	Os::File::IoVector vectors[num_vectors];
+	NATIVE_INT_TYPE total = 0;
+	NATIVE_INT_TYPE size;
+
+	// Buffers of sizes 0, 1, 2, ... so that the total is not a multiple of any one size
+	for (NATIVE_INT_TYPE i = 0; i < num_vectors; ++i) {
+		for (NATIVE_INT_TYPE j = 0; j < num_vectors; ++j) {
+			data[i][j] = static_cast<U8>(i * num_vectors + j);
+		}
+		vectors[i].buffer = data[i];
+		vectors[i].size = i;
+		total += i;
+	}
+
+	printf("Writing %d buffers to (%s).\n", num_vectors, test_file_name);
+	FW_ASSERT(test_file.open(test_file_name, Os::File::OPEN_CREATE) == Os::File::OP_OK);
+	file_status = test_file.writev(vectors, num_vectors, size);
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == total, size, total);
+	test_file.close();
+
+	printf("Reading %d buffers from (%s).\n", num_vectors, test_file_name);
+	memset(check, 0, sizeof(check));
+	for (NATIVE_INT_TYPE i = 0; i < num_vectors; ++i) {
+		vectors[i].buffer = check[i];
+	}
+	FW_ASSERT(test_file.open(test_file_name, Os::File::OPEN_READ) == Os::File::OP_OK);
+	file_status = test_file.readv(vectors, num_vectors, size);
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == total, size, total);
+	for (NATIVE_INT_TYPE i = 0; i < num_vectors; ++i) {
+		FW_ASSERT(memcmp(check[i], data[i], i) == 0, i);
+	}
+	// Reading at the end of the file reads nothing
+	file_status = test_file.readv(vectors, num_vectors, size);
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == 0, size);
+
+	// More empty buffers than are passed to the kernel in one call do not
+	// end the read before the buffer after them
+	FW_ASSERT(test_file.seek(0) == Os::File::OP_OK);
+	memset(check, 0, sizeof(check));
+	for (NATIVE_INT_TYPE i = 0; i < num_vectors - 1; ++i) {
+		vectors[i].buffer = NULL;
+		vectors[i].size = 0;
+	}
+	vectors[num_vectors - 1].buffer = check[0];
+	vectors[num_vectors - 1].size = num_vectors;
+	file_status = test_file.readv(vectors, num_vectors, size);
+	FW_ASSERT(file_status == Os::File::OP_OK, file_status);
+	FW_ASSERT(size == num_vectors, size);
+	// The file holds i bytes of data[i] for each i in turn
+	NATIVE_INT_TYPE offset = 0;
+	for (NATIVE_INT_TYPE i = 0; offset < num_vectors; ++i) {
+		for (NATIVE_INT_TYPE j = 0; (j < i) and (offset < num_vectors); ++j) {
+			FW_ASSERT(check[0][offset] == data[i][j], offset);
+			++offset;
+		}
+	}
+	test_file.close();
+
+	FW_ASSERT(::remove(test_file_name) == 0);
+}
+
+void testFileExclusiveCreate() {
+
+	Os::File test_file;
+	Os::File::Status file_status;
+	const char test_file_name[] = "test_file_exclusive";
+	const char data[] = "0123456789";
+	char buf[32];
+	NATIVE_INT_TYPE size;
+
+	printf("Creating (%s) exclusively.\n", test_file_name);
+	(void) ::remove(test_file_name);
+	FW_ASSERT(test_file.open(test_file_name, Os::File::OPEN_CREATE_EXCLUSIVE) == Os::File::OP_OK);
+	size = sizeof(data);
+	FW_ASSERT(test_file.write(data, size) == Os::File::OP_OK);
+	test_file.close();
+
+	// A second exclusive create fails and leaves the file as it was
+	file_status = test_file.open(test_file_name, Os::File::OPEN_CREATE_EXCLUSIVE);
+	FW_ASSERT(file_status == Os::File::FILE_EXISTS, file_status);
+	test_file.close();
+	FW_ASSERT(test_file.open(test_file_name, Os::File::OPEN_READ) == Os::File::OP_OK);
+	size = sizeof(buf);
+	FW_ASSERT(test_file.read(buf, size, false) == Os::File::OP_OK);
+	FW_ASSERT(size == sizeof(data), size);
+	FW_ASSERT(memcmp(buf, data, sizeof(data)) == 0);
+	test_file.close();
+
+	FW_ASSERT(::remove(test_file_name) == 0);
+}
+
+extern "C" {
+    void fileTest(void);
+}
+
+void fileTest(void) {
+    testFilePositionalIo();
+    testFileVectoredIo();
+    testFileExclusiveCreate();
+}
@@ -2,6 +2,7 @@
 #include <Os/FileSystem.hpp>
 #include <Os/File.hpp>
 #include <Utils/Hash/HashBuffer.hpp>
+#include <Utils/Hash/Hash.hpp>
 #include <Fw/Types/Assert.hpp>
 
 #include <stdio.h>
@@ -89,10 +90,101 @@ void testValidateFile() {
     }
 }
 
+void testValidateFileBatch() {
+
+    Os::ValidateFile::Status validateStatus;
+    Os::FileSystem::Status fsStatus;
+    const NATIVE_UINT_TYPE numFiles = 4;
+    const char* fileNames[numFiles] = { "mod.mk", "CMakeLists.txt", "TestMain.cpp", "OsValidateFileTest.cpp" };
+    const char* hashFileNames[numFiles] = { "mod.mk.hashed", "CMakeLists.txt.hashed", "TestMain.cpp.hashed", "OsValidateFileTest.cpp.hashed" };
+    Os::ValidateFile::BatchEntry entries[numFiles];
+    for (NATIVE_UINT_TYPE i = 0; i < numFiles; i++) {
+        entries[i].fileName = fileNames[i];
+        entries[i].hashFileName = hashFileNames[i];
+        entries[i].status = Os::ValidateFile::OTHER_ERROR;
+    }
+    static U8 readBuffer[4*4096];
+
+    // Create the hash files on three workers:
+    printf("Creating hashes for %u files\n", numFiles);
+    validateStatus = Os::ValidateFile::createValidationBatch(entries, numFiles, 3, readBuffer, sizeof(readBuffer), 0, 64*1024);
+    if ( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
+        printf("\tFailed to create hashes. Return status: %d\n", validateStatus);
+        FW_ASSERT(0);
+        return;
+    }
+
+    // Each hash must match the single-file validation:
+    for (NATIVE_UINT_TYPE i = 0; i < numFiles; i++) {
+        FW_ASSERT(Os::ValidateFile::VALIDATION_OK == entries[i].status, i, entries[i].status);
+        validateStatus = Os::ValidateFile::validate(fileNames[i], hashFileNames[i]);
+        FW_ASSERT(Os::ValidateFile::VALIDATION_OK == validateStatus, i, validateStatus);
+    }
+
+    // Validate the batch, with one hash file swapped and one file missing:
+    printf("Validating %u files\n", numFiles);
+    entries[1].hashFileName = hashFileNames[2];
+    entries[3].fileName = "thisfiledoesntexist";
+    validateStatus = Os::ValidateFile::validateBatch(entries, numFiles, VFILE_BATCH_MAX_WORKERS, readBuffer, sizeof(readBuffer), 0, 64*1024);
+    FW_ASSERT(Os::ValidateFile::VALIDATION_FAIL == validateStatus, validateStatus);
+    FW_ASSERT(Os::ValidateFile::VALIDATION_OK == entries[0].status, entries[0].status);
+    FW_ASSERT(Os::ValidateFile::VALIDATION_FAIL == entries[1].status, entries[1].status);
+    FW_ASSERT(Os::ValidateFile::VALIDATION_OK == entries[2].status, entries[2].status);
+    FW_ASSERT(Os::ValidateFile::FILE_DOESNT_EXIST == entries[3].status, entries[3].status);
+
+    // Remove hash files:
+    for (NATIVE_UINT_TYPE i = 0; i < numFiles; i++) {
+        fsStatus = Os::FileSystem::removeFile(hashFileNames[i]);
+        FW_ASSERT(Os::FileSystem::OP_OK == fsStatus, i, fsStatus);
+    }
+}
+
+void testWriteValidation() {
+
+    Os::ValidateFile::Status validateStatus;
+    Os::FileSystem::Status fsStatus;
+    const char fileName[] = "mod.mk";
+    const char hashFileName[] = "mod.mk.hashed";
+
+    // Hash the file in pieces, as a writer would:
+    printf("Storing an incremental hash of %s in %s\n", fileName, hashFileName);
+    Os::File file;
+    Os::File::Status fileStatus = file.open(fileName, Os::File::OPEN_READ);
+    FW_ASSERT(Os::File::OP_OK == fileStatus, fileStatus);
+    Utils::Hash hash;
+    hash.init();
+    U8 buffer[100];
+    NATIVE_INT_TYPE size = 0;
+    do {
+        size = sizeof(buffer);
+        fileStatus = file.read(buffer, size, false);
+        FW_ASSERT(Os::File::OP_OK == fileStatus, fileStatus);
+        hash.update(buffer, size);
+    } while (size > 0);
+    file.close();
+    Utils::HashBuffer hashBuffer;
+    hash.final(hashBuffer);
+
+    // The stored hash validates the file:
+    validateStatus = Os::ValidateFile::writeValidation(hashFileName, hashBuffer);
+    FW_ASSERT(Os::ValidateFile::VALIDATION_OK == validateStatus, validateStatus);
+    validateStatus = Os::ValidateFile::validate(fileName, hashFileName);
+    FW_ASSERT(Os::ValidateFile::VALIDATION_OK == validateStatus, validateStatus);
+
+    // A hash file that cannot be created:
+    validateStatus = Os::ValidateFile::writeValidation("thisdirdoesnotexist/mod.mk.hashed", hashBuffer);
+    FW_ASSERT(Os::ValidateFile::VALIDATION_OK != validateStatus, validateStatus);
+
+    fsStatus = Os::FileSystem::removeFile(hashFileName);
+    FW_ASSERT(Os::FileSystem::OP_OK == fsStatus, fsStatus);
+}
+
 extern "C" {
     void validateFileTest(void);
 }
 
 void validateFileTest(void) {
     testValidateFile(); 
+    testValidateFileBatch();
+    testWriteValidation();
 }
@@ -13,6 +13,9 @@ extern "C" {
   void intervalTimerTest(void);
   void fileSystemTest(void);
   void validateFileTest(void);
+  void fileTest(void);
+  void asyncIoTest(void);
+  void directWriterTest(void);
 }
 
 void run_test(int test_num)
@@ -49,6 +52,15 @@ void run_test(int test_num)
 		case 9:
 			validateFileTest();
 			break;
+		case 10:
+			fileTest();
+			break;
+		case 11:
+			asyncIoTest();
+			break;
+		case 12:
+			directWriterTest();
+			break;
 		default:
 			fprintf(stderr, "Invalid test number: %d\n", test_num);
 			break;
@@ -61,7 +73,7 @@ int main(int argc, char* argv[]) {
   if( argc != 2 ) {
     printf("Running all test cases\n");
 
-    for(int i = 0; i < 10; i++)
+    for(int i = 0; i < 13; i++)
     {
       run_test(i);
     }
@@ -10,7 +10,10 @@ TEST_SRC =      OsQueueTest.cpp \
 	        IntervalTimerTest.cpp \
                 OsValidateFileTest.cpp \
 	        OsTaskTest.cpp \
-                OsFileSystemTest.cpp
+                OsFileSystemTest.cpp \
+                OsFileTest.cpp \
+                OsAsyncIoTest.cpp \
+                OsDirectWriterTest.cpp
 
 TEST_MODS = Os Fw/Obj Fw/Types Utils/Hash
 
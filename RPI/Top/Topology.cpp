@@ -11,6 +11,8 @@ enum {
     DOWNLINK_PACKET_SIZE = 500,
     DOWNLINK_BUFFER_STORE_SIZE = 2500,
     DOWNLINK_BUFFER_QUEUE_SIZE = 5,
+    DOWNLINK_PACKETS_PER_CYCLE = 10,
+    DOWNLINK_BYTES_PER_CYCLE = 5*1024, // 50 KB/s at 10Hz
     UPLINK_BUFFER_STORE_SIZE = 3000,
     UPLINK_BUFFER_QUEUE_SIZE = 30
 };
@@ -113,6 +115,7 @@ void constructApp(int port_number, char* hostname) {
 
     fileUplink.init(30, 0);
     fileDownlink.init(30, 0);
+    fileDownlink.configure(DOWNLINK_PACKETS_PER_CYCLE, DOWNLINK_BYTES_PER_CYCLE);
     fileUplinkBufferManager.init(0);
     fileDownlinkBufferManager.init(1);
 
@@ -140,6 +143,7 @@ void constructApp(int port_number, char* hostname) {
     eventLogger.regCommands();
     prmDb.regCommands();
     fileDownlink.regCommands();
+    fileUplink.regCommands();
     health.regCommands();
     rpiDemo.regCommands();
 
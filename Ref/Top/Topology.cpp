@@ -15,6 +15,8 @@ enum {
     DOWNLINK_PACKET_SIZE = 500,
     DOWNLINK_BUFFER_STORE_SIZE = 2500,
     DOWNLINK_BUFFER_QUEUE_SIZE = 5,
+    DOWNLINK_PACKETS_PER_CYCLE = 100,
+    DOWNLINK_BYTES_PER_CYCLE = 50*1024, // 50 KB/s at 1Hz
     UPLINK_BUFFER_STORE_SIZE = 3000,
     UPLINK_BUFFER_QUEUE_SIZE = 30
 };
@@ -242,6 +244,7 @@ void constructApp(int port_number, char* hostname) {
 
     fileUplink.init(30, 0);
     fileDownlink.init(30, 0);
+    fileDownlink.configure(DOWNLINK_PACKETS_PER_CYCLE, DOWNLINK_BYTES_PER_CYCLE);
     fileUplinkBufferManager.init(0);
     fileDownlinkBufferManager.init(1);
     SG1.init(10,0);
@@ -264,6 +267,7 @@ void constructApp(int port_number, char* hostname) {
     eventLogger.regCommands();
     prmDb.regCommands();
     fileDownlink.regCommands();
+    fileUplink.regCommands();
     SG1.regCommands();
     SG2.regCommands();
     SG3.regCommands();
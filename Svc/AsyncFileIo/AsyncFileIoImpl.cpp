@@ -0,0 +1,320 @@
+// ====================================================================== 
+// \title  AsyncFileIoImpl.cpp
+// \brief  cpp file for AsyncFileIo component implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include "Svc/AsyncFileIo/AsyncFileIoImpl.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/BasicTypes.hpp"
+#include "Fw/Types/EightyCharString.hpp"
+#include <stdio.h>
+
+namespace Svc {
+
+  namespace {
+
+    //! The Os::AsyncIo context of the request that wakes the completion task
+    const POINTER_CAST WAKE_CONTEXT = ASYNC_IO_MAX_DEPTH;
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Construction, initialization, and destruction 
+  // ----------------------------------------------------------------------
+
+  AsyncFileIoImpl ::
+    AsyncFileIoImpl(
+#if FW_OBJECT_NAMES == 1
+        const char* compName
+#else
+        void
+#endif
+    ) :
+#if FW_OBJECT_NAMES == 1
+      AsyncFileIoComponentBase(compName),
+#else
+      AsyncFileIoComponentBase(),
+#endif
+      m_started(false),
+      m_quit(false),
+      m_submitting(0),
+      m_completed(0),
+      m_errors(0),
+      m_refused(0),
+      m_bytes(0)
+  {
+
+  }
+
+  void AsyncFileIoImpl ::
+    init(const NATIVE_INT_TYPE instance)
+  {
+    AsyncFileIoComponentBase::init(instance);
+  }
+
+  void AsyncFileIoImpl ::
+    start(
+        const NATIVE_INT_TYPE identifier,
+        const NATIVE_INT_TYPE priority,
+        const NATIVE_INT_TYPE stackSize,
+        const NATIVE_UINT_TYPE depth,
+        const NATIVE_UINT_TYPE workers,
+        const bool useIoUring
+    )
+  {
+    FW_ASSERT(not this->m_started);
+
+    char name[40];
+    (void) snprintf(name, sizeof(name), "AFIO_%d", static_cast<int>(identifier));
+    const Os::AsyncIo::Status status = this->m_asyncIo.start(
+        name, depth, workers, priority, stackSize, useIoUring);
+    if (status != Os::AsyncIo::OP_OK) {
+      this->log_WARNING_HI_AFIO_StartFailed(status);
+      return;
+    }
+
+    this->m_quit = false;
+    char taskName[40];
+    (void) snprintf(taskName, sizeof(taskName), "%s_CMPL", name);
+    const Os::Task::TaskStatus taskStatus = this->m_task.start(
+        Fw::EightyCharString(taskName), identifier, priority, stackSize,
+        AsyncFileIoImpl::completionTask, this);
+    FW_ASSERT(Os::Task::TASK_OK == taskStatus, taskStatus);
+    this->m_lock.lock();
+    this->m_started = true;
+    this->m_lock.unLock();
+
+    this->log_ACTIVITY_LO_AFIO_Started(
+        (this->m_asyncIo.getBackend() == Os::AsyncIo::IO_URING) ?
+        AFIO_IO_URING : AFIO_THREAD_POOL
+    );
+  }
+
+  void AsyncFileIoImpl ::
+    stop(void)
+  {
+    if (not this->m_started) {
+      return;
+    }
+
+    this->m_lock.lock();
+    this->m_quit = true;
+    this->m_lock.unLock();
+
+    // Wait for requests that were accepted before the quit to be
+    // submitted, so that the completion task does not exit before
+    // they are in flight
+    while (true) {
+      this->m_lock.lock();
+      const NATIVE_UINT_TYPE submitting = this->m_submitting;
+      this->m_lock.unLock();
+      if (submitting == 0) {
+        break;
+      }
+      (void) Os::Task::delay(1);
+    }
+
+    // Wake the completion task. If the queue is full, the completions
+    // of the requests in flight wake it instead
+    Os::AsyncIo::Request wake;
+    wake.operation = Os::AsyncIo::NOP;
+    wake.file = NULL;
+    wake.buffer = NULL;
+    wake.size = 0;
+    wake.offset = 0;
+    wake.context = WAKE_CONTEXT;
+    (void) this->m_asyncIo.submit(wake);
+
+    const Os::Task::TaskStatus taskStatus = this->m_task.join(NULL);
+    FW_ASSERT(Os::Task::TASK_OK == taskStatus, taskStatus);
+    this->m_asyncIo.stop();
+    this->m_lock.lock();
+    this->m_started = false;
+    this->m_lock.unLock();
+  }
+
+  AsyncFileIoImpl ::
+    ~AsyncFileIoImpl(void)
+  {
+    this->stop();
+  }
+
+  // ----------------------------------------------------------------------
+  // Handler implementations for user-defined typed input ports
+  // ----------------------------------------------------------------------
+
+  FileIoRequestStatus AsyncFileIoImpl ::
+    request_handler(
+        const NATIVE_INT_TYPE portNum,
+        FileIoOperation operation,
+        U64 file,
+        Fw::Buffer &buffer,
+        U64 offset,
+        U32 context
+    )
+  {
+    Os::AsyncIo::Request request;
+    switch (operation) {
+      case FILE_IO_READ:
+        request.operation = Os::AsyncIo::READ;
+        break;
+      case FILE_IO_WRITE:
+        request.operation = Os::AsyncIo::WRITE;
+        break;
+      case FILE_IO_FSYNC:
+        request.operation = Os::AsyncIo::FSYNC;
+        break;
+      default:
+        return FILE_IO_BAD_REQUEST;
+    }
+    request.file = reinterpret_cast<Os::File*>(static_cast<POINTER_CAST>(file));
+    request.buffer = reinterpret_cast<void*>(static_cast<POINTER_CAST>(buffer.getdata()));
+    request.size = buffer.getsize();
+    request.offset = offset;
+
+    this->m_lock.lock();
+    if (this->m_quit or not this->m_started) {
+      this->m_lock.unLock();
+      return FILE_IO_NOT_STARTED;
+    }
+    const NATIVE_UINT_TYPE index = this->findFree();
+    if (index == ASYNC_IO_MAX_DEPTH) {
+      ++this->m_refused;
+      this->m_lock.unLock();
+      return FILE_IO_BUSY;
+    }
+    // Claim the entry before submitting, since the completion may
+    // arrive before submit returns
+    Pending& pending = this->m_pending[index];
+    pending.m_inUse = true;
+    pending.m_client = portNum;
+    pending.m_buffer = buffer;
+    pending.m_context = context;
+    ++this->m_submitting;
+    this->m_lock.unLock();
+
+    request.context = index;
+    const Os::AsyncIo::Status status = this->m_asyncIo.submit(request);
+    if (status == Os::AsyncIo::OP_OK) {
+      this->m_lock.lock();
+      --this->m_submitting;
+      this->m_lock.unLock();
+      return FILE_IO_SUBMITTED;
+    }
+
+    this->m_lock.lock();
+    --this->m_submitting;
+    pending.m_inUse = false;
+    ++this->m_refused;
+    this->m_lock.unLock();
+    switch (status) {
+      case Os::AsyncIo::QUEUE_FULL:
+        return FILE_IO_BUSY;
+      case Os::AsyncIo::NOT_STARTED:
+        return FILE_IO_NOT_STARTED;
+      default:
+        return FILE_IO_BAD_REQUEST;
+    }
+  }
+
+  void AsyncFileIoImpl ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    this->m_lock.lock();
+    const U32 completed = this->m_completed;
+    const U32 errors = this->m_errors;
+    const U32 refused = this->m_refused;
+    const U64 bytes = this->m_bytes;
+    this->m_lock.unLock();
+
+    this->tlmWrite_AFIO_InFlight(this->m_asyncIo.getInFlight());
+    this->tlmWrite_AFIO_Completed(completed);
+    this->tlmWrite_AFIO_Errors(errors);
+    this->tlmWrite_AFIO_Refused(refused);
+    this->tlmWrite_AFIO_BytesTransferred(bytes);
+  }
+
+  // ----------------------------------------------------------------------
+  // Private helper methods
+  // ----------------------------------------------------------------------
+
+  void AsyncFileIoImpl ::
+    completionTask(void* ptr)
+  {
+    FW_ASSERT(ptr);
+    AsyncFileIoImpl* const comp = static_cast<AsyncFileIoImpl*>(ptr);
+    Os::AsyncIo::Completion completions[ASYNC_FILE_IO_REAP_BATCH];
+    while (true) {
+      const NATIVE_UINT_TYPE count =
+        comp->m_asyncIo.reap(completions, ASYNC_FILE_IO_REAP_BATCH, true);
+      for (NATIVE_UINT_TYPE i = 0; i < count; ++i) {
+        comp->deliver(completions[i]);
+      }
+      comp->m_lock.lock();
+      const bool quit = comp->m_quit and (comp->m_submitting == 0);
+      comp->m_lock.unLock();
+      if (quit and (comp->m_asyncIo.getInFlight() == 0)) {
+        break;
+      }
+    }
+  }
+
+  void AsyncFileIoImpl ::
+    deliver(const Os::AsyncIo::Completion& completion)
+  {
+    if (completion.request.context == WAKE_CONTEXT) {
+      return;
+    }
+    const NATIVE_UINT_TYPE index = completion.request.context;
+    FW_ASSERT(index < ASYNC_IO_MAX_DEPTH, index);
+
+    this->m_lock.lock();
+    Pending& entry = this->m_pending[index];
+    FW_ASSERT(entry.m_inUse, index);
+    const NATIVE_INT_TYPE client = entry.m_client;
+    Fw::Buffer buffer = entry.m_buffer;
+    const U32 context = entry.m_context;
+    entry.m_inUse = false;
+    ++this->m_completed;
+    if (completion.status != Os::File::OP_OK) {
+      ++this->m_errors;
+    }
+    else {
+      this->m_bytes += completion.size;
+    }
+    this->m_lock.unLock();
+
+    if (completion.status != Os::File::OP_OK) {
+      this->log_WARNING_LO_AFIO_IoError(client, context, completion.status);
+    }
+    if (this->isConnected_complete_OutputPort(client)) {
+      this->complete_out(
+          client,
+          buffer,
+          completion.status,
+          completion.size,
+          context
+      );
+    }
+  }
+
+  NATIVE_UINT_TYPE AsyncFileIoImpl ::
+    findFree(void)
+  {
+    NATIVE_UINT_TYPE index = 0;
+    while (index < ASYNC_IO_MAX_DEPTH and this->m_pending[index].m_inUse) {
+      ++index;
+    }
+    return index;
+  }
+
+}
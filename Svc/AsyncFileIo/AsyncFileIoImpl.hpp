@@ -0,0 +1,194 @@
+// ====================================================================== 
+// \title  AsyncFileIoImpl.hpp
+// \brief  hpp file for AsyncFileIo component implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef Svc_AsyncFileIoImpl_HPP
+#define Svc_AsyncFileIoImpl_HPP
+
+#include "Svc/AsyncFileIo/AsyncFileIoComponentAc.hpp"
+#include "Svc/AsyncFileIo/AsyncFileIoImplCfg.hpp"
+#include "Os/AsyncIo.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/Task.hpp"
+
+namespace Svc {
+
+  //! \class AsyncFileIoImpl
+  //! \brief A service that runs file operations for other components
+  //!
+  //! Clients request reads, writes, and syncs of open files on the
+  //! request port and return at once. The operations run on an
+  //! Os::AsyncIo, which uses io_uring when the kernel has it and a
+  //! pool of worker tasks otherwise. A completion task calls the
+  //! client back on the complete port with the same port number.
+  class AsyncFileIoImpl :
+    public AsyncFileIoComponentBase
+  {
+
+    PRIVATE:
+
+      //! \class Pending
+      //! \brief A request waiting for its completion
+      class Pending {
+
+        public:
+
+          //! Construct a Pending
+          Pending(void) :
+            m_inUse(false),
+            m_client(0),
+            m_context(0)
+          {
+
+          }
+
+        public:
+
+          //! Whether the entry holds a request
+          bool m_inUse;
+
+          //! The client port number
+          NATIVE_INT_TYPE m_client;
+
+          //! The buffer of the request
+          Fw::Buffer m_buffer;
+
+          //! The client context
+          U32 m_context;
+
+      };
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Construction, initialization, and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct an AsyncFileIo
+      AsyncFileIoImpl(
+#if FW_OBJECT_NAMES == 1
+          const char* compName //!< The component name
+#else
+          void
+#endif
+      );
+
+      //! Initialize an AsyncFileIo
+      void init(
+          const NATIVE_INT_TYPE instance = 0 //!< The instance number
+      );
+
+      //! Start the service and its completion task.
+      //! Requests are refused until this is called.
+      void start(
+          const NATIVE_INT_TYPE identifier, //!< The identifier of the completion task
+          const NATIVE_INT_TYPE priority, //!< The priority of the completion task and workers
+          const NATIVE_INT_TYPE stackSize, //!< The stack size of the completion task and workers
+          const NATIVE_UINT_TYPE depth, //!< The maximum number of requests in flight, up to ASYNC_IO_MAX_DEPTH
+          const NATIVE_UINT_TYPE workers, //!< The number of worker tasks if io_uring is not used
+          const bool useIoUring = true //!< Whether to try io_uring first
+      );
+
+      //! Stop the service.
+      //! Waits until the requests in flight have been completed to
+      //! their clients, then stops the completion task.
+      void stop(void);
+
+      //! Destroy an AsyncFileIo
+      ~AsyncFileIoImpl(void);
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Handler implementations for input ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for input port request
+      FileIoRequestStatus request_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          FileIoOperation operation, //!< The operation
+          U64 file, //!< A pointer to the open Os::File
+          Fw::Buffer &buffer, //!< The data or space for the transfer
+          U64 offset, //!< The file offset of the transfer
+          U32 context //!< The client context
+      );
+
+      //! Handler for input port schedIn
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          NATIVE_UINT_TYPE context //!< The call order
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Private helper methods
+      // ----------------------------------------------------------------------
+
+      //! The completion task. Reaps completions and calls the clients back
+      static void completionTask(
+          void* ptr //!< The component
+      );
+
+      //! Call a client back with a completion
+      void deliver(
+          const Os::AsyncIo::Completion& completion //!< The completion
+      );
+
+      //! Find an unused pending entry
+      //! \return The index of the entry, or ASYNC_IO_MAX_DEPTH if there is none
+      NATIVE_UINT_TYPE findFree(void);
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Private member variables
+      // ----------------------------------------------------------------------
+
+      //! The requests waiting for completions, indexed by the Os::AsyncIo context
+      Pending m_pending[ASYNC_IO_MAX_DEPTH];
+
+      //! Guards the pending entries and the counters
+      Os::Mutex m_lock;
+
+      //! The asynchronous I/O backend
+      Os::AsyncIo m_asyncIo;
+
+      //! The completion task
+      Os::Task m_task;
+
+      //! Whether the completion task is running
+      bool m_started;
+
+      //! Tells the completion task to exit once nothing is in flight,
+      //! and refuses new requests
+      bool m_quit;
+
+      //! The number of requests that have claimed an entry but have not
+      //! returned from Os::AsyncIo::submit
+      NATIVE_UINT_TYPE m_submitting;
+
+      //! The number of requests completed
+      U32 m_completed;
+
+      //! The number of requests completed with an error
+      U32 m_errors;
+
+      //! The number of requests refused at submission
+      U32 m_refused;
+
+      //! The number of bytes read and written
+      U64 m_bytes;
+
+  };
+
+}
+
+#endif
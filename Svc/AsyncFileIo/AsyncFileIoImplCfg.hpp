@@ -0,0 +1,16 @@
+/*
+ * AsyncFileIoImplCfg.hpp
+ *
+ *  Configuration for the AsyncFileIo component
+ */
+
+#ifndef ASYNCFILEIO_ASYNCFILEIOIMPLCFG_HPP_
+#define ASYNCFILEIO_ASYNCFILEIOIMPLCFG_HPP_
+
+// Define configuration values for the file I/O service
+
+enum {
+    ASYNC_FILE_IO_REAP_BATCH = 8, // !< The most completions the completion task collects per wakeup
+};
+
+#endif /* ASYNCFILEIO_ASYNCFILEIOIMPLCFG_HPP_ */
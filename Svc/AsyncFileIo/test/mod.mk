@@ -0,0 +1,11 @@
+#
+#   Copyright 2015, by the California Institute of Technology.
+#   ALL RIGHTS RESERVED. United States Government Sponsorship
+#   acknowledged.
+#
+#
+
+
+# There are some standard files that are included for reference
+
+SUBDIRS = ut
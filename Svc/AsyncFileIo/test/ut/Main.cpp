@@ -0,0 +1,30 @@
+// ----------------------------------------------------------------------
+// Main.cpp 
+// ----------------------------------------------------------------------
+
+#include "Tester.hpp"
+
+TEST(Test, readWriteIoUring) {
+  Svc::Tester tester;
+  tester.readWrite(true);
+}
+
+TEST(Test, readWriteThreadPool) {
+  Svc::Tester tester;
+  tester.readWrite(false);
+}
+
+TEST(Test, refused) {
+  Svc::Tester tester;
+  tester.refused();
+}
+
+TEST(Test, ioError) {
+  Svc::Tester tester;
+  tester.ioError();
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
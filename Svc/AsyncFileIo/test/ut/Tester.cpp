@@ -0,0 +1,266 @@
+// ====================================================================== 
+// \title  Tester.cpp
+// \brief  cpp file for AsyncFileIo test harness implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include "Tester.hpp"
+#include <string.h>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 100
+#define DEPTH 8
+#define WORKERS 2
+#define NUM_CLIENTS 4
+#define FILE_NAME "AsyncFileIoTest.bin"
+
+namespace Svc {
+
+  namespace {
+
+    U8 writeData[Tester::NUM_BLOCKS][Tester::BLOCK_SIZE];
+    U8 readData[Tester::NUM_BLOCKS][Tester::BLOCK_SIZE];
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction 
+  // ----------------------------------------------------------------------
+
+  Tester ::
+    Tester(void) : 
+#if FW_OBJECT_NAMES == 1
+      AsyncFileIoGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("AsyncFileIo")
+#else
+      AsyncFileIoGTestBase(MAX_HISTORY_SIZE),
+      component()
+#endif
+  {
+    this->connectPorts();
+    this->initComponents();
+    for (NATIVE_UINT_TYPE i = 0; i < NUM_BLOCKS; ++i) {
+      this->m_clients[i] = -1;
+      memset(writeData[i], i + 1, BLOCK_SIZE);
+      memset(readData[i], 0, BLOCK_SIZE);
+    }
+  }
+
+  Tester ::
+    ~Tester(void) 
+  {
+    this->component.stop();
+    this->m_file.close();
+  }
+
+  // ----------------------------------------------------------------------
+  // Tests 
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    readWrite(const bool useIoUring) 
+  {
+    ASSERT_EQ(Os::File::OP_OK, this->m_file.open(FILE_NAME, Os::File::OPEN_WRITE));
+    this->component.start(0, 0, 0, DEPTH, WORKERS, useIoUring);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_AFIO_Started_SIZE(1);
+    if (not useIoUring) {
+      ASSERT_EVENTS_AFIO_Started(0, AsyncFileIoComponentBase::AFIO_THREAD_POOL);
+    }
+
+    // Write the blocks back to front from several clients, then sync
+    // them. Stopping waits for every completion to be delivered
+    for (U32 block = NUM_BLOCKS; block > 0; --block) {
+      ASSERT_EQ(FILE_IO_SUBMITTED, this->request((block - 1) % NUM_CLIENTS, FILE_IO_WRITE, block - 1));
+    }
+    this->component.stop();
+    this->component.start(0, 0, 0, DEPTH, WORKERS, useIoUring);
+    ASSERT_EQ(FILE_IO_SUBMITTED, this->request(0, FILE_IO_FSYNC, 0));
+    this->component.stop();
+
+    ASSERT_from_complete_SIZE(NUM_BLOCKS + 1);
+    for (U32 i = 0; i < NUM_BLOCKS + 1; ++i) {
+      const FromPortEntry_complete& entry = this->fromPortHistory_complete->at(i);
+      ASSERT_EQ(Os::File::OP_OK, entry.status);
+      if (i < NUM_BLOCKS) {
+        ASSERT_EQ(static_cast<U32>(BLOCK_SIZE), entry.size);
+        ASSERT_EQ(static_cast<NATIVE_INT_TYPE>(entry.context % NUM_CLIENTS), this->m_clients[entry.context]);
+      }
+    }
+
+    // Read the blocks back
+    this->m_file.close();
+    ASSERT_EQ(Os::File::OP_OK, this->m_file.open(FILE_NAME, Os::File::OPEN_READ));
+    this->clearHistory();
+    this->component.start(0, 0, 0, DEPTH, WORKERS, useIoUring);
+    for (U32 block = 0; block < NUM_BLOCKS; ++block) {
+      ASSERT_EQ(FILE_IO_SUBMITTED, this->request(0, FILE_IO_READ, block));
+    }
+    this->component.stop();
+    ASSERT_from_complete_SIZE(NUM_BLOCKS);
+    ASSERT_EQ(0, memcmp(readData, writeData, sizeof(readData)));
+
+    // Telemetry counts the completions across restarts
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_SIZE(5);
+    ASSERT_TLM_AFIO_InFlight(0, 0);
+    ASSERT_TLM_AFIO_Completed(0, NUM_BLOCKS * 2 + 1);
+    ASSERT_TLM_AFIO_Errors(0, 0);
+    ASSERT_TLM_AFIO_BytesTransferred(0, NUM_BLOCKS * BLOCK_SIZE * 2);
+  }
+
+  void Tester ::
+    refused(void) 
+  {
+    ASSERT_EQ(Os::File::OP_OK, this->m_file.open(FILE_NAME, Os::File::OPEN_WRITE));
+    ASSERT_EQ(FILE_IO_NOT_STARTED, this->request(0, FILE_IO_WRITE, 0));
+
+    this->component.start(0, 0, 0, DEPTH, WORKERS);
+    this->m_file.close();
+    ASSERT_EQ(FILE_IO_BAD_REQUEST, this->request(0, FILE_IO_WRITE, 0));
+    ASSERT_EQ(FILE_IO_BAD_REQUEST, this->request(0, FILE_IO_FSYNC, 0));
+    this->component.stop();
+    ASSERT_EQ(FILE_IO_NOT_STARTED, this->request(0, FILE_IO_WRITE, 0));
+    ASSERT_from_complete_SIZE(0);
+
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_AFIO_Refused(0, 2);
+    ASSERT_TLM_AFIO_Completed(0, 0);
+  }
+
+  void Tester ::
+    ioError(void) 
+  {
+    // Reading a file opened for writing fails
+    ASSERT_EQ(Os::File::OP_OK, this->m_file.open(FILE_NAME, Os::File::OPEN_WRITE));
+    this->component.start(0, 0, 0, DEPTH, WORKERS);
+    ASSERT_EQ(FILE_IO_SUBMITTED, this->request(2, FILE_IO_READ, 5));
+    this->component.stop();
+
+    ASSERT_from_complete_SIZE(1);
+    ASSERT_NE(static_cast<U32>(Os::File::OP_OK), this->fromPortHistory_complete->at(0).status);
+    ASSERT_EQ(0U, this->fromPortHistory_complete->at(0).size);
+    ASSERT_EQ(2, this->m_clients[5]);
+    ASSERT_EVENTS_AFIO_IoError_SIZE(1);
+
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_AFIO_Completed(0, 1);
+    ASSERT_TLM_AFIO_Errors(0, 1);
+    ASSERT_TLM_AFIO_BytesTransferred(0, 0);
+  }
+
+  // ----------------------------------------------------------------------
+  // Handlers for typed from ports
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    from_complete_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &buffer,
+        U32 status,
+        U32 size,
+        U32 context
+    )
+  {
+    // Called on the completion task. The test reads the history
+    // only after stopping the component
+    this->pushFromPortEntry_complete(buffer, status, size, context);
+    if (context < NUM_BLOCKS) {
+      this->m_clients[context] = portNum;
+    }
+  }
+
+  // ----------------------------------------------------------------------
+  // Helper methods 
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    connectPorts(void) 
+  {
+
+    // request
+    for (NATIVE_INT_TYPE i = 0; i < NUM_CLIENTS; ++i) {
+      this->connect_to_request(
+          i,
+          this->component.get_request_InputPort(i)
+      );
+    }
+
+    // complete
+    for (NATIVE_INT_TYPE i = 0; i < NUM_CLIENTS; ++i) {
+      this->component.set_complete_OutputPort(
+          i, 
+          this->get_from_complete(i)
+      );
+    }
+
+    // schedIn
+    this->connect_to_schedIn(
+        0,
+        this->component.get_schedIn_InputPort(0)
+    );
+
+    // tlmOut
+    this->component.set_tlmOut_OutputPort(
+        0, 
+        this->get_from_tlmOut(0)
+    );
+
+    // timeCaller
+    this->component.set_timeCaller_OutputPort(
+        0, 
+        this->get_from_timeCaller(0)
+    );
+
+    // logOut
+    this->component.set_logOut_OutputPort(
+        0, 
+        this->get_from_logOut(0)
+    );
+
+    // LogText
+    this->component.set_LogText_OutputPort(
+        0, 
+        this->get_from_LogText(0)
+    );
+
+  }
+
+  void Tester ::
+    initComponents(void) 
+  {
+    this->init();
+    this->component.init(
+        INSTANCE
+    );
+  }
+
+  FileIoRequestStatus Tester ::
+    request(
+        const NATIVE_INT_TYPE client,
+        const FileIoOperation operation,
+        const U32 block
+    )
+  {
+    U8* const data = (FILE_IO_READ == operation) ? readData[block] : writeData[block];
+    Fw::Buffer buffer(0, block, reinterpret_cast<POINTER_CAST>(data), BLOCK_SIZE);
+    FileIoRequestStatus status;
+    do {
+      status = this->invoke_to_request(
+          client,
+          operation,
+          reinterpret_cast<POINTER_CAST>(&this->m_file),
+          buffer,
+          static_cast<U64>(block) * BLOCK_SIZE,
+          block
+      );
+    } while (FILE_IO_BUSY == status);
+    return status;
+  }
+
+} // end namespace Svc
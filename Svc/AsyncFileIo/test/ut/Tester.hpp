@@ -0,0 +1,128 @@
+// ====================================================================== 
+// \title  AsyncFileIo/test/ut/Tester.hpp
+// \brief  hpp file for AsyncFileIo test harness implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "GTestBase.hpp"
+#include "Svc/AsyncFileIo/AsyncFileIoImpl.hpp"
+#include "Os/File.hpp"
+
+namespace Svc {
+
+  class Tester :
+    public AsyncFileIoGTestBase
+  {
+
+    public:
+
+      enum {
+        //! The number of blocks in the test file
+        NUM_BLOCKS = 32,
+        //! The size of a block
+        BLOCK_SIZE = 512
+      };
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object Tester
+      //!
+      Tester(void);
+
+      //! Destroy object Tester
+      //!
+      ~Tester(void);
+
+    public:
+
+      // ---------------------------------------------------------------------- 
+      // Tests
+      // ---------------------------------------------------------------------- 
+
+      //! Blocks written out of order read back in place
+      //!
+      void readWrite(
+          const bool useIoUring //!< Whether to try io_uring
+      );
+
+      //! Requests are refused before start, after stop, and for closed files
+      //!
+      void refused(void);
+
+      //! A failed operation is reported to the client and counted
+      //!
+      void ioError(void);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Handlers for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for from_complete
+      //!
+      void from_complete_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &buffer, /*!< The buffer of the request*/
+          U32 status, /*!< The Os::File::Status of the operation*/
+          U32 size, /*!< The number of bytes transferred*/
+          U32 context /*!< The context of the request*/
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Connect ports
+      //!
+      void connectPorts(void);
+
+      //! Initialize components
+      //!
+      void initComponents(void);
+
+      //! Request an operation on the test file, retrying while the service is busy
+      //! \return The status of the request
+      FileIoRequestStatus request(
+          const NATIVE_INT_TYPE client, //!< The client
+          const FileIoOperation operation, //!< The operation
+          const U32 block //!< The block to transfer, also used as the context
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The component under test
+      //!
+      AsyncFileIoImpl component;
+
+      //! The test file
+      //!
+      Os::File m_file;
+
+      //! The clients that were called back, by context
+      //!
+      NATIVE_INT_TYPE m_clients[NUM_BLOCKS];
+
+  };
+
+} // end namespace Svc
+
+#endif
@@ -26,7 +26,10 @@ namespace Svc {
       BufferLogger() : BufferLoggerComponentBase(),
 #endif
       m_state(LOGGING_ON),
-      m_file(*this)
+      m_file(*this),
+      m_extractPending(false),
+      m_extractOpCode(0),
+      m_extractCmdSeq(0)
   {
 
   }
@@ -50,10 +53,20 @@ namespace Svc {
         const char *const logFilePrefix,
         const char *const logFileSuffix,
         const U32 maxFileSize,
-        const U8 sizeOfSize
+        const U8 sizeOfSize,
+        const bool directWrite,
+        const bool compress
     )
   {
-      m_file.init(logFilePrefix, logFileSuffix, maxFileSize, sizeOfSize);
+      m_file.init(logFilePrefix, logFileSuffix, maxFileSize, sizeOfSize, directWrite, compress);
+  }
+
+  void BufferLogger ::
+    initIndex(
+        const U32 recordsPerEntry
+    )
+  {
+      m_file.initIndex(recordsPerEntry);
   }
 
   // ----------------------------------------------------------------------
@@ -72,6 +85,8 @@ namespace Svc {
       m_file.logBuffer(addr, size);
     }
     this->bufferSendOut_out(0, fwBuffer);
+    // Resume an extraction whose step was dropped from a full queue
+    this->scheduleExtractStep();
   }
 
   void BufferLogger ::
@@ -86,6 +101,8 @@ namespace Svc {
       const U32 size = data.getBuffLength();
       m_file.logBuffer(addr, size);
     }
+    // Resume an extraction whose step was dropped from a full queue
+    this->scheduleExtractStep();
   }
 
   void BufferLogger ::
@@ -103,6 +120,23 @@ namespace Svc {
     // TODO
   }
 
+  // ----------------------------------------------------------------------
+  // Internal interface handler implementations
+  // ----------------------------------------------------------------------
+
+  void BufferLogger ::
+    extractStep_internalInterfaceHandler(void)
+  {
+    m_extractPending = false;
+    // The range may have been finished while this message was queued
+    if (!m_file.isExtracting()) {
+      return;
+    }
+    if (this->extractRange()) {
+      this->scheduleExtractStep();
+    }
+  }
+
   // ----------------------------------------------------------------------
   // Command handler implementations
   // ----------------------------------------------------------------------
@@ -115,6 +149,8 @@ namespace Svc {
         const Fw::CmdStringArg& file
     )
   {
+    // The range being extracted is in the files of the current base name
+    this->finishExtractRange();
     m_file.setBaseName(file);
     this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
   }
@@ -160,4 +196,84 @@ namespace Svc {
     }
   }
 
+  void BufferLogger ::
+    BL_ExtractRange_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        RangeKind kind,
+        U32 start,
+        U32 end,
+        const Fw::CmdStringArg& file
+    )
+  {
+    if (!m_file.isIndexed()) {
+      this->log_WARNING_HI_BL_NoIndexError();
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+      return;
+    }
+    if (m_file.isExtracting()) {
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_BUSY);
+      return;
+    }
+    const Os::File::Status status =
+      m_file.startExtract(kind, start, end, file.toChar());
+    if (status != Os::File::OP_OK) {
+      Fw::LogStringArg logStringArg(file.toChar());
+      this->log_WARNING_HI_BL_RangeExtractError(status, logStringArg);
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+      return;
+    }
+    // The command is answered when the range is finished
+    m_extractOpCode = opCode;
+    m_extractCmdSeq = cmdSeq;
+    m_extractFile = file.toChar();
+    this->scheduleExtractStep();
+  }
+
+  // ----------------------------------------------------------------------
+  // Private helper functions
+  // ----------------------------------------------------------------------
+
+  void BufferLogger ::
+    scheduleExtractStep(void)
+  {
+    if (!m_file.isExtracting() || m_extractPending) {
+      return;
+    }
+    // A message that does not fit in the queue is dropped. The next
+    // buffer schedules the step again
+    const NATIVE_INT_TYPE dropped = this->getNumMsgsDropped();
+    this->extractStep_internalInterfaceInvoke();
+    m_extractPending = (this->getNumMsgsDropped() == dropped);
+  }
+
+  bool BufferLogger ::
+    extractRange(void)
+  {
+    bool done = false;
+    const Os::File::Status status = m_file.extractStep(done);
+    if (status == Os::File::OP_OK && !done) {
+      return true;
+    }
+    const U32 records = m_file.finishExtract(status);
+    Fw::LogStringArg logStringArg(m_extractFile.toChar());
+    if (status == Os::File::OP_OK) {
+      this->log_ACTIVITY_HI_BL_RangeExtracted(records, logStringArg);
+      this->cmdResponse_out(m_extractOpCode, m_extractCmdSeq, Fw::COMMAND_OK);
+    }
+    else {
+      this->log_WARNING_HI_BL_RangeExtractError(status, logStringArg);
+      this->cmdResponse_out(m_extractOpCode, m_extractCmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+    }
+    return false;
+  }
+
+  void BufferLogger ::
+    finishExtractRange(void)
+  {
+    while (m_file.isExtracting()) {
+      (void) this->extractRange();
+    }
+  }
+
 };
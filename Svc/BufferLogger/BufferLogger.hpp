@@ -15,10 +15,13 @@
 
 #include "Svc/BufferLogger/BufferLoggerComponentAc.hpp"
 #include "Os/File.hpp"
+#include "Os/DirectWriter.hpp"
 #include "Fw/Types/EightyCharString.hpp"
 #include "Fw/Types/Assert.hpp"
 #include "Os/Mutex.hpp"
 #include "Utils/Hash/Hash.hpp"
+#include "Utils/Lz/LzEncoder.hpp"
+#include "Svc/BufferLogger/BufferLoggerCfg.hpp"
 
 namespace Svc {
 
@@ -62,7 +65,14 @@ namespace Svc {
               const char *const prefix, //!< The file name prefix
               const char *const suffix, //!< The file name suffix
               const U32 maxSize, //!< The maximum file size
-              const U8 sizeOfSize //!< The number of bytes to use when storing the size field and the start of each buffer)
+              const U8 sizeOfSize, //!< The number of bytes to use when storing the size field and the start of each buffer)
+              const bool directWrite, //!< Whether to write through an Os::DirectWriter
+              const bool compress //!< Whether to write a Utils::Lz stream
+          );
+
+          //! Set up the index written alongside each file
+          void initIndex(
+              const U32 recordsPerEntry //!< The most records between index entries. Zero turns the index off
           );
 
           //! Set base file name
@@ -82,6 +92,39 @@ namespace Svc {
           //! Flush the file
           bool flush(void);
 
+          //! Start copying a range of the records logged since the base name was set to
+          //! a new file. The records are copied by extractStep, from the files opened
+          //! before this call
+          //! \return The status of opening the new file
+          Os::File::Status startExtract(
+              const RangeKind kind, //!< Whether start and end are sequence numbers or seconds
+              const U32 start, //!< The start of the range
+              const U32 end, //!< The end of the range, inclusive
+              const char *const fileName //!< The file to write the records to
+          );
+
+          //! Copy the next records of the range, examining at most
+          //! BUFFERLOGGER_EXTRACT_RECORDS_PER_STEP of them
+          //! \return The status of the first failed file operation. The range is
+          //! finished if it is not OP_OK or done is set
+          Os::File::Status extractStep(
+              bool& done //!< Set when the range is finished
+          );
+
+          //! End the extraction, writing the hash file of the new file if it is complete
+          //! \return The number of records copied
+          U32 finishExtract(
+              const Os::File::Status status //!< The status of the extraction
+          );
+
+          //! Whether a range is being extracted
+          bool isExtracting(void) const {
+            return this->extraction.active;
+          }
+
+          //! Whether the files are indexed
+          bool isIndexed(void) const;
+
         PRIVATE:
 
           //! Open the file
@@ -94,22 +137,66 @@ namespace Svc {
               const U32 size //!< The number of bytes to write
           );
 
-          //! Write the size field of a buffer
+          //! Serialize the size field of a buffer
+          void serializeSize(
+              const U32 size, //!< The size
+              U8 *const sizeBuffer //!< The buffer to hold the size field. Must hold sizeOfSize bytes
+          );
+
+          //! Stage buffers for compression, writing out each frame that fills
           //! \return Success or failure
-          bool writeSize(
-              const U32 size //!< The size
+          bool stageBytes(
+              const Os::File::IoVector *const vectors, //!< The buffers
+              const NATIVE_INT_TYPE count //!< The number of buffers
           );
 
-          //! Write bytes to a file
+          //! Compress the staged bytes and write the frame to the file
+          //! \return Success or failure
+          bool writeStage(void);
+
+          //! Write buffers to a file with one call
           //! \return Success or failure
           bool writeBytes(
-              const void *const data, //!< The data
-              const U32 length //!< The number of bytes to write
+              const Os::File::IoVector *const vectors, //!< The buffers
+              const NATIVE_INT_TYPE count //!< The number of buffers
           );
 
           //! Write a hash file
           void writeHashFile(void);
 
+          //! Format the name of a file with the current base name
+          void formatName(
+              const NATIVE_UINT_TYPE counter, //!< The unique counter value
+              Fw::EightyCharString& fileName //!< The file name
+          );
+
+          //! Open the index of the current file
+          void openIndex(void);
+
+          //! Add an index entry for the next record if it is due
+          void indexRecord(void);
+
+          //! Write the buffered index entries to the index file
+          //! \return Success or failure
+          bool writeIndexEntries(void);
+
+          //! Open the next log file of the range being extracted and find the index
+          //! entry to start from
+          //! \return The status of the first failed file operation
+          Os::File::Status openExtractFile(
+              bool& opened //!< Set if the file has records to examine. Files without an index are skipped
+          );
+
+          //! Copy the next record of the log file being extracted if it is in the range
+          //! \return The status of the first failed file operation
+          Os::File::Status extractRecord(
+              bool& fileDone, //!< Set when the file has no more records
+              bool& rangeDone //!< Set when the range ends in this file
+          );
+
+          //! Close the log file being extracted and its index
+          void closeExtractFile(void);
+
           //! Close the file
           void close(void);
 
@@ -142,12 +229,107 @@ namespace Svc {
           // The current mode
           Mode::t mode;
 
+          //! Whether the file is written through directFile
+          bool directWrite;
+
           //! The underlying Os::File representation
           Os::File osFile;
 
+          //! The direct writer, used instead of osFile when directWrite is set
+          Os::DirectWriter directFile;
+
           //! The number of bytes written to the current file
           U32 bytesWritten;
 
+          //! The hash of the data handed to the current file
+          Utils::Hash hash;
+
+          //! Whether the file is written as a Utils::Lz stream
+          bool compress;
+
+          //! The compressor
+          Utils::LzEncoder encoder;
+
+          //! The bytes waiting to be compressed into the next frame
+          U8 stage[Utils::Lz::LZ_FRAME_DATA_SIZE];
+
+          //! The number of bytes in stage
+          U32 stageUsed;
+
+          //! The compressed frame
+          U8 frame[Utils::Lz::LZ_FRAME_HEADER_SIZE + Utils::Lz::LZ_FRAME_DATA_SIZE];
+
+          //! An entry of the index written alongside each file
+          struct IndexEntry {
+            U32 sequence; //!< The sequence number of the record
+            U32 seconds; //!< The time the record was logged
+            U32 useconds; //!< The time the record was logged
+            U32 offset; //!< The offset of the record in the file
+          };
+
+          //! The most records between index entries, or zero for no index
+          U32 recordsPerEntry;
+
+          //! The sequence number of the next record, counted from setBaseName
+          U32 sequence;
+
+          //! The number of records since the last index entry
+          U32 recordsSinceEntry;
+
+          //! The time of the last index entry, in seconds
+          U32 entrySeconds;
+
+          //! The name of the index of the current file
+          Fw::EightyCharString indexName;
+
+          //! The index of the current file
+          Os::File indexFile;
+
+          //! Whether indexFile is open
+          bool indexOpen;
+
+          //! The index entries not yet written to indexFile
+          IndexEntry indexEntries[BUFFERLOGGER_INDEX_BUFFER_ENTRIES];
+
+          //! The number of entries in indexEntries
+          NATIVE_UINT_TYPE numIndexEntries;
+
+          //! The state of a range extraction, kept between extractStep calls
+          struct Extraction {
+            Extraction(void) :
+              active(false), kind(BY_SEQUENCE), start(0), end(0), records(0),
+              fileCount(0), counter(0), fileOpen(false), sizeOfSize(0), fileSize(0),
+              offset(0), sequence(0), seconds(0),
+              haveNext(false), nextSequence(0), nextSeconds(0), nextOffset(0)
+            { }
+            bool active; //!< Whether a range is being extracted
+            RangeKind kind; //!< Whether start and end are sequence numbers or seconds
+            U32 start; //!< The start of the range
+            U32 end; //!< The end of the range, inclusive
+            Fw::EightyCharString outName; //!< The name of the file the records are copied to
+            Os::File outFile; //!< The file the records are copied to
+            Utils::Hash hash; //!< The hash of outFile
+            U32 records; //!< The number of records copied
+            NATIVE_UINT_TYPE fileCount; //!< The number of log files when the extraction started
+            NATIVE_UINT_TYPE counter; //!< The counter value of the next log file
+            bool fileOpen; //!< Whether a log file is being examined
+            Fw::EightyCharString inName; //!< The name of the log file
+            Os::File inFile; //!< The log file
+            Os::File indexFile; //!< The index of the log file
+            U8 sizeOfSize; //!< The size of the record size fields of the log file
+            U64 fileSize; //!< The number of bytes of records in the log file
+            U32 offset; //!< The offset of the next record
+            U32 sequence; //!< The sequence number of the next record
+            U32 seconds; //!< The time of the next record, in seconds
+            bool haveNext; //!< Whether the next index entry was read
+            U32 nextSequence; //!< The sequence number of the next index entry
+            U32 nextSeconds; //!< The time of the next index entry, in seconds
+            U32 nextOffset; //!< The offset of the next index entry
+          };
+
+          //! The range being extracted
+          Extraction extraction;
+
       }; // class File
 
     public:
@@ -178,9 +360,31 @@ namespace Svc {
           const char *const logFilePrefix, //!< The log file name prefix
           const char *const logFileSuffix, //!< The log file name suffix
           const U32 maxFileSize, //!< The maximum file size
-          const U8 sizeOfSize //!< The number of bytes to use when storing the size field at the start of each buffer
+          const U8 sizeOfSize, //!< The number of bytes to use when storing the size field at the start of each buffer
+          const bool directWrite = false, //!< Write through an Os::DirectWriter, bypassing the page cache and preallocating
+                                          //!< maxFileSize bytes. Buffers are staged until a block fills or BL_FlushFile is sent
+          const bool compress = false //!< Write each file as a Utils::Lz stream. Buffers are staged until a frame fills,
+                                      //!< BL_FlushFile is sent, or the file is closed. Files written this way are not indexed
+      );
+
+      //! Write a sparse index of record offsets and times alongside each log file, for
+      //! BL_ExtractRange. A record gets an entry when it starts a file, when recordsPerEntry
+      //! records have been logged since the last entry, or when the time is in a new second.
+      //! Call before opening a log file
+      void initIndex(
+          const U32 recordsPerEntry //!< The most records between index entries
       );
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Internal interface handler implementations
+      // ----------------------------------------------------------------------
+
+      //! Handler implementation for extractStep
+      //!
+      void extractStep_internalInterfaceHandler(void);
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -252,6 +456,34 @@ namespace Svc {
           const U32 cmdSeq /*!< The command sequence number*/
       );
 
+      //! Implementation for BL_ExtractRange command handler
+      //! Copy a range of records to a new file
+      void BL_ExtractRange_cmdHandler(
+          const FwOpcodeType opCode, /*!< The opcode*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          RangeKind kind, /*!< Whether start and end are sequence numbers or seconds*/
+          U32 start, /*!< The start of the range*/
+          U32 end, /*!< The end of the range*/
+          const Fw::CmdStringArg& file /*!< The file to write the records to*/
+      );
+
+  PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Private helper functions
+      // ----------------------------------------------------------------------
+
+      //! Queue an extractStep message if a range is being extracted and none is queued
+      void scheduleExtractStep(void);
+
+      //! Copy the next records of the range being extracted, and respond to
+      //! BL_ExtractRange when the range is finished
+      //! \return Whether more of the range remains
+      bool extractRange(void);
+
+      //! Copy the rest of the range being extracted
+      void finishExtractRange(void);
+
   PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -264,6 +496,18 @@ namespace Svc {
       //! The file
       File m_file;
 
+      //! Whether an extractStep message is queued
+      bool m_extractPending;
+
+      //! The opcode of the BL_ExtractRange command being executed
+      FwOpcodeType m_extractOpCode;
+
+      //! The sequence number of the BL_ExtractRange command being executed
+      U32 m_extractCmdSeq;
+
+      //! The file named by the BL_ExtractRange command being executed
+      Fw::EightyCharString m_extractFile;
+
   };
 
 }
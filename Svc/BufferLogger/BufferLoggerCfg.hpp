@@ -0,0 +1,21 @@
+/*
+ * BufferLoggerCfg.hpp
+ *
+ *  Configuration for the BufferLogger component
+ */
+
+#ifndef BUFFERLOGGER_BUFFERLOGGERCFG_HPP_
+#define BUFFERLOGGER_BUFFERLOGGERCFG_HPP_
+
+// Anonymous namespace for configuration parameters
+namespace {
+
+    enum {
+        BUFFERLOGGER_INDEX_BUFFER_ENTRIES = 16, // !< Index entries held in memory before they are written to the index file
+        BUFFERLOGGER_EXTRACT_CHUNK_SIZE = 1024, // !< Size of the buffer records are copied through by BL_ExtractRange
+        BUFFERLOGGER_EXTRACT_RECORDS_PER_STEP = 8 // !< Records examined by BL_ExtractRange per extractStep message
+    };
+
+}
+
+#endif /* BUFFERLOGGER_BUFFERLOGGERCFG_HPP_ */
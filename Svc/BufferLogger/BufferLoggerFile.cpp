@@ -13,6 +13,7 @@
 #include "Svc/BufferLogger/BufferLogger.hpp"
 #include "Os/ValidateFile.hpp"
 #include "Os/ValidatedFile.hpp"
+#include <string.h>
 
 namespace Svc {
 
@@ -32,7 +33,16 @@ namespace Svc {
       maxSize(0),
       sizeOfSize(0),
       mode(Mode::CLOSED),
-      bytesWritten(0)
+      directWrite(false),
+      bytesWritten(0),
+      compress(false),
+      stageUsed(0),
+      recordsPerEntry(0),
+      sequence(0),
+      recordsSinceEntry(0),
+      entrySeconds(0),
+      indexOpen(false),
+      numIndexEntries(0)
   {
   }
 
@@ -51,7 +61,9 @@ namespace Svc {
         const char *const logFilePrefix,
         const char *const logFileSuffix,
         const U32 maxFileSize,
-        const U8 sizeOfSize
+        const U8 sizeOfSize,
+        const bool directWrite,
+        const bool compress
     )
   {
       //NOTE(mereweth) - only call this before opening the file
@@ -61,6 +73,8 @@ namespace Svc {
       this->suffix = logFileSuffix;
       this->maxSize = maxFileSize;
       this->sizeOfSize = sizeOfSize;
+      this->directWrite = directWrite;
+      this->compress = compress;
 
       FW_ASSERT(sizeOfSize <= sizeof(U32), sizeOfSize);
       FW_ASSERT(maxSize > sizeOfSize, maxSize);
@@ -76,6 +90,7 @@ namespace Svc {
       }
       this->baseName = baseName;
       this->fileCounter = 0;
+      this->sequence = 0;
       this->open();
   }
 
@@ -85,9 +100,12 @@ namespace Svc {
         const U32 size
     )
   {
-    // Close the file if it will be too big
+    // Close the file if it will be too big. Staged bytes and the buffer
+    // may not compress at all
     if (this->mode == File::Mode::OPEN) {
-      const U32 projectedByteCount =
+      const U32 projectedByteCount = this->compress ?
+        this->bytesWritten +
+          Utils::LzEncoder::bound(this->stageUsed + this->sizeOfSize + size) :
         this->bytesWritten + this->sizeOfSize + size;
       if (projectedByteCount > this->maxSize) {
         this->closeAndEmitEvent();
@@ -99,7 +117,12 @@ namespace Svc {
     }
     // Write to the file if it is open
     if (this->mode == File::Mode::OPEN) {
-      (void) this->writeBuffer(data, size);
+      if (this->indexOpen) {
+        this->indexRecord();
+      }
+      if (this->writeBuffer(data, size)) {
+        ++this->sequence;
+      }
     }
   }
 
@@ -130,32 +153,29 @@ namespace Svc {
         return;
     }
 
-    if (this->fileCounter == 0) {
-        this->name.format(
-            "%s%s%s",
-            this->prefix.toChar(),
-            this->baseName.toChar(),
-            this->suffix.toChar()
-        );
+    this->formatName(this->fileCounter, this->name);
+
+    Os::File::Status status;
+    if (this->directWrite) {
+      status = this->directFile.open(this->name.toChar(), this->maxSize);
     }
     else {
-        this->name.format(
-            "%s%s%d%s",
-            this->prefix.toChar(),
-            this->baseName.toChar(),
-            this->fileCounter,
-            this->suffix.toChar()
-        );
+      status = this->osFile.open(
+          this->name.toChar(),
+          Os::File::OPEN_WRITE
+      );
     }
-
-    const Os::File::Status status = this->osFile.open(
-        this->name.toChar(),
-        Os::File::OPEN_WRITE
-    );
     if (status == Os::File::OP_OK) {
       this->fileCounter++;
       // Reset bytes written
       this->bytesWritten = 0;
+      this->stageUsed = 0;
+      // Start the hash of the file contents
+      this->hash.init();
+      // Start the index
+      if (this->isIndexed()) {
+        this->openIndex();
+      }
       // Set mode
       this->mode = File::Mode::OPEN;
     }
@@ -165,46 +185,126 @@ namespace Svc {
     }
   }
 
+  void BufferLogger::File ::
+    formatName(
+        const NATIVE_UINT_TYPE counter,
+        Fw::EightyCharString& fileName
+    )
+  {
+    if (counter == 0) {
+        fileName.format(
+            "%s%s%s",
+            this->prefix.toChar(),
+            this->baseName.toChar(),
+            this->suffix.toChar()
+        );
+    }
+    else {
+        fileName.format(
+            "%s%s%d%s",
+            this->prefix.toChar(),
+            this->baseName.toChar(),
+            counter,
+            this->suffix.toChar()
+        );
+    }
+  }
+
   bool BufferLogger::File ::
     writeBuffer(
         const U8 *const data,
         const U32 size
     )
   {
-    bool status = this->writeSize(size);
-    if (status) {
-      status = this->writeBytes(data, size);
+    // Write the size field and the data with one call
+    U8 sizeBuffer[sizeof(U32)];
+    this->serializeSize(size, sizeBuffer);
+    Os::File::IoVector vectors[2];
+    vectors[0].buffer = sizeBuffer;
+    vectors[0].size = this->sizeOfSize;
+    vectors[1].buffer = const_cast<U8*>(data);
+    vectors[1].size = size;
+    if (this->compress) {
+      return this->stageBytes(vectors, 2);
     }
-    return status;
+    return this->writeBytes(vectors, 2);
   }
 
-  bool BufferLogger::File ::
-    writeSize(const U32 size)
+  void BufferLogger::File ::
+    serializeSize(
+        const U32 size,
+        U8 *const sizeBuffer
+    )
   {
+    FW_ASSERT(this->sizeOfSize <= sizeof(U32), this->sizeOfSize);
     U32 sizeRegister = size;
-    U8 sizeBuffer[this->sizeOfSize];
     for (U8 i = 0; i < this->sizeOfSize; ++i) {
       sizeBuffer[this->sizeOfSize - i - 1] = sizeRegister & 0xFF;
       sizeRegister >>= 8;
     }
-    const bool status = this->writeBytes(
-        sizeBuffer,
-        sizeof(sizeBuffer)
-    );
+  }
+
+  bool BufferLogger::File ::
+    stageBytes(
+        const Os::File::IoVector *const vectors,
+        const NATIVE_INT_TYPE count
+    )
+  {
+    bool status = true;
+    for (NATIVE_INT_TYPE i = 0; i < count; ++i) {
+      const U8* data = static_cast<const U8*>(vectors[i].buffer);
+      U32 remaining = vectors[i].size;
+      // A buffer may fill several frames
+      while (remaining > 0) {
+        const U32 space = sizeof(this->stage) - this->stageUsed;
+        const U32 copy = (remaining < space) ? remaining : space;
+        memcpy(&this->stage[this->stageUsed], data, copy);
+        this->stageUsed += copy;
+        data += copy;
+        remaining -= copy;
+        if (this->stageUsed == sizeof(this->stage)) {
+          status = this->writeStage() && status;
+        }
+      }
+    }
     return status;
   }
 
+  bool BufferLogger::File ::
+    writeStage(void)
+  {
+    if (this->stageUsed == 0) {
+      return true;
+    }
+    Os::File::IoVector vector;
+    vector.buffer = this->frame;
+    vector.size = this->encoder.encode(this->stage, this->stageUsed, this->frame);
+    this->stageUsed = 0;
+    return this->writeBytes(&vector, 1);
+  }
+
   bool BufferLogger::File ::
     writeBytes(
-        const void *const data,
-        const NATIVE_UINT_TYPE length
+        const Os::File::IoVector *const vectors,
+        const NATIVE_INT_TYPE count
     )
   {
+    NATIVE_INT_TYPE length = 0;
+    for (NATIVE_INT_TYPE i = 0; i < count; ++i) {
+      length += vectors[i].size;
+    }
     FW_ASSERT(length > 0, length);
-    NATIVE_INT_TYPE size = length;
-    const Os::File::Status fileStatus = this->osFile.write(data, size);
+    // Hash the data as it is handed to the file, so closing the file
+    // does not read it back
+    for (NATIVE_INT_TYPE i = 0; i < count; ++i) {
+      this->hash.update(vectors[i].buffer, vectors[i].size);
+    }
+    NATIVE_INT_TYPE size = 0;
+    const Os::File::Status fileStatus = this->directWrite ?
+      this->directFile.writev(vectors, count, size) :
+      this->osFile.writev(vectors, count, size);
     bool status;
-    if (fileStatus == Os::File::OP_OK && size == static_cast<NATIVE_INT_TYPE>(length)) {
+    if (fileStatus == Os::File::OP_OK && size == length) {
       this->bytesWritten += length;
       status = true;
     }
@@ -221,8 +321,10 @@ namespace Svc {
     writeHashFile(void)
   {
     Os::ValidatedFile validatedFile(this->name.toChar());
+    Utils::HashBuffer hashBuffer;
+    this->hash.final(hashBuffer);
     const Os::ValidateFile::Status status =
-      validatedFile.createHashFile();
+      validatedFile.createHashFile(hashBuffer);
     if (status !=  Os::ValidateFile::VALIDATION_OK) {
       const Fw::EightyCharString &hashFileName = validatedFile.getHashFileName();
       Fw::LogStringArg logStringArg(hashFileName.toChar());
@@ -236,7 +338,21 @@ namespace Svc {
   bool BufferLogger::File ::
   flush(void)
   {
-    return true;
+    // Staged bytes are compressed into a frame of their own
+    if (this->compress && this->mode == File::Mode::OPEN &&
+        !this->writeStage()) {
+      return false;
+    }
+    // The index holds recent entries in memory
+    bool indexStatus = true;
+    if (this->indexOpen) {
+      indexStatus = this->writeIndexEntries();
+    }
+    // The direct writer stages the last block in memory
+    if (this->directWrite && this->mode == File::Mode::OPEN) {
+      return (this->directFile.flush() == Os::File::OP_OK) && indexStatus;
+    }
+    return indexStatus;
     // NOTE(if your fprime uses buffered file I/O, re-enable this)
     /*bool status = true;
     if(this->mode == File::Mode::OPEN)
@@ -258,8 +374,28 @@ namespace Svc {
     close(void)
   {
     if (this->mode == File::Mode::OPEN) {
+      // Write out the staged bytes
+      if (this->compress) {
+        (void) this->writeStage();
+      }
       // Close file
-      this->osFile.close();
+      if (this->directWrite) {
+        // Write the staged last block
+        const Os::File::Status fileStatus = this->directFile.close();
+        if (fileStatus != Os::File::OP_OK) {
+          Fw::LogStringArg string(this->name.toChar());
+          this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, 0, 0, string);
+        }
+      }
+      else {
+        this->osFile.close();
+      }
+      // Write out the rest of the index
+      if (this->indexOpen) {
+        (void) this->writeIndexEntries();
+        this->indexFile.close();
+        this->indexOpen = false;
+      }
       // Write out the hash file to disk
       this->writeHashFile();
       // Update mode
@@ -0,0 +1,469 @@
+// ======================================================================
+// \title  BufferLoggerIndex.cpp
+// \brief  Index and range extraction for Svc::BufferLogger::BufferLoggerFile
+//
+// \copyright
+// Copyright (C) 2015-2017 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Svc/BufferLogger/BufferLogger.hpp"
+#include "Fw/Types/SerialBuffer.hpp"
+#include "Os/FileSystem.hpp"
+#include "Os/ValidateFile.hpp"
+#include "Os/ValidatedFile.hpp"
+
+namespace Svc {
+
+  namespace {
+
+    //! The index file starts with the magic number, the version, and the
+    //! size of the record size fields. The entries follow, each holding
+    //! the sequence number, seconds, microseconds, and offset of a record
+    enum {
+      INDEX_MAGIC = 0x424C4958, // "BLIX"
+      INDEX_VERSION = 1,
+      INDEX_HEADER_SIZE = sizeof(U32) + 2*sizeof(U8),
+      INDEX_ENTRY_SIZE = 4*sizeof(U32)
+    };
+
+    //! Appended to the name of a log file to name its index
+    const char *const INDEX_SUFFIX = ".idx";
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Public functions
+  // ----------------------------------------------------------------------
+
+  void BufferLogger::File ::
+    initIndex(
+        const U32 recordsPerEntry
+    )
+  {
+    // Only call this before opening the file
+    FW_ASSERT(this->mode == File::Mode::CLOSED);
+    this->recordsPerEntry = recordsPerEntry;
+  }
+
+  bool BufferLogger::File ::
+    isIndexed(void) const
+  {
+    // Offsets in a compressed file do not point at records
+    return this->recordsPerEntry > 0 && !this->compress;
+  }
+
+  Os::File::Status BufferLogger::File ::
+    startExtract(
+        const RangeKind kind,
+        const U32 start,
+        const U32 end,
+        const char *const fileName
+    )
+  {
+    Extraction& extraction = this->extraction;
+    FW_ASSERT(!extraction.active);
+
+    const Os::File::Status status =
+      extraction.outFile.open(fileName, Os::File::OPEN_CREATE);
+    if (status != Os::File::OP_OK) {
+      return status;
+    }
+    extraction.active = true;
+    extraction.kind = kind;
+    extraction.start = start;
+    extraction.end = end;
+    extraction.outName = fileName;
+    extraction.hash.init();
+    extraction.records = 0;
+    // Files opened later hold records logged after the command
+    extraction.fileCount = this->fileCounter;
+    extraction.counter = 0;
+    extraction.fileOpen = false;
+    return Os::File::OP_OK;
+  }
+
+  Os::File::Status BufferLogger::File ::
+    extractStep(
+        bool& done
+    )
+  {
+    Extraction& extraction = this->extraction;
+    FW_ASSERT(extraction.active);
+    done = false;
+
+    // Walk the files in the order they were written, until the range ends
+    for (U32 step = 0; step < BUFFERLOGGER_EXTRACT_RECORDS_PER_STEP; ++step) {
+      Os::File::Status status = Os::File::OP_OK;
+      if (!extraction.fileOpen) {
+        if (extraction.counter >= extraction.fileCount) {
+          done = true;
+          return Os::File::OP_OK;
+        }
+        bool opened = false;
+        status = this->openExtractFile(opened);
+        if (status != Os::File::OP_OK || !opened) {
+          this->closeExtractFile();
+          if (status != Os::File::OP_OK) {
+            return status;
+          }
+          continue;
+        }
+      }
+      bool fileDone = false;
+      bool rangeDone = false;
+      status = this->extractRecord(fileDone, rangeDone);
+      if (status != Os::File::OP_OK) {
+        return status;
+      }
+      if (rangeDone) {
+        done = true;
+        return Os::File::OP_OK;
+      }
+      if (fileDone) {
+        this->closeExtractFile();
+      }
+    }
+    return Os::File::OP_OK;
+  }
+
+  U32 BufferLogger::File ::
+    finishExtract(
+        const Os::File::Status status
+    )
+  {
+    Extraction& extraction = this->extraction;
+    FW_ASSERT(extraction.active);
+    this->closeExtractFile();
+    extraction.outFile.close();
+    extraction.active = false;
+
+    if (status == Os::File::OP_OK) {
+      Utils::HashBuffer hashBuffer;
+      extraction.hash.final(hashBuffer);
+      Os::ValidatedFile validatedFile(extraction.outName.toChar());
+      const Os::ValidateFile::Status validateStatus =
+        validatedFile.createHashFile(hashBuffer);
+      if (validateStatus != Os::ValidateFile::VALIDATION_OK) {
+        const Fw::EightyCharString &hashFileName = validatedFile.getHashFileName();
+        Fw::LogStringArg logStringArg(hashFileName.toChar());
+        this->bufferLogger.log_WARNING_HI_BL_LogFileValidationError(
+            logStringArg,
+            validateStatus
+        );
+      }
+    }
+    return extraction.records;
+  }
+
+  // ----------------------------------------------------------------------
+  // Private functions
+  // ----------------------------------------------------------------------
+
+  void BufferLogger::File ::
+    openIndex(void)
+  {
+    FW_ASSERT(!this->indexOpen);
+    this->numIndexEntries = 0;
+    this->recordsSinceEntry = 0;
+    this->indexName.format("%s%s", this->name.toChar(), INDEX_SUFFIX);
+
+    Os::File::Status status = this->indexFile.open(
+        this->indexName.toChar(),
+        Os::File::OPEN_CREATE
+    );
+    if (status != Os::File::OP_OK) {
+      Fw::LogStringArg string(this->indexName.toChar());
+      this->bufferLogger.log_WARNING_HI_BL_LogFileOpenError(status, string);
+      return;
+    }
+
+    U8 header[INDEX_HEADER_SIZE];
+    Fw::SerialBuffer serialBuffer(header, sizeof(header));
+    (void) serialBuffer.serialize(static_cast<U32>(INDEX_MAGIC));
+    (void) serialBuffer.serialize(static_cast<U8>(INDEX_VERSION));
+    (void) serialBuffer.serialize(this->sizeOfSize);
+    NATIVE_INT_TYPE size = sizeof(header);
+    status = this->indexFile.write(header, size);
+    if (status != Os::File::OP_OK || size != static_cast<NATIVE_INT_TYPE>(sizeof(header))) {
+      Fw::LogStringArg string(this->indexName.toChar());
+      this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(status, size, sizeof(header), string);
+      this->indexFile.close();
+      return;
+    }
+    this->indexOpen = true;
+  }
+
+  void BufferLogger::File ::
+    indexRecord(void)
+  {
+    FW_ASSERT(this->indexOpen);
+    const Fw::Time time = this->bufferLogger.getTime();
+    if (this->bytesWritten == 0 ||
+        this->recordsSinceEntry >= this->recordsPerEntry ||
+        time.getSeconds() != this->entrySeconds) {
+      FW_ASSERT(this->numIndexEntries < BUFFERLOGGER_INDEX_BUFFER_ENTRIES, this->numIndexEntries);
+      IndexEntry& entry = this->indexEntries[this->numIndexEntries++];
+      entry.sequence = this->sequence;
+      entry.seconds = time.getSeconds();
+      entry.useconds = time.getUSeconds();
+      entry.offset = this->bytesWritten;
+      this->recordsSinceEntry = 0;
+      this->entrySeconds = entry.seconds;
+      if (this->numIndexEntries == BUFFERLOGGER_INDEX_BUFFER_ENTRIES) {
+        (void) this->writeIndexEntries();
+      }
+    }
+    ++this->recordsSinceEntry;
+  }
+
+  bool BufferLogger::File ::
+    writeIndexEntries(void)
+  {
+    if (this->numIndexEntries == 0) {
+      return true;
+    }
+
+    U8 buffer[BUFFERLOGGER_INDEX_BUFFER_ENTRIES * INDEX_ENTRY_SIZE];
+    Fw::SerialBuffer serialBuffer(buffer, sizeof(buffer));
+    for (NATIVE_UINT_TYPE i = 0; i < this->numIndexEntries; ++i) {
+      const IndexEntry& entry = this->indexEntries[i];
+      (void) serialBuffer.serialize(entry.sequence);
+      (void) serialBuffer.serialize(entry.seconds);
+      (void) serialBuffer.serialize(entry.useconds);
+      (void) serialBuffer.serialize(entry.offset);
+    }
+    const NATIVE_INT_TYPE length = serialBuffer.getBuffLength();
+    this->numIndexEntries = 0;
+
+    NATIVE_INT_TYPE size = length;
+    const Os::File::Status status = this->indexFile.write(buffer, size);
+    if (status != Os::File::OP_OK || size != length) {
+      Fw::LogStringArg string(this->indexName.toChar());
+      this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(status, size, length, string);
+      return false;
+    }
+    return true;
+  }
+
+  namespace {
+
+    //! Read the next index entry
+    //! \return Whether there was one
+    bool readIndexEntry(
+        Os::File& indexFile,
+        U32& sequence,
+        U32& seconds,
+        U32& offset
+    )
+    {
+      U8 buffer[INDEX_ENTRY_SIZE];
+      NATIVE_INT_TYPE size = sizeof(buffer);
+      const Os::File::Status status = indexFile.read(buffer, size);
+      if (status != Os::File::OP_OK || size != static_cast<NATIVE_INT_TYPE>(sizeof(buffer))) {
+        return false;
+      }
+      Fw::SerialBuffer serialBuffer(buffer, sizeof(buffer));
+      serialBuffer.fill();
+      U32 useconds = 0;
+      (void) serialBuffer.deserialize(sequence);
+      (void) serialBuffer.deserialize(seconds);
+      (void) serialBuffer.deserialize(useconds);
+      (void) serialBuffer.deserialize(offset);
+      return true;
+    }
+
+  }
+
+  Os::File::Status BufferLogger::File ::
+    openExtractFile(
+        bool& opened
+    )
+  {
+    Extraction& extraction = this->extraction;
+    opened = false;
+    this->formatName(extraction.counter, extraction.inName);
+    ++extraction.counter;
+    extraction.fileOpen = true;
+
+    // The open file holds bytesWritten bytes of records. The others were
+    // trimmed to their records when they were closed
+    const bool isOpenFile =
+      this->mode == File::Mode::OPEN && extraction.inName == this->name;
+    if (isOpenFile) {
+      // Make the records and the index of the open file readable
+      (void) this->flush();
+    }
+
+    // A file without an index is skipped
+    Fw::EightyCharString indexName;
+    indexName.format("%s%s", extraction.inName.toChar(), INDEX_SUFFIX);
+    Os::File& indexFile = extraction.indexFile;
+    Os::File::Status status = indexFile.open(indexName.toChar(), Os::File::OPEN_READ);
+    if (status == Os::File::DOESNT_EXIST) {
+      return Os::File::OP_OK;
+    }
+    if (status != Os::File::OP_OK) {
+      return status;
+    }
+    U8 header[INDEX_HEADER_SIZE];
+    NATIVE_INT_TYPE size = sizeof(header);
+    status = indexFile.read(header, size);
+    if (status != Os::File::OP_OK) {
+      return status;
+    }
+    Fw::SerialBuffer headerBuffer(header, sizeof(header));
+    headerBuffer.fill();
+    U32 magic = 0;
+    U8 version = 0;
+    U8 fileSizeOfSize = 0;
+    (void) headerBuffer.deserialize(magic);
+    (void) headerBuffer.deserialize(version);
+    (void) headerBuffer.deserialize(fileSizeOfSize);
+    if (size != static_cast<NATIVE_INT_TYPE>(sizeof(header)) ||
+        magic != INDEX_MAGIC ||
+        version != INDEX_VERSION ||
+        fileSizeOfSize > sizeof(U32)) {
+      return Os::File::BAD_SIZE;
+    }
+    extraction.sizeOfSize = fileSizeOfSize;
+
+    // Start from the last entry that cannot be past the start of the range.
+    // Records between two entries take the sequence numbers that follow
+    // the first entry, and its time. Several entries may share a second,
+    // so a time range starts before the first entry in its first second
+    const RangeKind kind = extraction.kind;
+    const U32 start = extraction.start;
+    if (!readIndexEntry(indexFile, extraction.sequence, extraction.seconds, extraction.offset)) {
+      return Os::File::OP_OK;
+    }
+    extraction.haveNext = readIndexEntry(
+        indexFile,
+        extraction.nextSequence,
+        extraction.nextSeconds,
+        extraction.nextOffset
+    );
+    while (extraction.haveNext &&
+           ((kind == BY_SEQUENCE) ?
+            (extraction.nextSequence <= start) :
+            (extraction.nextSeconds < start))) {
+      extraction.sequence = extraction.nextSequence;
+      extraction.seconds = extraction.nextSeconds;
+      extraction.offset = extraction.nextOffset;
+      extraction.haveNext = readIndexEntry(
+          indexFile,
+          extraction.nextSequence,
+          extraction.nextSeconds,
+          extraction.nextOffset
+      );
+    }
+
+    // Records logged to the open file after this point are not examined
+    if (isOpenFile) {
+      extraction.fileSize = this->bytesWritten;
+    }
+    else if (Os::FileSystem::getFileSize(extraction.inName.toChar(), extraction.fileSize) != Os::FileSystem::OP_OK) {
+      return Os::File::DOESNT_EXIST;
+    }
+
+    status = extraction.inFile.open(extraction.inName.toChar(), Os::File::OPEN_READ);
+    if (status != Os::File::OP_OK) {
+      return status;
+    }
+    opened = true;
+    return Os::File::OP_OK;
+  }
+
+  Os::File::Status BufferLogger::File ::
+    extractRecord(
+        bool& fileDone,
+        bool& rangeDone
+    )
+  {
+    Extraction& extraction = this->extraction;
+    const U8 fileSizeOfSize = extraction.sizeOfSize;
+    const U32 offset = extraction.offset;
+    if (offset + fileSizeOfSize > extraction.fileSize) {
+      fileDone = true;
+      return Os::File::OP_OK;
+    }
+    while (extraction.haveNext && extraction.nextOffset <= offset) {
+      extraction.sequence = extraction.nextSequence;
+      extraction.seconds = extraction.nextSeconds;
+      extraction.haveNext = readIndexEntry(
+          extraction.indexFile,
+          extraction.nextSequence,
+          extraction.nextSeconds,
+          extraction.nextOffset
+      );
+    }
+    const U32 key = (extraction.kind == BY_SEQUENCE) ?
+      extraction.sequence : extraction.seconds;
+    if (key > extraction.end) {
+      rangeDone = true;
+      return Os::File::OP_OK;
+    }
+
+    // Read the size field
+    U8 buffer[BUFFERLOGGER_EXTRACT_CHUNK_SIZE];
+    NATIVE_INT_TYPE size = fileSizeOfSize;
+    Os::File::Status status = extraction.inFile.readAt(buffer, size, offset);
+    if (status != Os::File::OP_OK) {
+      return status;
+    }
+    if (size != fileSizeOfSize) {
+      return Os::File::BAD_SIZE;
+    }
+    U32 recordSize = 0;
+    for (U8 i = 0; i < fileSizeOfSize; ++i) {
+      recordSize = (recordSize << 8) | buffer[i];
+    }
+    recordSize += fileSizeOfSize;
+    if (offset + recordSize > extraction.fileSize) {
+      return Os::File::BAD_SIZE;
+    }
+
+    // Copy the size field and the record
+    if (key >= extraction.start) {
+      U32 copied = 0;
+      while (copied < recordSize) {
+        const U32 remaining = recordSize - copied;
+        size = (remaining < sizeof(buffer)) ? remaining : sizeof(buffer);
+        const NATIVE_INT_TYPE length = size;
+        status = extraction.inFile.readAt(buffer, size, offset + copied);
+        if (status != Os::File::OP_OK) {
+          return status;
+        }
+        if (size != length) {
+          return Os::File::BAD_SIZE;
+        }
+        extraction.hash.update(buffer, size);
+        status = extraction.outFile.write(buffer, size);
+        if (status != Os::File::OP_OK) {
+          return status;
+        }
+        if (size != length) {
+          return Os::File::NO_SPACE;
+        }
+        copied += length;
+      }
+      ++extraction.records;
+    }
+
+    extraction.offset = offset + recordSize;
+    ++extraction.sequence;
+    return Os::File::OP_OK;
+  }
+
+  void BufferLogger::File ::
+    closeExtractFile(void)
+  {
+    Extraction& extraction = this->extraction;
+    extraction.inFile.close();
+    extraction.indexFile.close();
+    extraction.fileOpen = false;
+  }
+
+}
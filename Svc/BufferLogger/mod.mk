@@ -2,8 +2,8 @@
 # mod.mk
 # ---------------------------------------------------------------------- 
 
-SRC = BufferLoggerComponentAi.xml BufferLogger.cpp BufferLoggerFile.cpp
+SRC = BufferLoggerComponentAi.xml BufferLogger.cpp BufferLoggerFile.cpp BufferLoggerIndex.cpp
 
-HDR = BufferLogger.hpp
+HDR = BufferLogger.hpp BufferLoggerCfg.hpp
 
 SUBDIRS = test
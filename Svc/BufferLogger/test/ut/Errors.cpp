@@ -114,7 +114,7 @@ namespace Svc {
           0,
           Os::File::NOT_OPENED, // errornum
           0, // bytesWritten
-          sizeof(SIZE_TYPE), // bytesAttempted
+          sizeof(SIZE_TYPE) + COM_BUFFER_LENGTH, // bytesAttempted
           fileName.toChar() // file
       );
 
@@ -154,7 +154,7 @@ namespace Svc {
               i,
               Os::File::NOT_OPENED,
               0,
-              sizeof(SIZE_TYPE),
+              sizeof(SIZE_TYPE) + COM_BUFFER_LENGTH,
               fileName.toChar()
           );
       }
@@ -197,6 +197,28 @@ namespace Svc {
       (void) system("chmod +w buf");
     }
 
+    void Tester ::
+      ExtractNoIndex(void)
+    {
+      this->sendCmd_BL_OpenFile(0, 0, "ExtractNoIndex");
+      this->dispatchOne();
+      this->sendComBuffers(3);
+
+      this->clearHistory();
+      this->sendCmd_BL_ExtractRange(0, 0, BufferLogger::BY_SEQUENCE, 0, 2, "buf/ExtractNoIndex.out");
+      this->dispatchOne();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          BufferLogger::OPCODE_BL_EXTRACTRANGE,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_BL_NoIndexError_SIZE(1);
+      this->component.m_file.close();
+    }
+
   }
 
 }
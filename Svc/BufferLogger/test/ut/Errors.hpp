@@ -38,6 +38,9 @@ namespace Svc {
         //! Log file validation error
         void LogFileValidation(void);
 
+        //! Range extraction without an index
+        void ExtractNoIndex(void);
+
     };
 
   }
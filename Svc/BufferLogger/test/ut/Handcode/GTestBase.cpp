@@ -508,6 +508,144 @@ namespace Svc {
       << "  Actual:   " << this->eventsSize_BL_NoLogFileOpenInitError << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Event: BL_RangeExtracted
+  // ----------------------------------------------------------------------
+
+  void BufferLoggerGTestBase ::
+    assertEvents_BL_RangeExtracted_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_BL_RangeExtracted->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event BL_RangeExtracted\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_BL_RangeExtracted->size() << "\n";
+  }
+
+  void BufferLoggerGTestBase ::
+    assertEvents_BL_RangeExtracted(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32 records,
+        const char *const file
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_BL_RangeExtracted->size(), __index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event BL_RangeExtracted\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_BL_RangeExtracted->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const EventEntry_BL_RangeExtracted& e =
+      this->eventHistory_BL_RangeExtracted->at(__index);
+    ASSERT_EQ(records, e.records)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument records at index "
+      << __index
+      << " in history of event BL_RangeExtracted\n"
+      << "  Expected: " << records << "\n"
+      << "  Actual:   " << e.records << "\n";
+    ASSERT_STREQ(file, e.file.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument file at index "
+      << __index
+      << " in history of event BL_RangeExtracted\n"
+      << "  Expected: " << file << "\n"
+      << "  Actual:   " << e.file.toChar() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: BL_RangeExtractError
+  // ----------------------------------------------------------------------
+
+  void BufferLoggerGTestBase ::
+    assertEvents_BL_RangeExtractError_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_BL_RangeExtractError->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event BL_RangeExtractError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_BL_RangeExtractError->size() << "\n";
+  }
+
+  void BufferLoggerGTestBase ::
+    assertEvents_BL_RangeExtractError(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32 errornum,
+        const char *const file
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_BL_RangeExtractError->size(), __index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event BL_RangeExtractError\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_BL_RangeExtractError->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const EventEntry_BL_RangeExtractError& e =
+      this->eventHistory_BL_RangeExtractError->at(__index);
+    ASSERT_EQ(errornum, e.errornum)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument errornum at index "
+      << __index
+      << " in history of event BL_RangeExtractError\n"
+      << "  Expected: " << errornum << "\n"
+      << "  Actual:   " << e.errornum << "\n";
+    ASSERT_STREQ(file, e.file.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument file at index "
+      << __index
+      << " in history of event BL_RangeExtractError\n"
+      << "  Expected: " << file << "\n"
+      << "  Actual:   " << e.file.toChar() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: BL_NoIndexError
+  // ----------------------------------------------------------------------
+
+  void BufferLoggerGTestBase ::
+    assertEvents_BL_NoIndexError_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventsSize_BL_NoIndexError)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event BL_NoIndexError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventsSize_BL_NoIndexError << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // From ports
   // ----------------------------------------------------------------------
@@ -79,6 +79,21 @@
 #define ASSERT_EVENTS_BL_NoLogFileOpenInitError_SIZE(size) \
   this->assertEvents_BL_NoLogFileOpenInitError_size(__FILE__, __LINE__, size)
 
+#define ASSERT_EVENTS_BL_RangeExtracted_SIZE(size) \
+  this->assertEvents_BL_RangeExtracted_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_BL_RangeExtracted(index, _records, _file) \
+  this->assertEvents_BL_RangeExtracted(__FILE__, __LINE__, index, _records, _file)
+
+#define ASSERT_EVENTS_BL_RangeExtractError_SIZE(size) \
+  this->assertEvents_BL_RangeExtractError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_BL_RangeExtractError(index, _errornum, _file) \
+  this->assertEvents_BL_RangeExtractError(__FILE__, __LINE__, index, _errornum, _file)
+
+#define ASSERT_EVENTS_BL_NoIndexError_SIZE(size) \
+  this->assertEvents_BL_NoIndexError_size(__FILE__, __LINE__, size)
+
 // ----------------------------------------------------------------------
 // Macros for typed user from port history assertions
 // ----------------------------------------------------------------------
@@ -357,6 +372,58 @@ namespace Svc {
           const U32 size /*!< The asserted size*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BL_RangeExtracted
+      // ----------------------------------------------------------------------
+
+      void assertEvents_BL_RangeExtracted_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_BL_RangeExtracted(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32 records, /*!< The number of records copied*/
+          const char *const file /*!< The file*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BL_RangeExtractError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_BL_RangeExtractError_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_BL_RangeExtractError(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32 errornum, /*!< The error number returned from the failed file operation*/
+          const char *const file /*!< The file*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BL_NoIndexError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_BL_NoIndexError_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
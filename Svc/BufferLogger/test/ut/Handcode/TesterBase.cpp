@@ -52,6 +52,10 @@ namespace Svc {
       new History<EventEntry_BL_LogFileValidationError>(maxHistorySize);
     this->eventHistory_BL_LogFileWriteError =
       new History<EventEntry_BL_LogFileWriteError>(maxHistorySize);
+    this->eventHistory_BL_RangeExtracted =
+      new History<EventEntry_BL_RangeExtracted>(maxHistorySize);
+    this->eventHistory_BL_RangeExtractError =
+      new History<EventEntry_BL_RangeExtractError>(maxHistorySize);
     // Initialize histories for typed user output ports
     this->fromPortHistory_bufferSendOut =
       new History<FromPortEntry_bufferSendOut>(maxHistorySize);
@@ -76,6 +80,8 @@ namespace Svc {
     delete this->eventHistory_BL_LogFileOpenError;
     delete this->eventHistory_BL_LogFileValidationError;
     delete this->eventHistory_BL_LogFileWriteError;
+    delete this->eventHistory_BL_RangeExtracted;
+    delete this->eventHistory_BL_RangeExtractError;
   }
 
   void BufferLoggerTesterBase ::
@@ -1064,6 +1070,53 @@ namespace Svc {
 
   }
 
+  // ---------------------------------------------------------------------- 
+  // Command: BL_ExtractRange
+  // ---------------------------------------------------------------------- 
+
+  void BufferLoggerTesterBase ::
+    sendCmd_BL_ExtractRange(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        BufferLoggerComponentBase::RangeKind kind,
+        U32 start,
+        U32 end,
+        const Fw::CmdStringArg& file
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize((FwEnumStoreType) kind);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(start);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(end);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(file);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = BufferLoggerComponentBase::OPCODE_BL_EXTRACTRANGE + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
   
   void BufferLoggerTesterBase ::
     sendRawCmd(FwOpcodeType opcode, U32 cmdSeq, Fw::CmdArgBuffer& args) {
@@ -1456,6 +1509,121 @@ namespace Svc {
 
       }
 
+      case BufferLoggerComponentBase::EVENTID_BL_RANGEEXTRACTED: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 2,_numArgs,2);
+        
+#endif    
+        U32 records;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(records);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        Fw::LogStringArg file;
+        _status = args.deserialize(file);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_HI_BL_RangeExtracted(records, file);
+
+        break;
+
+      }
+
+      case BufferLoggerComponentBase::EVENTID_BL_RANGEEXTRACTERROR: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 2,_numArgs,2);
+        
+#endif    
+        U32 errornum;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(errornum);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        Fw::LogStringArg file;
+        _status = args.deserialize(file);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_BL_RangeExtractError(errornum, file);
+
+        break;
+
+      }
+
+      case BufferLoggerComponentBase::EVENTID_BL_NOINDEXERROR: 
+      {
+
+#if FW_AMPCS_COMPATIBLE
+        // For AMPCS, decode zero arguments
+        Fw::SerializeStatus _zero_status = Fw::FW_SERIALIZE_OK;
+        U8 _noArgs;
+        _zero_status = args.deserialize(_noArgs);
+        FW_ASSERT(
+            _zero_status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_zero_status)
+        );
+#endif    
+        this->logIn_WARNING_HI_BL_NoIndexError();
+
+        break;
+
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -1473,9 +1641,12 @@ namespace Svc {
     this->eventHistory_BL_LogFileOpenError->clear();
     this->eventHistory_BL_LogFileValidationError->clear();
     this->eventHistory_BL_LogFileWriteError->clear();
+    this->eventHistory_BL_RangeExtracted->clear();
+    this->eventHistory_BL_RangeExtractError->clear();
     this->eventsSize_BL_Activated = 0;
     this->eventsSize_BL_Deativated = 0;
     this->eventsSize_BL_NoLogFileOpenInitError = 0;
+    this->eventsSize_BL_NoIndexError = 0;
   }
 
 #if FW_ENABLE_TEXT_LOGGING
@@ -1664,4 +1835,51 @@ namespace Svc {
     ++this->eventsSize;
   }
 
+  // ----------------------------------------------------------------------
+  // Event: BL_RangeExtracted 
+  // ----------------------------------------------------------------------
+
+  void BufferLoggerTesterBase ::
+    logIn_ACTIVITY_HI_BL_RangeExtracted(
+        U32 records,
+        Fw::LogStringArg& file
+    )
+  {
+    EventEntry_BL_RangeExtracted e = {
+      records, file
+    };
+    eventHistory_BL_RangeExtracted->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: BL_RangeExtractError 
+  // ----------------------------------------------------------------------
+
+  void BufferLoggerTesterBase ::
+    logIn_WARNING_HI_BL_RangeExtractError(
+        U32 errornum,
+        Fw::LogStringArg& file
+    )
+  {
+    EventEntry_BL_RangeExtractError e = {
+      errornum, file
+    };
+    eventHistory_BL_RangeExtractError->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: BL_NoIndexError 
+  // ----------------------------------------------------------------------
+
+  void BufferLoggerTesterBase ::
+    logIn_WARNING_HI_BL_NoIndexError(
+        void
+    )
+  {
+    ++this->eventsSize_BL_NoIndexError;
+    ++this->eventsSize;
+  }
+
 } // end namespace Svc
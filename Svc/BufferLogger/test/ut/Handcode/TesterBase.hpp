@@ -542,6 +542,17 @@ namespace Svc {
           const U32 cmdSeq /*!< The command sequence number*/
       );
 
+      //! Send a BL_ExtractRange command
+      //!
+      void sendCmd_BL_ExtractRange(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          BufferLoggerComponentBase::RangeKind kind, 
+          U32 start, 
+          U32 end, 
+          const Fw::CmdStringArg& file 
+      );
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -784,6 +795,72 @@ namespace Svc {
       //!
       U32 eventsSize_BL_NoLogFileOpenInitError;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BL_RangeExtracted
+      // ----------------------------------------------------------------------
+
+      //! Handle event BL_RangeExtracted
+      //!
+      virtual void logIn_ACTIVITY_HI_BL_RangeExtracted(
+          U32 records, /*!< The number of records copied*/
+          Fw::LogStringArg& file /*!< The file*/
+      );
+
+      //! A history entry for event BL_RangeExtracted
+      //!
+      typedef struct {
+        U32 records;
+        Fw::LogStringArg file;
+      } EventEntry_BL_RangeExtracted;
+
+      //! The history of BL_RangeExtracted events
+      //!
+      History<EventEntry_BL_RangeExtracted> 
+        *eventHistory_BL_RangeExtracted;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BL_RangeExtractError
+      // ----------------------------------------------------------------------
+
+      //! Handle event BL_RangeExtractError
+      //!
+      virtual void logIn_WARNING_HI_BL_RangeExtractError(
+          U32 errornum, /*!< The error number returned from the failed file operation*/
+          Fw::LogStringArg& file /*!< The file*/
+      );
+
+      //! A history entry for event BL_RangeExtractError
+      //!
+      typedef struct {
+        U32 errornum;
+        Fw::LogStringArg file;
+      } EventEntry_BL_RangeExtractError;
+
+      //! The history of BL_RangeExtractError events
+      //!
+      History<EventEntry_BL_RangeExtractError> 
+        *eventHistory_BL_RangeExtractError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BL_NoIndexError
+      // ----------------------------------------------------------------------
+
+      //! Handle event BL_NoIndexError
+      //!
+      virtual void logIn_WARNING_HI_BL_NoIndexError(
+          void
+      );
+
+      //! Size of history for event BL_NoIndexError
+      //!
+      U32 eventsSize_BL_NoIndexError;
+
     protected:
 
       // ----------------------------------------------------------------------
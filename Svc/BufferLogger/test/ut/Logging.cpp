@@ -12,6 +12,7 @@
 
 #include "Logging.hpp"
 #include "Os/FileSystem.hpp"
+#include "Utils/Lz/LzDecoder.hpp"
 
 namespace Svc {
 
@@ -210,6 +211,273 @@ namespace Svc {
       tester.test(3, "BufferSendIn");
     }
 
+    class DirectWriteTester :
+      public SendBuffersTester
+    {
+
+      public:
+
+        DirectWriteTester(void) {
+          this->component.m_file.directWrite = true;
+        }
+
+      private:
+
+        void sendBuffers(const U32 n) {
+          this->sendComBuffers(n);
+        }
+
+    };
+
+    void Tester ::
+      DirectWrite(void)
+    {
+      DirectWriteTester tester;
+      tester.test(3, "DirectWrite");
+    }
+
+    class ExtractRangeTester :
+      public Logging::Tester
+    {
+
+      private:
+
+        //! Records logged per second of test time
+        enum { RECORDS_PER_SECOND = 3 };
+
+        //! Send an extract range command and check the extracted file
+        void extract(
+            const BufferLogger::RangeKind kind, //!< The kind of range
+            const U32 start, //!< The start of the range
+            const U32 end, //!< The end of the range
+            const U32 expectedRecords //!< The number of records expected
+        ) {
+          this->clearHistory();
+          const char *const fileName = "buf/ExtractRange.out";
+          this->sendCmd_BL_ExtractRange(0, 0, kind, start, end, fileName);
+          // The records are copied by extractStep messages
+          this->dispatchAll();
+          ASSERT_CMD_RESPONSE_SIZE(1);
+          ASSERT_CMD_RESPONSE(
+              0,
+              BufferLogger::OPCODE_BL_EXTRACTRANGE,
+              0,
+              Fw::COMMAND_OK
+          );
+          ASSERT_EVENTS_SIZE(1);
+          ASSERT_EVENTS_BL_RangeExtracted_SIZE(1);
+          ASSERT_EVENTS_BL_RangeExtracted(0, expectedRecords, fileName);
+          const U32 recordSize = COM_BUFFER_LENGTH + sizeof(SIZE_TYPE);
+          U64 size = 0;
+          ASSERT_EQ(
+              Os::FileSystem::OP_OK,
+              Os::FileSystem::getFileSize(fileName, size)
+          );
+          ASSERT_EQ(expectedRecords * recordSize, size);
+          if (expectedRecords > 0) {
+            this->checkLogFileIntegrity(
+                fileName,
+                expectedRecords * recordSize,
+                expectedRecords
+            );
+          }
+          this->checkFileValidation(fileName);
+        }
+
+        //! Send an extract range command while another one is running
+        void extractBusy(
+            const U32 numRecords //!< The number of records logged
+        ) {
+          this->clearHistory();
+          const char *const fileName = "buf/ExtractRange.out";
+          this->sendCmd_BL_ExtractRange(0, 0, BufferLogger::BY_SEQUENCE, 0, numRecords, fileName);
+          this->dispatchOne();
+          // The range takes more than one extractStep message
+          ASSERT_CMD_RESPONSE_SIZE(0);
+          ASSERT_TRUE(this->component.m_file.isExtracting());
+          this->sendCmd_BL_ExtractRange(0, 1, BufferLogger::BY_SEQUENCE, 0, numRecords, fileName);
+          this->dispatchAll();
+          ASSERT_CMD_RESPONSE_SIZE(2);
+          ASSERT_CMD_RESPONSE(
+              0,
+              BufferLogger::OPCODE_BL_EXTRACTRANGE,
+              1,
+              Fw::COMMAND_BUSY
+          );
+          ASSERT_CMD_RESPONSE(
+              1,
+              BufferLogger::OPCODE_BL_EXTRACTRANGE,
+              0,
+              Fw::COMMAND_OK
+          );
+          ASSERT_EVENTS_BL_RangeExtracted_SIZE(1);
+          ASSERT_EVENTS_BL_RangeExtracted(0, numRecords, fileName);
+        }
+
+      public:
+
+        void test(void) {
+          // Two records between index entries, so some records must be
+          // found by walking forward from an entry
+          this->component.initIndex(2);
+          this->setTestTimeSeconds(0);
+          this->sendCmd_BL_OpenFile(0, 0, "ExtractRange");
+          this->dispatchOne();
+          // Three files; the last one stays open
+          const U32 numRecords = 3 * MAX_ENTRIES_PER_FILE;
+          for (U32 i = 0; i < numRecords; ++i) {
+            this->setTestTimeSeconds(i / RECORDS_PER_SECOND);
+            this->sendComBuffers(1);
+          }
+          ASSERT_EQ(BufferLogger::File::Mode::OPEN, component.m_file.mode);
+          // Every file has an index
+          Fw::EightyCharString indexName;
+          indexName.format("%s.idx", this->component.m_file.name.toChar());
+          this->checkFileExists(indexName);
+
+          // Sequence ranges, across files and within the open file
+          this->extract(BufferLogger::BY_SEQUENCE, 3, 11, 9);
+          this->extract(BufferLogger::BY_SEQUENCE, 11, 14, 4);
+          this->extract(BufferLogger::BY_SEQUENCE, 0, numRecords, numRecords);
+          // Time ranges
+          this->extract(BufferLogger::BY_TIME, 1, 2, 2 * RECORDS_PER_SECOND);
+          this->extract(BufferLogger::BY_TIME, 4, 4, RECORDS_PER_SECOND);
+          // Ranges with no records
+          this->extract(BufferLogger::BY_SEQUENCE, 100, 200, 0);
+          this->extract(BufferLogger::BY_TIME, 10, 20, 0);
+          // A second range waits for the first
+          this->extractBusy(numRecords);
+
+          this->component.m_file.close();
+        }
+
+    };
+
+    void Tester ::
+      ExtractRange(void)
+    {
+      ExtractRangeTester tester;
+      tester.test();
+    }
+
+    class CompressedTester :
+      public Logging::Tester
+    {
+
+      private:
+
+        //! Decompress a log file into a new file
+        void decompress(
+            const char *const fileName, //!< The log file
+            const char *const outName //!< The file to write the records to
+        ) {
+          U64 size = 0;
+          ASSERT_EQ(
+              Os::FileSystem::OP_OK,
+              Os::FileSystem::getFileSize(fileName, size)
+          );
+          U8 stream[size];
+          Os::File file;
+          ASSERT_EQ(Os::File::OP_OK, file.open(fileName, Os::File::OPEN_READ));
+          NATIVE_INT_TYPE length = static_cast<NATIVE_INT_TYPE>(size);
+          ASSERT_EQ(Os::File::OP_OK, file.read(stream, length));
+          ASSERT_EQ(size, static_cast<U64>(length));
+          file.close();
+          Os::File outFile;
+          ASSERT_EQ(
+              Os::File::OP_OK,
+              outFile.open(outName, Os::File::OPEN_WRITE)
+          );
+          Utils::LzDecoder decoder;
+          U32 offset = 0;
+          while (offset < size) {
+            U32 used = 0;
+            const Utils::LzDecoder::Status status =
+              decoder.update(&stream[offset], size - offset, used);
+            ASSERT_NE(Utils::LzDecoder::BAD_FRAME, status);
+            offset += used;
+            if (status == Utils::LzDecoder::FRAME_READY) {
+              length = decoder.getSize();
+              ASSERT_EQ(
+                  Os::File::OP_OK,
+                  outFile.write(decoder.getData(), length)
+              );
+            }
+          }
+          ASSERT_TRUE(decoder.isIdle());
+          outFile.close();
+        }
+
+      public:
+
+        void test(void) {
+          // Staged records are projected at their uncompressed size plus
+          // a frame header, so four records fit in a file
+          const U32 recordsPerFile = MAX_ENTRIES_PER_FILE - 1;
+          this->component.m_file.compress = true;
+          // Compressed files are not indexed
+          this->component.initIndex(2);
+          ASSERT_FALSE(this->component.m_file.isIndexed());
+          this->sendCmd_BL_OpenFile(0, 0, "Compressed");
+          this->dispatchOne();
+          this->sendComBuffers(2 * recordsPerFile + 1);
+          ASSERT_EVENTS_SIZE(2);
+          ASSERT_EVENTS_BL_LogFileClosed_SIZE(2);
+          for (U32 i = 0; i < 2; ++i) {
+            Fw::EightyCharString fileName;
+            if (i == 0) {
+              fileName.format("buf/logCompressed.buf");
+            }
+            else {
+              fileName.format("buf/logCompressed%d.buf", i);
+            }
+            ASSERT_EVENTS_BL_LogFileClosed(i, fileName.toChar());
+            U64 size = 0;
+            ASSERT_EQ(
+                Os::FileSystem::OP_OK,
+                Os::FileSystem::getFileSize(fileName.toChar(), size)
+            );
+            ASSERT_LE(size, MAX_BYTES_PER_FILE);
+            this->checkFileValidation(fileName.toChar());
+            Fw::EightyCharString indexName;
+            indexName.format("%s.idx", fileName.toChar());
+            ASSERT_NE(
+                Os::FileSystem::OP_OK,
+                Os::FileSystem::getFileSize(indexName.toChar(), size)
+            );
+            // The records come back
+            const char *const outName = "buf/Compressed.out";
+            this->decompress(fileName.toChar(), outName);
+            this->checkLogFileIntegrity(
+                outName,
+                recordsPerFile * (COM_BUFFER_LENGTH + sizeof(SIZE_TYPE)),
+                recordsPerFile
+            );
+          }
+
+          // Flushing writes out the staged record
+          this->sendCmd_BL_FlushFile(0, 0);
+          this->dispatchOne();
+          const char *const outName = "buf/Compressed.out";
+          this->decompress(this->component.m_file.name.toChar(), outName);
+          this->checkLogFileIntegrity(
+              outName,
+              COM_BUFFER_LENGTH + sizeof(SIZE_TYPE),
+              1
+          );
+
+          this->component.m_file.close();
+        }
+
+    };
+
+    void Tester ::
+      Compressed(void)
+    {
+      CompressedTester tester;
+      tester.test();
+    }
+
     class OnOffTester :
       Logging::Tester
     {
@@ -41,6 +41,15 @@ namespace Svc {
         //! Test logging on/off capability
         void OnOff(void);
 
+        //! Test logging through the direct writer
+        void DirectWrite(void);
+
+        //! Test extracting ranges of records through the index
+        void ExtractRange(void);
+
+        //! Test logging compressed files
+        void Compressed(void);
+
     };
 
   }
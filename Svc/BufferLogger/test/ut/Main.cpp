@@ -31,6 +31,11 @@ TEST(TestErrors, LogFileValidation) {
   tester.LogFileValidation();
 }
 
+TEST(TestErrors, ExtractNoIndex) {
+  Svc::Errors::Tester tester;
+  tester.ExtractNoIndex();
+}
+
 // ----------------------------------------------------------------------
 // Test Logging
 // ----------------------------------------------------------------------
@@ -55,6 +60,21 @@ TEST(TestLogging, OnOff) {
   tester.OnOff();
 }
 
+TEST(TestLogging, DirectWrite) {
+  Svc::Logging::Tester tester;
+  tester.DirectWrite();
+}
+
+TEST(TestLogging, ExtractRange) {
+  Svc::Logging::Tester tester;
+  tester.ExtractRange();
+}
+
+TEST(TestLogging, Compressed) {
+  Svc::Logging::Tester tester;
+  tester.Compressed();
+}
+
 // ----------------------------------------------------------------------
 // Test Health
 // ----------------------------------------------------------------------
@@ -13,7 +13,7 @@ TEST_SRC=Handcode/TesterBase.cpp \
 TEST_MODS=Svc/BufferLogger \
 					Fw/Buffer Fw/Cmd Fw/Comp Fw/Port Fw/Time \
 					Fw/Tlm Fw/Types Fw/Log Fw/Obj Os Fw/Com \
-					Svc/Ping Svc/Sched Utils/Hash \
+					Svc/Ping Svc/Sched Utils/Hash Utils/Lz \
 					gtest
 
 
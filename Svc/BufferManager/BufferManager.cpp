@@ -14,8 +14,32 @@
 #include "Fw/Types/BasicTypes.hpp"
 #include "Svc/BufferManager/BufferManager.hpp"
 
+#include <string.h>
+
 namespace Svc {
 
+  namespace {
+
+    enum {
+      //! The bin index is in the high bits of a bin mode buffer ID
+      BIN_ID_SHIFT = 24,
+      //! The slot is in the low bits
+      BIN_SLOT_MASK = (1 << BIN_ID_SHIFT) - 1
+    };
+
+    //! Claim a client cache without blocking
+    //! \return Whether no other thread held the cache
+    bool claimCache(volatile I32& claimed) {
+      return __sync_lock_test_and_set(&claimed, 1) == 0;
+    }
+
+    //! Release a client cache
+    void releaseCache(volatile I32& claimed) {
+      __sync_lock_release(&claimed);
+    }
+
+  }
+
   // ----------------------------------------------------------------------
   // Warnings::State
   // ----------------------------------------------------------------------
@@ -23,7 +47,8 @@ namespace Svc {
   BufferManager::Warnings::State ::
     State(void) :
       storeSizeExceeded(false),
-      tooManyBuffers(false)
+      tooManyBuffers(false),
+      binsExhausted(false)
   {
 
   }
@@ -34,7 +59,8 @@ namespace Svc {
 
   BufferManager::Warnings ::
     Warnings(BufferManager& bufferManager) :
-      bufferManager(bufferManager)
+      bufferManager(bufferManager),
+      clear(true)
   {
 
   }
@@ -44,11 +70,16 @@ namespace Svc {
   {
     switch (status) {
       case Status::SUCCESS:
-        if (this->state.storeSizeExceeded || this->state.tooManyBuffers) {
+        if (
+            this->state.storeSizeExceeded ||
+            this->state.tooManyBuffers ||
+            this->state.binsExhausted
+        ) {
           this->bufferManager.log_ACTIVITY_HI_ClearedErrorState();
         }
         this->state.storeSizeExceeded = false;
         this->state.tooManyBuffers = false;
+        this->state.binsExhausted = false;
         break;
       case Status::STORE_SIZE_EXCEEDED:
         if (!this->state.storeSizeExceeded) {
@@ -62,10 +93,26 @@ namespace Svc {
           this->state.tooManyBuffers = true;
         }
         break;
+      case Status::BINS_EXHAUSTED:
+        if (!this->state.binsExhausted) {
+          this->bufferManager.log_WARNING_HI_BinsExhausted();
+          this->state.binsExhausted = true;
+        }
+        break;
       default:
         FW_ASSERT(0);
         break;
     }
+    this->clear =
+      !this->state.storeSizeExceeded &&
+      !this->state.tooManyBuffers &&
+      !this->state.binsExhausted;
+  }
+
+  bool BufferManager::Warnings ::
+    isClear(void) const
+  {
+    return this->clear;
   }
 
   // ----------------------------------------------------------------------
@@ -240,6 +287,226 @@ namespace Svc {
     return Free::SUCCESS;
   }
 
+  // ----------------------------------------------------------------------
+  // A bin of fixed-size buffers
+  // ----------------------------------------------------------------------
+
+  BufferManager::Bin ::
+    Bin(void) :
+      bufferSize(0),
+      stride(0),
+      numBuffers(0),
+      memoryBase(0),
+      freeSlots(0),
+      numFree(0),
+      states(0),
+      numHeld(0),
+      highWater(0),
+      failures(0)
+  {
+
+  }
+
+  BufferManager::Bin ::
+    ~Bin(void)
+  {
+    delete[] this->memoryBase;
+    delete[] this->freeSlots;
+    delete[] this->states;
+  }
+
+  void BufferManager::Bin ::
+    setup(
+        const U32 bufferSize,
+        const U32 numBuffers
+    )
+  {
+    FW_ASSERT(this->memoryBase == 0);
+    FW_ASSERT(bufferSize > 0);
+    FW_ASSERT(numBuffers > 0);
+    FW_ASSERT(numBuffers - 1 <= BIN_SLOT_MASK, numBuffers);
+    this->bufferSize = bufferSize;
+    this->stride = (bufferSize + sizeof(U64) - 1) & ~(sizeof(U64) - 1);
+    FW_ASSERT(this->stride >= bufferSize, bufferSize);
+    FW_ASSERT(numBuffers <= 0xFFFFFFFF / this->stride, numBuffers, this->stride);
+    this->numBuffers = numBuffers;
+    this->memoryBase = new U8[this->stride * numBuffers];
+    this->freeSlots = new U32[numBuffers];
+    this->states = new U8[numBuffers];
+    // Hand out the low slots first
+    for (U32 i = 0; i < numBuffers; ++i) {
+      this->freeSlots[i] = numBuffers - 1 - i;
+      this->states[i] = SLOT_FREE;
+    }
+    this->numFree = numBuffers;
+  }
+
+  U32 BufferManager::Bin ::
+    getBufferSize(void) const
+  {
+    return this->bufferSize;
+  }
+
+  U32 BufferManager::Bin ::
+    getHighWater(void) const
+  {
+    return this->highWater;
+  }
+
+  U32 BufferManager::Bin ::
+    getFailures(void) const
+  {
+    return this->failures;
+  }
+
+  U32 BufferManager::Bin ::
+    getNumFree(void) const
+  {
+    return this->numFree;
+  }
+
+  bool BufferManager::Bin ::
+    allocate(
+        U32& slot,
+        U8* &address
+    )
+  {
+    address = 0;
+    if (!this->pop(slot)) {
+      return false;
+    }
+    this->states[slot] = SLOT_ALLOCATED;
+    this->hold();
+    address = this->getAddress(slot);
+    return true;
+  }
+
+  void BufferManager::Bin ::
+    fail(void)
+  {
+    ++this->failures;
+  }
+
+  void BufferManager::Bin ::
+    free(
+        const U32 slot,
+        U8 *const address
+    )
+  {
+    FW_ASSERT(slot < this->numBuffers, slot, this->numBuffers);
+    FW_ASSERT(this->states[slot] == SLOT_ALLOCATED, slot, this->states[slot]);
+    FW_ASSERT(address == this->getAddress(slot), slot);
+    this->release();
+    this->push(slot);
+  }
+
+  bool BufferManager::Bin ::
+    cache(U32& slot)
+  {
+    if (!this->pop(slot)) {
+      return false;
+    }
+    this->states[slot] = SLOT_CACHED;
+    return true;
+  }
+
+  void BufferManager::Bin ::
+    uncache(const U32 slot)
+  {
+    FW_ASSERT(slot < this->numBuffers, slot, this->numBuffers);
+    FW_ASSERT(this->states[slot] == SLOT_CACHED, slot, this->states[slot]);
+    this->push(slot);
+  }
+
+  U8* BufferManager::Bin ::
+    allocateCached(const U32 slot)
+  {
+    FW_ASSERT(slot < this->numBuffers, slot, this->numBuffers);
+    FW_ASSERT(this->states[slot] == SLOT_CACHED, slot, this->states[slot]);
+    this->states[slot] = SLOT_ALLOCATED;
+    this->hold();
+    return this->getAddress(slot);
+  }
+
+  void BufferManager::Bin ::
+    freeCached(
+        const U32 slot,
+        U8 *const address
+    )
+  {
+    FW_ASSERT(slot < this->numBuffers, slot, this->numBuffers);
+    FW_ASSERT(this->states[slot] == SLOT_ALLOCATED, slot, this->states[slot]);
+    FW_ASSERT(address == this->getAddress(slot), slot);
+    this->release();
+    this->states[slot] = SLOT_CACHED;
+  }
+
+  bool BufferManager::Bin ::
+    pop(U32& slot)
+  {
+    FW_ASSERT(this->numFree <= this->numBuffers);
+    if (this->numFree == 0) {
+      slot = 0;
+      return false;
+    }
+    --this->numFree;
+    slot = this->freeSlots[this->numFree];
+    FW_ASSERT(slot < this->numBuffers, slot);
+    FW_ASSERT(this->states[slot] == SLOT_FREE, slot, this->states[slot]);
+    return true;
+  }
+
+  void BufferManager::Bin ::
+    push(const U32 slot)
+  {
+    FW_ASSERT(this->numFree < this->numBuffers);
+    this->states[slot] = SLOT_FREE;
+    this->freeSlots[this->numFree] = slot;
+    ++this->numFree;
+  }
+
+  U8* BufferManager::Bin ::
+    getAddress(const U32 slot) const
+  {
+    return &this->memoryBase[slot * this->stride];
+  }
+
+  void BufferManager::Bin ::
+    hold(void)
+  {
+    const U32 numHeld = __sync_add_and_fetch(&this->numHeld, 1);
+    FW_ASSERT(numHeld <= this->numBuffers, numHeld);
+    U32 highWater = this->highWater;
+    while (numHeld > highWater) {
+      const U32 seen =
+        __sync_val_compare_and_swap(&this->highWater, highWater, numHeld);
+      if (seen == highWater) {
+        break;
+      }
+      highWater = seen;
+    }
+  }
+
+  void BufferManager::Bin ::
+    release(void)
+  {
+    const U32 numHeld = __sync_sub_and_fetch(&this->numHeld, 1);
+    FW_ASSERT(numHeld < this->numBuffers, numHeld);
+  }
+
+  // ----------------------------------------------------------------------
+  // Cache
+  // ----------------------------------------------------------------------
+
+  BufferManager::Cache ::
+    Cache(void) :
+      claimed(0),
+      hits(0),
+      misses(0)
+  {
+    memset(this->count, 0, sizeof(this->count));
+  }
+
   // ----------------------------------------------------------------------
   // Construction, initialization, and destruction 
   // ----------------------------------------------------------------------
@@ -253,11 +520,42 @@ namespace Svc {
       BufferManagerComponentBase(compName),
       warnings(*this),
       store(storeSize),
-      allocationQueue(maxNumBuffers)
+      allocationQueue(maxNumBuffers),
+      numBins(0),
+      cacheBypasses(0),
+      lastCacheHits(0),
+      lastCacheMisses(0)
   {
 
   }
 
+  BufferManager ::
+    BufferManager(
+        const char *const compName,
+        const BinSpec *const binSpecs,
+        const U32 numBins
+    ) :
+      BufferManagerComponentBase(compName),
+      warnings(*this),
+      store(0),
+      allocationQueue(0),
+      numBins(numBins),
+      cacheBypasses(0),
+      lastCacheHits(0),
+      lastCacheMisses(0)
+  {
+    FW_ASSERT(binSpecs != 0);
+    FW_ASSERT(numBins > 0);
+    FW_ASSERT(numBins <= BUFFERMANAGER_MAX_BINS, numBins);
+    for (U32 i = 0; i < numBins; ++i) {
+      FW_ASSERT(
+          i == 0 || binSpecs[i].bufferSize > binSpecs[i - 1].bufferSize,
+          i, binSpecs[i].bufferSize
+      );
+      this->bins[i].setup(binSpecs[i].bufferSize, binSpecs[i].numBuffers);
+    }
+  }
+
   void BufferManager ::
     init(const NATIVE_INT_TYPE instance) 
   {
@@ -280,6 +578,10 @@ namespace Svc {
         U32 size 
     )
   {
+    if (this->numBins > 0) {
+      return this->allocateFromBins(portNum, size);
+    }
+
     U8 *address;
     U32 id;
     Fw::Buffer buffer;
@@ -287,6 +589,8 @@ namespace Svc {
 
     Warnings::Status::t warningStatus = Warnings::Status::SUCCESS;
 
+    this->mutex.lock();
+
     {
       const Store::Status status = 
         this->store.allocate(size, address);
@@ -310,6 +614,7 @@ namespace Svc {
     }
 
     this->warnings.update(warningStatus);
+    this->mutex.unLock();
     return buffer;
   }
 
@@ -323,11 +628,18 @@ namespace Svc {
     const U32 instance = static_cast<U32>(this->getInstance());
     FW_ASSERT(buffer.getmanagerID() == instance);
 
+    if (this->numBins > 0) {
+      this->freeToBins(portNum, buffer);
+      return;
+    }
+
     const U32 expectedId = buffer.getbufferID();
     U8 *const address = reinterpret_cast<U8*>(buffer.getdata());
     U32 sawId = 0;
     U32 size = 0;
 
+    this->mutex.lock();
+
     {
       const AllocationQueue::Free::Status status =
         this->allocationQueue.free(expectedId, sawId, size);
@@ -341,6 +653,265 @@ namespace Svc {
       this->store.free(size, address);
     }
 
+    this->mutex.unLock();
+
+  }
+
+  void BufferManager ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    if (this->numBins == 0) {
+      return;
+    }
+
+    // Each cache counts while a thread holds it. A count read here may
+    // be a call or two behind
+    U32 hits = 0;
+    U32 misses = 0;
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(this->caches); ++i) {
+      hits += this->caches[i].hits;
+      misses += this->caches[i].misses;
+    }
+    this->mutex.lock();
+    misses += this->cacheBypasses;
+    this->mutex.unLock();
+
+    this->tlmWrite_BufferManager_CacheHits(hits);
+    this->tlmWrite_BufferManager_CacheMisses(misses);
+
+    const U32 newHits = hits - this->lastCacheHits;
+    const U32 newMisses = misses - this->lastCacheMisses;
+    if (newHits + newMisses > 0) {
+      const F32 hitRate = 100.0f * newHits / (newHits + newMisses);
+      this->tlmWrite_BufferManager_CacheHitRate(hitRate);
+    }
+    this->lastCacheHits = hits;
+    this->lastCacheMisses = misses;
+  }
+
+  // ----------------------------------------------------------------------
+  // Private helper methods
+  // ----------------------------------------------------------------------
+
+  Fw::Buffer BufferManager ::
+    allocateFromBins(
+        const NATIVE_INT_TYPE portNum,
+        const U32 size
+    )
+  {
+    FW_ASSERT(portNum < NUM_BUFFERGETCALLEE_INPUT_PORTS, portNum);
+
+    // Find the smallest bin that holds the request
+    U32 binIndex = 0;
+    while (binIndex < this->numBins && size > this->bins[binIndex].getBufferSize()) {
+      ++binIndex;
+    }
+
+    Cache& cache = this->caches[portNum];
+    bool claimed = false;
+    if (binIndex < this->numBins) {
+      claimed = claimCache(cache.claimed);
+    }
+
+    if (claimed) {
+      if (cache.count[binIndex] > 0) {
+        ++cache.hits;
+      }
+      else {
+        ++cache.misses;
+        this->mutex.lock();
+        this->refillCache(cache, binIndex);
+        this->mutex.unLock();
+      }
+      if (cache.count[binIndex] > 0) {
+        --cache.count[binIndex];
+        const U32 slot = cache.slots[binIndex][cache.count[binIndex]];
+        Bin& bin = this->bins[binIndex];
+        const U32 highWater = bin.getHighWater();
+        U8 *const address = bin.allocateCached(slot);
+        releaseCache(cache.claimed);
+        Fw::Buffer buffer;
+        buffer.set(
+            this->getInstance(),
+            (binIndex << BIN_ID_SHIFT) | slot,
+            reinterpret_cast<U64>(address),
+            size
+        );
+        // The telemetry and the warnings change only with the mutex
+        // locked. A stale read of the warnings delays ClearedErrorState
+        // to a later allocation
+        const bool raised = (bin.getHighWater() != highWater);
+        if (raised || !this->warnings.isClear()) {
+          this->mutex.lock();
+          if (raised) {
+            this->writeBinTelemetry(binIndex);
+          }
+          this->warnings.update(Warnings::Status::SUCCESS);
+          this->mutex.unLock();
+        }
+        return buffer;
+      }
+      // The bin is empty. Keep the cache while the larger bins are
+      // tried, so its buffers are not reclaimed
+    }
+
+    this->mutex.lock();
+    if (!claimed && binIndex < this->numBins) {
+      ++this->cacheBypasses;
+    }
+    Fw::Buffer buffer = this->allocateUncached(binIndex, size);
+    this->mutex.unLock();
+    if (claimed) {
+      releaseCache(cache.claimed);
+    }
+    return buffer;
+  }
+
+  Fw::Buffer BufferManager ::
+    allocateUncached(
+        const U32 binIndex,
+        const U32 size
+    )
+  {
+    Fw::Buffer buffer;
+    buffer.set(this->getInstance(), 0, 0, size);
+
+    // A request larger than every bin can never be granted
+    Warnings::Status::t warningStatus = Warnings::Status::STORE_SIZE_EXCEEDED;
+
+    for (U32 i = binIndex; i < this->numBins; ++i) {
+      Bin& bin = this->bins[i];
+      if (bin.getNumFree() == 0) {
+        this->reclaimCached(i);
+      }
+      const U32 highWater = bin.getHighWater();
+      U32 slot = 0;
+      U8 *address = 0;
+      if (bin.allocate(slot, address)) {
+        buffer.setbufferID((i << BIN_ID_SHIFT) | slot);
+        buffer.setdata(reinterpret_cast<U64>(address));
+        if (bin.getHighWater() != highWater) {
+          this->writeBinTelemetry(i);
+        }
+        warningStatus = Warnings::Status::SUCCESS;
+        break;
+      }
+      // Try the next larger bin
+      bin.fail();
+      this->writeBinTelemetry(i);
+      warningStatus = Warnings::Status::BINS_EXHAUSTED;
+    }
+
+    this->warnings.update(warningStatus);
+    return buffer;
+  }
+
+  void BufferManager ::
+    freeToBins(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &buffer
+    )
+  {
+    FW_ASSERT(portNum < NUM_BUFFERSENDIN_INPUT_PORTS, portNum);
+    const U32 bufferId = buffer.getbufferID();
+    const U32 binIndex = bufferId >> BIN_ID_SHIFT;
+    const U32 slot = bufferId & BIN_SLOT_MASK;
+    FW_ASSERT(binIndex < this->numBins, binIndex, this->numBins);
+    U8 *const address = reinterpret_cast<U8*>(buffer.getdata());
+
+    Cache& cache = this->caches[portNum];
+    if (claimCache(cache.claimed)) {
+      if (cache.count[binIndex] == BUFFERMANAGER_CACHE_SIZE) {
+        this->mutex.lock();
+        this->flushCache(cache, binIndex);
+        this->mutex.unLock();
+      }
+      this->bins[binIndex].freeCached(slot, address);
+      cache.slots[binIndex][cache.count[binIndex]] = slot;
+      ++cache.count[binIndex];
+      releaseCache(cache.claimed);
+      return;
+    }
+
+    this->mutex.lock();
+    this->bins[binIndex].free(slot, address);
+    this->mutex.unLock();
+  }
+
+  void BufferManager ::
+    refillCache(
+        Cache& cache,
+        const U32 binIndex
+    )
+  {
+    Bin& bin = this->bins[binIndex];
+    if (bin.getNumFree() == 0) {
+      this->reclaimCached(binIndex);
+    }
+    U32 slot = 0;
+    while (cache.count[binIndex] < BUFFERMANAGER_CACHE_BATCH && bin.cache(slot)) {
+      cache.slots[binIndex][cache.count[binIndex]] = slot;
+      ++cache.count[binIndex];
+    }
+  }
+
+  void BufferManager ::
+    flushCache(
+        Cache& cache,
+        const U32 binIndex
+    )
+  {
+    Bin& bin = this->bins[binIndex];
+    for (U32 i = 0; i < BUFFERMANAGER_CACHE_BATCH && cache.count[binIndex] > 0; ++i) {
+      --cache.count[binIndex];
+      bin.uncache(cache.slots[binIndex][cache.count[binIndex]]);
+    }
+  }
+
+  void BufferManager ::
+    reclaimCached(const U32 binIndex)
+  {
+    // A cache held by another thread is skipped, as is the caller's own
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(this->caches); ++i) {
+      Cache& cache = this->caches[i];
+      if (claimCache(cache.claimed)) {
+        while (cache.count[binIndex] > 0) {
+          --cache.count[binIndex];
+          this->bins[binIndex].uncache(cache.slots[binIndex][cache.count[binIndex]]);
+        }
+        releaseCache(cache.claimed);
+      }
+    }
+  }
+
+  void BufferManager ::
+    writeBinTelemetry(const U32 binIndex)
+  {
+    const Bin& bin = this->bins[binIndex];
+    switch (binIndex) {
+      case 0:
+        this->tlmWrite_BufferManager_Bin0HighWater(bin.getHighWater());
+        this->tlmWrite_BufferManager_Bin0Failures(bin.getFailures());
+        break;
+      case 1:
+        this->tlmWrite_BufferManager_Bin1HighWater(bin.getHighWater());
+        this->tlmWrite_BufferManager_Bin1Failures(bin.getFailures());
+        break;
+      case 2:
+        this->tlmWrite_BufferManager_Bin2HighWater(bin.getHighWater());
+        this->tlmWrite_BufferManager_Bin2Failures(bin.getFailures());
+        break;
+      case 3:
+        this->tlmWrite_BufferManager_Bin3HighWater(bin.getHighWater());
+        this->tlmWrite_BufferManager_Bin3Failures(bin.getFailures());
+        break;
+      default:
+        FW_ASSERT(0, binIndex);
+        break;
+    }
   }
 
 }
@@ -14,6 +14,8 @@
 #define BufferManager_HPP
 
 #include "Svc/BufferManager/BufferManagerComponentAc.hpp"
+#include "Svc/BufferManager/BufferManagerCfg.hpp"
+#include "Os/Mutex.hpp"
 
 namespace Svc {
 
@@ -21,6 +23,23 @@ namespace Svc {
     public BufferManagerComponentBase
   {
 
+    public:
+
+      // ----------------------------------------------------------------------
+      // Types
+      // ----------------------------------------------------------------------
+
+      //! The buffers of one bin
+      struct BinSpec {
+
+        //! The size of each buffer
+        U32 bufferSize;
+
+        //! The number of buffers
+        U32 numBuffers;
+
+      };
+
     PRIVATE:
 
       // ---------------------------------------------------------------------- 
@@ -41,6 +60,8 @@ namespace Svc {
               STORE_SIZE_EXCEEDED,
               //! Too many buffers
               TOO_MANY_BUFFERS,
+              //! No bin has a free buffer
+              BINS_EXHAUSTED,
             } t;
 
           };
@@ -59,6 +80,9 @@ namespace Svc {
             //! TooManyBuffers
             bool tooManyBuffers;
 
+            //! BinsExhausted
+            bool binsExhausted;
+
           };
 
         public:
@@ -75,6 +99,9 @@ namespace Svc {
               const Status::t status //!< The status
           );
 
+          //! Whether no warning is in effect
+          bool isClear(void) const;
+
         PRIVATE:
 
           //! The enclosing BufferManager
@@ -83,6 +110,10 @@ namespace Svc {
           //! The warning state
           State state;
 
+          //! Whether no warning is in effect. Written with the mutex
+          //! locked and read on the cache hit path without it
+          volatile bool clear;
+
       };
 
     PRIVATE:
@@ -282,6 +313,196 @@ namespace Svc {
 
       };
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // A bin of fixed-size buffers
+      // ----------------------------------------------------------------------
+
+      class Bin {
+
+        public:
+
+          // ----------------------------------------------------------------------
+          // Construction and destruction 
+          // ----------------------------------------------------------------------
+
+          // Construct an empty Bin
+          Bin(void);
+
+          // Destroy a Bin
+          ~Bin(void);
+
+        public:
+
+          // ----------------------------------------------------------------------
+          // Methods 
+          // ----------------------------------------------------------------------
+
+          // Allocate the memory of the bin. Call once, before allocating buffers
+          void setup(
+              const U32 bufferSize, //!< The size of each buffer
+              const U32 numBuffers //!< The number of buffers
+          );
+
+          // Get the size of each buffer
+          U32 getBufferSize(void) const;
+
+          // Get the most buffers held by clients at once. Buffers in
+          // client caches are not counted
+          U32 getHighWater(void) const;
+
+          // Get the number of failed allocations
+          U32 getFailures(void) const;
+
+          // Get the number of free buffers
+          U32 getNumFree(void) const;
+
+          // Allocate a buffer
+          // \return Whether a buffer was free
+          bool allocate(
+              U32& slot, //!< The slot of the buffer
+              U8* &address //!< The address of the buffer
+          );
+
+          // Record an allocation that found the bin empty
+          void fail(void);
+
+          // Free a buffer. Buffers may be freed in any order
+          void free(
+              const U32 slot, //!< The slot of the buffer
+              U8 *const address //!< The address of the buffer
+          );
+
+          // Move a free buffer to a client cache
+          // \return Whether a buffer was free
+          bool cache(
+              U32& slot //!< The slot of the buffer
+          );
+
+          // Move a buffer from a client cache back to the bin
+          void uncache(
+              const U32 slot //!< The slot of the buffer
+          );
+
+          // Allocate a buffer held by a client cache. Touches only the
+          // state of the slot, so the bin need not be locked
+          U8* allocateCached(
+              const U32 slot //!< The slot of the buffer
+          );
+
+          // Free a buffer into a client cache. Touches only the state of
+          // the slot, so the bin need not be locked
+          void freeCached(
+              const U32 slot, //!< The slot of the buffer
+              U8 *const address //!< The address of the buffer
+          );
+
+        PRIVATE:
+
+          // ----------------------------------------------------------------------
+          // Types
+          // ----------------------------------------------------------------------
+
+          // The state of a slot
+          typedef enum {
+            SLOT_FREE, // On the free stack
+            SLOT_CACHED, // In a client cache
+            SLOT_ALLOCATED // Held by a client
+          } SlotState;
+
+        PRIVATE:
+
+          // ----------------------------------------------------------------------
+          // Private methods
+          // ----------------------------------------------------------------------
+
+          // Pop a slot off the free stack
+          bool pop(U32& slot);
+
+          // Push a slot onto the free stack
+          void push(const U32 slot);
+
+          // Get the address of a slot
+          U8* getAddress(const U32 slot) const;
+
+          // Count a buffer handed to a client and update the high water mark
+          void hold(void);
+
+          // Count a buffer returned by a client
+          void release(void);
+
+        PRIVATE:
+
+          // ----------------------------------------------------------------------
+          // Variables
+          // ----------------------------------------------------------------------
+
+          // The size of each buffer
+          U32 bufferSize;
+
+          // The distance between buffers, rounded up so that each buffer is aligned
+          U32 stride;
+
+          // The number of buffers
+          U32 numBuffers;
+
+          // Pointer to the base of the bin memory
+          U8* memoryBase;
+
+          // Stack of the slots of the free buffers
+          U32* freeSlots;
+
+          // The number of free buffers
+          U32 numFree;
+
+          // The state of each slot
+          U8* states;
+
+          // The number of buffers held by clients. Cached buffers change
+          // hands without the lock, so this changes atomically
+          volatile U32 numHeld;
+
+          // The most buffers held by clients at once
+          volatile U32 highWater;
+
+          // The number of failed allocations
+          U32 failures;
+
+      };
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // A client cache of free buffers
+      // ----------------------------------------------------------------------
+
+      //! The free buffers of one pair of bufferGetCallee and bufferSendIn
+      //! ports. A thread claims the cache while it uses it, so a pair of
+      //! ports called from two threads at once stays safe: the second
+      //! thread goes to the bins
+      struct Cache {
+
+        //! Construct an empty Cache
+        Cache(void);
+
+        //! Nonzero while a thread holds the cache
+        volatile I32 claimed;
+
+        //! The number of buffers cached from each bin
+        U32 count[BUFFERMANAGER_MAX_BINS];
+
+        //! The slots of the buffers cached from each bin
+        U32 slots[BUFFERMANAGER_MAX_BINS][BUFFERMANAGER_CACHE_SIZE];
+
+        //! Allocations taken from the cache
+        volatile U32 hits;
+
+        //! Allocations that refilled the cache from the bins
+        volatile U32 misses;
+
+      };
+
     public:
 
       // ----------------------------------------------------------------------
@@ -296,6 +517,18 @@ namespace Svc {
           const U32 maxNumBuffers
       );
 
+      //! Construct object BufferManager in bin mode. Each request gets a
+      //! buffer from the smallest bin that holds it and has one free, and
+      //! buffers may be returned in any order. Each pair of bufferGetCallee
+      //! and bufferSendIn ports keeps a cache of free buffers, so most
+      //! requests do not lock the bins
+      //!
+      BufferManager(
+          const char *const compName, //!< The component name
+          const BinSpec *const binSpecs, //!< The bins, in increasing order of buffer size
+          const U32 numBins //!< The number of bins
+      );
+
       //! Initialize object BufferManager
       //!
       void init(
@@ -326,6 +559,70 @@ namespace Svc {
           Fw::Buffer &buffer
       );
 
+      //! Handler implementation for schedIn
+      //!
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          NATIVE_UINT_TYPE context //!< The call order
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Private helper methods
+      // ----------------------------------------------------------------------
+
+      //! Allocate a buffer from the client cache, or from the bins
+      //!
+      Fw::Buffer allocateFromBins(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          const U32 size //!< The requested size
+      );
+
+      //! Allocate a buffer from the bins, starting with the smallest bin
+      //! that holds it. Call with the mutex locked
+      //!
+      Fw::Buffer allocateUncached(
+          const U32 binIndex, //!< The smallest bin that holds the request
+          const U32 size //!< The requested size
+      );
+
+      //! Return a buffer to the client cache, or to its bin
+      //!
+      void freeToBins(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          Fw::Buffer &buffer //!< The buffer
+      );
+
+      //! Move a batch of buffers from a bin to a cache the caller holds.
+      //! Call with the mutex locked
+      //!
+      void refillCache(
+          Cache& cache, //!< The cache
+          const U32 binIndex //!< The bin index
+      );
+
+      //! Move a batch of buffers from a cache the caller holds to its bin.
+      //! Call with the mutex locked
+      //!
+      void flushCache(
+          Cache& cache, //!< The cache
+          const U32 binIndex //!< The bin index
+      );
+
+      //! Move the buffers of a bin from the caches no other thread holds
+      //! back to the bin. Call with the mutex locked
+      //!
+      void reclaimCached(
+          const U32 binIndex //!< The bin index
+      );
+
+      //! Write the telemetry of a bin
+      //!
+      void writeBinTelemetry(
+          const U32 binIndex //!< The bin index
+      );
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -341,6 +638,27 @@ namespace Svc {
       //! The allocation queue
       AllocationQueue allocationQueue;
 
+      //! The number of bins, or zero if the store and allocation queue are used
+      const U32 numBins;
+
+      //! The bins
+      Bin bins[BUFFERMANAGER_MAX_BINS];
+
+      //! Guards the store, the allocation queue, the bins, and the warnings
+      Os::Mutex mutex;
+
+      //! The client caches, one for each pair of ports
+      Cache caches[NUM_BUFFERGETCALLEE_INPUT_PORTS];
+
+      //! Allocations that went to the bins because another thread held the cache
+      U32 cacheBypasses;
+
+      //! The cache hits at the last schedIn call
+      U32 lastCacheHits;
+
+      //! The cache misses at the last schedIn call
+      U32 lastCacheMisses;
+
     };
 
 }
@@ -0,0 +1,21 @@
+/*
+ * BufferManagerCfg.hpp
+ *
+ *  Configuration for the BufferManager component
+ */
+
+#ifndef BUFFERMANAGER_BUFFERMANAGERCFG_HPP_
+#define BUFFERMANAGER_BUFFERMANAGERCFG_HPP_
+
+// Anonymous namespace for configuration parameters
+namespace {
+
+    enum {
+        BUFFERMANAGER_MAX_BINS = 4, // !< Most bins of a BufferManager in bin mode. Each bin has its own telemetry channels
+        BUFFERMANAGER_CACHE_SIZE = 16, // !< Most free buffers of each bin a client cache holds
+        BUFFERMANAGER_CACHE_BATCH = 8 // !< Buffers moved between a client cache and its bin at once
+    };
+
+}
+
+#endif /* BUFFERMANAGER_BUFFERMANAGERCFG_HPP_ */
@@ -4,6 +4,6 @@
 
 SRC = BufferManagerComponentAi.xml BufferManager.cpp
 
-HDR = BufferManager.hpp
+HDR = BufferManager.hpp BufferManagerCfg.hpp
 
 SUBDIRS = test
@@ -163,6 +163,556 @@ namespace Svc {
       << "  Actual:   " << e.arg << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin0HighWater
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin0HighWater_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin0HighWater->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin0HighWater\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin0HighWater->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin0HighWater(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin0HighWater->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin0HighWater\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin0HighWater->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin0HighWater& e =
+      this->tlmHistory_BufferManager_Bin0HighWater->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin0HighWater\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin0Failures
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin0Failures_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin0Failures->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin0Failures\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin0Failures->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin0Failures(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin0Failures->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin0Failures\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin0Failures->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin0Failures& e =
+      this->tlmHistory_BufferManager_Bin0Failures->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin0Failures\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin1HighWater
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin1HighWater_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin1HighWater->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin1HighWater\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin1HighWater->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin1HighWater(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin1HighWater->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin1HighWater\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin1HighWater->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin1HighWater& e =
+      this->tlmHistory_BufferManager_Bin1HighWater->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin1HighWater\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin1Failures
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin1Failures_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin1Failures->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin1Failures\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin1Failures->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin1Failures(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin1Failures->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin1Failures\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin1Failures->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin1Failures& e =
+      this->tlmHistory_BufferManager_Bin1Failures->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin1Failures\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin2HighWater
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin2HighWater_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin2HighWater->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin2HighWater\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin2HighWater->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin2HighWater(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin2HighWater->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin2HighWater\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin2HighWater->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin2HighWater& e =
+      this->tlmHistory_BufferManager_Bin2HighWater->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin2HighWater\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin2Failures
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin2Failures_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin2Failures->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin2Failures\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin2Failures->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin2Failures(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin2Failures->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin2Failures\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin2Failures->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin2Failures& e =
+      this->tlmHistory_BufferManager_Bin2Failures->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin2Failures\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin3HighWater
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin3HighWater_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin3HighWater->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin3HighWater\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin3HighWater->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin3HighWater(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin3HighWater->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin3HighWater\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin3HighWater->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin3HighWater& e =
+      this->tlmHistory_BufferManager_Bin3HighWater->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin3HighWater\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_Bin3Failures
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin3Failures_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_Bin3Failures->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_Bin3Failures\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_Bin3Failures->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_Bin3Failures(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_Bin3Failures->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_Bin3Failures\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_Bin3Failures->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_Bin3Failures& e =
+      this->tlmHistory_BufferManager_Bin3Failures->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_Bin3Failures\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_CacheHits
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_CacheHits_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_CacheHits->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_CacheHits\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_CacheHits->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_CacheHits(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_CacheHits->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_CacheHits\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_CacheHits->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_CacheHits& e =
+      this->tlmHistory_BufferManager_CacheHits->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_CacheHits\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_CacheMisses
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_CacheMisses_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_CacheMisses->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_CacheMisses\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_CacheMisses->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_CacheMisses(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_CacheMisses->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_CacheMisses\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_CacheMisses->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_CacheMisses& e =
+      this->tlmHistory_BufferManager_CacheMisses->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_CacheMisses\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_CacheHitRate
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_CacheHitRate_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_CacheHitRate->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_CacheHitRate\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_CacheHitRate->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_CacheHitRate(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const F32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_CacheHitRate->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_CacheHitRate\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_CacheHitRate->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_CacheHitRate& e =
+      this->tlmHistory_BufferManager_CacheHitRate->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_CacheHitRate\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // Events
   // ----------------------------------------------------------------------
@@ -243,4 +793,24 @@ namespace Svc {
       << "  Actual:   " << this->eventsSize_TooManyBuffers << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Event: BinsExhausted
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertEvents_BinsExhausted_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventsSize_BinsExhausted)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event BinsExhausted\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventsSize_BinsExhausted << "\n";
+  }
+
 } // end namespace Svc
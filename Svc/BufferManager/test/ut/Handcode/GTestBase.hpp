@@ -35,6 +35,72 @@
 #define ASSERT_TLM_BufferManager_AllocatedSize(index, value) \
   this->assertTlm_BufferManager_AllocatedSize(__FILE__, __LINE__, index, value)
 
+#define ASSERT_TLM_BufferManager_Bin0HighWater_SIZE(size) \
+  this->assertTlm_BufferManager_Bin0HighWater_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin0HighWater(index, value) \
+  this->assertTlm_BufferManager_Bin0HighWater(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_Bin0Failures_SIZE(size) \
+  this->assertTlm_BufferManager_Bin0Failures_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin0Failures(index, value) \
+  this->assertTlm_BufferManager_Bin0Failures(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_Bin1HighWater_SIZE(size) \
+  this->assertTlm_BufferManager_Bin1HighWater_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin1HighWater(index, value) \
+  this->assertTlm_BufferManager_Bin1HighWater(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_Bin1Failures_SIZE(size) \
+  this->assertTlm_BufferManager_Bin1Failures_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin1Failures(index, value) \
+  this->assertTlm_BufferManager_Bin1Failures(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_Bin2HighWater_SIZE(size) \
+  this->assertTlm_BufferManager_Bin2HighWater_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin2HighWater(index, value) \
+  this->assertTlm_BufferManager_Bin2HighWater(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_Bin2Failures_SIZE(size) \
+  this->assertTlm_BufferManager_Bin2Failures_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin2Failures(index, value) \
+  this->assertTlm_BufferManager_Bin2Failures(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_Bin3HighWater_SIZE(size) \
+  this->assertTlm_BufferManager_Bin3HighWater_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin3HighWater(index, value) \
+  this->assertTlm_BufferManager_Bin3HighWater(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_Bin3Failures_SIZE(size) \
+  this->assertTlm_BufferManager_Bin3Failures_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_Bin3Failures(index, value) \
+  this->assertTlm_BufferManager_Bin3Failures(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_CacheHits_SIZE(size) \
+  this->assertTlm_BufferManager_CacheHits_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_CacheHits(index, value) \
+  this->assertTlm_BufferManager_CacheHits(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_CacheMisses_SIZE(size) \
+  this->assertTlm_BufferManager_CacheMisses_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_CacheMisses(index, value) \
+  this->assertTlm_BufferManager_CacheMisses(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_CacheHitRate_SIZE(size) \
+  this->assertTlm_BufferManager_CacheHitRate_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_CacheHitRate(index, value) \
+  this->assertTlm_BufferManager_CacheHitRate(__FILE__, __LINE__, index, value)
+
 // ----------------------------------------------------------------------
 // Macros for event history assertions 
 // ----------------------------------------------------------------------
@@ -51,6 +117,9 @@
 #define ASSERT_EVENTS_TooManyBuffers_SIZE(size) \
   this->assertEvents_TooManyBuffers_size(__FILE__, __LINE__, size)
 
+#define ASSERT_EVENTS_BinsExhausted_SIZE(size) \
+  this->assertEvents_BinsExhausted_size(__FILE__, __LINE__, size)
+
 namespace Svc {
 
   //! \class BufferManagerGTestBase
@@ -137,6 +206,237 @@ namespace Svc {
           const U32& val /*!< The channel value*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin0HighWater
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin0HighWater_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin0HighWater(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin0Failures
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin0Failures_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin0Failures(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin1HighWater
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin1HighWater_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin1HighWater(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin1Failures
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin1Failures_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin1Failures(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin2HighWater
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin2HighWater_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin2HighWater(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin2Failures
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin2Failures_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin2Failures(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin3HighWater
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin3HighWater_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin3HighWater(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin3Failures
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_Bin3Failures_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_Bin3Failures(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_CacheHits
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_CacheHits_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_CacheHits(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_CacheMisses
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_CacheMisses_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_CacheMisses(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_CacheHitRate
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_CacheHitRate_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_CacheHitRate(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const F32& val /*!< The channel value*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -185,6 +485,18 @@ namespace Svc {
           const U32 size /*!< The asserted size*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BinsExhausted
+      // ----------------------------------------------------------------------
+
+      void assertEvents_BinsExhausted_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
   };
 
 } // end namespace Svc
@@ -40,6 +40,28 @@ namespace Svc {
       new History<TlmEntry_BufferManager_NumAllocatedBuffers>(maxHistorySize);
     this->tlmHistory_BufferManager_AllocatedSize = 
       new History<TlmEntry_BufferManager_AllocatedSize>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin0HighWater = 
+      new History<TlmEntry_BufferManager_Bin0HighWater>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin0Failures = 
+      new History<TlmEntry_BufferManager_Bin0Failures>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin1HighWater = 
+      new History<TlmEntry_BufferManager_Bin1HighWater>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin1Failures = 
+      new History<TlmEntry_BufferManager_Bin1Failures>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin2HighWater = 
+      new History<TlmEntry_BufferManager_Bin2HighWater>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin2Failures = 
+      new History<TlmEntry_BufferManager_Bin2Failures>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin3HighWater = 
+      new History<TlmEntry_BufferManager_Bin3HighWater>(maxHistorySize);
+    this->tlmHistory_BufferManager_Bin3Failures = 
+      new History<TlmEntry_BufferManager_Bin3Failures>(maxHistorySize);
+    this->tlmHistory_BufferManager_CacheHits = 
+      new History<TlmEntry_BufferManager_CacheHits>(maxHistorySize);
+    this->tlmHistory_BufferManager_CacheMisses = 
+      new History<TlmEntry_BufferManager_CacheMisses>(maxHistorySize);
+    this->tlmHistory_BufferManager_CacheHitRate = 
+      new History<TlmEntry_BufferManager_CacheHitRate>(maxHistorySize);
     // Initialize event histories
 #if FW_ENABLE_TEXT_LOGGING
     this->textLogHistory = new History<TextLogEntry>(maxHistorySize);
@@ -54,6 +76,17 @@ namespace Svc {
     // Destroy telemetry histories
     delete this->tlmHistory_BufferManager_NumAllocatedBuffers;
     delete this->tlmHistory_BufferManager_AllocatedSize;
+    delete this->tlmHistory_BufferManager_Bin0HighWater;
+    delete this->tlmHistory_BufferManager_Bin0Failures;
+    delete this->tlmHistory_BufferManager_Bin1HighWater;
+    delete this->tlmHistory_BufferManager_Bin1Failures;
+    delete this->tlmHistory_BufferManager_Bin2HighWater;
+    delete this->tlmHistory_BufferManager_Bin2Failures;
+    delete this->tlmHistory_BufferManager_Bin3HighWater;
+    delete this->tlmHistory_BufferManager_Bin3Failures;
+    delete this->tlmHistory_BufferManager_CacheHits;
+    delete this->tlmHistory_BufferManager_CacheMisses;
+    delete this->tlmHistory_BufferManager_CacheHitRate;
     // Destroy event histories
 #if FW_ENABLE_TEXT_LOGGING
     delete this->textLogHistory;
@@ -234,6 +267,29 @@ namespace Svc {
 
     }
 
+    // Initialize output port schedIn
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_to_schedIn();
+        ++_port
+    ) {
+      this->m_to_schedIn[_port].init();
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_to_schedIn[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_to_schedIn[_port].setObjName(_portName);
+#endif
+
+    }
+
   }
 
   // ----------------------------------------------------------------------
@@ -272,6 +328,12 @@ namespace Svc {
     return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_to_bufferGetCallee);
   }
 
+  NATIVE_INT_TYPE BufferManagerTesterBase ::
+    getNum_to_schedIn(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_to_schedIn);
+  }
+
   NATIVE_INT_TYPE BufferManagerTesterBase ::
     getNum_from_tlmOut(void) const
   {
@@ -302,6 +364,16 @@ namespace Svc {
     this->m_to_bufferGetCallee[portNum].addCallPort(bufferGetCallee);
   }
 
+  void BufferManagerTesterBase ::
+    connect_to_schedIn(
+        const NATIVE_INT_TYPE portNum,
+        Svc::InputSchedPort *const schedIn
+    ) 
+  {
+    FW_ASSERT(portNum < this->getNum_to_schedIn(),static_cast<AssertArg>(portNum));
+    this->m_to_schedIn[portNum].addCallPort(schedIn);
+  }
+
 
   // ----------------------------------------------------------------------
   // Invocation functions for to ports
@@ -333,6 +405,19 @@ namespace Svc {
     );
   }
 
+  void BufferManagerTesterBase ::
+    invoke_to_schedIn(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_to_schedIn(),static_cast<AssertArg>(portNum));
+    FW_ASSERT(portNum < this->getNum_to_schedIn(),static_cast<AssertArg>(portNum));
+    this->m_to_schedIn[portNum].invoke(
+        context
+    );
+  }
+
   // ----------------------------------------------------------------------
   // Connection status for to ports
   // ----------------------------------------------------------------------
@@ -351,6 +436,13 @@ namespace Svc {
     return this->m_to_bufferGetCallee[portNum].isConnected();
   }
 
+  bool BufferManagerTesterBase ::
+    isConnected_to_schedIn(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_to_schedIn(), static_cast<AssertArg>(portNum));
+    return this->m_to_schedIn[portNum].isConnected();
+  }
+
   // ----------------------------------------------------------------------
   // Getters for from ports
   // ----------------------------------------------------------------------
@@ -512,6 +604,138 @@ namespace Svc {
         break;
       }
 
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN0HIGHWATER:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin0HighWater: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin0HighWater(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN0FAILURES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin0Failures: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin0Failures(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN1HIGHWATER:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin1HighWater: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin1HighWater(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN1FAILURES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin1Failures: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin1Failures(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN2HIGHWATER:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin2HighWater: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin2HighWater(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN2FAILURES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin2Failures: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin2Failures(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN3HIGHWATER:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin3HighWater: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin3HighWater(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_BIN3FAILURES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_Bin3Failures: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_Bin3Failures(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_CACHEHITS:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_CacheHits: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_CacheHits(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_CACHEMISSES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_CacheMisses: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_CacheMisses(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_CACHEHITRATE:
+      {
+        F32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_CacheHitRate: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_CacheHitRate(timeTag, arg);
+        break;
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -527,6 +751,17 @@ namespace Svc {
     this->tlmSize = 0;
     this->tlmHistory_BufferManager_NumAllocatedBuffers->clear();
     this->tlmHistory_BufferManager_AllocatedSize->clear();
+    this->tlmHistory_BufferManager_Bin0HighWater->clear();
+    this->tlmHistory_BufferManager_Bin0Failures->clear();
+    this->tlmHistory_BufferManager_Bin1HighWater->clear();
+    this->tlmHistory_BufferManager_Bin1Failures->clear();
+    this->tlmHistory_BufferManager_Bin2HighWater->clear();
+    this->tlmHistory_BufferManager_Bin2Failures->clear();
+    this->tlmHistory_BufferManager_Bin3HighWater->clear();
+    this->tlmHistory_BufferManager_Bin3Failures->clear();
+    this->tlmHistory_BufferManager_CacheHits->clear();
+    this->tlmHistory_BufferManager_CacheMisses->clear();
+    this->tlmHistory_BufferManager_CacheHitRate->clear();
   }
 
   // ---------------------------------------------------------------------- 
@@ -559,6 +794,171 @@ namespace Svc {
     ++this->tlmSize;
   }
 
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin0HighWater
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin0HighWater(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin0HighWater e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin0HighWater->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin0Failures
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin0Failures(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin0Failures e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin0Failures->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin1HighWater
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin1HighWater(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin1HighWater e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin1HighWater->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin1Failures
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin1Failures(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin1Failures e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin1Failures->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin2HighWater
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin2HighWater(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin2HighWater e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin2HighWater->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin2Failures
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin2Failures(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin2Failures e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin2Failures->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin3HighWater
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin3HighWater(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin3HighWater e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin3HighWater->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_Bin3Failures
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_Bin3Failures(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_Bin3Failures e = { timeTag, val };
+    this->tlmHistory_BufferManager_Bin3Failures->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_CacheHits
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_CacheHits(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_CacheHits e = { timeTag, val };
+    this->tlmHistory_BufferManager_CacheHits->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_CacheMisses
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_CacheMisses(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_CacheMisses e = { timeTag, val };
+    this->tlmHistory_BufferManager_CacheMisses->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_CacheHitRate
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_CacheHitRate(
+        const Fw::Time& timeTag,
+        const F32& val
+    )
+  {
+    TlmEntry_BufferManager_CacheHitRate e = { timeTag, val };
+    this->tlmHistory_BufferManager_CacheHitRate->push_back(e);
+    ++this->tlmSize;
+  }
+
   // ----------------------------------------------------------------------
   // Event dispatch
   // ----------------------------------------------------------------------
@@ -635,6 +1035,25 @@ namespace Svc {
 
       }
 
+      case BufferManagerComponentBase::EVENTID_BINSEXHAUSTED: 
+      {
+
+#if FW_AMPCS_COMPATIBLE
+        // For AMPCS, decode zero arguments
+        Fw::SerializeStatus _zero_status = Fw::FW_SERIALIZE_OK;
+        U8 _noArgs;
+        _zero_status = args.deserialize(_noArgs);
+        FW_ASSERT(
+            _zero_status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_zero_status)
+        );
+#endif    
+        this->logIn_WARNING_HI_BinsExhausted();
+
+        break;
+
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -651,6 +1070,7 @@ namespace Svc {
     this->eventsSize_ClearedErrorState = 0;
     this->eventsSize_StoreSizeExceeded = 0;
     this->eventsSize_TooManyBuffers = 0;
+    this->eventsSize_BinsExhausted = 0;
   }
 
 #if FW_ENABLE_TEXT_LOGGING
@@ -770,4 +1190,17 @@ namespace Svc {
     ++this->eventsSize;
   }
 
+  // ----------------------------------------------------------------------
+  // Event: BinsExhausted 
+  // ----------------------------------------------------------------------
+
+  void BufferManagerTesterBase ::
+    logIn_WARNING_HI_BinsExhausted(
+        void
+    )
+  {
+    ++this->eventsSize_BinsExhausted;
+    ++this->eventsSize;
+  }
+
 } // end namespace Svc
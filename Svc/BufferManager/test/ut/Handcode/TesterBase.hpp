@@ -61,6 +61,13 @@ namespace Svc {
           Fw::InputBufferGetPort *const bufferGetCallee /*!< The port*/
       );
 
+      //! Connect schedIn to to_schedIn[portNum]
+      //!
+      void connect_to_schedIn(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Svc::InputSchedPort *const schedIn /*!< The port*/
+      );
+
     public:
 
       // ----------------------------------------------------------------------
@@ -223,6 +230,13 @@ namespace Svc {
           U32 size 
       );
 
+      //! Invoke the to port connected to schedIn
+      //!
+      void invoke_to_schedIn(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
     public:
 
       // ----------------------------------------------------------------------
@@ -261,6 +275,12 @@ namespace Svc {
       //!
       NATIVE_INT_TYPE getNum_to_bufferGetCallee(void) const;
 
+      //! Get the number of to_schedIn ports
+      //!
+      //! \return The number of to_schedIn ports
+      //!
+      NATIVE_INT_TYPE getNum_to_schedIn(void) const;
+
       //! Get the number of from_tlmOut ports
       //!
       //! \return The number of from_tlmOut ports
@@ -289,6 +309,14 @@ namespace Svc {
           const NATIVE_INT_TYPE portNum /*!< The port number*/
       );
 
+      //! Check whether port is connected
+      //!
+      //! Whether to_schedIn[portNum] is connected
+      //!
+      bool isConnected_to_schedIn(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -403,6 +431,22 @@ namespace Svc {
       //!
       U32 eventsSize_TooManyBuffers;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: BinsExhausted
+      // ----------------------------------------------------------------------
+
+      //! Handle event BinsExhausted
+      //!
+      virtual void logIn_WARNING_HI_BinsExhausted(
+          void
+      );
+
+      //! Size of history for event BinsExhausted
+      //!
+      U32 eventsSize_BinsExhausted;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -475,6 +519,281 @@ namespace Svc {
       History<TlmEntry_BufferManager_AllocatedSize> 
         *tlmHistory_BufferManager_AllocatedSize;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin0HighWater
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin0HighWater
+      //!
+      virtual void tlmInput_BufferManager_Bin0HighWater(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin0HighWater
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin0HighWater;
+
+      //! The history of BufferManager_Bin0HighWater values
+      //!
+      History<TlmEntry_BufferManager_Bin0HighWater> 
+        *tlmHistory_BufferManager_Bin0HighWater;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin0Failures
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin0Failures
+      //!
+      virtual void tlmInput_BufferManager_Bin0Failures(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin0Failures
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin0Failures;
+
+      //! The history of BufferManager_Bin0Failures values
+      //!
+      History<TlmEntry_BufferManager_Bin0Failures> 
+        *tlmHistory_BufferManager_Bin0Failures;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin1HighWater
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin1HighWater
+      //!
+      virtual void tlmInput_BufferManager_Bin1HighWater(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin1HighWater
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin1HighWater;
+
+      //! The history of BufferManager_Bin1HighWater values
+      //!
+      History<TlmEntry_BufferManager_Bin1HighWater> 
+        *tlmHistory_BufferManager_Bin1HighWater;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin1Failures
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin1Failures
+      //!
+      virtual void tlmInput_BufferManager_Bin1Failures(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin1Failures
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin1Failures;
+
+      //! The history of BufferManager_Bin1Failures values
+      //!
+      History<TlmEntry_BufferManager_Bin1Failures> 
+        *tlmHistory_BufferManager_Bin1Failures;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin2HighWater
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin2HighWater
+      //!
+      virtual void tlmInput_BufferManager_Bin2HighWater(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin2HighWater
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin2HighWater;
+
+      //! The history of BufferManager_Bin2HighWater values
+      //!
+      History<TlmEntry_BufferManager_Bin2HighWater> 
+        *tlmHistory_BufferManager_Bin2HighWater;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin2Failures
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin2Failures
+      //!
+      virtual void tlmInput_BufferManager_Bin2Failures(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin2Failures
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin2Failures;
+
+      //! The history of BufferManager_Bin2Failures values
+      //!
+      History<TlmEntry_BufferManager_Bin2Failures> 
+        *tlmHistory_BufferManager_Bin2Failures;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin3HighWater
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin3HighWater
+      //!
+      virtual void tlmInput_BufferManager_Bin3HighWater(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin3HighWater
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin3HighWater;
+
+      //! The history of BufferManager_Bin3HighWater values
+      //!
+      History<TlmEntry_BufferManager_Bin3HighWater> 
+        *tlmHistory_BufferManager_Bin3HighWater;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_Bin3Failures
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_Bin3Failures
+      //!
+      virtual void tlmInput_BufferManager_Bin3Failures(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_Bin3Failures
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_Bin3Failures;
+
+      //! The history of BufferManager_Bin3Failures values
+      //!
+      History<TlmEntry_BufferManager_Bin3Failures> 
+        *tlmHistory_BufferManager_Bin3Failures;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_CacheHits
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_CacheHits
+      //!
+      virtual void tlmInput_BufferManager_CacheHits(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_CacheHits
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_CacheHits;
+
+      //! The history of BufferManager_CacheHits values
+      //!
+      History<TlmEntry_BufferManager_CacheHits> 
+        *tlmHistory_BufferManager_CacheHits;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_CacheMisses
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_CacheMisses
+      //!
+      virtual void tlmInput_BufferManager_CacheMisses(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_CacheMisses
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_CacheMisses;
+
+      //! The history of BufferManager_CacheMisses values
+      //!
+      History<TlmEntry_BufferManager_CacheMisses> 
+        *tlmHistory_BufferManager_CacheMisses;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_CacheHitRate
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_CacheHitRate
+      //!
+      virtual void tlmInput_BufferManager_CacheHitRate(
+          const Fw::Time& timeTag, /*!< The time*/
+          const F32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_CacheHitRate
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        F32 arg;
+      } TlmEntry_BufferManager_CacheHitRate;
+
+      //! The history of BufferManager_CacheHitRate values
+      //!
+      History<TlmEntry_BufferManager_CacheHitRate> 
+        *tlmHistory_BufferManager_CacheHitRate;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -495,11 +814,15 @@ namespace Svc {
 
       //! To port connected to bufferSendIn
       //!
-      Fw::OutputBufferSendPort m_to_bufferSendIn[1];
+      Fw::OutputBufferSendPort m_to_bufferSendIn[4];
 
       //! To port connected to bufferGetCallee
       //!
-      Fw::OutputBufferGetPort m_to_bufferGetCallee[1];
+      Fw::OutputBufferGetPort m_to_bufferGetCallee[4];
+
+      //! To port connected to schedIn
+      //!
+      Svc::OutputSchedPort m_to_schedIn[1];
 
     private:
 
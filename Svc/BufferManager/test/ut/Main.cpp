@@ -9,6 +9,30 @@ TEST(Test, ThreeBufferProblem) {
   tester.three_buffer_problem();
 }
 
+namespace {
+
+  const Svc::BufferManager::BinSpec BIN_SPECS[] = {
+    { 16, 4 },
+    { 64, 2 }
+  };
+
+}
+
+TEST(Test, BinsOutOfOrder) {
+  Svc::Tester tester(BIN_SPECS, FW_NUM_ARRAY_ELEMENTS(BIN_SPECS));
+  tester.binsOutOfOrder();
+}
+
+TEST(Test, BinsExhausted) {
+  Svc::Tester tester(BIN_SPECS, FW_NUM_ARRAY_ELEMENTS(BIN_SPECS));
+  tester.binsExhausted();
+}
+
+TEST(Test, BinCaches) {
+  Svc::Tester tester(BIN_SPECS, FW_NUM_ARRAY_ELEMENTS(BIN_SPECS));
+  tester.binCaches();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
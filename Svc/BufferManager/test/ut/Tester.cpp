@@ -35,6 +35,23 @@ namespace Svc {
     this->connectPorts();
   }
 
+  Tester ::
+    Tester(
+        const BufferManager::BinSpec *const binSpecs,
+        const U32 numBins
+    ) :
+#if FW_OBJECT_NAMES == 1
+      BufferManagerGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("BufferManager", binSpecs, numBins)
+#else
+      BufferManagerGTestBase(MAX_HISTORY_SIZE),
+      component(binSpecs, numBins)
+#endif
+  {
+    this->initComponents();
+    this->connectPorts();
+  }
+
   Tester ::
     ~Tester(void) 
   {
@@ -63,6 +80,124 @@ namespace Svc {
       ASSERT_EQ(0xDEADBEEF,*((U32*)buffer2.getdata()));
   }
 
+  void Tester ::
+    binsOutOfOrder(void)
+  {
+    Fw::Buffer buffers[4];
+    for (U32 i = 0; i < 4; ++i) {
+      buffers[i] = this->invoke_to_bufferGetCallee(0, 16);
+      ASSERT_NE(0U, buffers[i].getdata());
+      ASSERT_EQ(16U, buffers[i].getsize());
+      *((U32*)buffers[i].getdata()) = i;
+    }
+    // Return the middle buffers first; the others stay intact
+    this->invoke_to_bufferSendIn(0, buffers[2]);
+    this->invoke_to_bufferSendIn(0, buffers[1]);
+    ASSERT_EQ(0U, *((U32*)buffers[0].getdata()));
+    ASSERT_EQ(3U, *((U32*)buffers[3].getdata()));
+    // Freed buffers are reused at once, in any order
+    Fw::Buffer buffer = this->invoke_to_bufferGetCallee(0, 8);
+    ASSERT_EQ(buffers[1].getdata(), buffer.getdata());
+    *((U32*)buffer.getdata()) = 0xDEADBEEF;
+    ASSERT_EQ(0U, *((U32*)buffers[0].getdata()));
+    ASSERT_EQ(3U, *((U32*)buffers[3].getdata()));
+    this->invoke_to_bufferSendIn(0, buffers[3]);
+    this->invoke_to_bufferSendIn(0, buffers[0]);
+    this->invoke_to_bufferSendIn(0, buffer);
+    ASSERT_EVENTS_SIZE(0);
+    // Only the high water mark of the small bin moved
+    ASSERT_TLM_SIZE(8);
+    ASSERT_TLM_BufferManager_Bin0HighWater_SIZE(4);
+    ASSERT_TLM_BufferManager_Bin0HighWater(3, 4);
+    ASSERT_TLM_BufferManager_Bin0Failures(3, 0);
+  }
+
+  void Tester ::
+    binsExhausted(void)
+  {
+    // Fill the small bin
+    Fw::Buffer small[4];
+    for (U32 i = 0; i < 4; ++i) {
+      small[i] = this->invoke_to_bufferGetCallee(0, 16);
+      ASSERT_NE(0U, small[i].getdata());
+    }
+    this->clearHistory();
+    // Small requests fall back to the large bin
+    Fw::Buffer large[2];
+    for (U32 i = 0; i < 2; ++i) {
+      large[i] = this->invoke_to_bufferGetCallee(0, 4);
+      ASSERT_NE(0U, large[i].getdata());
+      ASSERT_EQ(4U, large[i].getsize());
+    }
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_TLM_BufferManager_Bin0Failures_SIZE(2);
+    ASSERT_TLM_BufferManager_Bin0Failures(1, 2);
+    ASSERT_TLM_BufferManager_Bin1HighWater_SIZE(2);
+    ASSERT_TLM_BufferManager_Bin1HighWater(1, 2);
+    // Both bins are empty
+    Fw::Buffer buffer = this->invoke_to_bufferGetCallee(0, 4);
+    ASSERT_EQ(0U, buffer.getdata());
+    buffer = this->invoke_to_bufferGetCallee(0, 64);
+    ASSERT_EQ(0U, buffer.getdata());
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_BinsExhausted_SIZE(1);
+    ASSERT_TLM_BufferManager_Bin0Failures(2, 3);
+    ASSERT_TLM_BufferManager_Bin1Failures(3, 2);
+    // No bin is large enough
+    buffer = this->invoke_to_bufferGetCallee(0, 65);
+    ASSERT_EQ(0U, buffer.getdata());
+    ASSERT_EVENTS_StoreSizeExceeded_SIZE(1);
+    // Return a large buffer and clear the error state
+    this->invoke_to_bufferSendIn(0, large[0]);
+    buffer = this->invoke_to_bufferGetCallee(0, 64);
+    ASSERT_EQ(large[0].getdata(), buffer.getdata());
+    ASSERT_EVENTS_ClearedErrorState_SIZE(1);
+    ASSERT_EVENTS_SIZE(3);
+    this->invoke_to_bufferSendIn(0, buffer);
+    this->invoke_to_bufferSendIn(0, large[1]);
+    for (U32 i = 0; i < 4; ++i) {
+      this->invoke_to_bufferSendIn(0, small[3 - i]);
+    }
+  }
+
+  void Tester ::
+    binCaches(void)
+  {
+    // The first allocation fills the cache of client 0
+    Fw::Buffer buffers[4];
+    for (U32 i = 0; i < 4; ++i) {
+      buffers[i] = this->invoke_to_bufferGetCallee(0, 16);
+      ASSERT_NE(0U, buffers[i].getdata());
+    }
+    // Client 1 frees them into its own cache
+    for (U32 i = 0; i < 4; ++i) {
+      this->invoke_to_bufferSendIn(1, buffers[i]);
+    }
+    // The small bin is empty, so client 0 takes them back
+    Fw::Buffer buffer = this->invoke_to_bufferGetCallee(0, 16);
+    ASSERT_NE(0U, buffer.getdata());
+    ASSERT_EVENTS_SIZE(0);
+    // Buffers in the caches do not count toward the high water mark
+    ASSERT_TLM_BufferManager_Bin0HighWater_SIZE(4);
+    ASSERT_TLM_BufferManager_Bin0HighWater(3, 4);
+    ASSERT_TLM_BufferManager_Bin0Failures(3, 0);
+    this->clearHistory();
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_SIZE(3);
+    ASSERT_TLM_BufferManager_CacheHits(0, 3);
+    ASSERT_TLM_BufferManager_CacheMisses(0, 2);
+    ASSERT_TLM_BufferManager_CacheHitRate(0, 60);
+    // A buffer freed and allocated by the same client is a hit
+    this->invoke_to_bufferSendIn(0, buffer);
+    Fw::Buffer again = this->invoke_to_bufferGetCallee(0, 16);
+    ASSERT_EQ(buffer.getdata(), again.getdata());
+    this->invoke_to_schedIn(0, 0);
+    ASSERT_TLM_BufferManager_CacheHits(1, 4);
+    ASSERT_TLM_BufferManager_CacheMisses(1, 2);
+    ASSERT_TLM_BufferManager_CacheHitRate(1, 100);
+    this->invoke_to_bufferSendIn(0, again);
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods 
   // ----------------------------------------------------------------------
@@ -72,15 +207,25 @@ namespace Svc {
   {
 
     // bufferSendIn
-    this->connect_to_bufferSendIn(
-        0,
-        this->component.get_bufferSendIn_InputPort(0)
-    );
+    for (NATIVE_INT_TYPE i = 0; i < 4; ++i) {
+      this->connect_to_bufferSendIn(
+          i,
+          this->component.get_bufferSendIn_InputPort(i)
+      );
+    }
 
     // bufferGetCallee
-    this->connect_to_bufferGetCallee(
+    for (NATIVE_INT_TYPE i = 0; i < 4; ++i) {
+      this->connect_to_bufferGetCallee(
+          i,
+          this->component.get_bufferGetCallee_InputPort(i)
+      );
+    }
+
+    // schedIn
+    this->connect_to_schedIn(
         0,
-        this->component.get_bufferGetCallee_InputPort(0)
+        this->component.get_schedIn_InputPort(0)
     );
 
     // timeCaller
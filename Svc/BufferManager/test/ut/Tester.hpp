@@ -32,6 +32,13 @@ namespace Svc {
       //!
       Tester(void);
 
+      //! Construct object Tester with a component in bin mode
+      //!
+      Tester(
+          const BufferManager::BinSpec *const binSpecs, //!< The bins
+          const U32 numBins //!< The number of bins
+      );
+
       //! Destroy object Tester
       //!
       ~Tester(void);
@@ -43,6 +50,18 @@ namespace Svc {
       // ---------------------------------------------------------------------- 
 
       void three_buffer_problem(void);
+
+      //! Free bin buffers in a different order than they were allocated
+      //!
+      void binsOutOfOrder(void);
+
+      //! Fill the bins, fall back to larger bins, and run out
+      //!
+      void binsExhausted(void);
+
+      //! Free buffers through another client and count the cache hits
+      //!
+      void binCaches(void);
     private:
 
       // ----------------------------------------------------------------------
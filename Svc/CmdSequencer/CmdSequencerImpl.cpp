@@ -43,7 +43,13 @@ namespace Svc {
         m_executedCount(0),
         m_totalExecutedCount(0),
         m_sequencesCompletedCount(0),
-        m_timeout(0)
+        m_timeout(0),
+        m_cache(*this),
+        m_cacheHitCount(0),
+        m_cacheMissCount(0),
+        m_numEngines(0),
+        m_engineBuffers(NULL),
+        m_engineAllocatorId(0)
     {
 
     }
@@ -88,6 +94,72 @@ namespace Svc {
         this->m_sequence->deallocateBuffer(allocator);
     }
 
+    void CmdSequencerComponentImpl ::
+      allocateCache(
+          NATIVE_INT_TYPE identifier,
+          Fw::MemAllocator& allocator,
+          NATIVE_UINT_TYPE bytes
+      )
+    {
+        this->m_cache.allocateBuffer(identifier, allocator, bytes);
+    }
+
+    void CmdSequencerComponentImpl ::
+      deallocateCache(Fw::MemAllocator& allocator)
+    {
+        this->m_cache.deallocateBuffer(allocator);
+    }
+
+    void CmdSequencerComponentImpl ::
+      addEngine(Sequence& sequence)
+    {
+        FW_ASSERT(
+            this->m_numEngines < Engine::MAX_ENGINES,
+            this->m_numEngines
+        );
+        FW_ASSERT(this->m_engineBuffers == NULL);
+        this->m_engines[this->m_numEngines].m_sequence = &sequence;
+        ++this->m_numEngines;
+    }
+
+    void CmdSequencerComponentImpl ::
+      allocateEngineBuffers(
+          NATIVE_INT_TYPE identifier,
+          Fw::MemAllocator& allocator,
+          NATIVE_UINT_TYPE bytes
+      )
+    {
+        FW_ASSERT(this->m_numEngines > 0);
+        FW_ASSERT(this->m_engineBuffers == NULL);
+        this->m_engineAllocatorId = identifier;
+        this->m_engineBuffers =
+          static_cast<U8*>(allocator.allocate(identifier, bytes));
+        FW_ASSERT(this->m_engineBuffers != NULL);
+        // give each engine an equal slice
+        const NATIVE_UINT_TYPE slice = bytes / this->m_numEngines;
+        for (NATIVE_UINT_TYPE i = 0; i < this->m_numEngines; ++i) {
+            this->m_engines[i].m_sequence->setBuffer(
+                &this->m_engineBuffers[i * slice],
+                slice
+            );
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      deallocateEngineBuffers(Fw::MemAllocator& allocator)
+    {
+        for (NATIVE_UINT_TYPE i = 0; i < this->m_numEngines; ++i) {
+            this->m_engines[i].m_sequence->clearBuffer();
+        }
+        if (this->m_engineBuffers != NULL) {
+            allocator.deallocate(
+                this->m_engineAllocatorId,
+                this->m_engineBuffers
+            );
+        }
+        this->m_engineBuffers = NULL;
+    }
+
     CmdSequencerComponentImpl::~CmdSequencerComponentImpl(void) {
 
     }
@@ -202,6 +274,72 @@ namespace Svc {
         this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
     }
 
+    void CmdSequencerComponentImpl ::
+      CS_ENGINE_RUN_cmdHandler(
+          FwOpcodeType opCode,
+          U32 cmdSeq,
+          U32 engine,
+          const Fw::CmdStringArg& fileName
+      )
+    {
+        if (not this->requireEngine(engine)) {
+            this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+            return;
+        }
+
+        Engine& e = this->m_engines[engine];
+        if (e.m_state != Engine::IDLE) {
+            this->log_WARNING_HI_CS_InvalidMode();
+            this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+            return;
+        }
+
+        // load commands
+        if (not this->loadFile(*e.m_sequence, fileName)) {
+            this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+            return;
+        }
+
+        e.m_executedCount = 0;
+        this->log_ACTIVITY_HI_CS_EngineStarted(
+            engine,
+            e.m_sequence->getLogFileName()
+        );
+        if (e.m_sequence->hasMoreRecords()) {
+            this->engineStep(engine);
+        } else {
+            this->engineComplete(engine);
+        }
+
+        this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
+    }
+
+    void CmdSequencerComponentImpl ::
+      CS_ENGINE_CANCEL_cmdHandler(
+          FwOpcodeType opCode,
+          U32 cmdSeq,
+          U32 engine
+      )
+    {
+        if (not this->requireEngine(engine)) {
+            this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+            return;
+        }
+
+        Engine& e = this->m_engines[engine];
+        if (e.m_state != Engine::IDLE) {
+            this->engineStop(engine);
+            this->log_ACTIVITY_HI_CS_SequenceCanceled(
+                e.m_sequence->getLogFileName()
+            );
+            ++this->m_cancelCmdCount;
+            this->tlmWrite_CS_CancelCommands(this->m_cancelCmdCount);
+        } else {
+            this->log_WARNING_LO_CS_NoSequenceActive();
+        }
+        this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
+    }
+
     // ----------------------------------------------------------------------
     // Private helper methods
     // ----------------------------------------------------------------------
@@ -209,9 +347,30 @@ namespace Svc {
     bool CmdSequencerComponentImpl ::
       loadFile(const Fw::CmdStringArg& fileName) 
     {
-      const bool status = this->m_sequence->loadFile(fileName);
+      return this->loadFile(*this->m_sequence, fileName);
+    }
+
+    bool CmdSequencerComponentImpl ::
+      loadFile(Sequence& sequence, const Fw::CmdStringArg& fileName) 
+    {
+      bool status;
+      if (this->m_cache.load(fileName, sequence)) {
+        // validated copy is current; skip reading the file
+        status = true;
+        ++this->m_cacheHitCount;
+        this->tlmWrite_CS_CacheHits(this->m_cacheHitCount);
+      } else {
+        status = sequence.loadFile(fileName);
+        if (status) {
+          this->m_cache.store(fileName, sequence);
+        }
+        if (this->m_cache.isEnabled()) {
+          ++this->m_cacheMissCount;
+          this->tlmWrite_CS_CacheMisses(this->m_cacheMissCount);
+        }
+      }
       if (status) {
-        Fw::LogStringArg& logFileName = this->m_sequence->getLogFileName();
+        Fw::LogStringArg& logFileName = sequence.getLogFileName();
         this->log_ACTIVITY_LO_CS_SequenceLoaded(logFileName);
         ++this->m_loadCmdCount;
         this->tlmWrite_CS_LoadCommands(this->m_loadCmdCount);
@@ -227,8 +386,8 @@ namespace Svc {
     void CmdSequencerComponentImpl::performCmd_Cancel(void) {
         this->m_sequence->reset();
         this->m_runMode = STOPPED;
-        this->m_cmdTimer.clear();
-        this->m_cmdTimeoutTimer.clear();
+        this->clearTimer(this->m_cmdTimer, CMD_TIMER_KEY);
+        this->clearTimer(this->m_cmdTimeoutTimer, CMD_TIMEOUT_KEY);
         this->m_executedCount = 0;
         // write sequence done port with error, if connected
         if (this->isConnected_seqDone_OutputPort(0)) {
@@ -245,12 +404,25 @@ namespace Svc {
           Fw::CommandResponse response
       )
     {
+        // a nonzero context belongs to a background engine
+        if (cmdSeq > 0) {
+            const U32 engine = cmdSeq - 1;
+            if (
+                engine < this->m_numEngines and
+                this->m_engines[engine].m_state == Engine::WAITING_RESPONSE
+            ) {
+                this->engineResponse(engine, opcode, response);
+            } else {
+                this->log_WARNING_HI_CS_UnexpectedCompletion(opcode);
+            }
+            return;
+        }
         if (this->m_runMode == STOPPED) {
             // Sequencer is not running
             this->log_WARNING_HI_CS_UnexpectedCompletion(opcode);
         } else {
             // clear command timeout
-            this->m_cmdTimeoutTimer.clear();
+            this->clearTimer(this->m_cmdTimeoutTimer, CMD_TIMEOUT_KEY);
             if (response != Fw::COMMAND_OK) {
                 this->commandError(this->m_executedCount, opcode, response);
                 this->performCmd_Cancel();
@@ -280,22 +452,133 @@ namespace Svc {
     {
 
         Fw::Time currTime = this->getTime();
+        // Nothing is due before the earliest timer expires
+        if (not this->m_nextDue.isExpiredAt(currTime)) {
+            return;
+        }
+        this->checkTimers(currTime);
+
+        for (NATIVE_UINT_TYPE i = 0; i < this->m_numEngines; ++i) {
+            this->engineCheckTimers(i, currTime);
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      timeoutIn_handler(NATIVE_INT_TYPE portNum, NATIVE_UINT_TYPE key)
+    {
+        const Fw::Time currTime = this->getTime();
+        switch (key) {
+          case CMD_TIMER_KEY:
+              this->checkTimers(currTime);
+              this->rearmTimer(this->m_cmdTimer, key, currTime);
+              break;
+          case CMD_TIMEOUT_KEY:
+              this->checkTimers(currTime);
+              this->rearmTimer(this->m_cmdTimeoutTimer, key, currTime);
+              break;
+          default: {
+              const U32 engine = (key - ENGINE_KEY_BASE) / 2;
+              if (engine >= this->m_numEngines) {
+                  // stale deadline from an engine that no longer exists
+                  break;
+              }
+              Engine& e = this->m_engines[engine];
+              this->engineCheckTimers(engine, currTime);
+              if (((key - ENGINE_KEY_BASE) % 2) == 0) {
+                  this->rearmTimer(e.m_cmdTimer, key, currTime);
+              } else {
+                  this->rearmTimer(e.m_cmdTimeoutTimer, key, currTime);
+              }
+              break;
+          }
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      checkTimers(const Fw::Time& currentTime)
+    {
         // check to see if a command time is pending
-        if (this->m_cmdTimer.isExpiredAt(currTime)) {
+        if (this->m_cmdTimer.isExpiredAt(currentTime)) {
             this->comCmdOut_out(0, m_record.m_command, 0);
-            this->m_cmdTimer.clear();
+            this->clearTimer(this->m_cmdTimer, CMD_TIMER_KEY);
             // start command timeout timer
-            this->setCmdTimeout(currTime);
-        } else if (this->m_cmdTimeoutTimer.isExpiredAt(this->getTime())) { // check for command timeout
-            this->log_WARNING_HI_CS_SequenceTimeout(
-                m_sequence->getLogFileName(),
-                this->m_executedCount
-            );
+            this->setCmdTimeout(currentTime);
+        } else if (this->m_cmdTimeoutTimer.isExpiredAt(currentTime)) { // check for command timeout
+            this->commandTimeout(*this->m_sequence, this->m_executedCount);
             // If there is a command timeout, cancel the sequence
             this->performCmd_Cancel();
         }
     }
 
+    void CmdSequencerComponentImpl ::
+      setTimer(
+          Timer& timer,
+          const U32 key,
+          const Fw::Time& time
+      )
+    {
+        timer.set(time);
+        this->updateNextDue();
+        if (this->isConnected_deadlineSetOut_OutputPort(0)) {
+            Fw::Time deadline = time;
+            this->deadlineSetOut_out(0, key, deadline);
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      clearTimer(
+          Timer& timer,
+          const U32 key
+      )
+    {
+        if (timer.isSet() and this->isConnected_deadlineCancelOut_OutputPort(0)) {
+            this->deadlineCancelOut_out(0, key);
+        }
+        timer.clear();
+        this->updateNextDue();
+    }
+
+    void CmdSequencerComponentImpl ::
+      updateNextDue(void)
+    {
+        this->m_nextDue.clear();
+        this->considerNextDue(this->m_cmdTimer);
+        this->considerNextDue(this->m_cmdTimeoutTimer);
+        for (NATIVE_UINT_TYPE i = 0; i < this->m_numEngines; ++i) {
+            this->considerNextDue(this->m_engines[i].m_cmdTimer);
+            this->considerNextDue(this->m_engines[i].m_cmdTimeoutTimer);
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      considerNextDue(const Timer& timer)
+    {
+        if (not timer.isSet()) {
+            return;
+        }
+        if (
+            not this->m_nextDue.isSet() or
+            Fw::Time::compare(
+                timer.getExpirationTime(),
+                this->m_nextDue.getExpirationTime()
+            ) == Fw::Time::LT
+        ) {
+            this->m_nextDue.set(timer.getExpirationTime());
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      rearmTimer(
+          Timer& timer,
+          const U32 key,
+          const Fw::Time& currentTime
+      )
+    {
+        if (timer.isSet() and not timer.isExpiredAt(currentTime)) {
+            this->setTimer(timer, key, timer.getExpirationTime());
+        }
+    }
+
     void CmdSequencerComponentImpl ::
       CS_START_cmdHandler(FwOpcodeType opcode, U32 cmdSeq) 
     {
@@ -386,9 +669,26 @@ namespace Svc {
         this->error();
     }
 
+    void CmdSequencerComponentImpl ::
+      commandTimeout(
+          Sequence& sequence,
+          const U32 number
+      )
+    {
+        this->log_WARNING_HI_CS_SequenceTimeout(
+            sequence.getLogFileName(),
+            number
+        );
+        this->error();
+    }
+
     void CmdSequencerComponentImpl::performCmd_Step(void) {
 
-        this->m_sequence->nextRecord(m_record);
+        if (not this->m_sequence->nextRecord(m_record)) {
+            // the sequence has reported the error
+            this->performCmd_Cancel();
+            return;
+        }
         // set clock time base and context from value set when sequence was loaded
         const Sequence::Header& header = this->m_sequence->getHeader();
         this->m_record.m_timeTag.setTimeBase(header.m_timeBase);
@@ -449,7 +749,7 @@ namespace Svc {
             this->comCmdOut_out(0, m_record.m_command, 0);
             this->setCmdTimeout(currentTime);
         } else {
-            this->m_cmdTimer.set(this->m_record.m_timeTag);
+            this->setTimer(this->m_cmdTimer, CMD_TIMER_KEY, this->m_record.m_timeTag);
         }
     }
 
@@ -470,9 +770,187 @@ namespace Svc {
         if ((this->m_timeout > 0) and (AUTO == this->m_stepMode)) {
             Fw::Time expTime = currentTime;
             expTime.add(this->m_timeout,0);
-            this->m_cmdTimeoutTimer.set(expTime);
+            this->setTimer(this->m_cmdTimeoutTimer, CMD_TIMEOUT_KEY, expTime);
         }
     }
 
-}
+    bool CmdSequencerComponentImpl ::
+      requireEngine(const U32 engine)
+    {
+        if (engine < this->m_numEngines) {
+            return true;
+        } else {
+            this->log_WARNING_HI_CS_EngineInvalid(engine);
+            this->error();
+            return false;
+        }
+    }
 
+    void CmdSequencerComponentImpl ::
+      engineStep(const NATIVE_UINT_TYPE engine)
+    {
+        FW_ASSERT(engine < this->m_numEngines, engine);
+        Engine& e = this->m_engines[engine];
+        if (not e.m_sequence->nextRecord(e.m_record)) {
+            // the sequence has reported the error
+            this->engineStop(engine);
+            return;
+        }
+        // set clock time base and context from value set when sequence was loaded
+        const Sequence::Header& header = e.m_sequence->getHeader();
+        e.m_record.m_timeTag.setTimeBase(header.m_timeBase);
+        e.m_record.m_timeTag.setTimeContext(header.m_timeContext);
+
+        Fw::Time currentTime = this->getTime();
+        switch (e.m_record.m_descriptor) {
+          case Sequence::Record::END_OF_SEQUENCE:
+                this->engineComplete(engine);
+                return;
+          case Sequence::Record::RELATIVE:
+                e.m_record.m_timeTag.add(
+                    currentTime.getSeconds(),
+                    currentTime.getUSeconds()
+                );
+                break;
+          case Sequence::Record::ABSOLUTE:
+                break;
+          default:
+                FW_ASSERT(0, e.m_record.m_descriptor);
+        }
+        if (currentTime >= e.m_record.m_timeTag) {
+            this->engineDispatch(engine, currentTime);
+        } else {
+            this->setTimer(
+                e.m_cmdTimer,
+                ENGINE_KEY_BASE + 2 * engine,
+                e.m_record.m_timeTag
+            );
+            e.m_state = Engine::WAITING_TIME;
+            this->tlmWriteEngine(engine);
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      engineDispatch(
+          const NATIVE_UINT_TYPE engine,
+          const Fw::Time& currentTime
+      )
+    {
+        Engine& e = this->m_engines[engine];
+        this->clearTimer(e.m_cmdTimer, ENGINE_KEY_BASE + 2 * engine);
+        e.m_state = Engine::WAITING_RESPONSE;
+        this->comCmdOut_out(0, e.m_record.m_command, engine + 1);
+        // start timeout timer if enabled
+        if (this->m_timeout > 0) {
+            Fw::Time expTime = currentTime;
+            expTime.add(this->m_timeout, 0);
+            this->setTimer(
+                e.m_cmdTimeoutTimer,
+                ENGINE_KEY_BASE + 2 * engine + 1,
+                expTime
+            );
+        }
+        this->tlmWriteEngine(engine);
+    }
+
+    void CmdSequencerComponentImpl ::
+      engineResponse(
+          const NATIVE_UINT_TYPE engine,
+          const FwOpcodeType opcode,
+          const Fw::CommandResponse response
+      )
+    {
+        Engine& e = this->m_engines[engine];
+        this->clearTimer(e.m_cmdTimeoutTimer, ENGINE_KEY_BASE + 2 * engine + 1);
+        if (response != Fw::COMMAND_OK) {
+            this->log_WARNING_HI_CS_CommandError(
+                e.m_sequence->getLogFileName(),
+                e.m_executedCount,
+                opcode,
+                response
+            );
+            this->error();
+            this->engineStop(engine);
+            return;
+        }
+        this->log_ACTIVITY_LO_CS_CommandComplete(
+            e.m_sequence->getLogFileName(),
+            e.m_executedCount,
+            opcode
+        );
+        ++e.m_executedCount;
+        ++this->m_totalExecutedCount;
+        this->tlmWrite_CS_CommandsExecuted(this->m_totalExecutedCount);
+        if (e.m_sequence->hasMoreRecords()) {
+            this->engineStep(engine);
+        } else {
+            this->engineComplete(engine);
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      engineCheckTimers(
+          const NATIVE_UINT_TYPE engine,
+          const Fw::Time& currentTime
+      )
+    {
+        Engine& e = this->m_engines[engine];
+        if (e.m_cmdTimer.isExpiredAt(currentTime)) {
+            this->engineDispatch(engine, currentTime);
+        } else if (e.m_cmdTimeoutTimer.isExpiredAt(currentTime)) {
+            this->commandTimeout(*e.m_sequence, e.m_executedCount);
+            this->engineStop(engine);
+        }
+    }
+
+    void CmdSequencerComponentImpl ::
+      engineStop(const NATIVE_UINT_TYPE engine)
+    {
+        Engine& e = this->m_engines[engine];
+        e.m_sequence->clear();
+        this->clearTimer(e.m_cmdTimer, ENGINE_KEY_BASE + 2 * engine);
+        this->clearTimer(e.m_cmdTimeoutTimer, ENGINE_KEY_BASE + 2 * engine + 1);
+        e.m_state = Engine::IDLE;
+        this->tlmWriteEngine(engine);
+    }
+
+    void CmdSequencerComponentImpl ::
+      engineComplete(const NATIVE_UINT_TYPE engine)
+    {
+        Engine& e = this->m_engines[engine];
+        ++this->m_sequencesCompletedCount;
+        this->engineStop(engine);
+        this->log_ACTIVITY_HI_CS_SequenceComplete(
+            e.m_sequence->getLogFileName()
+        );
+        this->tlmWrite_CS_SequencesCompleted(this->m_sequencesCompletedCount);
+    }
+
+    void CmdSequencerComponentImpl ::
+      tlmWriteEngine(const NATIVE_UINT_TYPE engine)
+    {
+        const Engine& e = this->m_engines[engine];
+        const U8 state = static_cast<U8>(e.m_state);
+        switch (engine) {
+          case 0:
+            this->tlmWrite_CS_Engine0State(state);
+            this->tlmWrite_CS_Engine0Executed(e.m_executedCount);
+            break;
+          case 1:
+            this->tlmWrite_CS_Engine1State(state);
+            this->tlmWrite_CS_Engine1Executed(e.m_executedCount);
+            break;
+          case 2:
+            this->tlmWrite_CS_Engine2State(state);
+            this->tlmWrite_CS_Engine2Executed(e.m_executedCount);
+            break;
+          case 3:
+            this->tlmWrite_CS_Engine3State(state);
+            this->tlmWrite_CS_Engine3Executed(e.m_executedCount);
+            break;
+          default:
+            FW_ASSERT(0, engine);
+        }
+    }
+
+}
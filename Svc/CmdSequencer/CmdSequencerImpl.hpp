@@ -41,6 +41,17 @@ namespace Svc {
         AUTO, MANUAL
       };
 
+      //! The keys of the deadlines set on deadlineSetOut
+      enum DeadlineKey {
+        //! The command time of the main sequence
+        CMD_TIMER_KEY = 0,
+        //! The command timeout of the main sequence
+        CMD_TIMEOUT_KEY = 1,
+        //! The command time of engine n is ENGINE_KEY_BASE + 2n,
+        //! and its command timeout is ENGINE_KEY_BASE + 2n + 1
+        ENGINE_KEY_BASE = 2
+      };
+
     public:
 
       // ----------------------------------------------------------------------
@@ -182,7 +193,8 @@ namespace Svc {
               //! Validate the time field of the sequence header
               //! \return Success or failure
               bool validateTime(
-                  CmdSequencerComponentImpl& component //!< Component for time and events
+                  CmdSequencerComponentImpl& component, //!< Component for time
+                  Events& events //!< Events of the sequence being loaded
               );
 
             public:
@@ -251,6 +263,16 @@ namespace Svc {
               Fw::MemAllocator& allocator //!< The allocator
           );
 
+          //! Give the sequence part of a memory buffer owned by the
+          //! caller. Use instead of allocateBuffer.
+          void setBuffer(
+              U8 *const buffer, //!< The buffer
+              NATIVE_UINT_TYPE bytes //!< The number of bytes
+          );
+
+          //! Detach a buffer given with setBuffer
+          void clearBuffer(void);
+
           //! Set the file name. Also sets the log file name.
           void setFileName(const Fw::CmdStringArg& fileName);
 
@@ -275,9 +297,11 @@ namespace Svc {
           //! \return Yes or no
           virtual bool hasMoreRecords(void) const = 0;
 
-          //! Get the next record in the sequence
-          //! Asserts on failure
-          virtual void nextRecord(
+          //! Get the next record in the sequence.
+          //! A format that reads the file again while the sequence
+          //! runs reports a failure with an event.
+          //! \return Success or failure
+          virtual bool nextRecord(
               Record& record //!< The returned record
           ) = 0;
 
@@ -290,6 +314,38 @@ namespace Svc {
           //! After calling this, hasMoreRecords should return false
           virtual void clear(void) = 0;
 
+          //! Query whether a loaded sequence may be stored in the
+          //! sequence cache. The default implementation returns true,
+          //! which is correct for formats that hold all the validated
+          //! record data in the sequence buffer.
+          //! \return Yes or no
+          virtual bool isCacheable(void) const;
+
+          //! Get the name of a file other than the sequence file that
+          //! validation reads, such as a CRC file. The sequence cache
+          //! checks it for changes along with the sequence file. The
+          //! default implementation returns false.
+          //! \return Whether the format has such a file
+          virtual bool getSideFileName(
+              const Fw::CmdStringArg& fileName, //!< The sequence file name
+              Fw::CmdStringArg& sideFileName //!< The side file name
+          ) const;
+
+          //! Get the validated record data of a loaded sequence
+          void getRecordData(
+              const U8*& data, //!< The record data
+              NATIVE_UINT_TYPE& size //!< The size of the record data
+          ) const;
+
+          //! Load validated record data in place of reading a file
+          //! \return Success or failure
+          bool loadRecordData(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              const Header& header, //!< The validated header
+              const U8* data, //!< The record data
+              const NATIVE_UINT_TYPE size //!< The size of the record data
+          );
+
         PROTECTED:
 
           //! The enclosing component
@@ -377,7 +433,8 @@ namespace Svc {
 
           //! Get the next record in the sequence.
           //! Asserts on failure
-          void nextRecord(
+          //! \return true
+          bool nextRecord(
               Record& record //!< The returned record
           );
 
@@ -505,6 +562,18 @@ namespace Svc {
             this->m_state = CLEAR;
           }
 
+          //! Determine whether the timer is set
+          //! \return Yes or no
+          bool isSet(void) const {
+            return this->m_state == SET;
+          }
+
+          //! Get the expiration time
+          //! \return The expiration time
+          const Fw::Time& getExpirationTime(void) const {
+            return this->expirationTime;
+          }
+
           //! Determine whether the timer is expired at a given time
           //! \return Yes or no
           bool isExpiredAt(
@@ -531,6 +600,255 @@ namespace Svc {
       };
 
 
+      //! \class SequenceCache
+      //! \brief A cache of validated sequences
+      //!
+      //! The cache holds the record data of recently loaded sequences
+      //! in one buffer. An entry is used only if the size, modification
+      //! time, and CRC of the sequence file and of its side file, if any,
+      //! and the current time base and context are the same as when it
+      //! was stored. When the buffer or the entry
+      //! table is full, the least recently used entries are evicted.
+      class SequenceCache {
+
+        public:
+
+          enum Constants {
+            //! The maximum number of cached sequences
+            MAX_ENTRIES = 8,
+            //! The size of the buffer for computing a file CRC
+            CRC_BUFFER_SIZE = 256
+          };
+
+        PRIVATE:
+
+          //! The size, modification time, and CRC of a file
+          struct FileKey {
+
+            //! Construct a FileKey
+            FileKey(void);
+
+            //! Whether two keys are the same
+            bool operator==(const FileKey& other) const;
+
+            //! The file size
+            U64 m_size;
+
+            //! The modification time, seconds part
+            U32 m_modSeconds;
+
+            //! The modification time, microseconds part
+            U32 m_modUSeconds;
+
+            //! The CRC32 of the file contents
+            U32 m_crc;
+
+          };
+
+          //! A cache entry
+          struct Entry {
+
+            //! Construct an Entry
+            Entry(void);
+
+            //! Whether the entry is in use
+            bool m_valid;
+
+            //! The sequence file name
+            Fw::CmdStringArg m_fileName;
+
+            //! The sequence file key when the entry was stored
+            FileKey m_fileKey;
+
+            //! The side file key when the entry was stored. Zero if the
+            //! format has no side file
+            FileKey m_sideFileKey;
+
+            //! The validated header
+            Sequence::Header m_header;
+
+            //! The offset of the record data in the cache buffer
+            NATIVE_UINT_TYPE m_offset;
+
+            //! The size of the record data
+            NATIVE_UINT_TYPE m_size;
+
+            //! The value of the use counter at the last use
+            U32 m_lastUse;
+
+          };
+
+        public:
+
+          //! Construct a SequenceCache
+          SequenceCache(
+              CmdSequencerComponentImpl& component //!< The enclosing component
+          );
+
+        public:
+
+          //! Give the cache a memory buffer.
+          //! The cache is disabled until this is called.
+          void allocateBuffer(
+              NATIVE_INT_TYPE identifier, //!< The identifier
+              Fw::MemAllocator& allocator, //!< The allocator
+              NATIVE_UINT_TYPE bytes //!< The byte budget
+          );
+
+          //! Deallocate the buffer
+          void deallocateBuffer(
+              Fw::MemAllocator& allocator //!< The allocator
+          );
+
+          //! Query whether the cache has a buffer
+          //! \return Yes or no
+          bool isEnabled(void) const;
+
+          //! Load a sequence from the cache
+          //! \return Whether the sequence was in the cache and was loaded
+          bool load(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              Sequence& sequence //!< The sequence to load
+          );
+
+          //! Store a sequence that was loaded from a file
+          void store(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              const Sequence& sequence //!< The loaded sequence
+          );
+
+          //! Remove all entries
+          void clear(void);
+
+        PRIVATE:
+
+          //! Compute the CRC32 of the contents of a file
+          //! \return Success or failure
+          static bool getFileCRC(
+              const char *const path, //!< The file path
+              U32& crc //!< The CRC
+          );
+
+          //! Get the size, modification time, and CRC of a file
+          //! \return Success or failure
+          static bool getFileKey(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              FileKey& fileKey //!< The file key
+          );
+
+          //! Get the keys of a sequence file and of its side file
+          //! \return Success or failure
+          static bool getEntryKeys(
+              const Fw::CmdStringArg& fileName, //!< The file name
+              const Sequence& sequence, //!< The sequence
+              FileKey& fileKey, //!< The sequence file key
+              FileKey& sideFileKey //!< The side file key
+          );
+
+          //! Find the entry for a file
+          //! \return The entry, or NULL if there is none
+          Entry* find(
+              const Fw::CmdStringArg& fileName //!< The file name
+          );
+
+          //! Remove an entry and close the gap in the buffer
+          void remove(
+              Entry& entry //!< The entry
+          );
+
+          //! Remove the least recently used entry
+          void evict(void);
+
+          //! Find an unused entry
+          //! \return The entry, or NULL if there is none
+          Entry* findFree(void);
+
+        PRIVATE:
+
+          //! The enclosing component
+          CmdSequencerComponentImpl& m_component;
+
+          //! The entries
+          Entry m_entries[MAX_ENTRIES];
+
+          //! The cache buffer
+          U8* m_data;
+
+          //! The size of the cache buffer
+          NATIVE_UINT_TYPE m_capacity;
+
+          //! The number of bytes in use
+          NATIVE_UINT_TYPE m_used;
+
+          //! The allocator ID
+          NATIVE_INT_TYPE m_allocatorId;
+
+          //! The use counter
+          U32 m_useCount;
+
+      };
+
+      //! \class Engine
+      //! \brief A background sequence engine
+      //!
+      //! An engine runs one sequence in AUTO mode alongside the sequence
+      //! run by CS_RUN and seqRunIn. Each engine has its own sequence
+      //! object, record cursor, and timers. All engines are driven by the
+      //! component thread from schedIn and cmdResponseIn, so an engine
+      //! does not need a thread or a queue of its own. Engine commands
+      //! are sent with context (engine number + 1), and the command
+      //! dispatcher returns the context as the command sequence number
+      //! of the response; context 0 belongs to the main sequence.
+      class Engine {
+
+        public:
+
+          enum Constants {
+            //! The maximum number of engines. The telemetry dictionary
+            //! has State and Executed channels for each engine.
+            MAX_ENGINES = 4
+          };
+
+          //! The engine state, as reported in telemetry
+          typedef enum {
+            IDLE = 0, //!< No sequence is running
+            WAITING_TIME = 1, //!< Waiting for the time of the next record
+            WAITING_RESPONSE = 2 //!< Waiting for a command response
+          } State;
+
+        public:
+
+          //! Construct an Engine
+          Engine(void) :
+            m_sequence(NULL),
+            m_state(IDLE),
+            m_executedCount(0)
+          {
+
+          }
+
+        public:
+
+          //! The sequence
+          Sequence *m_sequence;
+
+          //! The engine state
+          State m_state;
+
+          //! The sequence record currently being processed
+          Sequence::Record m_record;
+
+          //! The command time timer
+          Timer m_cmdTimer;
+
+          //! The command timeout timer
+          Timer m_cmdTimeoutTimer;
+
+          //! The number of commands executed in this sequence
+          U32 m_executedCount;
+
+      };
+
     public:
 
       // ----------------------------------------------------------------------
@@ -587,6 +905,42 @@ namespace Svc {
           Fw::MemAllocator& allocator //!< The allocator
       );
 
+      //! (Optional) Give the sequence cache a memory buffer.
+      //! Validated sequences are kept in the cache, up to the given
+      //! number of bytes, and are run again without reading the file.
+      void allocateCache(
+          NATIVE_INT_TYPE identifier, //!< The identifier
+          Fw::MemAllocator& allocator, //!< The allocator
+          NATIVE_UINT_TYPE bytes //!< The number of bytes
+      );
+
+      //! Return allocated cache buffer. Call during shutdown.
+      void deallocateCache(
+          Fw::MemAllocator& allocator //!< The allocator
+      );
+
+      //! (Optional) Add a background sequence engine.
+      //! The engine loads and runs sequences with the sequence object you
+      //! pass in. Engines are numbered in the order they are added,
+      //! starting at 0. Call this before allocateEngineBuffers.
+      void addEngine(
+          Sequence& sequence //!< The sequence object
+      );
+
+      //! Give the background engines a memory buffer.
+      //! The buffer is divided equally among the engines that have been
+      //! added. Call this after addEngine and before task is spawned.
+      void allocateEngineBuffers(
+          NATIVE_INT_TYPE identifier, //!< The identifier
+          Fw::MemAllocator& allocator, //!< The allocator
+          NATIVE_UINT_TYPE bytes //!< The number of bytes
+      );
+
+      //! Return allocated engine buffer. Call during shutdown.
+      void deallocateEngineBuffers(
+          Fw::MemAllocator& allocator //!< The allocator
+      );
+
       //! Destroy a CmdDispatcherComponentBase
       ~CmdSequencerComponentImpl(void);
 
@@ -610,6 +964,12 @@ namespace Svc {
           NATIVE_UINT_TYPE order //!< The call order
       );
 
+      //! Handler for input port timeoutIn
+      void timeoutIn_handler(
+          NATIVE_INT_TYPE portNum, //!< The port number
+          NATIVE_UINT_TYPE key //!< The deadline key
+      );
+
       //! Handler for input port seqRunIn
       void seqRunIn_handler(
           NATIVE_INT_TYPE portNum, //!< The port number
@@ -679,6 +1039,23 @@ namespace Svc {
           const Fw::CmdStringArg& fileName //!< The name of the sequence file
       );
 
+      //! Handler for command CS_ENGINE_RUN
+      //! Run a command sequence file on a background engine
+      void CS_ENGINE_RUN_cmdHandler(
+          FwOpcodeType opCode, //!< The opcode
+          U32 cmdSeq, //!< The command sequence number
+          U32 engine, //!< The engine number
+          const Fw::CmdStringArg& fileName //!< The name of the sequence file
+      );
+
+      //! Handler for command CS_ENGINE_CANCEL
+      //! Cancel the sequence running on a background engine
+      void CS_ENGINE_CANCEL_cmdHandler(
+          FwOpcodeType opCode, //!< The opcode
+          U32 cmdSeq, //!< The command sequence number
+          U32 engine //!< The engine number
+      );
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -691,6 +1068,13 @@ namespace Svc {
           const Fw::CmdStringArg& fileName //!< The file name
       );
 
+      //! Load a sequence file into a sequence object
+      //! \return Success or failure
+      bool loadFile(
+          Sequence& sequence, //!< The sequence object
+          const Fw::CmdStringArg& fileName //!< The file name
+      );
+
       //! Perform a Cancel command
       void performCmd_Cancel(void);
 
@@ -725,6 +1109,13 @@ namespace Svc {
           const U32 error //!< The error code
       );
 
+      //! Record a command that timed out. The main sequence and the
+      //! engines record timeouts the same way
+      void commandTimeout(
+          Sequence& sequence, //!< The sequence of the command
+          const U32 number //!< The command number
+      );
+
       //! Require a run mode
       //! \return Whether we are in the correct mode
       bool requireRunMode(
@@ -736,6 +1127,87 @@ namespace Svc {
           const Fw::Time &currentTime //!< The current time
       );
 
+      //! Check the timers of the main sequence
+      void checkTimers(
+          const Fw::Time& currentTime //!< The current time
+      );
+
+      //! Set a timer and its deadline, if deadlineSetOut is connected
+      void setTimer(
+          Timer& timer, //!< The timer
+          const U32 key, //!< The deadline key
+          const Fw::Time& time //!< The expiration time
+      );
+
+      //! Clear a timer and cancel its deadline, if it is set
+      void clearTimer(
+          Timer& timer, //!< The timer
+          const U32 key //!< The deadline key
+      );
+
+      //! Set the next due timer to the earliest expiration of the
+      //! timers of the main sequence and the engines
+      void updateNextDue(void);
+
+      //! Consider a timer for the next due timer
+      void considerNextDue(
+          const Timer& timer //!< The timer
+      );
+
+      //! Set the deadline of a timer again after the deadline
+      //! expired early, for example because the clock of the timer
+      //! wheel is ahead of the time source
+      void rearmTimer(
+          Timer& timer, //!< The timer
+          const U32 key, //!< The deadline key
+          const Fw::Time& currentTime //!< The current time
+      );
+
+      //! Require a valid engine number
+      //! \return Whether the engine exists
+      bool requireEngine(
+          const U32 engine //!< The engine number
+      );
+
+      //! Step an engine to its next record
+      void engineStep(
+          const NATIVE_UINT_TYPE engine //!< The engine number
+      );
+
+      //! Send the command in the current record of an engine
+      void engineDispatch(
+          const NATIVE_UINT_TYPE engine, //!< The engine number
+          const Fw::Time& currentTime //!< The current time
+      );
+
+      //! Handle a command response for an engine
+      void engineResponse(
+          const NATIVE_UINT_TYPE engine, //!< The engine number
+          const FwOpcodeType opcode, //!< The command opcode
+          const Fw::CommandResponse response //!< The command response
+      );
+
+      //! Check the timers of an engine
+      void engineCheckTimers(
+          const NATIVE_UINT_TYPE engine, //!< The engine number
+          const Fw::Time& currentTime //!< The current time
+      );
+
+      //! Stop the sequence running on an engine
+      void engineStop(
+          const NATIVE_UINT_TYPE engine //!< The engine number
+      );
+
+      //! Record completion of the sequence running on an engine
+      void engineComplete(
+          const NATIVE_UINT_TYPE engine //!< The engine number
+      );
+
+      //! Write the telemetry of an engine
+      void tlmWriteEngine(
+          const NATIVE_UINT_TYPE engine //!< The engine number
+      );
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -784,6 +1256,31 @@ namespace Svc {
       //! timeout timer
       Timer m_cmdTimeoutTimer;
 
+      //! Set to the earliest expiration of all set timers, so that
+      //! schedIn returns at once when nothing is due
+      Timer m_nextDue;
+
+      //! The cache of validated sequences
+      SequenceCache m_cache;
+
+      //! The number of sequences loaded from the cache
+      U32 m_cacheHitCount;
+
+      //! The number of sequences not found in the cache
+      U32 m_cacheMissCount;
+
+      //! The background engines
+      Engine m_engines[Engine::MAX_ENGINES];
+
+      //! The number of background engines
+      NATIVE_UINT_TYPE m_numEngines;
+
+      //! The buffer shared by the background engines
+      U8* m_engineBuffers;
+
+      //! The engine buffer allocator ID
+      NATIVE_INT_TYPE m_engineAllocatorId;
+
   };
 
 };
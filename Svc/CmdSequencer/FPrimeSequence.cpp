@@ -79,7 +79,7 @@ namespace Svc {
 
     const bool status = this->readFile()
      and this->validateCRC()
-     and this->m_header.validateTime(this->m_component)
+     and this->m_header.validateTime(this->m_component, this->m_events)
      and this->validateRecords();
 
     return status;
@@ -92,11 +92,12 @@ namespace Svc {
     return this->m_buffer.getBuffLeft() > 0;
   }
 
-  void CmdSequencerComponentImpl::FPrimeSequence ::
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
      nextRecord(Record& record)
   {
     Fw::SerializeStatus status = this->deserializeRecord(record);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return true;
   }
 
   void CmdSequencerComponentImpl::FPrimeSequence ::
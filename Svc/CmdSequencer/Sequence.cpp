@@ -41,10 +41,12 @@ namespace Svc {
     }
 
     bool CmdSequencerComponentImpl::Sequence::Header ::
-      validateTime(CmdSequencerComponentImpl& component)
+      validateTime(
+          CmdSequencerComponentImpl& component,
+          Events& events
+      )
     {
         Fw::Time validTime = component.getTime();
-        Events& events = component.m_sequence->m_events;
         // Time base
         const TimeBase validTimeBase = validTime.getTimeBase();
         if (
@@ -101,6 +103,24 @@ namespace Svc {
         this->m_buffer.clear();
     }
 
+    void CmdSequencerComponentImpl::Sequence ::
+      setBuffer(
+          U8 *const buffer,
+          NATIVE_UINT_TYPE bytes
+      )
+    {
+        // has to be at least as big as a header
+        FW_ASSERT(bytes >= Sequence::Header::SERIALIZED_SIZE);
+        FW_ASSERT(buffer != NULL);
+        this->m_buffer.setExtBuffer(buffer, bytes);
+    }
+
+    void CmdSequencerComponentImpl::Sequence ::
+      clearBuffer(void)
+    {
+        this->m_buffer.clear();
+    }
+
     const CmdSequencerComponentImpl::Sequence::Header& 
       CmdSequencerComponentImpl::Sequence ::
         getHeader(void) const
@@ -127,5 +147,46 @@ namespace Svc {
         return this->m_logFileName;
     }
 
+    bool CmdSequencerComponentImpl::Sequence ::
+      isCacheable(void) const
+    {
+        return true;
+    }
+
+    bool CmdSequencerComponentImpl::Sequence ::
+      getSideFileName(
+          const Fw::CmdStringArg& fileName,
+          Fw::CmdStringArg& sideFileName
+      ) const
+    {
+        return false;
+    }
+
+    void CmdSequencerComponentImpl::Sequence ::
+      getRecordData(const U8*& data, NATIVE_UINT_TYPE& size) const
+    {
+        data = this->m_buffer.getBuffAddr();
+        size = this->m_buffer.getBuffLength();
+    }
+
+    bool CmdSequencerComponentImpl::Sequence ::
+      loadRecordData(
+          const Fw::CmdStringArg& fileName,
+          const Header& header,
+          const U8* data,
+          const NATIVE_UINT_TYPE size
+      )
+    {
+        // make sure there is a buffer allocated
+        FW_ASSERT(this->m_buffer.getBuffAddr());
+        this->setFileName(fileName);
+        const Fw::SerializeStatus status = this->m_buffer.setBuff(data, size);
+        if (status != Fw::FW_SERIALIZE_OK) {
+            return false;
+        }
+        this->m_header = header;
+        return true;
+    }
+
 }
 
@@ -0,0 +1,320 @@
+// ====================================================================== 
+// \title  SequenceCache.cpp
+// \brief  CmdSequencerComponentImpl::SequenceCache implementation
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <string.h>
+
+#include "Fw/Types/Assert.hpp"
+#include "Os/FileSystem.hpp"
+#include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
+#include "Utils/Hash/libcrc/CRC32Update.hpp"
+
+namespace Svc {
+
+  CmdSequencerComponentImpl::SequenceCache::FileKey ::
+    FileKey(void) :
+      m_size(0),
+      m_modSeconds(0),
+      m_modUSeconds(0),
+      m_crc(0)
+  {
+
+  }
+
+  bool CmdSequencerComponentImpl::SequenceCache::FileKey ::
+    operator==(const FileKey& other) const
+  {
+    return
+      this->m_size == other.m_size and
+      this->m_modSeconds == other.m_modSeconds and
+      this->m_modUSeconds == other.m_modUSeconds and
+      this->m_crc == other.m_crc;
+  }
+
+  CmdSequencerComponentImpl::SequenceCache::Entry ::
+    Entry(void) :
+      m_valid(false),
+      m_offset(0),
+      m_size(0),
+      m_lastUse(0)
+  {
+
+  }
+
+  CmdSequencerComponentImpl::SequenceCache ::
+    SequenceCache(CmdSequencerComponentImpl& component) :
+      m_component(component),
+      m_data(NULL),
+      m_capacity(0),
+      m_used(0),
+      m_allocatorId(0),
+      m_useCount(0)
+  {
+
+  }
+
+  void CmdSequencerComponentImpl::SequenceCache ::
+    allocateBuffer(
+        NATIVE_INT_TYPE identifier,
+        Fw::MemAllocator& allocator,
+        NATIVE_UINT_TYPE bytes
+    )
+  {
+    FW_ASSERT(this->m_data == NULL);
+    this->m_allocatorId = identifier;
+    this->m_data = static_cast<U8*>(allocator.allocate(identifier, bytes));
+    FW_ASSERT(this->m_data != NULL);
+    this->m_capacity = bytes;
+    this->clear();
+  }
+
+  void CmdSequencerComponentImpl::SequenceCache ::
+    deallocateBuffer(Fw::MemAllocator& allocator)
+  {
+    if (this->m_data != NULL) {
+      allocator.deallocate(this->m_allocatorId, this->m_data);
+    }
+    this->m_data = NULL;
+    this->m_capacity = 0;
+    this->clear();
+  }
+
+  bool CmdSequencerComponentImpl::SequenceCache ::
+    isEnabled(void) const
+  {
+    return this->m_data != NULL;
+  }
+
+  bool CmdSequencerComponentImpl::SequenceCache ::
+    load(const Fw::CmdStringArg& fileName, Sequence& sequence)
+  {
+    if (not this->isEnabled() or not sequence.isCacheable()) {
+      return false;
+    }
+    Entry *const entry = this->find(fileName);
+    if (entry == NULL) {
+      return false;
+    }
+    // Check that the files have not changed since they were validated
+    FileKey fileKey, sideFileKey;
+    const bool fileStatus =
+      getEntryKeys(fileName, sequence, fileKey, sideFileKey);
+    if (
+        not fileStatus or
+        not (fileKey == entry->m_fileKey) or
+        not (sideFileKey == entry->m_sideFileKey)
+    ) {
+      this->remove(*entry);
+      return false;
+    }
+    // Check that the header would still pass time validation
+    const Fw::Time validTime = this->m_component.getTime();
+    if (
+        validTime.getTimeBase() != entry->m_header.m_timeBase or
+        validTime.getContext() != entry->m_header.m_timeContext
+    ) {
+      this->remove(*entry);
+      return false;
+    }
+    const bool status = sequence.loadRecordData(
+        fileName,
+        entry->m_header,
+        &this->m_data[entry->m_offset],
+        entry->m_size
+    );
+    if (status) {
+      entry->m_lastUse = ++this->m_useCount;
+    }
+    return status;
+  }
+
+  void CmdSequencerComponentImpl::SequenceCache ::
+    store(const Fw::CmdStringArg& fileName, const Sequence& sequence)
+  {
+    if (not this->isEnabled() or not sequence.isCacheable()) {
+      return;
+    }
+    // Replace any stale entry for the same file
+    Entry *entry = this->find(fileName);
+    if (entry != NULL) {
+      this->remove(*entry);
+    }
+    const U8* data = NULL;
+    NATIVE_UINT_TYPE size = 0;
+    sequence.getRecordData(data, size);
+    if (size > this->m_capacity) {
+      return;
+    }
+    FileKey fileKey, sideFileKey;
+    if (not getEntryKeys(fileName, sequence, fileKey, sideFileKey)) {
+      return;
+    }
+    // Evict least recently used entries until the sequence fits
+    entry = this->findFree();
+    while (entry == NULL or this->m_used + size > this->m_capacity) {
+      this->evict();
+      entry = this->findFree();
+    }
+    // Append the record data
+    if (size > 0) {
+      (void) memcpy(&this->m_data[this->m_used], data, size);
+    }
+    entry->m_valid = true;
+    entry->m_fileName = fileName;
+    entry->m_fileKey = fileKey;
+    entry->m_sideFileKey = sideFileKey;
+    entry->m_header = sequence.getHeader();
+    entry->m_offset = this->m_used;
+    entry->m_size = size;
+    entry->m_lastUse = ++this->m_useCount;
+    this->m_used += size;
+  }
+
+  void CmdSequencerComponentImpl::SequenceCache ::
+    clear(void)
+  {
+    for (NATIVE_UINT_TYPE i = 0; i < MAX_ENTRIES; ++i) {
+      this->m_entries[i].m_valid = false;
+    }
+    this->m_used = 0;
+  }
+
+  bool CmdSequencerComponentImpl::SequenceCache ::
+    getFileCRC(
+        const char *const path,
+        U32& crc
+    )
+  {
+    Os::File file;
+    if (file.open(path, Os::File::OPEN_READ) != Os::File::OP_OK) {
+      return false;
+    }
+    U8 buffer[CRC_BUFFER_SIZE];
+    U32 computed = 0xFFFFFFFFU;
+    bool status = true;
+    while (true) {
+      NATIVE_INT_TYPE size = sizeof(buffer);
+      if (file.read(buffer, size, false) != Os::File::OP_OK) {
+        status = false;
+        break;
+      }
+      if (size == 0) {
+        break;
+      }
+      computed = Utils::crc32Update(computed, buffer, size);
+    }
+    file.close();
+    crc = ~computed;
+    return status;
+  }
+
+  bool CmdSequencerComponentImpl::SequenceCache ::
+    getFileKey(
+        const Fw::CmdStringArg& fileName,
+        FileKey& fileKey
+    )
+  {
+    const char *const path = fileName.toChar();
+    return
+      Os::FileSystem::getFileSize(path, fileKey.m_size) ==
+        Os::FileSystem::OP_OK and
+      Os::FileSystem::getFileModTime(
+          path,
+          fileKey.m_modSeconds,
+          fileKey.m_modUSeconds
+      ) == Os::FileSystem::OP_OK and
+      getFileCRC(path, fileKey.m_crc);
+  }
+
+  bool CmdSequencerComponentImpl::SequenceCache ::
+    getEntryKeys(
+        const Fw::CmdStringArg& fileName,
+        const Sequence& sequence,
+        FileKey& fileKey,
+        FileKey& sideFileKey
+    )
+  {
+    sideFileKey = FileKey();
+    Fw::CmdStringArg sideFileName;
+    if (
+        sequence.getSideFileName(fileName, sideFileName) and
+        not getFileKey(sideFileName, sideFileKey)
+    ) {
+      return false;
+    }
+    return getFileKey(fileName, fileKey);
+  }
+
+  CmdSequencerComponentImpl::SequenceCache::Entry*
+    CmdSequencerComponentImpl::SequenceCache ::
+      find(const Fw::CmdStringArg& fileName)
+  {
+    for (NATIVE_UINT_TYPE i = 0; i < MAX_ENTRIES; ++i) {
+      Entry& entry = this->m_entries[i];
+      if (entry.m_valid and entry.m_fileName == fileName) {
+        return &entry;
+      }
+    }
+    return NULL;
+  }
+
+  CmdSequencerComponentImpl::SequenceCache::Entry*
+    CmdSequencerComponentImpl::SequenceCache ::
+      findFree(void)
+  {
+    for (NATIVE_UINT_TYPE i = 0; i < MAX_ENTRIES; ++i) {
+      if (not this->m_entries[i].m_valid) {
+        return &this->m_entries[i];
+      }
+    }
+    return NULL;
+  }
+
+  void CmdSequencerComponentImpl::SequenceCache ::
+    remove(Entry& entry)
+  {
+    FW_ASSERT(entry.m_valid);
+    const NATIVE_UINT_TYPE end = entry.m_offset + entry.m_size;
+    FW_ASSERT(end <= this->m_used, end, this->m_used);
+    // Move the data after the entry down to close the gap
+    (void) memmove(
+        &this->m_data[entry.m_offset],
+        &this->m_data[end],
+        this->m_used - end
+    );
+    for (NATIVE_UINT_TYPE i = 0; i < MAX_ENTRIES; ++i) {
+      Entry& other = this->m_entries[i];
+      if (other.m_valid and other.m_offset >= end and &other != &entry) {
+        other.m_offset -= entry.m_size;
+      }
+    }
+    this->m_used -= entry.m_size;
+    entry.m_valid = false;
+  }
+
+  void CmdSequencerComponentImpl::SequenceCache ::
+    evict(void)
+  {
+    Entry* lru = NULL;
+    for (NATIVE_UINT_TYPE i = 0; i < MAX_ENTRIES; ++i) {
+      Entry& entry = this->m_entries[i];
+      if (
+          entry.m_valid and
+          (lru == NULL or entry.m_lastUse < lru->m_lastUse)
+      ) {
+        lru = &entry;
+      }
+    }
+    // Only called when an entry is needed, so there is one to evict
+    FW_ASSERT(lru != NULL);
+    this->remove(*lru);
+  }
+
+}
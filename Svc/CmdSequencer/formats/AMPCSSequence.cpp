@@ -26,14 +26,25 @@ namespace Svc {
 
   }
 
+  bool AMPCSSequence ::
+    getSideFileName(
+        const Fw::CmdStringArg& fileName,
+        Fw::CmdStringArg& sideFileName
+    ) const
+  {
+    sideFileName = fileName;
+    sideFileName += ".CRC32";
+    return true;
+  }
+
   bool AMPCSSequence ::
     loadFile(const Fw::CmdStringArg& fileName) 
   {
     // Make sure there is a buffer allocated
     FW_ASSERT(this->m_buffer.getBuffAddr());
 
-    Fw::CmdStringArg crcFileName = fileName;
-    crcFileName += ".CRC32";
+    Fw::CmdStringArg crcFileName;
+    (void) this->getSideFileName(fileName, crcFileName);
 
     this->m_header.m_timeBase = TB_DONT_CARE;
     this->m_header.m_timeContext = FW_CONTEXT_DONT_CARE;
@@ -42,7 +53,7 @@ namespace Svc {
       and this->getFileSize(fileName)
       and this->readSequenceFile(fileName)
       and this->validateCRC()
-      and this->m_header.validateTime(this->m_component)
+      and this->m_header.validateTime(this->m_component, this->m_events)
       and this->validateRecords();
 
     return status;
@@ -174,11 +185,12 @@ namespace Svc {
     return this->m_buffer.getBuffLeft() > 0;
   }
 
-  void AMPCSSequence ::
+  bool AMPCSSequence ::
      nextRecord(Sequence::Record& record)
   {
     Fw::SerializeStatus status = this->deserializeRecord(record);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return true;
   }
 
   void AMPCSSequence ::
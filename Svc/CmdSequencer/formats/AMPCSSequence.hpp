@@ -109,7 +109,8 @@ namespace Svc {
 
       //! Get the next record in the sequence.
       //! Asserts on failure
-      void nextRecord(
+      //! \return true
+      bool nextRecord(
           Sequence::Record& record //!< The returned record
       );
 
@@ -122,6 +123,13 @@ namespace Svc {
       //! After calling this, hasMoreRecords should return false.
       void clear(void);
 
+      //! Get the name of the CRC file of a sequence file
+      //! \return true
+      bool getSideFileName(
+          const Fw::CmdStringArg& fileName, //!< The sequence file name
+          Fw::CmdStringArg& sideFileName //!< The CRC file name
+      ) const;
+
     PRIVATE:
 
       //! Read a CRC file
@@ -0,0 +1,535 @@
+// ======================================================================
+// \title  FPrimeStreamingSequence.cpp
+// \brief  FPrimeStreamingSequence implementation
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <string.h>
+
+#include "Fw/Types/Assert.hpp"
+#include "Os/FileSystem.hpp"
+#include "Svc/CmdSequencer/formats/FPrimeStreamingSequence.hpp"
+
+namespace Svc {
+
+  FPrimeStreamingSequence ::
+    FPrimeStreamingSequence(CmdSequencerComponentImpl& component) :
+      CmdSequencerComponentImpl::Sequence(component),
+      m_headerCRC(0),
+      m_fileOpen(false),
+      m_fileSize(0),
+      m_modSeconds(0),
+      m_modUSeconds(0),
+      m_dataSize(0),
+      m_dataRemaining(0),
+      m_recordNumber(0),
+      m_invalidRecordNumber(0),
+      m_invalidRecordStatus(Fw::FW_SERIALIZE_OK),
+      m_extraBytes(0)
+  {
+
+  }
+
+  bool FPrimeStreamingSequence ::
+    loadFile(const Fw::CmdStringArg& fileName)
+  {
+    // Make sure there is a buffer that can hold a complete record
+    FW_ASSERT(this->m_buffer.getBuffAddr());
+    const NATIVE_UINT_TYPE capacity = this->m_buffer.getBuffCapacity();
+    FW_ASSERT(capacity >= MIN_BUFFER_SIZE, capacity);
+
+    // Close any previously loaded sequence
+    this->clear();
+    this->setFileName(fileName);
+
+    bool result;
+
+    const Os::File::Status status = this->m_sequenceFile.open(
+        this->m_fileName.toChar(),
+        Os::File::OPEN_READ
+    );
+
+    if (status == Os::File::OP_OK) {
+      this->m_fileOpen = true;
+      result = this->readOpenFile();
+    } else if (status == Os::File::DOESNT_EXIST) {
+      this->m_events.fileNotFound();
+      result = false;
+    } else {
+      this->m_events.fileReadError();
+      result = false;
+    }
+
+    if (not result) {
+      this->clear();
+    }
+    return result;
+  }
+
+  bool FPrimeStreamingSequence ::
+    hasMoreRecords(void) const
+  {
+    return this->m_buffer.getBuffLeft() > 0 or this->m_dataRemaining > 0;
+  }
+
+  bool FPrimeStreamingSequence ::
+    nextRecord(Sequence::Record& record)
+  {
+    bool status = this->ensureRecord(true);
+    if (status) {
+      const Fw::SerializeStatus serializeStatus =
+        this->deserializeRecord(record);
+      if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+        this->m_events.recordInvalid(this->m_recordNumber, serializeStatus);
+        status = false;
+      }
+    }
+    if (status) {
+      ++this->m_recordNumber;
+    } else {
+      this->clear();
+    }
+    return status;
+  }
+
+  void FPrimeStreamingSequence ::
+    reset(void)
+  {
+    if (not (this->m_fileOpen and this->rewind())) {
+      this->clear();
+    }
+  }
+
+  void FPrimeStreamingSequence ::
+    clear(void)
+  {
+    if (this->m_fileOpen) {
+      this->m_sequenceFile.close();
+      this->m_fileOpen = false;
+    }
+    this->m_buffer.resetSer();
+    this->m_dataRemaining = 0;
+  }
+
+  bool FPrimeStreamingSequence ::
+    isCacheable(void) const
+  {
+    return false;
+  }
+
+  bool FPrimeStreamingSequence ::
+    readOpenFile(void)
+  {
+    U8 *const buffAddr = this->m_buffer.getBuffAddr();
+    this->m_crc.init();
+    bool status = this->getFileTimes(
+        this->m_fileSize,
+        this->m_modSeconds,
+        this->m_modUSeconds
+    );
+    if (not status) {
+      this->m_events.fileReadError();
+    }
+    status = status and this->readHeader();
+    if (status) {
+      this->m_crc.update(buffAddr, Sequence::Header::SERIALIZED_SIZE);
+      this->m_headerCRC = this->m_crc.m_computed;
+      status = this->deserializeHeader()
+        and this->streamRecords()
+        and this->readCRC();
+    }
+    if (status) {
+      this->m_crc.finalize();
+      status = this->validateCRC()
+        and this->m_header.validateTime(this->m_component, this->m_events)
+        and this->validateRecords()
+        and this->rewind();
+    }
+    return status;
+  }
+
+  bool FPrimeStreamingSequence ::
+    getFileTimes(
+        U64& fileSize,
+        U32& modSeconds,
+        U32& modUSeconds
+    )
+  {
+    const char *const path = this->m_fileName.toChar();
+    return
+      Os::FileSystem::getFileSize(path, fileSize) ==
+        Os::FileSystem::OP_OK and
+      Os::FileSystem::getFileModTime(path, modSeconds, modUSeconds) ==
+        Os::FileSystem::OP_OK;
+  }
+
+  bool FPrimeStreamingSequence ::
+    checkFileTimes(void)
+  {
+    U64 fileSize = 0;
+    U32 modSeconds = 0;
+    U32 modUSeconds = 0;
+    const bool status =
+      this->getFileTimes(fileSize, modSeconds, modUSeconds) and
+      fileSize == this->m_fileSize and
+      modSeconds == this->m_modSeconds and
+      modUSeconds == this->m_modUSeconds;
+    if (not status) {
+      this->m_events.fileReadError();
+    }
+    return status;
+  }
+
+  bool FPrimeStreamingSequence ::
+    readHeader(void)
+  {
+    Os::File& file = this->m_sequenceFile;
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    bool status = true;
+
+    NATIVE_INT_TYPE readLen = Sequence::Header::SERIALIZED_SIZE;
+    const Os::File::Status fileStatus = file.read(
+        buffer.getBuffAddr(),
+        readLen
+    );
+
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_HEADER,
+          file.getLastError()
+      );
+      status = false;
+    }
+
+    if (status and readLen != Sequence::Header::SERIALIZED_SIZE) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_HEADER_SIZE,
+          readLen
+      );
+      status = false;
+    }
+
+    if (status) {
+      const Fw::SerializeStatus serializeStatus =
+        buffer.setBuffLen(readLen);
+      FW_ASSERT(
+          serializeStatus == Fw::FW_SERIALIZE_OK,
+          serializeStatus
+      );
+    }
+
+    return status;
+  }
+
+  bool FPrimeStreamingSequence ::
+    deserializeHeader(void)
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    Header& header = this->m_header;
+
+    // File size
+    Fw::SerializeStatus serializeStatus = buffer.deserialize(header.m_fileSize);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::DESER_SIZE,
+          serializeStatus
+      );
+      return false;
+    }
+    if (header.m_fileSize < sizeof(this->m_crc.m_stored)) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_CRC,
+          header.m_fileSize
+      );
+      return false;
+    }
+    this->m_dataSize = header.m_fileSize - sizeof(this->m_crc.m_stored);
+    // Number of records
+    serializeStatus = buffer.deserialize(header.m_numRecords);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::DESER_NUM_RECORDS,
+          serializeStatus
+      );
+      return false;
+    }
+    // Time base
+    FwTimeBaseStoreType tbase;
+    serializeStatus = buffer.deserialize(tbase);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::DESER_TIME_BASE,
+          serializeStatus
+      );
+      return false;
+    }
+    header.m_timeBase = static_cast<TimeBase>(tbase);
+    // Time context
+    serializeStatus = buffer.deserialize(header.m_timeContext);
+    if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::DESER_TIME_CONTEXT,
+          serializeStatus
+      );
+      return false;
+    }
+    return true;
+  }
+
+  bool FPrimeStreamingSequence ::
+    streamRecords(void)
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    const U32 numRecords = this->m_header.m_numRecords;
+    Sequence::Record record;
+    bool status = true;
+
+    buffer.resetSer();
+    this->m_dataRemaining = this->m_dataSize;
+    this->m_invalidRecordNumber = 0;
+    this->m_invalidRecordStatus = Fw::FW_SERIALIZE_OK;
+    this->m_extraBytes = 0;
+
+    // Deserialize all records. Defer error reporting until the
+    // CRC has been checked, so events come out in the same order
+    // as for FPrimeSequence.
+    for (U32 recordNumber = 0; recordNumber < numRecords; ++recordNumber) {
+      status = this->ensureRecord(false);
+      if (not status) {
+        break;
+      }
+      const Fw::SerializeStatus serializeStatus =
+        this->deserializeRecord(record);
+      if (serializeStatus != Fw::FW_SERIALIZE_OK) {
+        this->m_invalidRecordNumber = recordNumber;
+        this->m_invalidRecordStatus = serializeStatus;
+        break;
+      }
+    }
+    // Count any data left after the last record
+    if (status and this->m_invalidRecordStatus == Fw::FW_SERIALIZE_OK) {
+      this->m_extraBytes = buffer.getBuffLeft() + this->m_dataRemaining;
+    }
+    // Run the rest of the data through the CRC
+    while (status and this->m_dataRemaining > 0) {
+      buffer.resetSer();
+      status = this->fillBuffer(false);
+    }
+    return status;
+  }
+
+  bool FPrimeStreamingSequence ::
+    readCRC(void)
+  {
+    Os::File& file = this->m_sequenceFile;
+    U8 crcBytes[sizeof(this->m_crc.m_stored)];
+
+    NATIVE_INT_TYPE readLen = sizeof(crcBytes);
+    const Os::File::Status fileStatus = file.read(crcBytes, readLen);
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      return false;
+    }
+    if (readLen != sizeof(crcBytes)) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA_SIZE,
+          readLen
+      );
+      return false;
+    }
+    Fw::ExternalSerializeBuffer crcBuff(crcBytes, sizeof(crcBytes));
+    Fw::SerializeStatus status = crcBuff.setBuffLen(sizeof(crcBytes));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    status = crcBuff.deserialize(this->m_crc.m_stored);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return true;
+  }
+
+  bool FPrimeStreamingSequence ::
+    validateCRC(void)
+  {
+    bool result = true;
+    if (this->m_crc.m_stored != this->m_crc.m_computed) {
+      this->m_events.fileCRCFailure(
+          this->m_crc.m_stored,
+          this->m_crc.m_computed
+      );
+      result = false;
+    }
+    return result;
+  }
+
+  bool FPrimeStreamingSequence ::
+    validateRecords(void)
+  {
+    if (this->m_invalidRecordStatus != Fw::FW_SERIALIZE_OK) {
+      this->m_events.recordInvalid(
+          this->m_invalidRecordNumber,
+          this->m_invalidRecordStatus
+      );
+      return false;
+    }
+    if (this->m_extraBytes > 0) {
+      this->m_events.recordMismatch(
+          this->m_header.m_numRecords,
+          this->m_extraBytes
+      );
+      return false;
+    }
+    return true;
+  }
+
+  bool FPrimeStreamingSequence ::
+    fillBuffer(const bool checkCRC)
+  {
+    Os::File& file = this->m_sequenceFile;
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    U8 *const buffAddr = buffer.getBuffAddr();
+
+    // Move the unread bytes to the front of the buffer
+    const NATIVE_UINT_TYPE buffLeft = buffer.getBuffLeft();
+    (void) memmove(buffAddr, buffer.getBuffAddrLeft(), buffLeft);
+
+    // Fill the rest of the buffer
+    const NATIVE_UINT_TYPE space = buffer.getBuffCapacity() - buffLeft;
+    const NATIVE_UINT_TYPE size = (this->m_dataRemaining < space) ?
+      this->m_dataRemaining : space;
+    NATIVE_INT_TYPE readLen = size;
+    const Os::File::Status fileStatus = file.read(&buffAddr[buffLeft], readLen);
+    // check read status
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      return false;
+    }
+    // check read size
+    if (static_cast<NATIVE_INT_TYPE>(size) != readLen) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA_SIZE,
+          readLen
+      );
+      return false;
+    }
+    this->m_crc.update(&buffAddr[buffLeft], size);
+    this->m_dataRemaining -= size;
+    // set buffer size
+    const Fw::SerializeStatus serializeStatus =
+      buffer.setBuffLen(buffLeft + size);
+    FW_ASSERT(serializeStatus == Fw::FW_SERIALIZE_OK, serializeStatus);
+    // the file is read more than once, so check that it has not changed
+    if (not this->checkFileTimes()) {
+      return false;
+    }
+    if (checkCRC and this->m_dataRemaining == 0) {
+      this->m_crc.finalize();
+      return this->validateCRC();
+    }
+    return true;
+  }
+
+  bool FPrimeStreamingSequence ::
+    ensureRecord(const bool checkCRC)
+  {
+    bool status = true;
+    if (
+        this->m_buffer.getBuffLeft() < MAX_RECORD_SIZE and
+        this->m_dataRemaining > 0
+    ) {
+      status = this->fillBuffer(checkCRC);
+    }
+    return status;
+  }
+
+  bool FPrimeStreamingSequence ::
+    rewind(void)
+  {
+    Os::File& file = this->m_sequenceFile;
+    const Os::File::Status fileStatus =
+      file.seek(Sequence::Header::SERIALIZED_SIZE);
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      return false;
+    }
+    this->m_buffer.resetSer();
+    this->m_dataRemaining = this->m_dataSize;
+    this->m_crc.m_computed = this->m_headerCRC;
+    this->m_recordNumber = 0;
+    return true;
+  }
+
+  Fw::SerializeStatus FPrimeStreamingSequence ::
+    deserializeRecord(Sequence::Record& record)
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+
+    // Descriptor
+    U8 descEntry;
+    Fw::SerializeStatus status = buffer.deserialize(descEntry);
+    if (status == Fw::FW_SERIALIZE_OK) {
+      switch (descEntry) {
+        case Sequence::Record::ABSOLUTE...Sequence::Record::END_OF_SEQUENCE:
+          record.m_descriptor = static_cast<Sequence::Record::Descriptor>(descEntry);
+          break;
+        default:
+          status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+      }
+    }
+    if (
+      status == Fw::FW_SERIALIZE_OK and
+      record.m_descriptor == Sequence::Record::END_OF_SEQUENCE
+    ) {
+      return Fw::FW_SERIALIZE_OK;
+    }
+    // Time tag
+    U32 seconds = 0, useconds = 0;
+    if (status == Fw::FW_SERIALIZE_OK) {
+      status = buffer.deserialize(seconds);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+      status = buffer.deserialize(useconds);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+      record.m_timeTag.set(seconds, useconds);
+    }
+    // Record size
+    U32 recordSize = 0;
+    if (status == Fw::FW_SERIALIZE_OK) {
+      status = buffer.deserialize(recordSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK and recordSize > buffer.getBuffLeft()) {
+      // Not enough data left
+      status = Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    if (
+      status == Fw::FW_SERIALIZE_OK and
+      recordSize + sizeof(FwPacketDescriptorType) > Fw::ComBuffer::SERIALIZED_SIZE
+    ) {
+      // Record size is too big for com buffer
+      status = Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    // Command
+    if (status == Fw::FW_SERIALIZE_OK) {
+      Fw::ComBuffer& comBuffer = record.m_command;
+      comBuffer.resetSer();
+      NATIVE_UINT_TYPE size = recordSize;
+      status = comBuffer.setBuffLen(recordSize);
+      FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+      status = buffer.deserialize(comBuffer.getBuffAddr(), size, true);
+    }
+    return status;
+  }
+
+}
@@ -0,0 +1,205 @@
+// ======================================================================
+// \title  FPrimeStreamingSequence.hpp
+// \brief  FPrimeStreamingSequence interface
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_FPrimeStreamingSequence_HPP
+#define Svc_FPrimeStreamingSequence_HPP
+
+#include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
+
+namespace Svc {
+
+  //! \class FPrimeStreamingSequence
+  //! \brief A sequence in F Prime format that is streamed from the file
+  //!
+  //! The sequence buffer is used as a sliding window over the file
+  //! instead of holding the whole file. The CRC and the records are
+  //! validated in a single sequential pass, and records are read back
+  //! a window at a time while the sequence runs. The file size is
+  //! therefore not limited by the buffer size. The buffer must hold at
+  //! least one maximum-size record (MIN_BUFFER_SIZE).
+  //!
+  //! Because the file is read again while the sequence runs, each read
+  //! checks that the file size and modification time are unchanged, and
+  //! the data read back is checked against the stored CRC.
+  class FPrimeStreamingSequence :
+    public CmdSequencerComponentImpl::Sequence
+  {
+
+    public:
+
+      enum Constants {
+        //! The maximum serialized size of a record
+        MAX_RECORD_SIZE =
+          sizeof(U8) +
+          sizeof(U32) +
+          sizeof(U32) +
+          sizeof(U32) +
+          Fw::ComBuffer::SERIALIZED_SIZE,
+        //! The minimum buffer size
+        MIN_BUFFER_SIZE = MAX_RECORD_SIZE
+      };
+
+    public:
+
+      //! Construct an FPrimeStreamingSequence
+      FPrimeStreamingSequence(
+          CmdSequencerComponentImpl& component //!< The enclosing component
+      );
+
+    public:
+
+      //! Load a sequence file
+      //! \return Success or failure
+      bool loadFile(
+          const Fw::CmdStringArg& fileName //!< The file name
+      );
+
+      //! Query whether the sequence has any more records
+      //! \return Yes or no
+      bool hasMoreRecords(void) const;
+
+      //! Get the next record in the sequence.
+      //! On failure, report the error and clear the sequence.
+      //! \return Success or failure
+      bool nextRecord(
+          Sequence::Record& record //!< The returned record
+      );
+
+      //! Reset the sequence to the beginning.
+      //! After calling this, hasMoreRecords should return true, unless
+      //! the sequence has no records.
+      void reset(void);
+
+      //! Clear the sequence records.
+      //! After calling this, hasMoreRecords should return false.
+      void clear(void);
+
+      //! The buffer holds only part of the record data, so a
+      //! streaming sequence is never cached
+      //! \return false
+      bool isCacheable(void) const;
+
+    PRIVATE:
+
+      //! Read and validate an open sequence file
+      //! \return Success or failure
+      bool readOpenFile(void);
+
+      //! Get the size and modification time of the sequence file
+      //! \return Success or failure
+      bool getFileTimes(
+          U64& fileSize, //!< The file size
+          U32& modSeconds, //!< The modification time, seconds part
+          U32& modUSeconds //!< The modification time, microseconds part
+      );
+
+      //! Check that the size and modification time of the sequence
+      //! file are the same as when it was opened
+      //! \return Success or failure
+      bool checkFileTimes(void);
+
+      //! Read the binary sequence header into the buffer
+      //! \return Success or failure
+      bool readHeader(void);
+
+      //! Deserialize the binary sequence header from the buffer
+      //! \return Success or failure
+      bool deserializeHeader(void);
+
+      //! Stream the record data through the CRC and the record validator
+      //! \return Success or failure
+      bool streamRecords(void);
+
+      //! Read the stored CRC that follows the record data
+      //! \return Success or failure
+      bool readCRC(void);
+
+      //! Validate the CRC
+      //! \return Success or failure
+      bool validateCRC(void);
+
+      //! Report the outcome of record validation
+      //! \return Success or failure
+      bool validateRecords(void);
+
+      //! Move the unread bytes to the front of the buffer and
+      //! fill the rest of the buffer from the file. The new bytes are
+      //! run through the CRC.
+      //! \return Success or failure
+      bool fillBuffer(
+          const bool checkCRC //!< Whether to validate the CRC after the last bytes
+      );
+
+      //! Fill the buffer if it may not hold a complete record
+      //! \return Success or failure
+      bool ensureRecord(
+          const bool checkCRC //!< Whether to validate the CRC after the last bytes
+      );
+
+      //! Rewind the file to the first record
+      //! \return Success or failure
+      bool rewind(void);
+
+      //! Deserialize a record from the buffer
+      //! \return Serialize status
+      Fw::SerializeStatus deserializeRecord(
+          Sequence::Record& record //!< The record
+      );
+
+    PRIVATE:
+
+      //! The CRC values
+      CmdSequencerComponentImpl::FPrimeSequence::CRC m_crc;
+
+      //! The computed CRC after the header, where each pass over the
+      //! record data starts
+      U32 m_headerCRC;
+
+      //! The sequence file
+      Os::File m_sequenceFile;
+
+      //! Whether the sequence file is open
+      bool m_fileOpen;
+
+      //! The size of the sequence file when it was opened
+      U64 m_fileSize;
+
+      //! The modification time of the sequence file when it was opened,
+      //! seconds part
+      U32 m_modSeconds;
+
+      //! The modification time of the sequence file when it was opened,
+      //! microseconds part
+      U32 m_modUSeconds;
+
+      //! The size of the record data, excluding the CRC
+      U32 m_dataSize;
+
+      //! The number of record data bytes not yet read into the buffer
+      U32 m_dataRemaining;
+
+      //! The number of the next record to run
+      U32 m_recordNumber;
+
+      //! The number of the first invalid record
+      U32 m_invalidRecordNumber;
+
+      //! The status of the first invalid record
+      Fw::SerializeStatus m_invalidRecordStatus;
+
+      //! The number of bytes after the last record
+      U32 m_extraBytes;
+
+  };
+
+}
+
+#endif
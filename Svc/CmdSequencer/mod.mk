@@ -8,10 +8,13 @@ SRC = \
 	Events.cpp \
 	FPrimeSequence.cpp \
         Sequence.cpp \
-	formats/AMPCSSequence.cpp
+	SequenceCache.cpp \
+	formats/AMPCSSequence.cpp \
+	formats/FPrimeStreamingSequence.cpp
 
 HDR = \
 	CmdSequencerImpl.hpp \
-	formats/AMPCSSequence.hpp
+	formats/AMPCSSequence.hpp \
+	formats/FPrimeStreamingSequence.hpp
 
 SUBDIRS = test
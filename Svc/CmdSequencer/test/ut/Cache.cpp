@@ -0,0 +1,245 @@
+// ====================================================================== 
+// \title  Cache.cpp
+// \brief  Test the validated sequence cache
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "Os/FileSystem.hpp"
+#include "Svc/CmdSequencer/test/ut/Cache.hpp"
+
+namespace Svc {
+
+  namespace Cache {
+
+    // ----------------------------------------------------------------------
+    // Constants 
+    // ----------------------------------------------------------------------
+
+    //! The cache allocator ID
+    static const NATIVE_INT_TYPE CACHE_ALLOCATOR_ID = ALLOCATOR_ID + 1;
+
+    //! The number of records in the test sequence
+    static const U32 NUM_RECORDS = 5;
+
+    // ----------------------------------------------------------------------
+    // Constructors and destructors
+    // ----------------------------------------------------------------------
+
+    Tester ::
+      Tester(const SequenceFiles::File::Format::t format) :
+        ImmediateBase::Tester(format)
+    {
+      this->component.allocateCache(
+          CACHE_ALLOCATOR_ID,
+          this->mallocator,
+          BUFFER_SIZE
+      );
+    }
+
+    Tester ::
+      ~Tester(void)
+    {
+      this->component.deallocateCache(this->mallocator);
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests 
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      Hit(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Validate the file: the first load is a miss
+      this->validateFile(0, fileName);
+      ASSERT_TLM_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses(0, 1);
+      // Run the sequence: the records come from the cache
+      this->runSequence(0, fileName);
+      ASSERT_TLM_CS_CacheHits_SIZE(1);
+      ASSERT_TLM_CS_CacheHits(0, 1);
+      ASSERT_TLM_CS_CacheMisses_SIZE(0);
+      // Execute commands
+      this->executeCommandsAuto(
+          fileName,
+          NUM_RECORDS,
+          NUM_RECORDS,
+          CmdExecMode::NO_NEW_SEQUENCE
+      );
+      // Check for command complete on seqDone
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_OK);
+    }
+
+    void Tester ::
+      Changed(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateFile(0, fileName);
+      ASSERT_TLM_CS_CacheMisses_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses(0, 1);
+      // Overwrite the file with a longer sequence
+      const U32 numRecords = 2 * NUM_RECORDS;
+      SequenceFiles::ImmediateFile newFile(numRecords, this->format);
+      newFile.setName(fileName);
+      newFile.write();
+      // Run the sequence: the cached copy is stale
+      this->runSequence(0, fileName);
+      ASSERT_TLM_CS_CacheHits_SIZE(0);
+      ASSERT_TLM_CS_CacheMisses_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses(0, 2);
+      // Execute commands from the new file
+      this->executeCommandsAuto(
+          fileName,
+          numRecords,
+          numRecords,
+          CmdExecMode::NO_NEW_SEQUENCE
+      );
+      // Check for command complete on seqDone
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_OK);
+    }
+
+    void Tester ::
+      ChangedSameSizeAndTime(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateFile(0, fileName);
+      ASSERT_TLM_CS_CacheMisses_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses(0, 1);
+      // Change the last byte of the file, keeping its size and
+      // modification time
+      struct stat fileStat;
+      ASSERT_EQ(0, ::stat(fileName, &fileStat));
+      FILE *const fp = fopen(fileName, "r+b");
+      ASSERT_TRUE(fp != NULL);
+      ASSERT_EQ(0, fseek(fp, -1, SEEK_END));
+      const int byte = fgetc(fp);
+      ASSERT_NE(EOF, byte);
+      ASSERT_EQ(0, fseek(fp, -1, SEEK_END));
+      ASSERT_NE(EOF, fputc(byte ^ 0xFF, fp));
+      ASSERT_EQ(0, fclose(fp));
+      struct timeval times[2];
+      times[0].tv_sec = fileStat.st_atim.tv_sec;
+      times[0].tv_usec = fileStat.st_atim.tv_nsec / 1000;
+      times[1].tv_sec = fileStat.st_mtim.tv_sec;
+      times[1].tv_usec = fileStat.st_mtim.tv_nsec / 1000;
+      ASSERT_EQ(0, ::utimes(fileName, times));
+      // Run the sequence: the CRC differs, so the cached copy is not
+      // used, and the changed file fails validation
+      this->sendCmd_CS_RUN(0, 0, fileName);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_RUN,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      ASSERT_TLM_CS_CacheHits_SIZE(0);
+      ASSERT_TLM_CS_CacheMisses_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses(0, 2);
+    }
+
+    void Tester ::
+      Evict(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Validate one more file than there are cache entries
+      const U32 numFiles =
+        CmdSequencerComponentImpl::SequenceCache::MAX_ENTRIES + 1;
+      for (U32 i = 0; i < numFiles; ++i) {
+        SequenceFiles::ImmediateFile file(i + 1, this->format);
+        file.write();
+        this->validateFile(0, file.getName().toChar());
+        ASSERT_TLM_CS_CacheMisses_SIZE(1);
+        ASSERT_TLM_CS_CacheMisses(0, i + 1);
+      }
+      // The least recently used file was evicted
+      {
+        SequenceFiles::ImmediateFile file(1, this->format);
+        this->validateFile(0, file.getName().toChar());
+        ASSERT_TLM_CS_CacheHits_SIZE(0);
+        ASSERT_TLM_CS_CacheMisses_SIZE(1);
+        ASSERT_TLM_CS_CacheMisses(0, numFiles + 1);
+      }
+      // The most recently used file is still cached
+      {
+        SequenceFiles::ImmediateFile file(numFiles, this->format);
+        this->validateFile(0, file.getName().toChar());
+        ASSERT_TLM_CS_CacheHits_SIZE(1);
+        ASSERT_TLM_CS_CacheHits(0, 1);
+        ASSERT_TLM_CS_CacheMisses_SIZE(0);
+      }
+    }
+
+    void Tester ::
+      SideFileChanged(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateFile(0, fileName);
+      ASSERT_TLM_CS_CacheMisses_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses(0, 1);
+      // Remove the CRC file. The sequence file is unchanged
+      Fw::EightyCharString crcFileName(fileName);
+      crcFileName += ".CRC32";
+      ASSERT_EQ(
+          Os::FileSystem::OP_OK,
+          Os::FileSystem::removeFile(crcFileName.toChar())
+      );
+      // Run the sequence: the cached copy is stale, and the load fails
+      this->sendCmd_CS_RUN(0, 0, fileName);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_RUN,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_FileNotFound(0, crcFileName.toChar());
+      ASSERT_TLM_CS_CacheHits_SIZE(0);
+      ASSERT_TLM_CS_CacheMisses_SIZE(1);
+      ASSERT_TLM_CS_CacheMisses(0, 2);
+    }
+
+  }
+
+}
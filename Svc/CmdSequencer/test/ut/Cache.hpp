@@ -0,0 +1,69 @@
+// ====================================================================== 
+// \title  Cache.hpp
+// \brief  Test the validated sequence cache
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef Svc_Cache_HPP
+#define Svc_Cache_HPP
+
+#include "Svc/CmdSequencer/test/ut/ImmediateBase.hpp"
+
+namespace Svc {
+
+  namespace Cache {
+
+    //! Test sequences that are run from the sequence cache
+    class Tester :
+      public ImmediateBase::Tester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors and destructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object Tester
+        Tester(
+            const SequenceFiles::File::Format::t format = 
+            SequenceFiles::File::Format::F_PRIME //!< The file format to use
+        );
+
+        //! Destroy object Tester
+        ~Tester(void);
+
+      public:
+
+        // ---------------------------------------------------------------------- 
+        // Tests
+        // ---------------------------------------------------------------------- 
+
+        //! Validate a sequence, then run it from the cache
+        void Hit(void);
+
+        //! Validate a sequence, change the file, then run it
+        void Changed(void);
+
+        //! Validate a sequence, change its contents but not its size or
+        //! modification time, then run it
+        void ChangedSameSizeAndTime(void);
+
+        //! Validate more sequences than fit in the cache
+        void Evict(void);
+
+        //! Validate an AMPCS sequence, remove its CRC file, then run it
+        void SideFileChanged(void);
+
+    };
+
+  }
+
+}
+
+#endif
@@ -0,0 +1,164 @@
+// ====================================================================== 
+// \title  Deadlines.cpp
+// \brief  Test timers driven by deadline ports
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include "Svc/CmdSequencer/test/ut/CommandBuffers.hpp"
+#include "Svc/CmdSequencer/test/ut/Deadlines.hpp"
+
+namespace Svc {
+
+  namespace Deadlines {
+
+    // ----------------------------------------------------------------------
+    // Constructors and destructors
+    // ----------------------------------------------------------------------
+
+    Tester ::
+      Tester(void) :
+        Svc::Tester(SequenceFiles::File::Format::F_PRIME)
+    {
+      this->component.set_deadlineSetOut_OutputPort(
+          0,
+          this->get_from_deadlineSetOut(0)
+      );
+      this->component.set_deadlineCancelOut_OutputPort(
+          0,
+          this->get_from_deadlineCancelOut(0)
+      );
+      this->connect_to_timeoutIn(
+          0,
+          this->component.get_timeoutIn_InputPort(0)
+      );
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests 
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      Relative(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 0);
+      this->setTestTime(testTime);
+      // Write the file; each record runs 2 seconds after the previous one
+      SequenceFiles::RelativeFile file(2, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run the sequence; the first command waits for a deadline
+      this->runSequence(0, fileName);
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_from_deadlineSetOut_SIZE(1);
+      ASSERT_from_deadlineSetOut(
+          0,
+          CmdSequencerComponentImpl::CMD_TIMER_KEY,
+          Fw::Time(TB_WORKSTATION_TIME, 3, 0)
+      );
+      // A deadline that expires early is set again
+      this->expire(CmdSequencerComponentImpl::CMD_TIMER_KEY, 2);
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_from_deadlineSetOut_SIZE(1);
+      ASSERT_from_deadlineSetOut(
+          0,
+          CmdSequencerComponentImpl::CMD_TIMER_KEY,
+          Fw::Time(TB_WORKSTATION_TIME, 3, 0)
+      );
+      // The deadline expires; the command goes out and the timeout is set
+      this->expire(CmdSequencerComponentImpl::CMD_TIMER_KEY, 3);
+      {
+        Fw::ComBuffer comBuff;
+        CommandBuffers::create(comBuff, 0, 1);
+        ASSERT_from_comCmdOut_SIZE(1);
+        ASSERT_from_comCmdOut(0, comBuff, 0U);
+      }
+      ASSERT_from_deadlineCancelOut_SIZE(1);
+      ASSERT_from_deadlineSetOut_SIZE(1);
+      ASSERT_from_deadlineSetOut(
+          0,
+          CmdSequencerComponentImpl::CMD_TIMEOUT_KEY,
+          Fw::Time(TB_WORKSTATION_TIME, 3 + TIMEOUT, 0)
+      );
+      // The response cancels the timeout and sets the next command time
+      this->invoke_to_cmdResponseIn(0, 0, 0, Fw::COMMAND_OK);
+      this->clearAndDispatch();
+      ASSERT_from_deadlineCancelOut_SIZE(1);
+      ASSERT_from_deadlineCancelOut(
+          0,
+          CmdSequencerComponentImpl::CMD_TIMEOUT_KEY
+      );
+      ASSERT_from_deadlineSetOut_SIZE(1);
+      ASSERT_from_deadlineSetOut(
+          0,
+          CmdSequencerComponentImpl::CMD_TIMER_KEY,
+          Fw::Time(TB_WORKSTATION_TIME, 5, 0)
+      );
+      // Canceling the sequence cancels the deadline
+      this->sendCmd_CS_CANCEL(0, 0);
+      this->clearAndDispatch();
+      ASSERT_from_deadlineCancelOut_SIZE(1);
+      ASSERT_from_deadlineCancelOut(
+          0,
+          CmdSequencerComponentImpl::CMD_TIMER_KEY
+      );
+      ASSERT_from_comCmdOut_SIZE(0);
+    }
+
+    void Tester ::
+      Timeout(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 0);
+      this->setTestTime(testTime);
+      // Write the file
+      SequenceFiles::ImmediateFile file(2, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run the sequence; the first command goes out at once
+      this->runSequence(0, fileName);
+      ASSERT_from_comCmdOut_SIZE(1);
+      ASSERT_from_deadlineSetOut_SIZE(1);
+      ASSERT_from_deadlineSetOut(
+          0,
+          CmdSequencerComponentImpl::CMD_TIMEOUT_KEY,
+          Fw::Time(TB_WORKSTATION_TIME, 1 + TIMEOUT, 0)
+      );
+      // The timeout deadline expires
+      this->expire(CmdSequencerComponentImpl::CMD_TIMEOUT_KEY, 1 + TIMEOUT);
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_SequenceTimeout(0, fileName, 0);
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_EQ(CmdSequencerComponentImpl::STOPPED, this->component.m_runMode);
+      // A stale deadline has no effect
+      this->expire(CmdSequencerComponentImpl::CMD_TIMEOUT_KEY, 2 + TIMEOUT);
+      ASSERT_EVENTS_SIZE(0);
+      ASSERT_from_deadlineSetOut_SIZE(0);
+      // So does a deadline for an engine that does not exist
+      this->expire(CmdSequencerComponentImpl::ENGINE_KEY_BASE, 2 + TIMEOUT);
+      ASSERT_EVENTS_SIZE(0);
+      ASSERT_from_deadlineSetOut_SIZE(0);
+    }
+
+    // ----------------------------------------------------------------------
+    // Private helper methods
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      expire(const U32 key, const U32 seconds)
+    {
+      Fw::Time testTime(TB_WORKSTATION_TIME, seconds, 0);
+      this->setTestTime(testTime);
+      this->invoke_to_timeoutIn(0, key);
+      this->clearAndDispatch();
+    }
+
+  }
+
+}
@@ -0,0 +1,65 @@
+// ====================================================================== 
+// \title  Deadlines.hpp
+// \brief  Test timers driven by deadline ports
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef Svc_Deadlines_HPP
+#define Svc_Deadlines_HPP
+
+#include "Svc/CmdSequencer/test/ut/Tester.hpp"
+
+namespace Svc {
+
+  namespace Deadlines {
+
+    //! Test a sequencer whose timers are driven by a timer wheel
+    class Tester :
+      public Svc::Tester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors and destructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object Tester
+        Tester(void);
+
+      public:
+
+        // ---------------------------------------------------------------------- 
+        // Tests
+        // ---------------------------------------------------------------------- 
+
+        //! Run relative commands on deadline expiration
+        void Relative(void);
+
+        //! Time out a command on deadline expiration
+        void Timeout(void);
+
+      private:
+
+        // ---------------------------------------------------------------------- 
+        // Private helper methods
+        // ---------------------------------------------------------------------- 
+
+        //! Expire a deadline at a time
+        void expire(
+            const U32 key, //!< The deadline key
+            const U32 seconds //!< The time in seconds
+        );
+
+    };
+
+  }
+
+}
+
+#endif
@@ -0,0 +1,300 @@
+// ====================================================================== 
+// \title  Engines.cpp
+// \brief  Test background sequence engines
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include "Svc/CmdSequencer/test/ut/CommandBuffers.hpp"
+#include "Svc/CmdSequencer/test/ut/Engines.hpp"
+
+namespace Svc {
+
+  namespace Engines {
+
+    // ----------------------------------------------------------------------
+    // Constants 
+    // ----------------------------------------------------------------------
+
+    //! The engine buffer allocator ID
+    static const NATIVE_INT_TYPE ENGINE_ALLOCATOR_ID = ALLOCATOR_ID + 2;
+
+    // ----------------------------------------------------------------------
+    // Constructors and destructors
+    // ----------------------------------------------------------------------
+
+    Tester ::
+      Tester(void) :
+        Svc::Tester(SequenceFiles::File::Format::F_PRIME),
+        engineSequence0(this->component),
+        engineSequence1(this->component)
+    {
+      this->component.addEngine(this->engineSequence0);
+      this->component.addEngine(this->engineSequence1);
+      this->component.allocateEngineBuffers(
+          ENGINE_ALLOCATOR_ID,
+          this->mallocator,
+          NUM_ENGINES * BUFFER_SIZE
+      );
+    }
+
+    Tester ::
+      ~Tester(void)
+    {
+      this->component.deallocateEngineBuffers(this->mallocator);
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests 
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      Concurrent(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the files
+      SequenceFiles::ImmediateFile file0(3, this->format);
+      SequenceFiles::ImmediateFile file1(2, this->format);
+      SequenceFiles::ImmediateFile mainFile(1, this->format);
+      const char *const fileName0 = file0.getName().toChar();
+      const char *const fileName1 = file1.getName().toChar();
+      const char *const mainFileName = mainFile.getName().toChar();
+      file0.write();
+      file1.write();
+      mainFile.write();
+      // Start both engines
+      this->runOnEngine(0, fileName0);
+      this->runOnEngine(1, fileName1);
+      // Run the main sequence; its command has context 0
+      this->runSequence(0, mainFileName);
+      {
+        Fw::ComBuffer comBuff;
+        CommandBuffers::create(comBuff, 0, 1);
+        ASSERT_from_comCmdOut_SIZE(1);
+        ASSERT_from_comCmdOut(0, comBuff, 0U);
+      }
+      // Interleave the responses
+      this->respond(1, fileName1, 0, 2);
+      this->respond(0, fileName0, 0, 3);
+      // Complete the main sequence
+      this->invoke_to_cmdResponseIn(0, 0, 0, Fw::COMMAND_OK);
+      this->clearAndDispatch();
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+      ASSERT_EVENTS_CS_SequenceComplete(0, mainFileName);
+      ASSERT_EQ(CmdSequencerComponentImpl::STOPPED, this->component.m_runMode);
+      // Engines are still running
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Engine::WAITING_RESPONSE,
+          this->component.m_engines[0].m_state
+      );
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Engine::WAITING_RESPONSE,
+          this->component.m_engines[1].m_state
+      );
+      this->respond(0, fileName0, 1, 3);
+      this->respond(1, fileName1, 1, 2);
+      this->respond(0, fileName0, 2, 3);
+      // Check the totals
+      ASSERT_EQ(6U, this->component.m_totalExecutedCount);
+      ASSERT_EQ(3U, this->component.m_sequencesCompletedCount);
+    }
+
+    void Tester ::
+      Errors(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      SequenceFiles::ImmediateFile file(3, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run on an engine that does not exist
+      this->sendCmd_CS_ENGINE_RUN(0, 0, NUM_ENGINES, fileName);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_ENGINE_RUN,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_EngineInvalid(0, NUM_ENGINES);
+      // Cancel an idle engine
+      this->sendCmd_CS_ENGINE_CANCEL(0, 0, 0);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_ENGINE_CANCEL,
+          0,
+          Fw::COMMAND_OK
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_NoSequenceActive_SIZE(1);
+      // Run on a busy engine
+      this->runOnEngine(0, fileName);
+      this->sendCmd_CS_ENGINE_RUN(0, 0, 0, fileName);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_ENGINE_RUN,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_InvalidMode_SIZE(1);
+      // A response for an idle engine is unexpected
+      this->invoke_to_cmdResponseIn(0, 0, 2, Fw::COMMAND_OK);
+      this->clearAndDispatch();
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_UnexpectedCompletion(0, 0);
+      // Fail the first command
+      this->invoke_to_cmdResponseIn(0, 0, 1, Fw::COMMAND_EXECUTION_ERROR);
+      this->clearAndDispatch();
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_CommandError(
+          0,
+          fileName,
+          0,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      ASSERT_TLM_CS_Errors_SIZE(1);
+      ASSERT_TLM_CS_Engine0State(0, CmdSequencerComponentImpl::Engine::IDLE);
+      // Run again and cancel
+      this->runOnEngine(0, fileName);
+      this->sendCmd_CS_ENGINE_CANCEL(0, 0, 0);
+      this->clearAndDispatch();
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_ENGINE_CANCEL,
+          0,
+          Fw::COMMAND_OK
+      );
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_SequenceCanceled(0, fileName);
+      ASSERT_TLM_CS_CancelCommands(0, 1);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Engine::IDLE,
+          this->component.m_engines[0].m_state
+      );
+    }
+
+    void Tester ::
+      Timeout(void) 
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      SequenceFiles::ImmediateFile file(3, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run the sequence
+      this->runOnEngine(1, fileName);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Timer::SET,
+          this->component.m_engines[1].m_cmdTimeoutTimer.m_state
+      );
+      // Set the test time to be after the timeout
+      testTime.set(TB_WORKSTATION_TIME, 2 * TIMEOUT, 1);
+      this->setTestTime(testTime);
+      // Call the schedule port
+      this->invoke_to_schedIn(0, 0);
+      this->clearAndDispatch();
+      // Assert events
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_SequenceTimeout(0, fileName, 0);
+      // The timeout counts as an error, as it does for the main sequence
+      ASSERT_TLM_CS_Errors_SIZE(1);
+      ASSERT_TLM_CS_Errors(0, 1);
+      // Verify that the engine is idle again
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Engine::IDLE,
+          this->component.m_engines[1].m_state
+      );
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Timer::CLEAR,
+          this->component.m_engines[1].m_cmdTimeoutTimer.m_state
+      );
+      ASSERT_TLM_CS_Engine1State(0, CmdSequencerComponentImpl::Engine::IDLE);
+    }
+
+    // ----------------------------------------------------------------------
+    // Private helper methods
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      runOnEngine(const U32 engine, const char *const fileName)
+    {
+      this->sendCmd_CS_ENGINE_RUN(0, 0, engine, fileName);
+      this->clearAndDispatch();
+      // Assert command response
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_ENGINE_RUN,
+          0,
+          Fw::COMMAND_OK
+      );
+      // Assert events
+      ASSERT_EVENTS_SIZE(2);
+      ASSERT_EVENTS_CS_SequenceLoaded(0, fileName);
+      ASSERT_EVENTS_CS_EngineStarted(0, engine, fileName);
+      // Assert the first command, sent with context engine + 1
+      Fw::ComBuffer comBuff;
+      CommandBuffers::create(comBuff, 0, 1);
+      ASSERT_from_comCmdOut_SIZE(1);
+      ASSERT_from_comCmdOut(0, comBuff, engine + 1);
+      // Assert telemetry
+      ASSERT_TLM_CS_Engine0State_SIZE(engine == 0 ? 1 : 0);
+      ASSERT_TLM_CS_Engine1State_SIZE(engine == 1 ? 1 : 0);
+    }
+
+    void Tester ::
+      respond(
+          const U32 engine,
+          const char *const fileName,
+          const U32 record,
+          const U32 numRecords
+      )
+    {
+      this->invoke_to_cmdResponseIn(0, record, engine + 1, Fw::COMMAND_OK);
+      this->clearAndDispatch();
+      ASSERT_EVENTS_CS_CommandComplete_SIZE(1);
+      ASSERT_EVENTS_CS_CommandComplete(0, fileName, record, record);
+      if (record < numRecords - 1) {
+        // The next command goes out with the same context
+        Fw::ComBuffer comBuff;
+        CommandBuffers::create(comBuff, record + 1, record + 2);
+        ASSERT_from_comCmdOut_SIZE(1);
+        ASSERT_from_comCmdOut(0, comBuff, engine + 1);
+        ASSERT_EVENTS_SIZE(1);
+      }
+      else {
+        ASSERT_from_comCmdOut_SIZE(0);
+        ASSERT_EVENTS_SIZE(2);
+        ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+        ASSERT_EVENTS_CS_SequenceComplete(0, fileName);
+        ASSERT_EQ(
+            CmdSequencerComponentImpl::Engine::IDLE,
+            this->component.m_engines[engine].m_state
+        );
+        ASSERT_EQ(numRecords, this->component.m_engines[engine].m_executedCount);
+      }
+    }
+
+  }
+
+}
@@ -0,0 +1,103 @@
+// ====================================================================== 
+// \title  Engines.hpp
+// \brief  Test background sequence engines
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef Svc_Engines_HPP
+#define Svc_Engines_HPP
+
+#include "Svc/CmdSequencer/test/ut/Tester.hpp"
+
+namespace Svc {
+
+  namespace Engines {
+
+    //! Test sequences that run on background engines
+    class Tester :
+      public Svc::Tester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constants
+        // ----------------------------------------------------------------------
+
+        enum {
+          //! The number of engines under test
+          NUM_ENGINES = 2
+        };
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors and destructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object Tester
+        Tester(void);
+
+        //! Destroy object Tester
+        ~Tester(void);
+
+      public:
+
+        // ---------------------------------------------------------------------- 
+        // Tests
+        // ---------------------------------------------------------------------- 
+
+        //! Run sequences on two engines and the main sequence at once
+        void Concurrent(void);
+
+        //! Send invalid engine commands and a failing command response
+        void Errors(void);
+
+        //! Time out a command sent by an engine
+        void Timeout(void);
+
+      private:
+
+        // ---------------------------------------------------------------------- 
+        // Private helper methods
+        // ---------------------------------------------------------------------- 
+
+        //! Run a sequence on an engine
+        void runOnEngine(
+            const U32 engine, //!< The engine number
+            const char *const fileName //!< The file name
+        );
+
+        //! Send a command response to an engine and check that it
+        //! sends the next command or completes
+        void respond(
+            const U32 engine, //!< The engine number
+            const char *const fileName, //!< The file name
+            const U32 record, //!< The record number of the response
+            const U32 numRecords //!< The number of records in the file
+        );
+
+      private:
+
+        // ---------------------------------------------------------------------- 
+        // Private member variables
+        // ---------------------------------------------------------------------- 
+
+        //! The sequence of engine 0
+        CmdSequencerComponentImpl::FPrimeSequence engineSequence0;
+
+        //! The sequence of engine 1
+        CmdSequencerComponentImpl::FPrimeSequence engineSequence1;
+
+    };
+
+  }
+
+}
+
+#endif
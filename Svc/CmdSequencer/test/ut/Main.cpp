@@ -6,6 +6,9 @@
 
 #include "Os/FileSystem.hpp"
 #include "Svc/CmdSequencer/test/ut/AMPCS.hpp"
+#include "Svc/CmdSequencer/test/ut/Cache.hpp"
+#include "Svc/CmdSequencer/test/ut/Deadlines.hpp"
+#include "Svc/CmdSequencer/test/ut/Engines.hpp"
 #include "Svc/CmdSequencer/test/ut/Health.hpp"
 #include "Svc/CmdSequencer/test/ut/Immediate.hpp"
 #include "Svc/CmdSequencer/test/ut/ImmediateEOS.hpp"
@@ -13,6 +16,7 @@
 #include "Svc/CmdSequencer/test/ut/NoFiles.hpp"
 #include "Svc/CmdSequencer/test/ut/Relative.hpp"
 #include "Svc/CmdSequencer/test/ut/SequenceFiles/SequenceFiles.hpp"
+#include "Svc/CmdSequencer/test/ut/Streaming.hpp"
 #include "Svc/CmdSequencer/test/ut/Tester.hpp"
 #include "Svc/CmdSequencer/test/ut/Mixed.hpp"
 #include "Svc/CmdSequencer/test/ut/UnitTest.hpp"
@@ -376,6 +380,91 @@ TEST(Relative, ValidateAMPCS) {
   Svc::Relative::Tester tester(Svc::SequenceFiles::File::Format::AMPCS);
   tester.Validate();
 }
+
+TEST(Streaming, AutoByCommand) {
+  Svc::Streaming::Tester tester;
+  tester.AutoByCommand();
+}
+
+TEST(Streaming, Cancel) {
+  Svc::Streaming::Tester tester;
+  tester.Cancel();
+}
+
+TEST(Streaming, FileErrors) {
+  Svc::Streaming::Tester tester;
+  tester.FileErrors();
+}
+
+TEST(Streaming, Validate) {
+  Svc::Streaming::Tester tester;
+  tester.Validate();
+}
+
+TEST(Streaming, RunReadError) {
+  Svc::Streaming::Tester tester;
+  tester.RunReadError();
+}
+
+TEST(Streaming, FileChanged) {
+  Svc::Streaming::Tester tester;
+  tester.FileChanged();
+}
+
+TEST(Cache, Hit) {
+  Svc::Cache::Tester tester;
+  tester.Hit();
+}
+
+TEST(Cache, Changed) {
+  Svc::Cache::Tester tester;
+  tester.Changed();
+}
+
+TEST(Cache, ChangedSameSizeAndTime) {
+  Svc::Cache::Tester tester;
+  tester.ChangedSameSizeAndTime();
+}
+
+TEST(Cache, ChangedSameSizeAndTimeAMPCS) {
+  Svc::Cache::Tester tester(Svc::SequenceFiles::File::Format::AMPCS);
+  tester.ChangedSameSizeAndTime();
+}
+
+TEST(Cache, Evict) {
+  Svc::Cache::Tester tester;
+  tester.Evict();
+}
+
+TEST(Cache, SideFileChangedAMPCS) {
+  Svc::Cache::Tester tester(Svc::SequenceFiles::File::Format::AMPCS);
+  tester.SideFileChanged();
+}
+
+TEST(Engines, Concurrent) {
+  Svc::Engines::Tester tester;
+  tester.Concurrent();
+}
+
+TEST(Engines, Errors) {
+  Svc::Engines::Tester tester;
+  tester.Errors();
+}
+
+TEST(Engines, Timeout) {
+  Svc::Engines::Tester tester;
+  tester.Timeout();
+}
+
+TEST(Deadlines, Relative) {
+  Svc::Deadlines::Tester tester;
+  tester.Relative();
+}
+
+TEST(Deadlines, Timeout) {
+  Svc::Deadlines::Tester tester;
+  tester.Timeout();
+}
 #endif
 
 int main(int argc, char **argv) {
@@ -0,0 +1,238 @@
+// ====================================================================== 
+// \title  Streaming.cpp
+// \brief  Test the streaming F Prime sequence format
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <sys/time.h>
+
+#include "Os/File.hpp"
+#include "Os/FileSystem.hpp"
+#include "Svc/CmdSequencer/test/ut/Streaming.hpp"
+
+namespace Svc {
+
+  namespace Streaming {
+
+    // ----------------------------------------------------------------------
+    // Constants 
+    // ----------------------------------------------------------------------
+
+    //! Enough records that the file is several times the buffer size
+    static const U32 NUM_RECORDS = 20;
+
+    // ----------------------------------------------------------------------
+    // Constructors 
+    // ----------------------------------------------------------------------
+
+    Tester ::
+      Tester(void) :
+        ImmediateBase::Tester(SequenceFiles::File::Format::F_PRIME)
+    {
+      // Replace the default sequence with a streaming sequence
+      // that has the smallest allowed buffer
+      this->component.deallocateBuffer(this->mallocator);
+      this->component.setSequenceFormat(
+          this->sequences.fPrimeStreamingSequence
+      );
+      this->component.allocateBuffer(
+          ALLOCATOR_ID,
+          this->mallocator,
+          FPrimeStreamingSequence::MIN_BUFFER_SIZE
+      );
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests 
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      AutoByCommand(void) 
+    {
+      const U32 numCommands = NUM_RECORDS;
+      const U32 bound = numCommands;
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      this->parameterizedAutoByCommand(file, numCommands, bound);
+    }
+
+    void Tester ::
+      Cancel(void) 
+    {
+      const U32 numCommands = NUM_RECORDS;
+      const U32 bound = NUM_RECORDS / 2;
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      this->parameterizedCancel(file, numCommands, bound);
+    }
+
+    void Tester ::
+      FileErrors(void) 
+    {
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      this->parameterizedFileErrors(file);
+    }
+
+    void Tester ::
+      Validate(void)
+    {
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      this->parameterizedValidate(file);
+    }
+
+    void Tester ::
+      RunReadError(void)
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write and validate the file
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      this->validateFile(0, fileName);
+      // Run the sequence and execute the first command
+      this->runSequence(0, fileName);
+      this->executeCommandsAuto(
+          fileName,
+          NUM_RECORDS,
+          1,
+          CmdExecMode::NO_NEW_SEQUENCE
+      );
+      // Fail the read of the next window
+      this->readInterceptor.enable();
+      this->readInterceptor.waitCount = 0;
+      this->readInterceptor.fileStatus = Os::File::NO_SPACE;
+      this->readInterceptor.errorType = Interceptors::Read::ErrorType::READ;
+      Os::setLastError(Os::File::NO_SPACE);
+      this->invoke_to_cmdResponseIn(0, 1, 0, Fw::COMMAND_OK);
+      this->clearAndDispatch();
+      this->readInterceptor.disable();
+      // Assert events
+      ASSERT_EVENTS_SIZE(2);
+      ASSERT_EVENTS_CS_CommandComplete(0, fileName, 1, 1);
+      ASSERT_EVENTS_CS_FileInvalid_SIZE(1);
+      ASSERT_EVENTS_CS_FileInvalid(
+          0,
+          fileName,
+          CmdSequencerComponentImpl::SEQ_READ_SEQ_DATA,
+          Os::File::NO_SPACE
+      );
+      // Assert telemetry
+      ASSERT_TLM_CS_Errors_SIZE(1);
+      ASSERT_TLM_CS_Errors(0, 1);
+      // The sequence is stopped
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_EXECUTION_ERROR);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::STOPPED,
+          this->component.m_runMode
+      );
+      ASSERT_FALSE(this->component.m_sequence->hasMoreRecords());
+    }
+
+    void Tester ::
+      FileChanged(void)
+    {
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      SequenceFiles::ImmediateFile file(NUM_RECORDS, this->format);
+      const char *const fileName = file.getName().toChar();
+      // Append a byte to the file after the sequence starts
+      {
+        file.write();
+        this->validateFile(0, fileName);
+        this->runSequence(0, fileName);
+        U64 fileSize = 0;
+        ASSERT_EQ(
+            Os::FileSystem::OP_OK,
+            Os::FileSystem::getFileSize(fileName, fileSize)
+        );
+        Os::File osFile;
+        ASSERT_EQ(
+            Os::File::OP_OK,
+            osFile.open(fileName, Os::File::OPEN_WRITE)
+        );
+        ASSERT_EQ(
+            Os::File::OP_OK,
+            osFile.seek(static_cast<NATIVE_INT_TYPE>(fileSize))
+        );
+        U8 byte = 0;
+        NATIVE_INT_TYPE size = sizeof(byte);
+        ASSERT_EQ(Os::File::OP_OK, osFile.write(&byte, size));
+        osFile.close();
+        // The next read finds the change
+        this->invoke_to_cmdResponseIn(0, 0, 0, Fw::COMMAND_OK);
+        this->clearAndDispatch();
+        ASSERT_EVENTS_SIZE(2);
+        ASSERT_EVENTS_CS_CommandComplete(0, fileName, 0, 0);
+        ASSERT_EVENTS_CS_FileReadError_SIZE(1);
+        ASSERT_EVENTS_CS_FileReadError(0, fileName);
+        ASSERT_from_seqDone_SIZE(1);
+        ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_EXECUTION_ERROR);
+        ASSERT_EQ(
+            CmdSequencerComponentImpl::STOPPED,
+            this->component.m_runMode
+        );
+      }
+      // Change a byte of the last record after the sequence starts,
+      // keeping the file size and modification time
+      {
+        file.write();
+        this->validateFile(0, fileName);
+        this->runSequence(0, fileName);
+        U64 fileSize = 0;
+        ASSERT_EQ(
+            Os::FileSystem::OP_OK,
+            Os::FileSystem::getFileSize(fileName, fileSize)
+        );
+        U32 modSeconds = 0;
+        U32 modUSeconds = 0;
+        ASSERT_EQ(
+            Os::FileSystem::OP_OK,
+            Os::FileSystem::getFileModTime(fileName, modSeconds, modUSeconds)
+        );
+        Os::File osFile;
+        ASSERT_EQ(
+            Os::File::OP_OK,
+            osFile.open(fileName, Os::File::OPEN_WRITE)
+        );
+        const U64 offset = fileSize - sizeof(U32) - 1;
+        ASSERT_EQ(
+            Os::File::OP_OK,
+            osFile.seek(static_cast<NATIVE_INT_TYPE>(offset))
+        );
+        U8 byte = 0xFF;
+        NATIVE_INT_TYPE size = sizeof(byte);
+        ASSERT_EQ(Os::File::OP_OK, osFile.write(&byte, size));
+        osFile.close();
+        struct timeval times[2];
+        times[0].tv_sec = modSeconds;
+        times[0].tv_usec = modUSeconds;
+        times[1] = times[0];
+        ASSERT_EQ(0, utimes(fileName, times));
+        // Run commands until the last of the data is read
+        U32 i = 0;
+        while (this->component.m_runMode == CmdSequencerComponentImpl::RUNNING) {
+          ASSERT_LT(i, NUM_RECORDS);
+          this->invoke_to_cmdResponseIn(0, i, 0, Fw::COMMAND_OK);
+          this->clearAndDispatch();
+          ++i;
+        }
+        // The CRC check fails before the changed record runs
+        ASSERT_LT(i, NUM_RECORDS);
+        ASSERT_EVENTS_SIZE(2);
+        ASSERT_EVENTS_CS_CommandComplete(0, fileName, i - 1, i - 1);
+        ASSERT_EVENTS_CS_FileCrcFailure_SIZE(1);
+        ASSERT_from_seqDone_SIZE(1);
+        ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_EXECUTION_ERROR);
+      }
+    }
+
+  }
+
+}
@@ -0,0 +1,65 @@
+// ====================================================================== 
+// \title  Streaming.hpp
+// \brief  Test the streaming F Prime sequence format
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef Svc_Streaming_HPP
+#define Svc_Streaming_HPP
+
+#include "Svc/CmdSequencer/test/ut/ImmediateBase.hpp"
+
+namespace Svc {
+
+  namespace Streaming {
+
+    //! Test sequences that are larger than the sequence buffer
+    class Tester :
+      public ImmediateBase::Tester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object Tester
+        Tester(void);
+
+      public:
+
+        // ---------------------------------------------------------------------- 
+        // Tests
+        // ---------------------------------------------------------------------- 
+
+        //! Run an automatic sequence by command
+        void AutoByCommand(void);
+
+        //! Start and cancel a sequence
+        void Cancel(void);
+
+        //! Inject file errors
+        void FileErrors(void);
+
+        //! Validate a sequence file
+        void Validate(void);
+
+        //! Inject a read error while a sequence runs
+        void RunReadError(void);
+
+        //! Change a sequence file while it runs
+        void FileChanged(void);
+
+    };
+
+  }
+
+}
+
+#endif
@@ -88,6 +88,25 @@ namespace Svc {
     this->pushFromPortEntry_pingOut(key);
   }
 
+  void Tester ::
+    from_deadlineSetOut_handler(
+      const NATIVE_INT_TYPE portNum,
+      U32 key,
+      Fw::Time &deadline
+    )
+  {
+    this->pushFromPortEntry_deadlineSetOut(key, deadline);
+  }
+
+  void Tester ::
+    from_deadlineCancelOut_handler(
+      const NATIVE_INT_TYPE portNum,
+      U32 key
+    )
+  {
+    this->pushFromPortEntry_deadlineCancelOut(key);
+  }
+
   // ----------------------------------------------------------------------
   // Virtual function interface 
   // ----------------------------------------------------------------------
@@ -438,6 +457,9 @@ namespace Svc {
     // Assert events
     ASSERT_EVENTS_SIZE(1);
     ASSERT_EVENTS_CS_SequenceTimeout(0, fileName, 0);
+    // Assert telemetry
+    ASSERT_TLM_CS_Errors_SIZE(1);
+    ASSERT_TLM_CS_Errors(0, 1);
     // Verify that the sequencer is idle again
     ASSERT_EQ(
         CmdSequencerComponentImpl::STOPPED,
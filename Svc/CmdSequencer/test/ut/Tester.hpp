@@ -18,6 +18,7 @@
 #include "Os/File.hpp"
 #include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
 #include "Svc/CmdSequencer/formats/AMPCSSequence.hpp"
+#include "Svc/CmdSequencer/formats/FPrimeStreamingSequence.hpp"
 #include "Svc/CmdSequencer/test/ut/SequenceFiles/SequenceFiles.hpp"
 #include "Svc/CmdSequencer/test/ut/UnitTest.hpp"
 
@@ -67,7 +68,8 @@ namespace Svc {
         Sequences(
             CmdSequencerComponentImpl& component //!< The component under test
         ) :
-          ampcsSequence(component)
+          ampcsSequence(component),
+          fPrimeStreamingSequence(component)
         {
 
         }
@@ -75,6 +77,9 @@ namespace Svc {
         //! The AMPCS sequence
         AMPCSSequence ampcsSequence;
 
+        //! The streaming F Prime sequence
+        FPrimeStreamingSequence fPrimeStreamingSequence;
+
       };
 
       struct Interceptors {
@@ -279,6 +284,21 @@ namespace Svc {
           U32 key //!< Value to return to pinger
       );
 
+      //! Handler for from_deadlineSetOut
+      //!
+      void from_deadlineSetOut_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          U32 key, //!< The key
+          Fw::Time &deadline //!< The time of the deadline
+      );
+
+      //! Handler for from_deadlineCancelOut
+      //!
+      void from_deadlineCancelOut_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          U32 key //!< The key
+      );
+
 #if VERBOSE
     protected:
 
@@ -4,7 +4,10 @@
 
 TEST_SRC= \
   AMPCS.cpp \
+  Cache.cpp \
   CommandBuffers.cpp \
+  Deadlines.cpp \
+  Engines.cpp \
   Handcode/GTestBase.cpp \
   Health.cpp \
   ImmediateBase.cpp \
@@ -41,6 +44,7 @@ TEST_SRC= \
   SequenceFiles/SizeFieldTooSmallFile.cpp \
   SequenceFiles/TooLargeFile.cpp \
   SequenceFiles/USecFieldTooShortFile.cpp \
+  Streaming.cpp \
   Handcode/TesterBase.cpp \
   Tester.cpp
 
@@ -49,6 +53,7 @@ TEST_MODS= \
   Svc/Sched \
   Svc/Ping \
   Svc/Seq \
+  Svc/Deadline \
   Fw/Cmd \
   Fw/Comp \
   Fw/Port \
@@ -8,6 +8,8 @@
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Types/SerialBuffer.hpp>
 #include <Os/ValidateFile.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <Fw/Types/EightyCharString.hpp>
 #include <iostream>
 #include <stdio.h>
 
@@ -21,18 +23,39 @@ namespace Svc {
 
   ComLogger ::
 #if FW_OBJECT_NAMES == 1
-    ComLogger(const char* compName, const char* incomingFilePrefix, U32 maxFileSize, bool storeBufferLength) :
+    ComLogger(const char* compName, const char* incomingFilePrefix, U32 maxFileSize, bool storeBufferLength, bool directWrite) :
     ComLoggerComponentBase(compName), 
 #else
-    ComLogger(const char* incomingFilePrefix, U32 maxFileSize, bool storeBufferLength) :
+    ComLogger(const char* incomingFilePrefix, U32 maxFileSize, bool storeBufferLength, bool directWrite) :
 #endif
     maxFileSize(maxFileSize),
     fileMode(CLOSED), 
     byteCount(0),
     writeErrorOccured(false),
     openErrorOccured(false),
-    storeBufferLength(storeBufferLength)
+    storeBufferLength(storeBufferLength),
+    directWrite(directWrite),
+    compress(false),
+    activeBlock(0),
+    blockSize(0),
+    flushCycles(0),
+    cyclesSinceFlush(0),
+    writerStarted(false),
+    allocator(NULL),
+    allocatorId(0),
+    fileWrites(0),
+    periodWrites(0),
+    periodBytes(0),
+    maxLatency(0)
   {
+    for( NATIVE_UINT_TYPE i = 0; i < NUM_BLOCKS; i++ ) {
+      this->blocks[i].data = NULL;
+      this->blocks[i].used = 0;
+      this->blocks[i].frame = NULL;
+      this->blocks[i].frameSize = 0;
+      this->blocks[i].busy = false;
+    }
+
     if( this->storeBufferLength ) {
       FW_ASSERT(maxFileSize > sizeof(U16), maxFileSize); // must be a positive integer greater than buffer length size
     }
@@ -66,9 +89,11 @@ namespace Svc {
     // in the destructor. This can cause "virtual method called" segmentation 
     // faults.
     // So I am copying part of that function here.
+    // Buffered data is written out first, without events:
+    this->shutdownWriter(false);
     if( OPEN == this->fileMode ) {
       // Close file:
-      this->file.close();
+      (void) this->closeLogFile();
 
       // Write out the hash file to disk:
       this->writeHashFile();
@@ -82,6 +107,60 @@ namespace Svc {
     }
   }
 
+  void ComLogger ::
+    startWriter(
+      NATIVE_INT_TYPE identifier,
+      NATIVE_INT_TYPE priority,
+      NATIVE_INT_TYPE stackSize,
+      Fw::MemAllocator& allocator,
+      NATIVE_UINT_TYPE blockSize,
+      U32 flushCycles,
+      bool compress
+    )
+  {
+    FW_ASSERT(!this->writerStarted);
+    FW_ASSERT(CLOSED == this->fileMode);
+    FW_ASSERT(blockSize >= FW_COM_BUFFER_MAX_SIZE + sizeof(U16), blockSize);
+
+    // One allocation holds all the blocks, followed by their compressed frames:
+    const NATIVE_UINT_TYPE frameCapacity = compress ? Utils::LzEncoder::bound(blockSize) : 0;
+    U8* data = static_cast<U8*>(allocator.allocate(identifier, NUM_BLOCKS * (blockSize + frameCapacity)));
+    FW_ASSERT(data != NULL);
+    for( NATIVE_UINT_TYPE i = 0; i < NUM_BLOCKS; i++ ) {
+      this->blocks[i].data = &data[i * blockSize];
+      this->blocks[i].used = 0;
+      this->blocks[i].frame = compress ? &data[NUM_BLOCKS * blockSize + i * frameCapacity] : NULL;
+      this->blocks[i].frameSize = 0;
+      this->blocks[i].busy = false;
+    }
+    this->compress = compress;
+    this->allocator = &allocator;
+    this->allocatorId = identifier;
+    this->activeBlock = 0;
+    this->blockSize = blockSize;
+    this->flushCycles = flushCycles;
+    this->cyclesSinceFlush = 0;
+
+    char name[40];
+    (void) snprintf(name, sizeof(name), "CLWQ_%d", identifier);
+    Os::Queue::QueueStatus qStat = this->writeQueue.create(Fw::EightyCharString(name), NUM_BLOCKS + 1, sizeof(NATIVE_UINT_TYPE));
+    FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+    (void) snprintf(name, sizeof(name), "CLRQ_%d", identifier);
+    qStat = this->resultQueue.create(Fw::EightyCharString(name), NUM_BLOCKS, sizeof(WriteResult));
+    FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+
+    (void) snprintf(name, sizeof(name), "CLWR_%d", identifier);
+    Os::Task::TaskStatus tStat = this->writerTask.start(Fw::EightyCharString(name), identifier, priority, stackSize, ComLogger::writerTaskEntry, this);
+    FW_ASSERT(Os::Task::TASK_OK == tStat, tStat);
+    this->writerStarted = true;
+  }
+
+  void ComLogger ::
+    stopWriter(void)
+  {
+    this->shutdownWriter(true);
+  }
+
   // ----------------------------------------------------------------------
   // Handler implementations
   // ----------------------------------------------------------------------
@@ -104,9 +183,13 @@ namespace Svc {
 
     // Close the file if it will be too big:
     if( OPEN == this->fileMode ) {
-      U32 projectedByteCount = this->byteCount + size;
+      U32 length = size;
       if( this->storeBufferLength ) {
-        projectedByteCount += sizeof(size);
+        length += sizeof(size);
+      }
+      U32 projectedByteCount = this->byteCount + length;
+      if( this->compress ) {
+        projectedByteCount = this->byteCount + this->projectedCompressedSize(length);
       }
       if( projectedByteCount > this->maxFileSize ) {
         this->closeFile();
@@ -144,6 +227,32 @@ namespace Svc {
       this->pingOut_out(0,key);
   }
 
+  void ComLogger ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    if( this->writerStarted ) {
+      // Collect the blocks the writer task has finished:
+      this->reapResults();
+
+      // Write a partly filled block that has waited long enough:
+      ++this->cyclesSinceFlush;
+      const Block& block = this->blocks[this->activeBlock];
+      if( this->cyclesSinceFlush >= this->flushCycles && block.used > 0 && !block.busy ) {
+        this->submitBlock();
+      }
+    }
+
+    this->tlmWrite_FileWrites(this->fileWrites);
+    this->tlmWrite_BytesPerWrite( (this->periodWrites > 0) ? (U32) (this->periodBytes / this->periodWrites) : 0 );
+    this->tlmWrite_FlushLatency(this->maxLatency);
+    this->periodWrites = 0;
+    this->periodBytes = 0;
+    this->maxLatency = 0;
+  }
+
   void ComLogger ::
     openFile(
     )
@@ -155,19 +264,26 @@ namespace Svc {
     // Create filename:
     Fw::Time timestamp = getTime();
     memset(this->fileName, 0, sizeof(this->fileName));
-    bytesCopied = snprintf((char*) this->fileName, sizeof(this->fileName), "%s_%d_%d_%06d.com", 
-      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds());
+    const char* extension = this->compress ? ".com.lz" : ".com";
+    bytesCopied = snprintf((char*) this->fileName, sizeof(this->fileName), "%s_%d_%d_%06d%s", 
+      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds(), extension);
 
     // "A return value of size or more means that the output was truncated"
     // See here: http://linux.die.net/man/3/snprintf
     FW_ASSERT( bytesCopied < sizeof(this->fileName) );
 
     // Create sha filename:
-    bytesCopied = snprintf((char*) this->hashFileName, sizeof(this->hashFileName), "%s_%d_%d_%06d.com%s", 
-      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds(), Utils::Hash::getFileExtensionString());
+    bytesCopied = snprintf((char*) this->hashFileName, sizeof(this->hashFileName), "%s_%d_%d_%06d%s%s", 
+      this->filePrefix, (U32) timestamp.getTimeBase(), timestamp.getSeconds(), timestamp.getUSeconds(), extension, Utils::Hash::getFileExtensionString());
     FW_ASSERT( bytesCopied < sizeof(this->hashFileName) );
 
-    Os::File::Status ret = file.open((char*) this->fileName, Os::File::OPEN_WRITE);
+    Os::File::Status ret;
+    if( this->directWrite ) {
+      ret = this->directFile.open((char*) this->fileName, this->maxFileSize);
+    }
+    else {
+      ret = file.open((char*) this->fileName, Os::File::OPEN_WRITE);
+    }
     if( Os::File::OP_OK != ret ) {
       if( !openErrorOccured ) { // throttle this event, otherwise a positive 
                                 // feedback event loop can occur!
@@ -182,6 +298,9 @@ namespace Svc {
       // Reset byte count:
       this->byteCount = 0;
 
+      // Start the hash of the file contents:
+      this->hash.init();
+
       // Set mode:
       this->fileMode = OPEN; 
     }    
@@ -192,8 +311,17 @@ namespace Svc {
     )
   {
     if( OPEN == this->fileMode ) {
-      // Close file:
-      this->file.close();
+      // Write out the buffered data:
+      if( this->writerStarted ) {
+        this->flushBlocks();
+      }
+
+      // Close file. A direct write file writes its last block here:
+      Os::File::Status ret = this->closeLogFile();
+      if( Os::File::OP_OK != ret ) {
+        Fw::LogStringArg logStringArg((char*) this->fileName);
+        this->log_WARNING_HI_FileWriteError(ret, 0, 0, logStringArg);
+      }
 
       // Write out the hash file to disk:
       this->writeHashFile();
@@ -213,32 +341,94 @@ namespace Svc {
       U16 size
     )
   {
+    // Write the length and the buffer with one call:
+    U8 buffer[sizeof(size)];
+    Os::File::IoVector vectors[2];
+    NATIVE_INT_TYPE count = 0;
     if( this->storeBufferLength ) {
-      U8 buffer[sizeof(size)];
       Fw::SerialBuffer serialLength(&buffer[0], sizeof(size)); 
       serialLength.serialize(size);
-      if(writeToFile(serialLength.getBuffAddr(), serialLength.getBuffLength())) {
-        this->byteCount += serialLength.getBuffLength();
-      }
-      else {
-        return;
+      vectors[count].buffer = serialLength.getBuffAddr();
+      vectors[count].size = serialLength.getBuffLength();
+      ++count;
+    }
+    vectors[count].buffer = data.getBuffAddr();
+    vectors[count].size = size;
+    ++count;
+
+    // Hash the data as it is handed to the file, so closing the file does
+    // not read it back. A failed write then shows up as a validation failure.
+    // Compressed blocks are hashed and counted when they are compressed:
+    if( !this->compress ) {
+      for( NATIVE_INT_TYPE i = 0; i < count; i++ ) {
+        this->hash.update(vectors[i].buffer, vectors[i].size);
       }
     }
 
-    // Write buffer to file:
-    if(writeToFile(data.getBuffAddr(), size)) {
-      this->byteCount += size;
+    U32 length = 0;
+    if( this->writerStarted ) {
+      this->appendToBlock(vectors, count, length);
+      if( !this->compress ) {
+        this->byteCount += length;
+      }
+    }
+    else {
+      // Compressed files are only written through the writer task:
+      FW_ASSERT(!this->compress);
+      if(writeToFile(vectors, count, length)) {
+        this->byteCount += length;
+      }
     }
   }
 
   bool ComLogger ::
     writeToFile(
-      void* data, 
-      U16 length
+      const Os::File::IoVector* vectors,
+      NATIVE_INT_TYPE count,
+      U32& length
+    )
+  {
+    length = 0;
+    for( NATIVE_INT_TYPE i = 0; i < count; i++ ) {
+      length += vectors[i].size;
+    }
+    NATIVE_INT_TYPE size = 0;
+    Os::IntervalTimer timer;
+    timer.start();
+    Os::File::Status ret = this->writeVectors(vectors, count, size);
+    timer.stop();
+    return this->checkWrite(ret, size, length, timer.getDiffUsec());
+  }
+
+  Os::File::Status ComLogger ::
+    writeVectors(
+      const Os::File::IoVector* vectors,
+      NATIVE_INT_TYPE count,
+      NATIVE_INT_TYPE& size
     )
   {
-    NATIVE_INT_TYPE size = length;
-    Os::File::Status ret = file.write(data, size);
+    if( this->directWrite ) {
+      return this->directFile.writev(vectors, count, size);
+    }
+    return this->file.writev(vectors, count, size);
+  }
+
+  bool ComLogger ::
+    checkWrite(
+      Os::File::Status ret,
+      NATIVE_INT_TYPE size,
+      U32 length,
+      U32 latency
+    )
+  {
+    // Update the statistics:
+    ++this->fileWrites;
+    ++this->periodWrites;
+    this->periodBytes += length;
+    if( latency > this->maxLatency ) {
+      this->maxLatency = latency;
+    }
+
     if( Os::File::OP_OK != ret || size != (NATIVE_INT_TYPE) length ) {
       if( !writeErrorOccured ) { // throttle this event, otherwise a positive 
                                  // feedback event loop can occur!
@@ -253,12 +443,246 @@ namespace Svc {
     return true;
   }
 
+  void ComLogger ::
+    appendToBlock(
+      const Os::File::IoVector* vectors,
+      NATIVE_INT_TYPE count,
+      U32& length
+    )
+  {
+    length = 0;
+    for( NATIVE_INT_TYPE i = 0; i < count; i++ ) {
+      length += vectors[i].size;
+    }
+    FW_ASSERT(length <= this->blockSize, length, this->blockSize);
+
+    // Start on the other block if this one is full. Either block may
+    // still be with the writer task:
+    this->waitForBlock(this->activeBlock);
+    if( this->blocks[this->activeBlock].used + length > this->blockSize ) {
+      this->submitBlock();
+      this->waitForBlock(this->activeBlock);
+    }
+
+    Block& block = this->blocks[this->activeBlock];
+    for( NATIVE_INT_TYPE i = 0; i < count; i++ ) {
+      memcpy(&block.data[block.used], vectors[i].buffer, vectors[i].size);
+      block.used += vectors[i].size;
+    }
+  }
+
+  void ComLogger ::
+    submitBlock(
+    )
+  {
+    Block& block = this->blocks[this->activeBlock];
+    if( 0 == block.used ) {
+      return;
+    }
+    FW_ASSERT(!block.busy, this->activeBlock);
+
+    if( this->compress ) {
+      this->compressBlock(block);
+    }
+
+    block.busy = true;
+    Os::Queue::QueueStatus qStat = this->writeQueue.send(
+      reinterpret_cast<const U8*>(&this->activeBlock), sizeof(this->activeBlock), 0, Os::Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+
+    this->activeBlock = (this->activeBlock + 1) % NUM_BLOCKS;
+    this->cyclesSinceFlush = 0;
+  }
+
+  void ComLogger ::
+    compressBlock(
+      Block& block
+    )
+  {
+    block.frameSize = this->encoder.encode(block.data, block.used, block.frame);
+    this->hash.update(block.frame, block.frameSize);
+    this->byteCount += block.frameSize;
+  }
+
+  U32 ComLogger ::
+    projectedCompressedSize(
+      U32 length
+    )
+  {
+    // The staged block and the next buffer may not compress at all, and the
+    // buffer may start a new block. A busy block has already been counted:
+    const Block& block = this->blocks[this->activeBlock];
+    const NATIVE_UINT_TYPE staged = block.busy ? 0 : block.used;
+    return Utils::LzEncoder::bound(staged) + Utils::LzEncoder::bound(length);
+  }
+
+  void ComLogger ::
+    waitForBlock(
+      NATIVE_UINT_TYPE index
+    )
+  {
+    while( this->blocks[index].busy ) {
+      WriteResult result;
+      NATIVE_INT_TYPE size = 0;
+      NATIVE_INT_TYPE priority = 0;
+      Os::Queue::QueueStatus qStat = this->resultQueue.receive(
+        reinterpret_cast<U8*>(&result), sizeof(result), size, priority, Os::Queue::QUEUE_BLOCKING);
+      FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+      FW_ASSERT(sizeof(result) == size, size);
+      this->handleResult(result, true);
+    }
+  }
+
+  void ComLogger ::
+    flushBlocks(
+    )
+  {
+    this->submitBlock();
+    for( NATIVE_UINT_TYPE i = 0; i < NUM_BLOCKS; i++ ) {
+      this->waitForBlock(i);
+    }
+  }
+
+  void ComLogger ::
+    reapResults(
+    )
+  {
+    while( true ) {
+      WriteResult result;
+      NATIVE_INT_TYPE size = 0;
+      NATIVE_INT_TYPE priority = 0;
+      Os::Queue::QueueStatus qStat = this->resultQueue.receive(
+        reinterpret_cast<U8*>(&result), sizeof(result), size, priority, Os::Queue::QUEUE_NONBLOCKING);
+      if( Os::Queue::QUEUE_NO_MORE_MSGS == qStat ) {
+        break;
+      }
+      FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+      FW_ASSERT(sizeof(result) == size, size);
+      this->handleResult(result, true);
+    }
+  }
+
+  void ComLogger ::
+    handleResult(
+      const WriteResult& result,
+      bool report
+    )
+  {
+    FW_ASSERT(result.block < NUM_BLOCKS, result.block);
+    Block& block = this->blocks[result.block];
+    FW_ASSERT(block.busy, result.block);
+    block.busy = false;
+    block.used = 0;
+
+    if( report ) {
+      (void) this->checkWrite(result.status, result.written, result.size, result.latency);
+    }
+  }
+
+  void ComLogger ::
+    shutdownWriter(
+      bool report
+    )
+  {
+    if( !this->writerStarted ) {
+      return;
+    }
+
+    // Write out the active block, then stop the task:
+    this->submitBlock();
+    const NATIVE_UINT_TYPE stop = NUM_BLOCKS;
+    Os::Queue::QueueStatus qStat = this->writeQueue.send(
+      reinterpret_cast<const U8*>(&stop), sizeof(stop), 0, Os::Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+    Os::Task::TaskStatus tStat = this->writerTask.join(NULL);
+    FW_ASSERT(Os::Task::TASK_OK == tStat, tStat);
+
+    for( NATIVE_UINT_TYPE i = 0; i < NUM_BLOCKS; i++ ) {
+      if( this->blocks[i].busy ) {
+        WriteResult result;
+        NATIVE_INT_TYPE size = 0;
+        NATIVE_INT_TYPE priority = 0;
+        qStat = this->resultQueue.receive(
+          reinterpret_cast<U8*>(&result), sizeof(result), size, priority, Os::Queue::QUEUE_NONBLOCKING);
+        FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+        this->handleResult(result, report);
+      }
+    }
+
+    this->allocator->deallocate(this->allocatorId, this->blocks[0].data);
+    for( NATIVE_UINT_TYPE i = 0; i < NUM_BLOCKS; i++ ) {
+      this->blocks[i].data = NULL;
+      this->blocks[i].frame = NULL;
+    }
+    this->writerStarted = false;
+  }
+
+  void ComLogger ::
+    writerTaskEntry(
+      void* ptr
+    )
+  {
+    FW_ASSERT(ptr != NULL);
+    static_cast<ComLogger*>(ptr)->runWriter();
+  }
+
+  void ComLogger ::
+    runWriter(
+    )
+  {
+    while( true ) {
+      NATIVE_UINT_TYPE index = 0;
+      NATIVE_INT_TYPE size = 0;
+      NATIVE_INT_TYPE priority = 0;
+      Os::Queue::QueueStatus qStat = this->writeQueue.receive(
+        reinterpret_cast<U8*>(&index), sizeof(index), size, priority, Os::Queue::QUEUE_BLOCKING);
+      FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+      if( NUM_BLOCKS == index ) {
+        break;
+      }
+      FW_ASSERT(index < NUM_BLOCKS, index);
+
+      // The block is not touched by the component thread until the result is returned:
+      Block& block = this->blocks[index];
+      Os::File::IoVector vector;
+      vector.buffer = this->compress ? block.frame : block.data;
+      vector.size = this->compress ? block.frameSize : block.used;
+
+      WriteResult result;
+      result.block = index;
+      result.size = vector.size;
+      result.written = 0;
+      Os::IntervalTimer timer;
+      timer.start();
+      result.status = this->writeVectors(&vector, 1, result.written);
+      timer.stop();
+      result.latency = timer.getDiffUsec();
+
+      qStat = this->resultQueue.send(
+        reinterpret_cast<const U8*>(&result), sizeof(result), 0, Os::Queue::QUEUE_BLOCKING);
+      FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+    }
+  }
+
+  Os::File::Status ComLogger ::
+    closeLogFile(
+    )
+  {
+    if( this->directWrite ) {
+      return this->directFile.close();
+    }
+    this->file.close();
+    return Os::File::OP_OK;
+  }
+
   void ComLogger :: 
     writeHashFile(
     )
   {
+    Utils::HashBuffer hashBuffer;
+    this->hash.final(hashBuffer);
     Os::ValidateFile::Status validateStatus;
-    validateStatus = Os::ValidateFile::createValidation((char*) this->fileName, (char*)this->hashFileName);
+    validateStatus = Os::ValidateFile::writeValidation((char*)this->hashFileName, hashBuffer);
     if( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
       Fw::LogStringArg logStringArg1((char*) this->fileName);
       Fw::LogStringArg logStringArg2((char*) this->hashFileName);
@@ -9,9 +9,14 @@
 
 #include "Svc/ComLogger/ComLoggerComponentAc.hpp"
 #include <Os/File.hpp>
+#include <Os/DirectWriter.hpp>
 #include <Os/Mutex.hpp>
+#include <Os/Queue.hpp>
+#include <Os/Task.hpp>
+#include <Fw/Types/MemAllocator.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Utils/Hash/Hash.hpp>
+#include <Utils/Lz/LzEncoder.hpp>
 
 #include <limits.h>
 #include <stdio.h>
@@ -36,10 +41,13 @@ namespace Svc {
       //                    where you can ensure that all buffers given to the ComLogger are the same size
       //                    in which case you do not need the overhead. Or you store an id which you can
       //                    match to an expected size on the ground during post processing.
+      // directWrite: if true, write files through an Os::DirectWriter, which bypasses the page cache
+      //              and preallocates maxFileSize bytes, for predictable write latency. Buffers are
+      //              staged in memory until a block fills or the file is closed.
 #if FW_OBJECT_NAMES == 1
-      ComLogger(const char* compName, const char* filePrefix, U32 maxFileSize, bool storeBufferLength=true);
+      ComLogger(const char* compName, const char* filePrefix, U32 maxFileSize, bool storeBufferLength=true, bool directWrite=false);
 #else
-      ComLogger(const char* filePrefix, U32 maxFileSize, bool storeBufferLength=true);
+      ComLogger(const char* filePrefix, U32 maxFileSize, bool storeBufferLength=true, bool directWrite=false);
 #endif
 
       void init(
@@ -49,6 +57,27 @@ namespace Svc {
 
       ~ComLogger(void);
 
+      // Start buffered mode. Com buffers are appended to one of two blocks of blockSize bytes
+      // each, taken from allocator, and a writer task writes a block out while the other one
+      // fills. A block is written when the next buffer does not fit, when it has waited
+      // flushCycles schedIn calls, and before the file is closed. blockSize must hold the
+      // largest com buffer and its length. If compress is true, each block is compressed
+      // into a Utils::Lz stream before it is written, and the files are named .com.lz.
+      // Call before the component receives buffers.
+      void startWriter(
+          NATIVE_INT_TYPE identifier, //!< The identifier for the allocator and the writer task
+          NATIVE_INT_TYPE priority, //!< The writer task priority
+          NATIVE_INT_TYPE stackSize, //!< The writer task stack size
+          Fw::MemAllocator& allocator, //!< The allocator for the blocks
+          NATIVE_UINT_TYPE blockSize, //!< The size of each block
+          U32 flushCycles, //!< The schedIn calls a partly filled block waits before it is written
+          bool compress = false //!< Whether to compress the blocks
+      );
+
+      // Write out the buffered data, stop the writer task, and release the blocks.
+      // Call after the component thread has exited.
+      void stopWriter(void);
+
       // ----------------------------------------------------------------------
       // Handler implementations
       // ----------------------------------------------------------------------
@@ -73,6 +102,13 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+      //! Handler implementation for schedIn
+      //!
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
       // ----------------------------------------------------------------------
       // Constants:
       // ----------------------------------------------------------------------
@@ -82,6 +118,11 @@ namespace Svc {
         MAX_PATH_SIZE = PATH_MAX
       };
 
+      // The number of blocks in buffered mode:
+      enum {
+        NUM_BLOCKS = 2
+      };
+
       // The filename data:
       U8 filePrefix[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U32 maxFileSize;
@@ -96,13 +137,58 @@ namespace Svc {
 
       FileMode fileMode;
       Os::File file;
+      Os::DirectWriter directFile;
       U8 fileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U8 hashFileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U32 byteCount;
       bool writeErrorOccured;
       bool openErrorOccured;
       bool storeBufferLength;
-      
+      bool directWrite;
+      bool compress;
+      Utils::Hash hash; // hash of the data handed to the open file
+      Utils::LzEncoder encoder;
+
+      // ----------------------------------------------------------------------
+      // Buffered mode state:
+      // ----------------------------------------------------------------------
+
+      // A block of com buffers waiting to be written:
+      struct Block {
+        U8* data;
+        NATIVE_UINT_TYPE used;
+        U8* frame; // the compressed block, if compressing
+        NATIVE_UINT_TYPE frameSize;
+        bool busy; // sent to the writer task and not yet returned
+      };
+
+      // The result of a block write, sent back by the writer task:
+      struct WriteResult {
+        NATIVE_UINT_TYPE block;
+        Os::File::Status status;
+        NATIVE_INT_TYPE size;
+        NATIVE_INT_TYPE written;
+        U32 latency;
+      };
+
+      Block blocks[NUM_BLOCKS];
+      NATIVE_UINT_TYPE activeBlock;
+      NATIVE_UINT_TYPE blockSize;
+      U32 flushCycles;
+      U32 cyclesSinceFlush;
+      Os::Queue writeQueue; // block indexes, component thread to writer task
+      Os::Queue resultQueue; // write results, writer task to component thread
+      Os::Task writerTask;
+      bool writerStarted;
+      Fw::MemAllocator* allocator;
+      NATIVE_INT_TYPE allocatorId;
+
+      // Write statistics for telemetry:
+      U32 fileWrites;
+      U32 periodWrites;
+      U64 periodBytes;
+      U32 maxLatency;
+
       // ----------------------------------------------------------------------
       // File functions:
       // ---------------------------------------------------------------------- 
@@ -122,12 +208,76 @@ namespace Svc {
       // ---------------------------------------------------------------------- 
 
       bool writeToFile(
-        void* data, 
-        U16 length
+        const Os::File::IoVector* vectors,
+        NATIVE_INT_TYPE count,
+        U32& length
+      );
+
+      Os::File::Status writeVectors(
+        const Os::File::IoVector* vectors,
+        NATIVE_INT_TYPE count,
+        NATIVE_INT_TYPE& size
+      );
+
+      bool checkWrite(
+        Os::File::Status ret,
+        NATIVE_INT_TYPE size,
+        U32 length,
+        U32 latency
+      );
+
+      // ----------------------------------------------------------------------
+      // Buffered mode functions:
+      // ----------------------------------------------------------------------
+
+      void appendToBlock(
+        const Os::File::IoVector* vectors,
+        NATIVE_INT_TYPE count,
+        U32& length
+      );
+
+      void submitBlock(
+      );
+
+      void compressBlock(
+        Block& block
+      );
+
+      U32 projectedCompressedSize(
+        U32 length
+      );
+
+      void waitForBlock(
+        NATIVE_UINT_TYPE index
+      );
+
+      void flushBlocks(
+      );
+
+      void reapResults(
+      );
+
+      void handleResult(
+        const WriteResult& result,
+        bool report
+      );
+
+      void shutdownWriter(
+        bool report
+      );
+
+      static void writerTaskEntry(
+        void* ptr
+      );
+
+      void runWriter(
       );
 
       void writeHashFile(
       );
+
+      Os::File::Status closeLogFile(
+      );
   };
 };
 
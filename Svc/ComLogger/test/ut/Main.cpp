@@ -16,6 +16,21 @@ TEST(Test, testLoggingNoLength) {
   tester.testLoggingNoLength();
 }
 
+TEST(Test, testLoggingDirect) {
+  Svc::Tester tester("Tester");
+  tester.testLoggingDirect();
+}
+
+TEST(Test, testLoggingBuffered) {
+  Svc::Tester tester("Tester");
+  tester.testLoggingBuffered();
+}
+
+TEST(Test, testLoggingCompressed) {
+  Svc::Tester tester("Tester");
+  tester.testLoggingCompressed();
+}
+
 TEST(Test, openError) {
   Svc::Tester tester("Tester");
   tester.openError();
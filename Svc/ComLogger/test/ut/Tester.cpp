@@ -9,6 +9,8 @@
 #include <Os/ValidateFile.hpp>
 #include <Os/FileSystem.hpp>
 #include <Fw/Types/SerialBuffer.hpp>
+#include <Os/Task.hpp>
+#include <Utils/Lz/LzEncoder.hpp>
 
 #define ID_BASE 256
 
@@ -40,6 +42,8 @@ namespace Svc {
     this->connect_to_comIn(0, comLogger.get_comIn_InputPort(0));
     comLogger.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
     comLogger.set_logOut_OutputPort(0, this->get_from_logOut(0));
+    this->connect_to_schedIn(0, comLogger.get_schedIn_InputPort(0));
+    comLogger.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
   }
 
   void Tester ::
@@ -62,6 +66,25 @@ namespace Svc {
       this->dispatchOne();
   }
 
+  U32 Tester ::
+    waitForWrites(U32 writes)
+  {
+    // Tick schedIn until the writer task has returned the blocks:
+    U32 fileWrites = 0;
+    for(int i = 0; i < 100 && fileWrites < writes; i++)
+    {
+      this->clearTlm();
+      invoke_to_schedIn(0, 0);
+      dispatchAll();
+      EXPECT_EQ(1u, this->tlmHistory_FileWrites->size());
+      fileWrites = this->tlmHistory_FileWrites->at(0).arg;
+      if( fileWrites < writes ) {
+        Os::Task::delay(10);
+      }
+    }
+    return fileWrites;
+  }
+
   // ----------------------------------------------------------------------
   // Tests 
   // ----------------------------------------------------------------------
@@ -299,6 +322,231 @@ namespace Svc {
      }
   }
 
+  void Tester ::
+    testLoggingDirect(void) 
+  {
+      U8 fileName[2048];
+      U8 hashFileName[2048];
+      U8 buf[1024];
+      NATIVE_INT_TYPE length;
+      Os::File::Status ret;
+      Os::File file;
+
+      U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
+      Fw::ComBuffer buffer(&data[0], sizeof(data));
+
+      // Write through the direct writer:
+      comLogger.directWrite = true;
+
+      Fw::Time testTime(TB_NONE, 8, 654321);
+      Fw::Time testTimeNext(TB_NONE, 9, 654321);
+      memset(fileName, 0, sizeof(fileName));
+      snprintf((char*) fileName, sizeof(fileName), "%s_%d_%d_%06d.com", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+      memset(hashFileName, 0, sizeof(hashFileName));
+      snprintf((char*) hashFileName, sizeof(hashFileName), "%s_%d_%d_%06d.com%s", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds(), Utils::Hash::getFileExtensionString());
+
+      // Fill a file, then roll over to the next one:
+      setTestTime(testTime);
+      for(int i = 0; i < MAX_ENTRIES_PER_FILE; i++)
+      {
+        invoke_to_comIn(0, buffer, 0);
+        dispatchAll();
+        ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+      }
+      setTestTime(testTimeNext);
+      invoke_to_comIn(0, buffer, 0);
+      dispatchAll();
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_FileClosed(0, (char*) fileName);
+
+      // The padding and the preallocated space are trimmed:
+      U64 fileSize = 0;
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize((char*) fileName, fileSize));
+      ASSERT_EQ(MAX_BYTES_PER_FILE, fileSize);
+
+      // Check data:
+      ret = file.open((char*) fileName, Os::File::OPEN_READ);
+      ASSERT_EQ(Os::File::OP_OK,ret);
+      for(int i = 0; i < MAX_ENTRIES_PER_FILE; i++)
+      {
+        length = sizeof(U16) + COM_BUFFER_LENGTH;
+        ret = file.read(&buf, length);
+        ASSERT_EQ(Os::File::OP_OK, ret);
+        ASSERT_EQ(length, (NATIVE_INT_TYPE) (sizeof(U16) + COM_BUFFER_LENGTH));
+        ASSERT_EQ(0, buf[0]);
+        ASSERT_EQ(COM_BUFFER_LENGTH, buf[1]);
+        ASSERT_EQ(memcmp(&buf[sizeof(U16)], data, COM_BUFFER_LENGTH), 0);
+      }
+      file.close();
+
+      ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, Os::ValidateFile::validate((char*) fileName, (char*) hashFileName));
+  }
+
+  void Tester ::
+    testLoggingBuffered(void) 
+  {
+      U8 fileName[2048];
+      U8 hashFileName[2048];
+      U8 buf[1024];
+      NATIVE_INT_TYPE length;
+      Os::File::Status ret;
+      Os::File file;
+      U64 fileSize = 0;
+
+      U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
+      Fw::ComBuffer buffer(&data[0], sizeof(data));
+
+      // Buffer through the writer task. A partly filled block is written
+      // after two schedIn calls:
+      comLogger.startWriter(0, 0, 20*1024, allocator, FW_COM_BUFFER_MAX_SIZE + sizeof(U16), 2);
+
+      Fw::Time testTime(TB_NONE, 10, 654321);
+      Fw::Time testTimeNext(TB_NONE, 11, 654321);
+      memset(fileName, 0, sizeof(fileName));
+      snprintf((char*) fileName, sizeof(fileName), "%s_%d_%d_%06d.com", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+      memset(hashFileName, 0, sizeof(hashFileName));
+      snprintf((char*) hashFileName, sizeof(hashFileName), "%s_%d_%d_%06d.com%s", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds(), Utils::Hash::getFileExtensionString());
+
+      // Buffers are held in the block:
+      setTestTime(testTime);
+      for(int i = 0; i < 2; i++)
+      {
+        invoke_to_comIn(0, buffer, 0);
+        dispatchAll();
+        ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+      }
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize((char*) fileName, fileSize));
+      ASSERT_EQ(0u, fileSize);
+
+      // The first schedIn call does not flush:
+      invoke_to_schedIn(0, 0);
+      dispatchAll();
+      ASSERT_TLM_FileWrites(0, 0);
+      ASSERT_EQ(2*(sizeof(U16) + COM_BUFFER_LENGTH), comLogger.blocks[comLogger.activeBlock].used);
+
+      // The second one hands the block to the writer task:
+      invoke_to_schedIn(0, 0);
+      dispatchAll();
+      ASSERT_EQ(0u, comLogger.blocks[comLogger.activeBlock].used);
+      ASSERT_EQ(1u, waitForWrites(1));
+      ASSERT_TLM_BytesPerWrite(0, 2*(sizeof(U16) + COM_BUFFER_LENGTH));
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize((char*) fileName, fileSize));
+      ASSERT_EQ(2*(sizeof(U16) + COM_BUFFER_LENGTH), fileSize);
+
+      // Fill the file, then roll over to the next one. Closing the file
+      // writes out the block first:
+      for(int i = 2; i < MAX_ENTRIES_PER_FILE; i++)
+      {
+        invoke_to_comIn(0, buffer, 0);
+        dispatchAll();
+      }
+      setTestTime(testTimeNext);
+      invoke_to_comIn(0, buffer, 0);
+      dispatchAll();
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_FileClosed(0, (char*) fileName);
+      ASSERT_EQ(2u, comLogger.fileWrites);
+
+      // Check data:
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize((char*) fileName, fileSize));
+      ASSERT_EQ(MAX_BYTES_PER_FILE, fileSize);
+      ret = file.open((char*) fileName, Os::File::OPEN_READ);
+      ASSERT_EQ(Os::File::OP_OK,ret);
+      for(int i = 0; i < MAX_ENTRIES_PER_FILE; i++)
+      {
+        length = sizeof(U16) + COM_BUFFER_LENGTH;
+        ret = file.read(&buf, length);
+        ASSERT_EQ(Os::File::OP_OK, ret);
+        ASSERT_EQ(length, (NATIVE_INT_TYPE) (sizeof(U16) + COM_BUFFER_LENGTH));
+        ASSERT_EQ(0, buf[0]);
+        ASSERT_EQ(COM_BUFFER_LENGTH, buf[1]);
+        ASSERT_EQ(memcmp(&buf[sizeof(U16)], data, COM_BUFFER_LENGTH), 0);
+      }
+      file.close();
+
+      ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, Os::ValidateFile::validate((char*) fileName, (char*) hashFileName));
+
+      // Stopping the writer writes out the buffer in the new file:
+      comLogger.stopWriter();
+      ASSERT_EQ(3u, comLogger.fileWrites);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize((char*) comLogger.fileName, fileSize));
+      ASSERT_EQ(sizeof(U16) + COM_BUFFER_LENGTH, fileSize);
+  }
+
+  void Tester ::
+    testLoggingCompressed(void) 
+  {
+      U8 fileName[2048];
+      U8 hashFileName[2048];
+      U8 buf[1024];
+      U8 records[MAX_ENTRIES_PER_FILE * (sizeof(U16) + COM_BUFFER_LENGTH)];
+      U8 stream[Utils::LzEncoder::bound(sizeof(records))];
+      NATIVE_INT_TYPE length;
+      Os::File::Status ret;
+      Os::File file;
+      U64 fileSize = 0;
+      Utils::LzEncoder encoder;
+
+      U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
+      Fw::ComBuffer buffer(&data[0], sizeof(data));
+      for(int i = 0; i < MAX_ENTRIES_PER_FILE; i++)
+      {
+        U8* record = &records[i * (sizeof(U16) + COM_BUFFER_LENGTH)];
+        record[0] = 0;
+        record[1] = COM_BUFFER_LENGTH;
+        memcpy(&record[sizeof(U16)], data, COM_BUFFER_LENGTH);
+      }
+
+      // Compress the blocks before the writer task writes them:
+      comLogger.startWriter(0, 0, 20*1024, allocator, FW_COM_BUFFER_MAX_SIZE + sizeof(U16), 2, true);
+
+      Fw::Time testTime(TB_NONE, 12, 654321);
+      Fw::Time testTimeNext(TB_NONE, 13, 654321);
+      memset(fileName, 0, sizeof(fileName));
+      snprintf((char*) fileName, sizeof(fileName), "%s_%d_%d_%06d.com.lz", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+      memset(hashFileName, 0, sizeof(hashFileName));
+      snprintf((char*) hashFileName, sizeof(hashFileName), "%s_%d_%d_%06d.com.lz%s", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds(), Utils::Hash::getFileExtensionString());
+
+      // The file rolls over when the staged block might not fit even if
+      // it does not compress. Three buffers fit in the file:
+      setTestTime(testTime);
+      for(int i = 0; i < 3; i++)
+      {
+        invoke_to_comIn(0, buffer, 0);
+        dispatchAll();
+        ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+      }
+      ASSERT_EQ(0u, comLogger.byteCount);
+      setTestTime(testTimeNext);
+      invoke_to_comIn(0, buffer, 0);
+      dispatchAll();
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_FileClosed(0, (char*) fileName);
+      ASSERT_EQ(1u, comLogger.fileWrites);
+
+      // Check data:
+      const U32 streamSize = encoder.encode(records, 3 * (sizeof(U16) + COM_BUFFER_LENGTH), stream);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize((char*) fileName, fileSize));
+      ASSERT_EQ(streamSize, fileSize);
+      ASSERT_LE(fileSize, MAX_BYTES_PER_FILE);
+      ret = file.open((char*) fileName, Os::File::OPEN_READ);
+      ASSERT_EQ(Os::File::OP_OK,ret);
+      length = streamSize;
+      ret = file.read(&buf, length);
+      ASSERT_EQ(Os::File::OP_OK, ret);
+      ASSERT_EQ(length, (NATIVE_INT_TYPE) streamSize);
+      ASSERT_EQ(memcmp(buf, stream, streamSize), 0);
+      file.close();
+
+      ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, Os::ValidateFile::validate((char*) fileName, (char*) hashFileName));
+
+      // Stopping the writer compresses the buffer in the new file:
+      comLogger.stopWriter();
+      ASSERT_EQ(2u, comLogger.fileWrites);
+      ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize((char*) comLogger.fileName, fileSize));
+      ASSERT_EQ(encoder.encode(records, sizeof(U16) + COM_BUFFER_LENGTH, stream), fileSize);
+  }
+
   void Tester ::
     openError(void) 
   {
@@ -430,7 +678,7 @@ namespace Svc {
           0,
           Os::File::NOT_OPENED,
           0,
-          2,
+          sizeof(U16) + sizeof(data),
           (char*) fileName
       );
 
@@ -469,7 +717,7 @@ namespace Svc {
           1,
           Os::File::NOT_OPENED,
           0,
-          2,
+          sizeof(U16) + sizeof(data),
           (char*) fileName
       );
   }
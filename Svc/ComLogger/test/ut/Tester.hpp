@@ -8,6 +8,7 @@
 #include "GTestBase.hpp"
 #include "../../ComLogger.hpp"
 #include <Fw/Comp/ActiveComponentBase.hpp>
+#include <Fw/Types/MallocAllocator.hpp>
 #include <stdio.h>
 
 #define QUEUE_DEPTH 10
@@ -28,6 +29,9 @@ namespace Svc {
 
       void testLogging(void);
       void testLoggingNoLength(void);
+      void testLoggingDirect(void);
+      void testLoggingBuffered(void);
+      void testLoggingCompressed(void);
       void openError(void);
       void writeError(void);
       void closeFileCommand(void);
@@ -43,7 +47,10 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+      U32 waitForWrites(U32 writes);
+
       ComLogger comLogger;
+      Fw::MallocAllocator allocator;
   };
 
 };
@@ -9,9 +9,11 @@ TEST_SRC=Handcode/TesterBase.cpp \
 
 TEST_MODS=Svc/ComLogger \
 			Svc/Ping \
+			Svc/Sched \
 					Fw/Cmd Fw/Comp Fw/Port Fw/Prm Fw/Time \
 					Fw/Tlm Fw/Types Fw/Log Fw/Obj Os Fw/Com \
 					Utils/Hash \
+					Utils/Lz \
 					gtest
 
 
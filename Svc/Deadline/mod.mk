@@ -0,0 +1,6 @@
+# ---------------------------------------------------------------------- 
+# mod.mk
+# ---------------------------------------------------------------------- 
+
+SRC = DeadlineSetPortAi.xml \
+      DeadlineCancelPortAi.xml
@@ -0,0 +1,74 @@
+// ====================================================================== 
+// \title  Compressor.cpp
+// \brief  cpp file for FileDownlink::Compressor
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileDownlink/FileDownlink.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+
+  Os::File::Status FileDownlink::Compressor ::
+    open(
+        const char *const sourceFileName,
+        const char *const compressedFileName
+    )
+  {
+    this->fileSize = 0;
+    this->compressedSize = 0;
+    Os::File::Status status =
+      this->source.open(sourceFileName, Os::File::OPEN_READ);
+    if (status != Os::File::OP_OK) {
+      return status;
+    }
+    // Never write over a file that has the staged name
+    status = this->compressed.open(
+        compressedFileName,
+        Os::File::OPEN_CREATE_EXCLUSIVE
+    );
+    if (status != Os::File::OP_OK) {
+      this->source.close();
+    }
+    return status;
+  }
+
+  FileDownlink::Compressor::Status FileDownlink::Compressor ::
+    compressFrame(void)
+  {
+    // A read that waits for a full frame loses the last partial frame
+    NATIVE_INT_TYPE size = sizeof(this->data);
+    if (this->source.read(this->data, size, false) != Os::File::OP_OK) {
+      return COMPRESS_ERROR;
+    }
+    if (size == 0) {
+      return COMPRESS_DONE;
+    }
+    const U32 frameSize = this->encoder.encode(this->data, size, this->frame);
+    FW_ASSERT(frameSize <= sizeof(this->frame), frameSize);
+    NATIVE_INT_TYPE writeSize = frameSize;
+    if (
+        this->compressed.write(this->frame, writeSize) != Os::File::OP_OK or
+        static_cast<U32>(writeSize) != frameSize
+    ) {
+      return COMPRESS_ERROR;
+    }
+    this->fileSize += size;
+    this->compressedSize += frameSize;
+    return COMPRESS_MORE;
+  }
+
+  void FileDownlink::Compressor ::
+    close(void)
+  {
+    this->compressed.close();
+    this->source.close();
+  }
+
+}
@@ -20,7 +20,8 @@ namespace Svc {
   Os::File::Status FileDownlink::File ::
     open(
         const char *const sourceFileName,
-        const char *const destFileName
+        const char *const destFileName,
+        const char *const readFileName
     )
   {
 
@@ -32,10 +33,14 @@ namespace Svc {
     Fw::LogStringArg destLogStringArg(destFileName);
     this->destName = destLogStringArg;
 
+    // The file read is the source file unless a staged copy is sent
+    const char *const fileName =
+      (readFileName != NULL) ? readFileName : sourceFileName;
+
     // Set size
     U64 size;
     const Os::FileSystem::Status status = 
-      Os::FileSystem::getFileSize(sourceFileName, size);
+      Os::FileSystem::getFileSize(fileName, size);
     if (status != Os::FileSystem::OP_OK)
       return Os::File::BAD_SIZE;
     this->size = size;
@@ -44,33 +49,73 @@ namespace Svc {
     CFDP::Checksum checksum;
     this->checksum = checksum;
 
+    // Empty the read-ahead buffer
+    this->readAheadOffset = 0;
+    this->readAheadSize = 0;
+
     // Open osFile for reading
-    return this->osFile.open(sourceFileName, Os::File::OPEN_READ);
+    return this->osFile.open(fileName, Os::File::OPEN_READ);
 
   }
 
   Os::File::Status FileDownlink::File ::
     read(
-        U8 *const data,
+        const U8*& data,
         const U32 byteOffset,
         const U32 size
     )
   {
 
-    Os::File::Status status;
-    status = this->osFile.seek(byteOffset);
-    if (status != Os::File::OP_OK)
-      return status;
+    FW_ASSERT(size <= FILEDOWNLINK_READ_AHEAD_SIZE, size);
+
+    if (
+        byteOffset < this->readAheadOffset or
+        byteOffset + size > this->readAheadOffset + this->readAheadSize
+    ) {
+      const Os::File::Status status = this->fillReadAhead(byteOffset, size);
+      if (status != Os::File::OP_OK)
+        return status;
+    }
 
-    NATIVE_INT_TYPE intSize = size;
-    status = this->osFile.read(data, intSize);
+    data = &this->readAhead[byteOffset - this->readAheadOffset];
+    return Os::File::OP_OK;
+
+  }
+
+  Os::File::Status FileDownlink::File ::
+    fillReadAhead(
+        const U32 byteOffset,
+        const U32 size
+    )
+  {
+
+    // Start on an aligned offset if the bytes still fit in the buffer
+    U32 chunkOffset = 
+      byteOffset - byteOffset % FILEDOWNLINK_READ_AHEAD_ALIGNMENT;
+    if (byteOffset + size > chunkOffset + FILEDOWNLINK_READ_AHEAD_SIZE)
+      chunkOffset = byteOffset;
+
+    // Read up to a full buffer, stopping at the end of the file
+    FW_ASSERT(byteOffset + size <= this->size, byteOffset, size, this->size);
+    U32 chunkSize = this->size - chunkOffset;
+    if (chunkSize > FILEDOWNLINK_READ_AHEAD_SIZE)
+      chunkSize = FILEDOWNLINK_READ_AHEAD_SIZE;
+
+    // Invalidate the buffer until the read succeeds
+    this->readAheadSize = 0;
+
+    NATIVE_INT_TYPE intSize = chunkSize;
+    const Os::File::Status status = 
+      this->osFile.readAt(this->readAhead, intSize, chunkOffset);
     if (status != Os::File::OP_OK)
       return status;
-    FW_ASSERT(static_cast<U32>(intSize) == size);
-
-    this->checksum.update(data, byteOffset, size);
+    if (static_cast<U32>(intSize) < byteOffset + size - chunkOffset)
+      return Os::File::BAD_SIZE;
 
+    this->readAheadOffset = chunkOffset;
+    this->readAheadSize = intSize;
     return Os::File::OP_OK;
 
   }
+
 }
@@ -13,6 +13,7 @@
 #include <Svc/FileDownlink/FileDownlink.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/BasicTypes.hpp>
+#include <Os/FileSystem.hpp>
 
 namespace Svc {
 
@@ -30,9 +31,21 @@ namespace Svc {
       filesSent(this),
       packetsSent(this),
       warnings(this),
-      sequenceIndex(0)
+      sequenceIndex(0),
+      packetsPerCycle(FILEDOWNLINK_DEFAULT_PACKETS_PER_CYCLE),
+      phase(PHASE_START),
+      transfer(TRANSFER_FILE),
+      startOffset(0),
+      byteOffset(0),
+      endOffset(0),
+      opCode(0),
+      cmdSeq(0)
   {
-
+    FW_ASSERT(
+        downlinkPacketSize <= FILEDOWNLINK_READ_AHEAD_SIZE,
+        downlinkPacketSize
+    );
+    this->pacer.setBytesPerCycle(FILEDOWNLINK_DEFAULT_BYTES_PER_CYCLE);
   }
 
   void FileDownlink ::
@@ -44,6 +57,17 @@ namespace Svc {
     FileDownlinkComponentBase::init(queueDepth, instance);
   }
 
+  void FileDownlink ::
+    configure(
+        const U32 packetsPerCycle,
+        const U32 bytesPerCycle
+    )
+  {
+    FW_ASSERT(packetsPerCycle > 0);
+    this->packetsPerCycle = packetsPerCycle;
+    this->pacer.setBytesPerCycle(bytesPerCycle);
+  }
+
   FileDownlink ::
     ~FileDownlink(void)
   {
@@ -62,144 +86,420 @@ namespace Svc {
         const Fw::CmdStringArg& destFileName
     )
   {
+    this->queueTransfer(
+        opCode,
+        cmdSeq,
+        sourceFileName,
+        destFileName,
+        TRANSFER_FILE,
+        0,
+        0
+    );
+  }
 
-    Os::File::Status status;
-
-    if (this->mode.get() == Mode::CANCEL) {
-      Fw::LogStringArg sourceLogStringArg(sourceFileName);
-      Fw::LogStringArg destLogStringArg(destFileName);
-      this->log_ACTIVITY_HI_FileDownlink_DownlinkCanceled(
-          sourceLogStringArg,
-          destLogStringArg
-      );
-      this->mode.set(Mode::IDLE);
-      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
-      return;
-    }
+  void FileDownlink ::
+    FileDownlink_SendPartial_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName,
+        U32 startOffset,
+        U32 length
+    )
+  {
+    this->queueTransfer(
+        opCode,
+        cmdSeq,
+        sourceFileName,
+        destFileName,
+        TRANSFER_PARTIAL,
+        startOffset,
+        length
+    );
+  }
 
-    this->mode.set(Mode::DOWNLINK);
+  void FileDownlink ::
+    FileDownlink_Resend_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName,
+        U32 startOffset,
+        U32 length
+    )
+  {
+    this->queueTransfer(
+        opCode,
+        cmdSeq,
+        sourceFileName,
+        destFileName,
+        TRANSFER_RESEND,
+        startOffset,
+        length
+    );
+  }
 
-    status = this->file.open(
-        sourceFileName.toChar(),
-        destFileName.toChar()
+  void FileDownlink ::
+    FileDownlink_SendCompressed_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName
+    )
+  {
+    this->queueTransfer(
+        opCode,
+        cmdSeq,
+        sourceFileName,
+        destFileName,
+        TRANSFER_COMPRESSED,
+        0,
+        0
     );
-    if (status != Os::File::OP_OK) { 
-      this->warnings.fileOpenError();
-      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
-      return; 
+  }
+
+  void FileDownlink ::
+    FileDownlink_Cancel_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq
+    )
+  {
+    (void) this->mode.change(Mode::DOWNLINK, Mode::CANCEL);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
+  }
+
+  // ----------------------------------------------------------------------
+  // Handler implementations for user-defined typed input ports
+  // ----------------------------------------------------------------------
+
+  void FileDownlink ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    this->pacer.startCycle();
+    U32 packets = 0;
+    while (packets < this->packetsPerCycle and this->pacer.canSend()) {
+      const StepStatus status = this->step();
+      if (status == STEP_BLOCKED) {
+        break;
+      }
+      if (status == STEP_SENT) {
+        ++packets;
+      }
     }
+  }
 
-    this->sendStartPacket();
+  // ----------------------------------------------------------------------
+  // Private helper methods 
+  // ----------------------------------------------------------------------
 
-    status = this->sendDataPackets();
-    if (status != Os::File::OP_OK) { 
+  void FileDownlink ::
+    queueTransfer(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName,
+        const Transfer transfer,
+        const U32 startOffset,
+        const U32 length
+    )
+  {
+    // The command completes when the transfer is done
+    FileQueue::Entry entry;
+    entry.sourceName = sourceFileName;
+    entry.destName = destFileName;
+    entry.transfer = transfer;
+    entry.startOffset = startOffset;
+    entry.length = length;
+    entry.opCode = opCode;
+    entry.cmdSeq = cmdSeq;
+    if (not this->fileQueue.push(entry)) {
+      this->warnings.queueFull(sourceFileName);
       this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
-      return; 
     }
+  }
 
-    this->file.osFile.close();
+  bool FileDownlink ::
+    setRange(const FileQueue::Entry& entry)
+  {
+    const U32 fileSize = this->file.size;
+    U32 startOffset = entry.startOffset;
+    // A resend must cover at least one byte
+    const bool valid = (entry.transfer == TRANSFER_RESEND) ?
+      (startOffset < fileSize) : (startOffset <= fileSize);
+    if (not valid) {
+      this->warnings.badRange(startOffset);
+      return false;
+    }
 
-    if (this->mode.get() == Mode::CANCEL) {
-      this->sendCancelPacket();
-      this->log_ACTIVITY_HI_FileDownlink_DownlinkCanceled(
-          this->file.sourceName,
-          this->file.destName
-      );
+    // A length of zero, or one that runs past the end, means the rest
+    // of the file
+    U32 endOffset = fileSize;
+    if (entry.length > 0 and entry.length < fileSize - startOffset) {
+      endOffset = startOffset + entry.length;
+    }
+
+    this->transfer = entry.transfer;
+    if (entry.transfer == TRANSFER_RESEND) {
+      // Widen the range to whole packets, so the packets sent match the
+      // ones sent by SendFile
+      const U32 packetSize = this->downlinkPacketSize;
+      startOffset -= startOffset % packetSize;
+      const U32 tail = endOffset % packetSize;
+      if (tail > 0) {
+        const U32 pad = packetSize - tail;
+        endOffset = (fileSize - endOffset > pad) ? endOffset + pad : fileSize;
+      }
+      this->sequenceIndex = startOffset / packetSize + 1;
+      this->phase = PHASE_DATA;
     }
     else {
-      this->sendEndPacket();
-      this->log_ACTIVITY_HI_FileDownlink_FileSent(
-          this->file.sourceName,
-          this->file.destName
-      );
-      this->filesSent.fileSent();
+      this->sequenceIndex = 0;
+      this->phase = PHASE_START;
     }
+    this->startOffset = startOffset;
+    this->byteOffset = startOffset;
+    this->endOffset = endOffset;
+    return true;
+  }
 
-    this->mode.set(Mode::IDLE);
-    
-    this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
+  FileDownlink::StepStatus FileDownlink ::
+    step(void)
+  {
+    switch (this->mode.get()) {
+      case Mode::IDLE:
+        return this->startFile();
+      case Mode::CANCEL:
+        return this->sendCancelPacket();
+      case Mode::DOWNLINK:
+        break;
+      default:
+        FW_ASSERT(0);
+    }
+    switch (this->phase) {
+      case PHASE_COMPRESS:
+        return this->compressFile();
+      case PHASE_START:
+        return this->sendStartPacket();
+      case PHASE_DATA:
+        return this->sendDataPacket();
+      case PHASE_END:
+        return this->sendEndPacket();
+      default:
+        FW_ASSERT(0, this->phase);
+    }
+    return STEP_BLOCKED;
+  }
+
+  FileDownlink::StepStatus FileDownlink ::
+    startFile(void)
+  {
+    FileQueue::Entry entry;
+    if (not this->fileQueue.pop(entry)) {
+      return STEP_BLOCKED;
+    }
+    this->opCode = entry.opCode;
+    this->cmdSeq = entry.cmdSeq;
 
+    // A compressed transfer sends a staged copy of the file
+    if (entry.transfer == TRANSFER_COMPRESSED) {
+      return this->startCompression(entry);
+    }
+
+    if (this->openFile(entry, NULL)) {
+      this->mode.set(Mode::DOWNLINK);
+    }
+    else {
+      this->cmdResponse_out(this->opCode, this->cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+    }
+    return STEP_CONTINUE;
   }
 
-  void FileDownlink ::
-    FileDownlink_Cancel_cmdHandler(
-        const FwOpcodeType opCode,
-        const U32 cmdSeq
+  bool FileDownlink ::
+    openFile(
+        const FileQueue::Entry& entry,
+        const char *const readFileName
     )
   {
-    if (this->mode.get() == Mode::DOWNLINK)
-      this->mode.set(Mode::CANCEL);
-    this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
+    const Os::File::Status status = this->file.open(
+        entry.sourceName.toChar(),
+        entry.destName.toChar(),
+        readFileName
+    );
+    if (status != Os::File::OP_OK) { 
+      this->warnings.fileOpenError();
+      return false;
+    }
+    if (not this->setRange(entry)) {
+      this->file.osFile.close();
+      return false;
+    }
+    return true;
   }
 
-  // ----------------------------------------------------------------------
-  // Private helper methods 
-  // ----------------------------------------------------------------------
+  FileDownlink::StepStatus FileDownlink ::
+    startCompression(const FileQueue::Entry& entry)
+  {
+    this->compressedName.format(
+        "%s%s",
+        entry.sourceName.toChar(),
+        FILEDOWNLINK_STAGED_SUFFIX
+    );
+    const Os::File::Status status = this->compressor.open(
+        entry.sourceName.toChar(),
+        this->compressedName.toChar()
+    );
+    if (status == Os::File::FILE_EXISTS) {
+      this->warnings.stagedFileExists(this->compressedName);
+      this->cmdResponse_out(this->opCode, this->cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+      return STEP_CONTINUE;
+    }
+    if (status != Os::File::OP_OK) {
+      this->warnings.compressError(entry.sourceName);
+      this->cmdResponse_out(this->opCode, this->cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+      return STEP_CONTINUE;
+    }
+
+    // The copy is written over the next cycles. The downlink can be
+    // canceled in the meantime, so name the file for the cancel event.
+    this->compressedEntry = entry;
+    Fw::LogStringArg sourceLogStringArg(entry.sourceName);
+    this->file.sourceName = sourceLogStringArg;
+    Fw::LogStringArg destLogStringArg(entry.destName);
+    this->file.destName = destLogStringArg;
+    this->transfer = TRANSFER_COMPRESSED;
+    this->phase = PHASE_COMPRESS;
+    this->mode.set(Mode::DOWNLINK);
+    return STEP_CONTINUE;
+  }
 
-  Os::File::Status FileDownlink ::
-    sendDataPacket(const U32 byteOffset)
+  FileDownlink::StepStatus FileDownlink ::
+    compressFile(void)
   {
+    for (U32 frame = 0; frame < FILEDOWNLINK_COMPRESS_FRAMES_PER_CYCLE; ++frame) {
+      const Compressor::Status status = this->compressor.compressFrame();
+      if (status == Compressor::COMPRESS_ERROR) {
+        this->warnings.compressError(this->compressedEntry.sourceName);
+        this->finishFile(Fw::COMMAND_EXECUTION_ERROR);
+        return STEP_BLOCKED;
+      }
+      if (status == Compressor::COMPRESS_DONE) {
+        this->compressor.close();
+        this->log_ACTIVITY_LO_FileDownlink_FileCompressed(
+            this->file.sourceName,
+            this->compressor.getFileSize(),
+            this->compressor.getCompressedSize()
+        );
+        // Send the copy in place of the file
+        if (not this->openFile(
+              this->compressedEntry,
+              this->compressedName.toChar()
+        )) {
+          this->finishFile(Fw::COMMAND_EXECUTION_ERROR);
+        }
+        return STEP_BLOCKED;
+      }
+    }
+    return STEP_BLOCKED;
+  }
 
-    const U32 fileSize = this->file.size;
-    FW_ASSERT(byteOffset < fileSize, byteOffset);
+  void FileDownlink ::
+    finishFile(const Fw::CommandResponse response)
+  {
+    this->file.osFile.close();
+    if (this->transfer == TRANSFER_COMPRESSED) {
+      this->compressor.close();
+      (void) Os::FileSystem::removeFile(this->compressedName.toChar());
+    }
+    this->mode.set(Mode::IDLE);
+    this->cmdResponse_out(this->opCode, this->cmdSeq, response);
+  }
+
+  FileDownlink::StepStatus FileDownlink ::
+    sendDataPacket(void)
+  {
+
+    const U32 endOffset = this->endOffset;
+    const U32 byteOffset = this->byteOffset;
+    FW_ASSERT(byteOffset < endOffset, byteOffset, endOffset);
     const U16 maxDataSize = this->downlinkPacketSize;
-    const U16 dataSize = (byteOffset + maxDataSize > fileSize) ?
-      fileSize - byteOffset : maxDataSize;
-    U8 buffer[dataSize];
+    const U16 dataSize = (byteOffset + maxDataSize > endOffset) ?
+      endOffset - byteOffset : maxDataSize;
+    const U8* data = NULL;
 
+    // The data is carved from the read-ahead buffer of the file
     const Os::File::Status status = 
-      this->file.read(buffer, byteOffset, dataSize);
+      this->file.read(data, byteOffset, dataSize);
     if (status != Os::File::OP_OK) {
       this->warnings.fileRead();
-      return status;
+      this->finishFile(Fw::COMMAND_EXECUTION_ERROR);
+      return STEP_CONTINUE;
     }
 
     const Fw::FilePacket::DataPacket dataPacket = {
       { Fw::FilePacket::T_DATA, this->sequenceIndex },
       byteOffset,
       dataSize,
-      buffer
+      data
     };
-    ++this->sequenceIndex;
     Fw::FilePacket filePacket;
     filePacket.fromDataPacket(dataPacket);
-    this->sendFilePacket(filePacket);
-
-    return Os::File::OP_OK;
-
-  }
+    if (not this->sendFilePacket(filePacket)) {
+      // The data is read again on the next cycle
+      return STEP_BLOCKED;
+    }
 
-  Os::File::Status FileDownlink ::
-    sendDataPackets(void)
-  {
-    this->sequenceIndex = 1;
-    for (
-        U32 byteOffset = 0; 
-        byteOffset < this->file.size; 
-        byteOffset += this->downlinkPacketSize
-    ) {
-      if (this->mode.get() == Mode::CANCEL)
-        return Os::File::OP_OK;
-      const Os::File::Status status = 
-        this->sendDataPacket(byteOffset);
-      if (status != Os::File::OP_OK)
-        return status;
+    this->file.updateChecksum(data, byteOffset, dataSize);
+    ++this->sequenceIndex;
+    this->byteOffset += dataSize;
+    if (this->byteOffset >= endOffset) {
+      if (this->transfer == TRANSFER_RESEND) {
+        // A resend has no end packet
+        this->log_ACTIVITY_HI_FileDownlink_RangeSent(
+            this->file.sourceName,
+            this->startOffset,
+            endOffset - this->startOffset
+        );
+        this->finishFile(Fw::COMMAND_OK);
+      }
+      else {
+        this->phase = PHASE_END;
+      }
     }
-    return Os::File::OP_OK;
+    return STEP_SENT;
+
   }
 
-  void FileDownlink ::
+  FileDownlink::StepStatus FileDownlink ::
     sendCancelPacket(void)
   {
-    const Fw::FilePacket::CancelPacket cancelPacket = {
-      { Fw::FilePacket::T_CANCEL, this->sequenceIndex }
-    };
-    Fw::FilePacket filePacket;
-    filePacket.fromCancelPacket(cancelPacket);
-    this->sendFilePacket(filePacket);
+    // A resend replays packets of a transfer that the ground may still
+    // complete, so it is stopped without a cancel packet. Nothing has
+    // been sent for a file that is still being compressed.
+    const bool sendPacket =
+      (this->transfer != TRANSFER_RESEND) and
+      (this->phase != PHASE_COMPRESS);
+    if (sendPacket) {
+      const Fw::FilePacket::CancelPacket cancelPacket = {
+        { Fw::FilePacket::T_CANCEL, this->sequenceIndex }
+      };
+      Fw::FilePacket filePacket;
+      filePacket.fromCancelPacket(cancelPacket);
+      if (not this->sendFilePacket(filePacket)) {
+        return STEP_BLOCKED;
+      }
+    }
+    this->log_ACTIVITY_HI_FileDownlink_DownlinkCanceled(
+        this->file.sourceName,
+        this->file.destName
+    );
+    this->finishFile(Fw::COMMAND_OK);
+    return sendPacket ? STEP_SENT : STEP_CONTINUE;
   }
 
-  void FileDownlink ::
+  FileDownlink::StepStatus FileDownlink ::
     sendEndPacket(void)
   {
 
@@ -216,35 +516,67 @@ namespace Svc {
 
     Fw::FilePacket filePacket;
     filePacket.fromEndPacket(endPacket);
-    this->sendFilePacket(filePacket);
+    if (not this->sendFilePacket(filePacket)) {
+      return STEP_BLOCKED;
+    }
+
+    if (this->transfer != TRANSFER_PARTIAL) {
+      this->log_ACTIVITY_HI_FileDownlink_FileSent(
+          this->file.sourceName,
+          this->file.destName
+      );
+      this->filesSent.fileSent();
+    }
+    else {
+      this->log_ACTIVITY_HI_FileDownlink_RangeSent(
+          this->file.sourceName,
+          this->startOffset,
+          this->endOffset - this->startOffset
+      );
+    }
+    this->finishFile(Fw::COMMAND_OK);
+    return STEP_SENT;
 
   }
 
-  void FileDownlink ::
+  FileDownlink::StepStatus FileDownlink ::
     sendStartPacket(void)
   {
+    const U8 flags = (this->transfer == TRANSFER_COMPRESSED) ?
+      static_cast<U8>(Fw::FilePacket::StartPacket::FLAG_COMPRESSED) : 0;
     Fw::FilePacket::StartPacket startPacket;
     startPacket.initialize(
         this->file.size,
         this->file.sourceName.toChar(),
-        this->file.destName.toChar()
+        this->file.destName.toChar(),
+        flags
     );
     Fw::FilePacket filePacket;
     filePacket.fromStartPacket(startPacket);
-    this->sendFilePacket(filePacket);
+    if (not this->sendFilePacket(filePacket)) {
+      return STEP_BLOCKED;
+    }
+    this->sequenceIndex = 1;
+    this->phase = (this->byteOffset < this->endOffset) ? PHASE_DATA : PHASE_END;
+    return STEP_SENT;
   }
 
-  void FileDownlink ::
+  bool FileDownlink ::
     sendFilePacket(const Fw::FilePacket& filePacket)
   {
     const U32 bufferSize = filePacket.bufferSize();
     Fw::Buffer buffer = this->bufferGetCaller_out(0, bufferSize);
-    FW_ASSERT(buffer.getdata() != 0);
+    if (buffer.getdata() == 0) {
+      // No buffer available; try again on the next cycle
+      return false;
+    }
     FW_ASSERT(buffer.getsize() == bufferSize, bufferSize, buffer.getsize());
     const Fw::SerializeStatus status = filePacket.toBuffer(buffer);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     this->bufferSendOut_out(0, buffer);
     this->packetsSent.packetSent();
+    this->pacer.packetSent(bufferSize);
+    return true;
   }
 
   void FileDownlink ::
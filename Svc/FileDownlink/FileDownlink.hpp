@@ -14,9 +14,12 @@
 #define Svc_FileDownlink_HPP
 
 #include <Svc/FileDownlink/FileDownlinkComponentAc.hpp>
+#include <Svc/FileDownlink/FileDownlinkCfg.hpp>
 #include <Fw/FilePacket/FilePacket.hpp>
+#include <Fw/Types/EightyCharString.hpp>
 #include <Os/File.hpp>
 #include <Os/Mutex.hpp>
+#include <Utils/Lz/LzEncoder.hpp>
 
 namespace Svc {
 
@@ -60,6 +63,21 @@ namespace Svc {
             return value;
           }
 
+          //! Set the Mode value if it currently has an expected value
+          //! \return Whether the value was changed
+          bool change(
+              const Type from, //!< The expected value
+              const Type to //!< The new value
+          ) {
+            this->mutex.lock();
+            const bool changed = (this->value == from);
+            if (changed) {
+              this->value = to;
+            }
+            this->mutex.unLock();
+            return changed;
+          }
+
         private:
 
           //! The Mode value
@@ -76,7 +94,11 @@ namespace Svc {
         public:
 
           //! Constructor
-          File() : size(0) { }
+          File() : 
+            size(0),
+            readAheadOffset(0),
+            readAheadSize(0)
+          { }
 
         public:
           
@@ -97,20 +119,52 @@ namespace Svc {
           //! The checksum for the file
           ::CFDP::Checksum checksum;
 
+          //! The read-ahead buffer
+          U8 readAhead[FILEDOWNLINK_READ_AHEAD_SIZE];
+
+          //! The file offset of the first byte in the read-ahead buffer
+          U32 readAheadOffset;
+
+          //! The number of valid bytes in the read-ahead buffer
+          U32 readAheadSize;
+
         public:
 
           //! Open the OS file for reading and initialize the checksum
           Os::File::Status open(
               const char *const sourceFileName, //!< The source file name
-              const char *const destFileName //!< The destination file name
+              const char *const destFileName, //!< The destination file name
+              const char *const readFileName = NULL //!< The file to read, if not the source file
           );
 
-          //! Read bytes from the OS file and update the checksum
+          //! Get bytes of the OS file from the read-ahead buffer,
+          //! refilling the buffer if it does not hold them.
+          //! The data stays valid until the next call to read or open.
           Os::File::Status read(
-              U8 *const data,
+              const U8*& data, //!< Set to the bytes in the read-ahead buffer
+              const U32 byteOffset, //!< The file offset of the bytes
+              const U32 size //!< The number of bytes. At most FILEDOWNLINK_READ_AHEAD_SIZE
+          );
+
+        PRIVATE:
+
+          //! Fill the read-ahead buffer with a chunk of the file that
+          //! holds the given bytes
+          Os::File::Status fillReadAhead(
+              const U32 byteOffset, //!< The file offset of the bytes
+              const U32 size //!< The number of bytes
+          );
+
+        public:
+
+          //! Update the checksum with bytes that were sent
+          void updateChecksum(
+              const U8 *const data,
               const U32 byteOffset,
               const U32 size
-          );
+          ) {
+            this->checksum.update(data, byteOffset, size);
+          }
 
           //! Get the checksum
           void getChecksum(::CFDP::Checksum& checksum) {
@@ -119,6 +173,198 @@ namespace Svc {
 
       };
 
+      //! The kind of transfer requested by a command
+      typedef enum {
+        TRANSFER_FILE, //!< The whole file
+        TRANSFER_PARTIAL, //!< A byte range, with start and end packets
+        TRANSFER_RESEND, //!< Data packets of an earlier transfer, replayed
+        TRANSFER_COMPRESSED //!< A compressed copy of the whole file
+      } Transfer;
+
+      //! Class to compress a file into a staged copy, one frame at a time
+      class Compressor {
+
+        public:
+
+          //! The result of compressing a frame
+          typedef enum {
+            COMPRESS_MORE, //!< A frame was written; the file has more data
+            COMPRESS_DONE, //!< The whole file is in the copy
+            COMPRESS_ERROR //!< The file could not be read or the copy written
+          } Status;
+
+        public:
+
+          //! Constructor
+          Compressor(void) : fileSize(0), compressedSize(0) { }
+
+        public:
+
+          //! Open a file and create its compressed copy. The copy
+          //! must not exist; if it does, FILE_EXISTS is returned.
+          //! \return The status of the first open that failed, or OP_OK
+          Os::File::Status open(
+              const char *const sourceFileName, //!< The file to compress
+              const char *const compressedFileName //!< The compressed copy
+          );
+
+          //! Compress the next frame of the file into the copy.
+          //! The copy is a Utils::Lz stream
+          Status compressFrame(void);
+
+          //! Close the files
+          void close(void);
+
+          //! Get the number of bytes of the file compressed so far
+          U32 getFileSize(void) const {
+            return this->fileSize;
+          }
+
+          //! Get the size of the compressed copy so far
+          U32 getCompressedSize(void) const {
+            return this->compressedSize;
+          }
+
+        PRIVATE:
+
+          //! The encoder
+          Utils::LzEncoder encoder;
+
+          //! The file being compressed
+          Os::File source;
+
+          //! The compressed copy
+          Os::File compressed;
+
+          //! The number of bytes of the file compressed so far
+          U32 fileSize;
+
+          //! The size of the compressed copy so far
+          U32 compressedSize;
+
+          //! A frame of the file
+          U8 data[Utils::Lz::LZ_FRAME_DATA_SIZE];
+
+          //! The frame compressed
+          U8 frame[Utils::Lz::LZ_FRAME_HEADER_SIZE + Utils::Lz::LZ_FRAME_DATA_SIZE];
+
+      };
+
+      //! Class representing the files waiting to be sent
+      class FileQueue {
+
+        public:
+
+          //! A queued SendFile command
+          struct Entry {
+
+            //! The source file name
+            Fw::CmdStringArg sourceName;
+
+            //! The destination file name
+            Fw::CmdStringArg destName;
+
+            //! The kind of transfer
+            Transfer transfer;
+
+            //! The offset of the first byte to send
+            U32 startOffset;
+
+            //! The number of bytes to send, or zero for the rest of the file
+            U32 length;
+
+            //! The opcode of the command
+            FwOpcodeType opCode;
+
+            //! The sequence number of the command
+            U32 cmdSeq;
+
+          };
+
+        public:
+
+          //! Constructor
+          FileQueue(void) : head(0), count(0) { }
+
+        public:
+
+          //! Add an entry at the back of the queue
+          //! \return Whether there was room for the entry
+          bool push(const Entry& entry);
+
+          //! Remove the entry at the front of the queue
+          //! \return Whether there was an entry to remove
+          bool pop(Entry& entry);
+
+          //! Get the number of entries in the queue
+          U32 getCount(void) const {
+            return this->count;
+          }
+
+        PRIVATE:
+
+          //! The entries
+          Entry entries[FILEDOWNLINK_FILE_QUEUE_DEPTH];
+
+          //! The index of the front entry
+          U32 head;
+
+          //! The number of entries
+          U32 count;
+
+      };
+
+      //! Class to pace the downlink to a number of bytes per cycle
+      class Pacer {
+
+        public:
+
+          //! Constructor
+          Pacer(void) : bytesPerCycle(0), credit(0) { }
+
+        public:
+
+          //! Set the number of bytes per cycle. Zero means no limit.
+          void setBytesPerCycle(const U32 bytesPerCycle);
+
+          //! Start a cycle by adding a cycle of credit.
+          //! Unused credit does not carry over, but a deficit from a
+          //! packet that overran the last cycle does.
+          void startCycle(void);
+
+          //! Whether another packet may be sent in this cycle
+          bool canSend(void) const {
+            return (this->bytesPerCycle == 0) or (this->credit > 0);
+          }
+
+          //! Charge a sent packet against the credit
+          void packetSent(const U32 size);
+
+        PRIVATE:
+
+          //! The number of bytes per cycle
+          U32 bytesPerCycle;
+
+          //! The number of bytes that may still be sent in this cycle
+          I32 credit;
+
+      };
+
+      //! The phase of the file being downlinked
+      typedef enum { 
+        PHASE_COMPRESS, //!< Compressing the file into its staged copy
+        PHASE_START, //!< Sending the start packet
+        PHASE_DATA, //!< Sending data packets
+        PHASE_END //!< Sending the end packet
+      } Phase;
+
+      //! The outcome of a step of the downlink
+      typedef enum {
+        STEP_SENT, //!< A packet was sent
+        STEP_CONTINUE, //!< Progress was made without sending a packet
+        STEP_BLOCKED //!< Nothing more can be done in this cycle
+      } StepStatus;
+
       //! Class to record files sent
       class FilesSent {
 
@@ -193,6 +439,26 @@ namespace Svc {
           //! Issue a File Read Error warning
           void fileRead(void);
 
+          //! Issue a Bad Range warning
+          void badRange(
+              const U32 startOffset //!< The requested start offset
+          );
+
+          //! Issue a Queue Full warning
+          void queueFull(
+              const Fw::CmdStringArg& sourceFileName //!< The file that was not queued
+          );
+
+          //! Issue a Compress Error warning
+          void compressError(
+              const Fw::CmdStringArg& sourceFileName //!< The file that was not compressed
+          );
+
+          //! Issue a Staged File Exists warning
+          void stagedFileExists(
+              const Fw::EightyCharString& stagedFileName //!< The name of the staged copy
+          );
+
         PRIVATE:
 
           //! Record a warning
@@ -231,6 +497,13 @@ namespace Svc {
           const NATIVE_INT_TYPE instance //!< The instance number
       );
 
+      //! Set the downlink rate. The rate applies to each schedIn call.
+      //!
+      void configure(
+          const U32 packetsPerCycle, //!< The maximum number of packets per cycle
+          const U32 bytesPerCycle //!< The maximum number of bytes per cycle. Zero means no limit
+      );
+
       //! Destroy object FileDownlink
       //!
       ~FileDownlink(void);
@@ -250,6 +523,37 @@ namespace Svc {
           const Fw::CmdStringArg& destFileName //!< The name of the destination file on the ground
       );
 
+      //! Implementation for FileDownlink_SendPartial command handler
+      //!
+      void FileDownlink_SendPartial_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& sourceFileName, //!< The name of the on-board file to send
+          const Fw::CmdStringArg& destFileName, //!< The name of the destination file on the ground
+          U32 startOffset, //!< The offset of the first byte to send
+          U32 length //!< The number of bytes to send. Zero means to the end of the file
+      );
+
+      //! Implementation for FileDownlink_Resend command handler
+      //!
+      void FileDownlink_Resend_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& sourceFileName, //!< The name of the on-board file to send
+          const Fw::CmdStringArg& destFileName, //!< The name of the destination file on the ground
+          U32 startOffset, //!< The offset of the first byte to send
+          U32 length //!< The number of bytes to send. Zero means to the end of the file
+      );
+
+      //! Implementation for FileDownlink_SendCompressed command handler
+      //!
+      void FileDownlink_SendCompressed_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& sourceFileName, //!< The name of the on-board file to send
+          const Fw::CmdStringArg& destFileName //!< The name of the destination file on the ground
+      );
+
       //! Implementation for FileDownlink_Cancel command handler
       //!
       void FileDownlink_Cancel_cmdHandler(
@@ -264,6 +568,13 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+      //! Handler implementation for schedIn
+      //!
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
 
     PRIVATE:
 
@@ -271,17 +582,62 @@ namespace Svc {
       // Private helper methods 
       // ----------------------------------------------------------------------
 
-      Os::File::Status sendDataPacket(const U32 byteOffset);
+      //! Add a transfer to the file queue, or reject the command
+      //! if the queue is full
+      void queueTransfer(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& sourceFileName, //!< The source file name
+          const Fw::CmdStringArg& destFileName, //!< The destination file name
+          const Transfer transfer, //!< The kind of transfer
+          const U32 startOffset, //!< The offset of the first byte to send
+          const U32 length //!< The number of bytes to send, or zero
+      );
+
+      //! Set up the byte range of an opened file
+      //! \return Whether the range is valid
+      bool setRange(
+          const FileQueue::Entry& entry //!< The queue entry
+      );
 
-      Os::File::Status sendDataPackets(void);
+      //! Take the next step of the downlink
+      StepStatus step(void);
 
-      void sendCancelPacket(void);
+      //! Open the file at the front of the queue
+      StepStatus startFile(void);
 
-      void sendEndPacket(void);
+      //! Open a file and set up its byte range
+      //! \return Whether the file is ready to send
+      bool openFile(
+          const FileQueue::Entry& entry, //!< The queue entry
+          const char *const readFileName //!< The file to read, if not the source file
+      );
 
-      void sendStartPacket(void);
+      //! Create the staged copy of a file for SendCompressed
+      StepStatus startCompression(
+          const FileQueue::Entry& entry //!< The queue entry
+      );
 
-      void sendFilePacket(const Fw::FilePacket& filePacket);
+      //! Compress the next frames of the file into its staged copy,
+      //! and open the copy for sending once it is complete
+      //! \return STEP_BLOCKED, so that a cycle compresses at most
+      //!         FILEDOWNLINK_COMPRESS_FRAMES_PER_CYCLE frames
+      StepStatus compressFile(void);
+
+      //! Close the file and respond to its SendFile command
+      void finishFile(const Fw::CommandResponse response);
+
+      StepStatus sendDataPacket(void);
+
+      StepStatus sendCancelPacket(void);
+
+      StepStatus sendEndPacket(void);
+
+      StepStatus sendStartPacket(void);
+
+      //! Send a file packet if a buffer is available
+      //! \return Whether the packet was sent
+      bool sendFilePacket(const Fw::FilePacket& filePacket);
 
     PRIVATE:
 
@@ -310,6 +666,45 @@ namespace Svc {
       //! The current sequence index
       U32 sequenceIndex;
 
+      //! The files waiting to be sent
+      FileQueue fileQueue;
+
+      //! The byte pacing
+      Pacer pacer;
+
+      //! The compressor for SendCompressed
+      Compressor compressor;
+
+      //! The name of the staged copy of a compressed file
+      Fw::EightyCharString compressedName;
+
+      //! The queue entry of the file being compressed
+      FileQueue::Entry compressedEntry;
+
+      //! The maximum number of packets per cycle
+      U32 packetsPerCycle;
+
+      //! The phase of the file being downlinked
+      Phase phase;
+
+      //! The kind of transfer in progress
+      Transfer transfer;
+
+      //! The offset of the first byte of the transfer
+      U32 startOffset;
+
+      //! The offset of the next data packet
+      U32 byteOffset;
+
+      //! The offset just past the last byte of the transfer
+      U32 endOffset;
+
+      //! The opcode of the SendFile command being executed
+      FwOpcodeType opCode;
+
+      //! The sequence number of the SendFile command being executed
+      U32 cmdSeq;
+
     };
 
 } // end namespace Svc
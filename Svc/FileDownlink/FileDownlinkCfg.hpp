@@ -0,0 +1,26 @@
+/*
+ * FileDownlinkCfg.hpp
+ *
+ *  Configuration for the FileDownlink component
+ */
+
+#ifndef FILEDOWNLINK_FILEDOWNLINKCFG_HPP_
+#define FILEDOWNLINK_FILEDOWNLINKCFG_HPP_
+
+// Anonymous namespace for configuration parameters
+namespace {
+
+    enum {
+        FILEDOWNLINK_FILE_QUEUE_DEPTH = 10, // !< Number of SendFile commands that can wait behind the file being downlinked
+        FILEDOWNLINK_DEFAULT_PACKETS_PER_CYCLE = 1, // !< Packets sent per schedIn call until configure() is called
+        FILEDOWNLINK_DEFAULT_BYTES_PER_CYCLE = 0, // !< Bytes sent per schedIn call until configure() is called. Zero means no byte limit
+        FILEDOWNLINK_READ_AHEAD_SIZE = 4096, // !< Size of the buffer that data packets are carved from. Must hold at least one data packet
+        FILEDOWNLINK_READ_AHEAD_ALIGNMENT = 512, // !< Read-ahead refills start on a multiple of this file offset when the packet still fits
+        FILEDOWNLINK_COMPRESS_FRAMES_PER_CYCLE = 1 // !< Frames of up to Utils::Lz::LZ_FRAME_DATA_SIZE bytes that SendCompressed compresses per schedIn call
+    };
+
+    const char FILEDOWNLINK_STAGED_SUFFIX[] = ".lz.tmp"; // !< Appended to the source file name to get the staged copy that SendCompressed writes
+
+}
+
+#endif /* FILEDOWNLINK_FILEDOWNLINKCFG_HPP_ */
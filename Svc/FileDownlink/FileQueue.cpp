@@ -0,0 +1,42 @@
+// ====================================================================== 
+// \title  FileQueue.cpp
+// \brief  cpp file for FileDownlink::FileQueue
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileDownlink/FileDownlink.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+
+  bool FileDownlink::FileQueue ::
+    push(const Entry& entry)
+  {
+    if (this->count == FILEDOWNLINK_FILE_QUEUE_DEPTH) {
+      return false;
+    }
+    const U32 tail = (this->head + this->count) % FILEDOWNLINK_FILE_QUEUE_DEPTH;
+    this->entries[tail] = entry;
+    ++this->count;
+    return true;
+  }
+
+  bool FileDownlink::FileQueue ::
+    pop(Entry& entry)
+  {
+    if (this->count == 0) {
+      return false;
+    }
+    entry = this->entries[this->head];
+    this->head = (this->head + 1) % FILEDOWNLINK_FILE_QUEUE_DEPTH;
+    --this->count;
+    return true;
+  }
+
+}
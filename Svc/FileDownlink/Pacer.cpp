@@ -0,0 +1,47 @@
+// ====================================================================== 
+// \title  Pacer.cpp
+// \brief  cpp file for FileDownlink::Pacer
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileDownlink/FileDownlink.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+
+  void FileDownlink::Pacer ::
+    setBytesPerCycle(const U32 bytesPerCycle)
+  {
+    // The credit is signed, so the rate must fit in it
+    FW_ASSERT(bytesPerCycle <= 0x7FFFFFFF, bytesPerCycle);
+    this->bytesPerCycle = bytesPerCycle;
+    this->credit = 0;
+  }
+
+  void FileDownlink::Pacer ::
+    startCycle(void)
+  {
+    if (this->bytesPerCycle == 0) {
+      return;
+    }
+    const I32 rate = static_cast<I32>(this->bytesPerCycle);
+    // Keep a deficit, but do not bank unused credit across cycles
+    this->credit = (this->credit > 0) ? rate : this->credit + rate;
+  }
+
+  void FileDownlink::Pacer ::
+    packetSent(const U32 size)
+  {
+    if (this->bytesPerCycle == 0) {
+      return;
+    }
+    this->credit -= static_cast<I32>(size);
+  }
+
+}
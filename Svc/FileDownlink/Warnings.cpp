@@ -37,4 +37,45 @@ namespace Svc {
     this->warning();
   }
 
+  void FileDownlink::Warnings ::
+    badRange(const U32 startOffset)
+  {
+    this->fileDownlink->log_WARNING_HI_FileDownlink_BadRange(
+        this->fileDownlink->file.sourceName,
+        startOffset,
+        this->fileDownlink->file.size
+    );
+    this->warning();
+  }
+
+  void FileDownlink::Warnings ::
+    queueFull(const Fw::CmdStringArg& sourceFileName)
+  {
+    Fw::LogStringArg sourceLogStringArg(sourceFileName);
+    this->fileDownlink->log_WARNING_HI_FileDownlink_QueueFull(
+        sourceLogStringArg
+    );
+    this->warning();
+  }
+
+  void FileDownlink::Warnings ::
+    compressError(const Fw::CmdStringArg& sourceFileName)
+  {
+    Fw::LogStringArg sourceLogStringArg(sourceFileName);
+    this->fileDownlink->log_WARNING_HI_FileDownlink_CompressError(
+        sourceLogStringArg
+    );
+    this->warning();
+  }
+
+  void FileDownlink::Warnings ::
+    stagedFileExists(const Fw::EightyCharString& stagedFileName)
+  {
+    Fw::LogStringArg stagedLogStringArg(stagedFileName.toChar());
+    this->fileDownlink->log_WARNING_HI_FileDownlink_StagedFileExists(
+        stagedLogStringArg
+    );
+    this->warning();
+  }
+
 }
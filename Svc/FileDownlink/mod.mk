@@ -4,10 +4,14 @@
 
 SRC = \
 			FileDownlinkComponentAi.xml \
+			Compressor.cpp \
 			File.cpp \
 			FileDownlink.cpp \
+			FileQueue.cpp \
+			Pacer.cpp \
 			Warnings.cpp
 
-HDR = FileDownlink.hpp
+HDR = FileDownlink.hpp \
+			FileDownlinkCfg.hpp
 
 SUBDIRS = test
@@ -518,6 +518,360 @@ namespace Svc {
       << "  Actual:   " << e.destFileName.toChar() << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_QueueFull
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_QueueFull_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileDownlink_QueueFull->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileDownlink_QueueFull\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileDownlink_QueueFull->size() << "\n";
+  }
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_QueueFull(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const sourceFileName
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileDownlink_QueueFull->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileDownlink_QueueFull\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileDownlink_QueueFull->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileDownlink_QueueFull& e =
+      this->eventHistory_FileDownlink_QueueFull->at(index);
+    ASSERT_STREQ(sourceFileName, e.sourceFileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument sourceFileName at index "
+      << index
+      << " in history of event FileDownlink_QueueFull\n"
+      << "  Expected: " << sourceFileName << "\n"
+      << "  Actual:   " << e.sourceFileName.toChar() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_RangeSent
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_RangeSent_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileDownlink_RangeSent->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileDownlink_RangeSent\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileDownlink_RangeSent->size() << "\n";
+  }
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_RangeSent(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const sourceFileName,
+        const U32 startOffset,
+        const U32 length
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileDownlink_RangeSent->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileDownlink_RangeSent\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileDownlink_RangeSent->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileDownlink_RangeSent& e =
+      this->eventHistory_FileDownlink_RangeSent->at(index);
+    ASSERT_STREQ(sourceFileName, e.sourceFileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument sourceFileName at index "
+      << index
+      << " in history of event FileDownlink_RangeSent\n"
+      << "  Expected: " << sourceFileName << "\n"
+      << "  Actual:   " << e.sourceFileName.toChar() << "\n";
+    ASSERT_EQ(startOffset, e.startOffset)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument startOffset at index "
+      << index
+      << " in history of event FileDownlink_RangeSent\n"
+      << "  Expected: " << startOffset << "\n"
+      << "  Actual:   " << e.startOffset << "\n";
+    ASSERT_EQ(length, e.length)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument length at index "
+      << index
+      << " in history of event FileDownlink_RangeSent\n"
+      << "  Expected: " << length << "\n"
+      << "  Actual:   " << e.length << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_BadRange
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_BadRange_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileDownlink_BadRange->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileDownlink_BadRange\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileDownlink_BadRange->size() << "\n";
+  }
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_BadRange(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const sourceFileName,
+        const U32 startOffset,
+        const U32 fileSize
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileDownlink_BadRange->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileDownlink_BadRange\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileDownlink_BadRange->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileDownlink_BadRange& e =
+      this->eventHistory_FileDownlink_BadRange->at(index);
+    ASSERT_STREQ(sourceFileName, e.sourceFileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument sourceFileName at index "
+      << index
+      << " in history of event FileDownlink_BadRange\n"
+      << "  Expected: " << sourceFileName << "\n"
+      << "  Actual:   " << e.sourceFileName.toChar() << "\n";
+    ASSERT_EQ(startOffset, e.startOffset)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument startOffset at index "
+      << index
+      << " in history of event FileDownlink_BadRange\n"
+      << "  Expected: " << startOffset << "\n"
+      << "  Actual:   " << e.startOffset << "\n";
+    ASSERT_EQ(fileSize, e.fileSize)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileSize at index "
+      << index
+      << " in history of event FileDownlink_BadRange\n"
+      << "  Expected: " << fileSize << "\n"
+      << "  Actual:   " << e.fileSize << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_FileCompressed
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_FileCompressed_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileDownlink_FileCompressed->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileDownlink_FileCompressed\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileDownlink_FileCompressed->size() << "\n";
+  }
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_FileCompressed(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const sourceFileName,
+        const U32 fileSize,
+        const U32 compressedSize
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileDownlink_FileCompressed->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileDownlink_FileCompressed\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileDownlink_FileCompressed->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileDownlink_FileCompressed& e =
+      this->eventHistory_FileDownlink_FileCompressed->at(index);
+    ASSERT_STREQ(sourceFileName, e.sourceFileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument sourceFileName at index "
+      << index
+      << " in history of event FileDownlink_FileCompressed\n"
+      << "  Expected: " << sourceFileName << "\n"
+      << "  Actual:   " << e.sourceFileName.toChar() << "\n";
+    ASSERT_EQ(fileSize, e.fileSize)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileSize at index "
+      << index
+      << " in history of event FileDownlink_FileCompressed\n"
+      << "  Expected: " << fileSize << "\n"
+      << "  Actual:   " << e.fileSize << "\n";
+    ASSERT_EQ(compressedSize, e.compressedSize)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument compressedSize at index "
+      << index
+      << " in history of event FileDownlink_FileCompressed\n"
+      << "  Expected: " << compressedSize << "\n"
+      << "  Actual:   " << e.compressedSize << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_CompressError
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_CompressError_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileDownlink_CompressError->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileDownlink_CompressError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileDownlink_CompressError->size() << "\n";
+  }
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_CompressError(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const sourceFileName
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileDownlink_CompressError->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileDownlink_CompressError\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileDownlink_CompressError->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileDownlink_CompressError& e =
+      this->eventHistory_FileDownlink_CompressError->at(index);
+    ASSERT_STREQ(sourceFileName, e.sourceFileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument sourceFileName at index "
+      << index
+      << " in history of event FileDownlink_CompressError\n"
+      << "  Expected: " << sourceFileName << "\n"
+      << "  Actual:   " << e.sourceFileName.toChar() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_StagedFileExists
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_StagedFileExists_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileDownlink_StagedFileExists->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileDownlink_StagedFileExists\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileDownlink_StagedFileExists->size() << "\n";
+  }
+
+  void FileDownlinkGTestBase ::
+    assertEvents_FileDownlink_StagedFileExists(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const stagedFileName
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileDownlink_StagedFileExists->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileDownlink_StagedFileExists\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileDownlink_StagedFileExists->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileDownlink_StagedFileExists& e =
+      this->eventHistory_FileDownlink_StagedFileExists->at(index);
+    ASSERT_STREQ(stagedFileName, e.stagedFileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument stagedFileName at index "
+      << index
+      << " in history of event FileDownlink_StagedFileExists\n"
+      << "  Expected: " << stagedFileName << "\n"
+      << "  Actual:   " << e.stagedFileName.toChar() << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // From ports
   // ----------------------------------------------------------------------
@@ -82,6 +82,42 @@
 #define ASSERT_EVENTS_FileDownlink_DownlinkCanceled(index, _sourceFileName, _destFileName) \
   this->assertEvents_FileDownlink_DownlinkCanceled(__FILE__, __LINE__, index, _sourceFileName, _destFileName)
 
+#define ASSERT_EVENTS_FileDownlink_QueueFull_SIZE(size) \
+  this->assertEvents_FileDownlink_QueueFull_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileDownlink_QueueFull(index, _sourceFileName) \
+  this->assertEvents_FileDownlink_QueueFull(__FILE__, __LINE__, index, _sourceFileName)
+
+#define ASSERT_EVENTS_FileDownlink_RangeSent_SIZE(size) \
+  this->assertEvents_FileDownlink_RangeSent_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileDownlink_RangeSent(index, _sourceFileName, _startOffset, _length) \
+  this->assertEvents_FileDownlink_RangeSent(__FILE__, __LINE__, index, _sourceFileName, _startOffset, _length)
+
+#define ASSERT_EVENTS_FileDownlink_BadRange_SIZE(size) \
+  this->assertEvents_FileDownlink_BadRange_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileDownlink_BadRange(index, _sourceFileName, _startOffset, _fileSize) \
+  this->assertEvents_FileDownlink_BadRange(__FILE__, __LINE__, index, _sourceFileName, _startOffset, _fileSize)
+
+#define ASSERT_EVENTS_FileDownlink_FileCompressed_SIZE(size) \
+  this->assertEvents_FileDownlink_FileCompressed_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileDownlink_FileCompressed(index, _sourceFileName, _fileSize, _compressedSize) \
+  this->assertEvents_FileDownlink_FileCompressed(__FILE__, __LINE__, index, _sourceFileName, _fileSize, _compressedSize)
+
+#define ASSERT_EVENTS_FileDownlink_CompressError_SIZE(size) \
+  this->assertEvents_FileDownlink_CompressError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileDownlink_CompressError(index, _sourceFileName) \
+  this->assertEvents_FileDownlink_CompressError(__FILE__, __LINE__, index, _sourceFileName)
+
+#define ASSERT_EVENTS_FileDownlink_StagedFileExists_SIZE(size) \
+  this->assertEvents_FileDownlink_StagedFileExists_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileDownlink_StagedFileExists(index, _stagedFileName) \
+  this->assertEvents_FileDownlink_StagedFileExists(__FILE__, __LINE__, index, _stagedFileName)
+
 // ----------------------------------------------------------------------
 // Macros for typed user from port history assertions
 // ----------------------------------------------------------------------
@@ -389,6 +425,126 @@ namespace Svc {
           const char *const destFileName /*!< The destination file name*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_QueueFull
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileDownlink_QueueFull_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileDownlink_QueueFull(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const sourceFileName /*!< The source file name*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_RangeSent
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileDownlink_RangeSent_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileDownlink_RangeSent(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const sourceFileName, /*!< The source file name*/
+          const U32 startOffset, /*!< The offset of the first byte of the range*/
+          const U32 length /*!< The number of bytes sent*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_BadRange
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileDownlink_BadRange_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileDownlink_BadRange(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const sourceFileName, /*!< The source file name*/
+          const U32 startOffset, /*!< The offset of the first byte of the range*/
+          const U32 fileSize /*!< The file size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_FileCompressed
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileDownlink_FileCompressed_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileDownlink_FileCompressed(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const sourceFileName, /*!< The source file name*/
+          const U32 fileSize, /*!< The size of the file*/
+          const U32 compressedSize /*!< The size of the compressed copy*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_CompressError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileDownlink_CompressError_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileDownlink_CompressError(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const sourceFileName /*!< The source file name*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_StagedFileExists
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileDownlink_StagedFileExists_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileDownlink_StagedFileExists(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const stagedFileName /*!< The name of the staged copy*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
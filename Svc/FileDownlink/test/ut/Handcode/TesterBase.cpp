@@ -56,6 +56,18 @@ namespace Svc {
       new History<EventEntry_FileDownlink_FileSent>(maxHistorySize);
     this->eventHistory_FileDownlink_DownlinkCanceled =
       new History<EventEntry_FileDownlink_DownlinkCanceled>(maxHistorySize);
+    this->eventHistory_FileDownlink_QueueFull =
+      new History<EventEntry_FileDownlink_QueueFull>(maxHistorySize);
+    this->eventHistory_FileDownlink_RangeSent =
+      new History<EventEntry_FileDownlink_RangeSent>(maxHistorySize);
+    this->eventHistory_FileDownlink_BadRange =
+      new History<EventEntry_FileDownlink_BadRange>(maxHistorySize);
+    this->eventHistory_FileDownlink_FileCompressed =
+      new History<EventEntry_FileDownlink_FileCompressed>(maxHistorySize);
+    this->eventHistory_FileDownlink_CompressError =
+      new History<EventEntry_FileDownlink_CompressError>(maxHistorySize);
+    this->eventHistory_FileDownlink_StagedFileExists =
+      new History<EventEntry_FileDownlink_StagedFileExists>(maxHistorySize);
     // Initialize histories for typed user output ports
     this->fromPortHistory_bufferGetCaller =
       new History<FromPortEntry_bufferGetCaller>(maxHistorySize);
@@ -84,6 +96,12 @@ namespace Svc {
     delete this->eventHistory_FileDownlink_FileReadError;
     delete this->eventHistory_FileDownlink_FileSent;
     delete this->eventHistory_FileDownlink_DownlinkCanceled;
+    delete this->eventHistory_FileDownlink_QueueFull;
+    delete this->eventHistory_FileDownlink_RangeSent;
+    delete this->eventHistory_FileDownlink_BadRange;
+    delete this->eventHistory_FileDownlink_FileCompressed;
+    delete this->eventHistory_FileDownlink_CompressError;
+    delete this->eventHistory_FileDownlink_StagedFileExists;
   }
 
   void FileDownlinkTesterBase ::
@@ -382,6 +400,29 @@ namespace Svc {
 
     }
 
+    // Initialize output port schedIn
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_to_schedIn();
+        ++_port
+    ) {
+      this->m_to_schedIn[_port].init();
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_to_schedIn[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_to_schedIn[_port].setObjName(_portName);
+#endif
+
+    }
+
   }
 
   // ----------------------------------------------------------------------
@@ -442,6 +483,12 @@ namespace Svc {
     return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_to_pingIn);
   }
 
+  NATIVE_INT_TYPE FileDownlinkTesterBase ::
+    getNum_to_schedIn(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_to_schedIn);
+  }
+
   NATIVE_INT_TYPE FileDownlinkTesterBase ::
     getNum_from_pingOut(void) const
   {
@@ -480,6 +527,16 @@ namespace Svc {
     this->m_to_pingIn[portNum].addCallPort(pingIn);
   }
 
+  void FileDownlinkTesterBase ::
+    connect_to_schedIn(
+        const NATIVE_INT_TYPE portNum,
+        Svc::InputSchedPort *const schedIn
+    ) 
+  {
+    FW_ASSERT(portNum < this->getNum_to_schedIn(),static_cast<AssertArg>(portNum));
+    this->m_to_schedIn[portNum].addCallPort(schedIn);
+  }
+
 
   // ----------------------------------------------------------------------
   // Invocation functions for to ports
@@ -498,6 +555,19 @@ namespace Svc {
     );
   }
 
+  void FileDownlinkTesterBase ::
+    invoke_to_schedIn(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_to_schedIn(),static_cast<AssertArg>(portNum));
+    FW_ASSERT(portNum < this->getNum_to_schedIn(),static_cast<AssertArg>(portNum));
+    this->m_to_schedIn[portNum].invoke(
+        context
+    );
+  }
+
   // ----------------------------------------------------------------------
   // Connection status for to ports
   // ----------------------------------------------------------------------
@@ -516,6 +586,13 @@ namespace Svc {
     return this->m_to_pingIn[portNum].isConnected();
   }
 
+  bool FileDownlinkTesterBase ::
+    isConnected_to_schedIn(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_to_schedIn(), static_cast<AssertArg>(portNum));
+    return this->m_to_schedIn[portNum].isConnected();
+  }
+
   // ----------------------------------------------------------------------
   // Getters for from ports
   // ----------------------------------------------------------------------
@@ -913,6 +990,141 @@ namespace Svc {
 
   }
 
+
+  // ---------------------------------------------------------------------- 
+  // Command: FileDownlink_SendPartial
+  // ---------------------------------------------------------------------- 
+
+  void FileDownlinkTesterBase ::
+    sendCmd_FileDownlink_SendPartial(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName,
+        U32 startOffset,
+        U32 length
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize(sourceFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(destFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(startOffset);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(length);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = FileDownlinkComponentBase::OPCODE_FILEDOWNLINK_SENDPARTIAL + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Command: FileDownlink_Resend
+  // ---------------------------------------------------------------------- 
+
+  void FileDownlinkTesterBase ::
+    sendCmd_FileDownlink_Resend(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName,
+        U32 startOffset,
+        U32 length
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize(sourceFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(destFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(startOffset);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(length);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = FileDownlinkComponentBase::OPCODE_FILEDOWNLINK_RESEND + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Command: FileDownlink_SendCompressed
+  // ---------------------------------------------------------------------- 
+
+  void FileDownlinkTesterBase ::
+    sendCmd_FileDownlink_SendCompressed(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize(sourceFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(destFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = FileDownlinkComponentBase::OPCODE_FILEDOWNLINK_SENDCOMPRESSED + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
   
   void FileDownlinkTesterBase ::
     sendRawCmd(FwOpcodeType opcode, U32 cmdSeq, Fw::CmdArgBuffer& args) {
@@ -1223,6 +1435,294 @@ namespace Svc {
 
       }
 
+      case FileDownlinkComponentBase::EVENTID_FILEDOWNLINK_QUEUEFULL: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+        
+#endif    
+        Fw::LogStringArg sourceFileName;
+        _status = args.deserialize(sourceFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileDownlink_QueueFull(sourceFileName);
+
+        break;
+
+      }
+
+      case FileDownlinkComponentBase::EVENTID_FILEDOWNLINK_RANGESENT: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 3,_numArgs,3);
+        
+#endif    
+        Fw::LogStringArg sourceFileName;
+        _status = args.deserialize(sourceFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 startOffset;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(startOffset);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 length;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(length);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_HI_FileDownlink_RangeSent(sourceFileName, startOffset, length);
+
+        break;
+
+      }
+
+      case FileDownlinkComponentBase::EVENTID_FILEDOWNLINK_BADRANGE: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 3,_numArgs,3);
+        
+#endif    
+        Fw::LogStringArg sourceFileName;
+        _status = args.deserialize(sourceFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 startOffset;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(startOffset);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 fileSize;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(fileSize);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileDownlink_BadRange(sourceFileName, startOffset, fileSize);
+
+        break;
+
+      }
+
+      case FileDownlinkComponentBase::EVENTID_FILEDOWNLINK_FILECOMPRESSED: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 3,_numArgs,3);
+        
+#endif    
+        Fw::LogStringArg sourceFileName;
+        _status = args.deserialize(sourceFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 fileSize;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(fileSize);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 compressedSize;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(compressedSize);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_LO_FileDownlink_FileCompressed(sourceFileName, fileSize, compressedSize);
+
+        break;
+
+      }
+
+      case FileDownlinkComponentBase::EVENTID_FILEDOWNLINK_COMPRESSERROR: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+        
+#endif    
+        Fw::LogStringArg sourceFileName;
+        _status = args.deserialize(sourceFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileDownlink_CompressError(sourceFileName);
+
+        break;
+
+      }
+
+      case FileDownlinkComponentBase::EVENTID_FILEDOWNLINK_STAGEDFILEEXISTS: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+        
+#endif    
+        Fw::LogStringArg stagedFileName;
+        _status = args.deserialize(stagedFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileDownlink_StagedFileExists(stagedFileName);
+
+        break;
+
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -1240,6 +1740,12 @@ namespace Svc {
     this->eventHistory_FileDownlink_FileReadError->clear();
     this->eventHistory_FileDownlink_FileSent->clear();
     this->eventHistory_FileDownlink_DownlinkCanceled->clear();
+    this->eventHistory_FileDownlink_QueueFull->clear();
+    this->eventHistory_FileDownlink_RangeSent->clear();
+    this->eventHistory_FileDownlink_BadRange->clear();
+    this->eventHistory_FileDownlink_FileCompressed->clear();
+    this->eventHistory_FileDownlink_CompressError->clear();
+    this->eventHistory_FileDownlink_StagedFileExists->clear();
   }
 
 #if FW_ENABLE_TEXT_LOGGING
@@ -1386,4 +1892,106 @@ namespace Svc {
     ++this->eventsSize;
   }
 
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_QueueFull 
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkTesterBase ::
+    logIn_WARNING_HI_FileDownlink_QueueFull(
+        Fw::LogStringArg& sourceFileName
+    )
+  {
+    EventEntry_FileDownlink_QueueFull e = {
+      sourceFileName
+    };
+    eventHistory_FileDownlink_QueueFull->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_RangeSent 
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkTesterBase ::
+    logIn_ACTIVITY_HI_FileDownlink_RangeSent(
+        Fw::LogStringArg& sourceFileName,
+        U32 startOffset,
+        U32 length
+    )
+  {
+    EventEntry_FileDownlink_RangeSent e = {
+      sourceFileName, startOffset, length
+    };
+    eventHistory_FileDownlink_RangeSent->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_BadRange 
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkTesterBase ::
+    logIn_WARNING_HI_FileDownlink_BadRange(
+        Fw::LogStringArg& sourceFileName,
+        U32 startOffset,
+        U32 fileSize
+    )
+  {
+    EventEntry_FileDownlink_BadRange e = {
+      sourceFileName, startOffset, fileSize
+    };
+    eventHistory_FileDownlink_BadRange->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_FileCompressed 
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkTesterBase ::
+    logIn_ACTIVITY_LO_FileDownlink_FileCompressed(
+        Fw::LogStringArg& sourceFileName,
+        U32 fileSize,
+        U32 compressedSize
+    )
+  {
+    EventEntry_FileDownlink_FileCompressed e = {
+      sourceFileName, fileSize, compressedSize
+    };
+    eventHistory_FileDownlink_FileCompressed->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_CompressError 
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkTesterBase ::
+    logIn_WARNING_HI_FileDownlink_CompressError(
+        Fw::LogStringArg& sourceFileName
+    )
+  {
+    EventEntry_FileDownlink_CompressError e = {
+      sourceFileName
+    };
+    eventHistory_FileDownlink_CompressError->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileDownlink_StagedFileExists 
+  // ----------------------------------------------------------------------
+
+  void FileDownlinkTesterBase ::
+    logIn_WARNING_HI_FileDownlink_StagedFileExists(
+        Fw::LogStringArg& stagedFileName
+    )
+  {
+    EventEntry_FileDownlink_StagedFileExists e = {
+      stagedFileName
+    };
+    eventHistory_FileDownlink_StagedFileExists->push_back(e);
+    ++this->eventsSize;
+  }
+
 } // end namespace Svc
@@ -61,6 +61,13 @@ namespace Svc {
           Svc::InputPingPort *const pingIn /*!< The port*/
       );
 
+      //! Connect schedIn to to_schedIn[portNum]
+      //!
+      void connect_to_schedIn(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Svc::InputSchedPort *const schedIn /*!< The port*/
+      );
+
     public:
 
       // ----------------------------------------------------------------------
@@ -366,6 +373,13 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+      //! Invoke the to port connected to schedIn
+      //!
+      void invoke_to_schedIn(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
     public:
 
       // ----------------------------------------------------------------------
@@ -426,6 +440,12 @@ namespace Svc {
       //!
       NATIVE_INT_TYPE getNum_to_pingIn(void) const;
 
+      //! Get the number of to_schedIn ports
+      //!
+      //! \return The number of to_schedIn ports
+      //!
+      NATIVE_INT_TYPE getNum_to_schedIn(void) const;
+
       //! Get the number of from_pingOut ports
       //!
       //! \return The number of from_pingOut ports
@@ -462,6 +482,14 @@ namespace Svc {
           const NATIVE_INT_TYPE portNum /*!< The port number*/
       );
 
+      //! Check whether port is connected
+      //!
+      //! Whether to_schedIn[portNum] is connected
+      //!
+      bool isConnected_to_schedIn(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
       // ----------------------------------------------------------------------
       // Functions for sending commands
       // ----------------------------------------------------------------------
@@ -487,6 +515,37 @@ namespace Svc {
           const U32 cmdSeq /*!< The command sequence number*/
       );
 
+      //! Send a FileDownlink_SendPartial command
+      //!
+      void sendCmd_FileDownlink_SendPartial(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CmdStringArg& sourceFileName, /*!< The name of the on-board file to send*/
+          const Fw::CmdStringArg& destFileName, /*!< The name of the destination file on the ground*/
+          U32 startOffset, /*!< The offset of the first byte to send*/
+          U32 length /*!< The number of bytes to send. Zero means to the end of the file*/
+      );
+
+      //! Send a FileDownlink_Resend command
+      //!
+      void sendCmd_FileDownlink_Resend(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CmdStringArg& sourceFileName, /*!< The name of the on-board file to send*/
+          const Fw::CmdStringArg& destFileName, /*!< The name of the destination file on the ground*/
+          U32 startOffset, /*!< The offset of the first byte to send*/
+          U32 length /*!< The number of bytes to send. Zero means to the end of the file*/
+      );
+
+      //! Send a FileDownlink_SendCompressed command
+      //!
+      void sendCmd_FileDownlink_SendCompressed(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CmdStringArg& sourceFileName, /*!< The name of the on-board file to send*/
+          const Fw::CmdStringArg& destFileName /*!< The name of the destination file on the ground*/
+      );
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -675,6 +734,156 @@ namespace Svc {
       History<EventEntry_FileDownlink_DownlinkCanceled> 
         *eventHistory_FileDownlink_DownlinkCanceled;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_QueueFull
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileDownlink_QueueFull
+      //!
+      virtual void logIn_WARNING_HI_FileDownlink_QueueFull(
+          Fw::LogStringArg& sourceFileName /*!< The source file name*/
+      );
+
+      //! A history entry for event FileDownlink_QueueFull
+      //!
+      typedef struct {
+        Fw::LogStringArg sourceFileName;
+      } EventEntry_FileDownlink_QueueFull;
+
+      //! The history of FileDownlink_QueueFull events
+      //!
+      History<EventEntry_FileDownlink_QueueFull> 
+        *eventHistory_FileDownlink_QueueFull;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_RangeSent
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileDownlink_RangeSent
+      //!
+      virtual void logIn_ACTIVITY_HI_FileDownlink_RangeSent(
+          Fw::LogStringArg& sourceFileName, /*!< The source file name*/
+          U32 startOffset, /*!< The offset of the first byte of the range*/
+          U32 length /*!< The number of bytes sent*/
+      );
+
+      //! A history entry for event FileDownlink_RangeSent
+      //!
+      typedef struct {
+        Fw::LogStringArg sourceFileName;
+        U32 startOffset;
+        U32 length;
+      } EventEntry_FileDownlink_RangeSent;
+
+      //! The history of FileDownlink_RangeSent events
+      //!
+      History<EventEntry_FileDownlink_RangeSent> 
+        *eventHistory_FileDownlink_RangeSent;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_BadRange
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileDownlink_BadRange
+      //!
+      virtual void logIn_WARNING_HI_FileDownlink_BadRange(
+          Fw::LogStringArg& sourceFileName, /*!< The source file name*/
+          U32 startOffset, /*!< The offset of the first byte of the range*/
+          U32 fileSize /*!< The file size*/
+      );
+
+      //! A history entry for event FileDownlink_BadRange
+      //!
+      typedef struct {
+        Fw::LogStringArg sourceFileName;
+        U32 startOffset;
+        U32 fileSize;
+      } EventEntry_FileDownlink_BadRange;
+
+      //! The history of FileDownlink_BadRange events
+      //!
+      History<EventEntry_FileDownlink_BadRange> 
+        *eventHistory_FileDownlink_BadRange;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_FileCompressed
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileDownlink_FileCompressed
+      //!
+      virtual void logIn_ACTIVITY_LO_FileDownlink_FileCompressed(
+          Fw::LogStringArg& sourceFileName, /*!< The source file name*/
+          U32 fileSize, /*!< The size of the file*/
+          U32 compressedSize /*!< The size of the compressed copy*/
+      );
+
+      //! A history entry for event FileDownlink_FileCompressed
+      //!
+      typedef struct {
+        Fw::LogStringArg sourceFileName;
+        U32 fileSize;
+        U32 compressedSize;
+      } EventEntry_FileDownlink_FileCompressed;
+
+      //! The history of FileDownlink_FileCompressed events
+      //!
+      History<EventEntry_FileDownlink_FileCompressed> 
+        *eventHistory_FileDownlink_FileCompressed;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_CompressError
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileDownlink_CompressError
+      //!
+      virtual void logIn_WARNING_HI_FileDownlink_CompressError(
+          Fw::LogStringArg& sourceFileName /*!< The source file name*/
+      );
+
+      //! A history entry for event FileDownlink_CompressError
+      //!
+      typedef struct {
+        Fw::LogStringArg sourceFileName;
+      } EventEntry_FileDownlink_CompressError;
+
+      //! The history of FileDownlink_CompressError events
+      //!
+      History<EventEntry_FileDownlink_CompressError> 
+        *eventHistory_FileDownlink_CompressError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileDownlink_StagedFileExists
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileDownlink_StagedFileExists
+      //!
+      virtual void logIn_WARNING_HI_FileDownlink_StagedFileExists(
+          Fw::LogStringArg& stagedFileName /*!< The name of the staged copy*/
+      );
+
+      //! A history entry for event FileDownlink_StagedFileExists
+      //!
+      typedef struct {
+        Fw::LogStringArg stagedFileName;
+      } EventEntry_FileDownlink_StagedFileExists;
+
+      //! The history of FileDownlink_StagedFileExists events
+      //!
+      History<EventEntry_FileDownlink_StagedFileExists> 
+        *eventHistory_FileDownlink_StagedFileExists;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -798,6 +1007,10 @@ namespace Svc {
       //!
       Svc::OutputPingPort m_to_pingIn[1];
 
+      //! To port connected to schedIn
+      //!
+      Svc::OutputSchedPort m_to_schedIn[1];
+
     private:
 
       // ----------------------------------------------------------------------
@@ -24,6 +24,51 @@ TEST(FileDownlink, CancelInIdleMode) {
   tester.cancelInIdleMode();
 }
 
+TEST(FileDownlink, QueueFull) {
+  Svc::Tester tester;
+  tester.queueFull();
+}
+
+TEST(FileDownlink, QueueTwoFiles) {
+  Svc::Tester tester;
+  tester.queueTwoFiles();
+}
+
+TEST(FileDownlink, Pacing) {
+  Svc::Tester tester;
+  tester.pacing();
+}
+
+TEST(FileDownlink, BufferUnavailable) {
+  Svc::Tester tester;
+  tester.bufferUnavailable();
+}
+
+TEST(FileDownlink, SendPartial) {
+  Svc::Tester tester;
+  tester.sendPartial();
+}
+
+TEST(FileDownlink, Resend) {
+  Svc::Tester tester;
+  tester.resend();
+}
+
+TEST(FileDownlink, ReadAhead) {
+  Svc::Tester tester;
+  tester.readAhead();
+}
+
+TEST(FileDownlink, SendCompressed) {
+  Svc::Tester tester;
+  tester.sendCompressed();
+}
+
+TEST(FileDownlink, CancelCompression) {
+  Svc::Tester tester;
+  tester.cancelCompression();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -12,8 +12,11 @@
 
 #include <errno.h>
 #include <unistd.h>
+#include <string.h>
 
 #include "Tester.hpp"
+#include <Os/FileSystem.hpp>
+#include <Utils/Lz/LzEncoder.hpp>
 
 #define INSTANCE 0
 #define CMD_SEQ 0
@@ -22,6 +25,7 @@
 #define DOWNLINK_PACKET_SIZE 5
 #define MANAGER_ID 100
 #define BUFFER_ID 200
+#define MAX_CYCLES 100
 
 namespace Svc {
 
@@ -32,7 +36,8 @@ namespace Svc {
   Tester ::
     Tester(void) : 
       FileDownlinkGTestBase("Tester", MAX_HISTORY_SIZE),
-      component("FileDownlink", DOWNLINK_PACKET_SIZE)
+      component("FileDownlink", DOWNLINK_PACKET_SIZE),
+      buffersAvailable(true)
   {
     this->connectPorts();
     this->initComponents();
@@ -130,8 +135,18 @@ namespace Svc {
     cancelDownlink(void) 
   {
 
-    // Pretend we are already downlinking
-    this->component.mode.set(FileDownlink::Mode::DOWNLINK);
+    // Create a file
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    // Queue the file and send the start packet
+    this->queueFile(sourceFileName, destFileName);
+    this->runCycle();
+    ASSERT_from_bufferSendOut_SIZE(1);
+    ASSERT_EQ(FileDownlink::Mode::DOWNLINK, this->component.mode.get());
 
     // Send a cancel command and assert COMMAND_OK
     this->cancel(Fw::COMMAND_OK);
@@ -142,24 +157,46 @@ namespace Svc {
     // Clear the command response history
     this->cmdResponseHistory->clear();
 
-    // Send a file and assert COMMAND_OK
-    this->sendFile("source.bin", "dest.bin", Fw::COMMAND_OK);
+    // Send the cancel packet and assert COMMAND_OK for the file
+    this->runCycle();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDFILE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
 
     // Assert telemetry
-    ASSERT_TLM_SIZE(0);
+    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_FileDownlink_PacketsSent_SIZE(2);
 
     // Assert cancel event
     ASSERT_EVENTS_SIZE(1);
     ASSERT_EVENTS_FileDownlink_DownlinkCanceled_SIZE(1);
     ASSERT_EVENTS_FileDownlink_DownlinkCanceled(
         0,
-        "source.bin",
-        "dest.bin"
+        sourceFileName,
+        destFileName
+    );
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_CANCEL,
+        2,
+        checksum
     );
 
     // Assert IDLE mode
     ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
 
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+
   }
 
   void Tester ::
@@ -177,6 +214,690 @@ namespace Svc {
 
   }
 
+  void Tester ::
+    queueFull(void) 
+  {
+
+    // Fill the queue
+    for (U32 i = 0; i < FILEDOWNLINK_FILE_QUEUE_DEPTH; ++i) {
+      this->queueFile("source.bin", "dest.bin");
+    }
+    ASSERT_CMD_RESPONSE_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send one more file and assert COMMAND_EXECUTION_ERROR
+    this->queueFile("overflow.bin", "dest.bin");
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDFILE,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+
+    // Assert telemetry
+    ASSERT_TLM_SIZE(1);
+    ASSERT_TLM_FileDownlink_Warnings(0, 1);
+
+    // Assert events
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_QueueFull_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_QueueFull(0, "overflow.bin");
+
+    // Assert idle mode
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+
+  }
+
+  void Tester ::
+    queueTwoFiles(void) 
+  {
+
+    // Create two files
+    U8 data1[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBuffer1(data1, sizeof(data1));
+    fileBuffer1.write("source1.bin");
+    U8 data2[] = { 9, 8, 7 };
+    FileBuffer fileBuffer2(data2, sizeof(data2));
+    fileBuffer2.write("source2.bin");
+
+    // Queue both files
+    this->queueFile("source1.bin", "dest1.bin");
+    this->queueFile("source2.bin", "dest2.bin");
+    ASSERT_CMD_RESPONSE_SIZE(0);
+
+    // Run the first file
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_FileSent_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_FileSent(0, "source1.bin", "dest1.bin");
+    this->cmdResponseHistory->clear();
+
+    // Run the second file
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDFILE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_FileDownlink_FileSent_SIZE(2);
+    ASSERT_EVENTS_FileDownlink_FileSent(1, "source2.bin", "dest2.bin");
+
+    // Assert telemetry: 4 packets for the first file, 3 for the second
+    ASSERT_TLM_FileDownlink_PacketsSent_SIZE(7);
+    ASSERT_TLM_FileDownlink_FilesSent_SIZE(2);
+    ASSERT_TLM_FileDownlink_FilesSent(1, 2);
+
+    // Assert idle mode
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+
+    // Remove the outgoing files
+    this->removeFile("source1.bin");
+    this->removeFile("source2.bin");
+
+  }
+
+  void Tester ::
+    pacing(void) 
+  {
+
+    // Create a file
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    // With no byte limit, the whole file goes out in one cycle
+    this->component.configure(10, 0);
+    this->queueFile(sourceFileName, destFileName);
+    this->runCycle();
+    ASSERT_from_bufferSendOut_SIZE(4);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+    this->clearHistory();
+
+    // The packets are 29 (start), 16, 16 (data), and 9 (end) bytes.
+    // At 20 bytes per cycle, the 9-byte deficit left by the start packet
+    // holds the downlink to one packet per cycle.
+    this->component.configure(10, 20);
+    this->queueFile(sourceFileName, destFileName);
+    for (U32 cycle = 1; cycle <= 4; ++cycle) {
+      this->runCycle();
+      ASSERT_from_bufferSendOut_SIZE(cycle);
+    }
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        4,
+        checksum
+    );
+    this->clearHistory();
+
+    // Two packets per cycle with no byte limit
+    this->component.configure(2, 0);
+    this->queueFile(sourceFileName, destFileName);
+    this->runCycle();
+    ASSERT_from_bufferSendOut_SIZE(2);
+    this->runCycle();
+    ASSERT_from_bufferSendOut_SIZE(4);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    bufferUnavailable(void) 
+  {
+
+    // Create a file
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    // Send the start packet
+    this->queueFile(sourceFileName, destFileName);
+    this->runCycle();
+    ASSERT_from_bufferSendOut_SIZE(1);
+
+    // Run a cycle with no buffers and assert no progress
+    this->buffersAvailable = false;
+    this->runCycle();
+    ASSERT_from_bufferSendOut_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(0);
+    ASSERT_EQ(FileDownlink::Mode::DOWNLINK, this->component.mode.get());
+
+    // Finish the file
+    this->buffersAvailable = true;
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDFILE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        4,
+        checksum
+    );
+
+    // Compare the outgoing and incoming files
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    sendPartial(void) 
+  {
+
+    // Create a file
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+    this->component.configure(10, 0);
+
+    // Send bytes 3 through 6
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_FileDownlink_SendPartial(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg,
+        3,
+        4
+    );
+    this->component.doDispatch();
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDPARTIAL,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    // Assert events and telemetry
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_RangeSent_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_RangeSent(0, sourceFileName, 3, 4);
+    ASSERT_TLM_FileDownlink_FilesSent_SIZE(0);
+
+    // Validate the packets: start, one data packet, end
+    CFDP::Checksum checksum1;
+    checksum1.update(&data[3], 3, 4);
+    ASSERT_from_bufferSendOut_SIZE(3);
+    validateStartPacket(this->fromPortHistory_bufferSendOut->at(0).fwBuffer);
+    Fw::FilePacket::DataPacket dataPacket;
+    U32 byteOffset = 3;
+    validateDataPacket(
+        this->fromPortHistory_bufferSendOut->at(1).fwBuffer,
+        dataPacket,
+        1,
+        byteOffset
+    );
+    ASSERT_EQ(7U, byteOffset);
+    validateEndPacket(
+        this->fromPortHistory_bufferSendOut->at(2).fwBuffer,
+        2,
+        checksum1
+    );
+    this->clearHistory();
+
+    // Send the rest of the file in two ranges
+    this->sendCmd_FileDownlink_SendPartial(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg,
+        0,
+        3
+    );
+    this->component.doDispatch();
+    this->sendCmd_FileDownlink_SendPartial(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg,
+        7,
+        0
+    );
+    this->component.doDispatch();
+    this->runCycle();
+    ASSERT_CMD_RESPONSE_SIZE(2);
+    ASSERT_EVENTS_FileDownlink_RangeSent(1, sourceFileName, 7, 3);
+
+    // The range checksums add up to the file checksum
+    ASSERT_from_bufferSendOut_SIZE(6);
+    CFDP::Checksum checksum0;
+    checksum0.update(&data[0], 0, 3);
+    validateEndPacket(
+        this->fromPortHistory_bufferSendOut->at(2).fwBuffer,
+        2,
+        checksum0
+    );
+    CFDP::Checksum checksum2;
+    checksum2.update(&data[7], 7, 3);
+    validateEndPacket(
+        this->fromPortHistory_bufferSendOut->at(5).fwBuffer,
+        2,
+        checksum2
+    );
+    CFDP::Checksum fileChecksum;
+    fileBufferOut.getChecksum(fileChecksum);
+    ASSERT_EQ(
+        fileChecksum.getValue(),
+        checksum0.getValue() + checksum1.getValue() + checksum2.getValue()
+    );
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    resend(void) 
+  {
+
+    // Create a file
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+    this->component.configure(10, 0);
+
+    // Resend byte 7. This is in the second data packet of the file.
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_FileDownlink_Resend(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg,
+        7,
+        1
+    );
+    this->component.doDispatch();
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_RESEND,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    // Assert that the whole packet was resent, and nothing else
+    ASSERT_from_bufferSendOut_SIZE(1);
+    Fw::FilePacket::DataPacket dataPacket;
+    U32 byteOffset = DOWNLINK_PACKET_SIZE;
+    validateDataPacket(
+        this->fromPortHistory_bufferSendOut->at(0).fwBuffer,
+        dataPacket,
+        2,
+        byteOffset
+    );
+    ASSERT_EQ(sizeof(data), byteOffset);
+    ASSERT_EQ(0, memcmp(&data[5], dataPacket.data, 5));
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_RangeSent(0, sourceFileName, 5, 5);
+    this->clearHistory();
+
+    // Request a resend past the end of the file
+    this->sendCmd_FileDownlink_Resend(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg,
+        sizeof(data),
+        0
+    );
+    this->component.doDispatch();
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_RESEND,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+    ASSERT_from_bufferSendOut_SIZE(0);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_BadRange(0, sourceFileName, sizeof(data), sizeof(data));
+    ASSERT_TLM_FileDownlink_Warnings(0, 1);
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    readAhead(void) 
+  {
+
+    // Create a file that fills the read-ahead buffer twice
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    const U32 fileSize = 2 * FILEDOWNLINK_READ_AHEAD_SIZE + 2;
+    U8 *const data = new U8[fileSize];
+    for (U32 i = 0; i < fileSize; ++i) {
+      data[i] = i % 251;
+    }
+    Os::File file;
+    ASSERT_EQ(Os::File::OP_OK, file.open(sourceFileName, Os::File::OPEN_WRITE));
+    NATIVE_INT_TYPE intSize = fileSize;
+    ASSERT_EQ(Os::File::OP_OK, file.write(data, intSize));
+    ASSERT_EQ(fileSize, static_cast<U32>(intSize));
+    file.close();
+    this->component.configure(10, 0);
+
+    // Resend the packet that holds the first byte of the second buffer,
+    // then the end of the file
+    const U32 crossOffset = FILEDOWNLINK_READ_AHEAD_SIZE;
+    const U32 endOffset = fileSize - 3;
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_FileDownlink_Resend(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg,
+        crossOffset,
+        1
+    );
+    this->component.doDispatch();
+    this->sendCmd_FileDownlink_Resend(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg,
+        endOffset,
+        0
+    );
+    this->component.doDispatch();
+    this->runCycle();
+    ASSERT_CMD_RESPONSE_SIZE(2);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_FILEDOWNLINK_RESEND, CMD_SEQ, Fw::COMMAND_OK);
+    ASSERT_CMD_RESPONSE(1, FileDownlink::OPCODE_FILEDOWNLINK_RESEND, CMD_SEQ, Fw::COMMAND_OK);
+
+    // Validate the packets against the file
+    const U32 firstOffsets[] = {
+      crossOffset - crossOffset % DOWNLINK_PACKET_SIZE,
+      endOffset - endOffset % DOWNLINK_PACKET_SIZE
+    };
+    U32 packetIndex = 0;
+    for (U32 range = 0; range < 2; ++range) {
+      const U32 last = (range == 0) ? 
+        firstOffsets[0] + 1 : fileSize;
+      U32 byteOffset = firstOffsets[range];
+      while (byteOffset < last) {
+        Fw::FilePacket::DataPacket dataPacket;
+        const U32 offset = byteOffset;
+        validateDataPacket(
+            this->fromPortHistory_bufferSendOut->at(packetIndex).fwBuffer,
+            dataPacket,
+            offset / DOWNLINK_PACKET_SIZE + 1,
+            byteOffset
+        );
+        ASSERT_EQ(0, memcmp(&data[offset], dataPacket.data, dataPacket.dataSize));
+        ++packetIndex;
+      }
+    }
+    ASSERT_from_bufferSendOut_SIZE(packetIndex);
+    ASSERT_EVENTS_FileDownlink_RangeSent_SIZE(2);
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+    delete[] data;
+
+  }
+
+  void Tester ::
+    sendCompressed(void) 
+  {
+
+    // Create a file that compresses
+    const char *const sourceFileName = "source.bin";
+    const char *const compressedFileName = "source.bin.lz.tmp";
+    const char *const destFileName = "dest.bin";
+    U8 data[40];
+    for (U32 i = 0; i < sizeof(data); ++i) {
+      data[i] = i % 4;
+    }
+    FileBuffer fileBuffer(data, sizeof(data));
+    fileBuffer.write(sourceFileName);
+    this->component.configure(10, 0);
+
+    // The data packets carry the compressed stream
+    Utils::LzEncoder encoder;
+    U8 stream[sizeof(data) + Utils::Lz::LZ_FRAME_HEADER_SIZE];
+    const U32 streamSize = encoder.encode(data, sizeof(data), stream);
+    ASSERT_LT(streamSize, sizeof(data));
+    FileBuffer streamBufferOut(stream, streamSize);
+
+    // Send the file and assert COMMAND_OK
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_FileDownlink_SendCompressed(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch();
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDCOMPRESSED,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    // Assert events
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_FileDownlink_FileCompressed_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_FileCompressed(
+        0,
+        sourceFileName,
+        sizeof(data),
+        streamSize
+    );
+    ASSERT_EVENTS_FileDownlink_FileSent(0, sourceFileName, destFileName);
+    ASSERT_TLM_FileDownlink_FilesSent(0, 1);
+
+    // The start packet marks the file as compressed
+    Fw::FilePacket filePacket;
+    validateFilePacket(
+        this->fromPortHistory_bufferSendOut->at(0).fwBuffer,
+        filePacket
+    );
+    const Fw::FilePacket::StartPacket& startPacket = filePacket.asStartPacket();
+    ASSERT_EQ(streamSize, startPacket.fileSize);
+    ASSERT_EQ(
+        Fw::FilePacket::StartPacket::FLAG_COMPRESSED,
+        startPacket.flags
+    );
+
+    // Validate the packet history and compare the stream
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    streamBufferOut.getChecksum(checksum);
+    const U32 numDataPackets = 
+      (streamSize + DOWNLINK_PACKET_SIZE - 1) / DOWNLINK_PACKET_SIZE;
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        numDataPackets + 2,
+        checksum
+    );
+    FileBuffer streamBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(streamBufferIn, streamBufferOut));
+
+    // The staged copy is removed
+    U64 size = 0;
+    ASSERT_NE(
+        Os::FileSystem::OP_OK,
+        Os::FileSystem::getFileSize(compressedFileName, size)
+    );
+    this->removeFile(sourceFileName);
+    this->clearHistory();
+
+    // A file that does not exist is not compressed
+    this->sendCmd_FileDownlink_SendCompressed(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch();
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDCOMPRESSED,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_CompressError(0, sourceFileName);
+    ASSERT_from_bufferSendOut_SIZE(0);
+    ASSERT_NE(
+        Os::FileSystem::OP_OK,
+        Os::FileSystem::getFileSize(compressedFileName, size)
+    );
+    this->clearHistory();
+
+    // A file that has the staged name is not written over
+    fileBuffer.write(sourceFileName);
+    streamBufferOut.write(compressedFileName);
+    this->sendCmd_FileDownlink_SendCompressed(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch();
+    this->runUntilResponse();
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDCOMPRESSED,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_StagedFileExists(0, compressedFileName);
+    ASSERT_from_bufferSendOut_SIZE(0);
+    ASSERT_EQ(
+        Os::FileSystem::OP_OK,
+        Os::FileSystem::getFileSize(compressedFileName, size)
+    );
+    ASSERT_EQ(streamSize, size);
+    this->removeFile(compressedFileName);
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    cancelCompression(void) 
+  {
+
+    // Create a file of several frames
+    const char *const sourceFileName = "source.bin";
+    const char *const compressedFileName = "source.bin.lz.tmp";
+    const char *const destFileName = "dest.bin";
+    const U32 numFrames = FILEDOWNLINK_COMPRESS_FRAMES_PER_CYCLE + 2;
+    const U32 size = numFrames * Utils::Lz::LZ_FRAME_DATA_SIZE;
+    U8 *const data = new U8[size];
+    for (U32 i = 0; i < size; ++i) {
+      data[i] = i % 4;
+    }
+    FileBuffer fileBuffer(data, size);
+    fileBuffer.write(sourceFileName);
+    this->component.configure(10, 0);
+
+    // Start the compression. A cycle compresses part of the file and
+    // sends nothing.
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_FileDownlink_SendCompressed(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch();
+    this->runCycle();
+    ASSERT_CMD_RESPONSE_SIZE(0);
+    ASSERT_from_bufferSendOut_SIZE(0);
+    ASSERT_EQ(FileDownlink::Mode::DOWNLINK, this->component.mode.get());
+    ASSERT_EQ(FileDownlink::PHASE_COMPRESS, this->component.phase);
+    U64 fileSize = 0;
+    ASSERT_EQ(
+        Os::FileSystem::OP_OK,
+        Os::FileSystem::getFileSize(compressedFileName, fileSize)
+    );
+
+    // Cancel the downlink
+    this->cancel(Fw::COMMAND_OK);
+    this->cmdResponseHistory->clear();
+    this->runCycle();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDCOMPRESSED,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    // No packet is sent, and the staged copy is removed
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_DownlinkCanceled(
+        0,
+        sourceFileName,
+        destFileName
+    );
+    ASSERT_from_bufferSendOut_SIZE(0);
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+    ASSERT_NE(
+        Os::FileSystem::OP_OK,
+        Os::FileSystem::getFileSize(compressedFileName, fileSize)
+    );
+
+    this->removeFile(sourceFileName);
+    delete[] data;
+
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
@@ -187,6 +908,10 @@ namespace Svc {
         U32 size
     )
   {
+    if (not this->buffersAvailable) {
+      Fw::Buffer buffer(MANAGER_ID, BUFFER_ID, 0, 0);
+      return buffer;
+    }
     U8 *const data = new U8[size];
     Fw::Buffer buffer(
         MANAGER_ID,
@@ -289,6 +1014,12 @@ namespace Svc {
         this->get_from_pingOut(0)
     );
 
+    // schedIn
+    this->connect_to_schedIn(
+        0,
+        this->component.get_schedIn_InputPort(0)
+    );
+
   }
 
   void Tester ::
@@ -302,14 +1033,11 @@ namespace Svc {
   }
 
   void Tester ::
-    sendFile(
+    queueFile(
         const char *const sourceFileName,
-        const char *const destFileName,
-        const Fw::CommandResponse response
+        const char *const destFileName
     )
   {
-
-    // Command the File Downlink component to send the file
     Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
     Fw::CmdStringArg destCmdStringArg(destFileName);
     this->sendCmd_FileDownlink_SendFile(
@@ -319,6 +1047,41 @@ namespace Svc {
         destCmdStringArg
     );
     this->component.doDispatch();
+  }
+
+  void Tester ::
+    runCycle(void)
+  {
+    this->invoke_to_schedIn(0, 0);
+    this->component.doDispatch();
+  }
+
+  void Tester ::
+    runUntilResponse(void)
+  {
+    const U32 responses = this->cmdResponseHistory->size();
+    for (U32 cycle = 0; cycle < MAX_CYCLES; ++cycle) {
+      if (this->cmdResponseHistory->size() > responses) {
+        return;
+      }
+      this->runCycle();
+    }
+    FAIL() << "No command response after " << MAX_CYCLES << " cycles";
+  }
+
+  void Tester ::
+    sendFile(
+        const char *const sourceFileName,
+        const char *const destFileName,
+        const Fw::CommandResponse response
+    )
+  {
+
+    // Command the File Downlink component to send the file
+    this->queueFile(sourceFileName, destFileName);
+
+    // Run the downlink
+    this->runUntilResponse();
 
     // Assert command response
     ASSERT_CMD_RESPONSE_SIZE(1);
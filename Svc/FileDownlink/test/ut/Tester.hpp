@@ -119,6 +119,47 @@ namespace Svc {
       //!
       void cancelInIdleMode(void);
 
+      //! Fill the file queue and send one more file
+      //!
+      void queueFull(void);
+
+      //! Queue two files and downlink them in order
+      //!
+      void queueTwoFiles(void);
+
+      //! Downlink a file with packet and byte limits per cycle
+      //!
+      void pacing(void);
+
+      //! Downlink a file when buffers are briefly unavailable
+      //!
+      void bufferUnavailable(void);
+
+      //! Send two byte ranges of a file and check that their
+      //! checksums add up to the checksum of the file
+      //!
+      void sendPartial(void);
+
+      //! Resend data packets that cover a byte range
+      //! Request a resend past the end of the file
+      //!
+      void resend(void);
+
+      //! Resend packets of a file that is larger than the read-ahead
+      //! buffer, including a packet that crosses a buffer boundary
+      //!
+      void readAhead(void);
+
+      //! Send a compressed copy of a file and check that the data
+      //! packets decompress to the file. Then send a file that does
+      //! not exist, and a file whose staged name is taken
+      //!
+      void sendCompressed(void);
+
+      //! Cancel a SendCompressed command while the file is compressed
+      //!
+      void cancelCompression(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -163,7 +204,23 @@ namespace Svc {
       void initComponents(void);
 
       //! Command the FileDownlink component to send a file
-      //! Assert a command response
+      //! Do not run the downlink
+      //!
+      void queueFile(
+          const char *const sourceFileName, //!< The source file name
+          const char *const destFileName //!< The destination file name
+      );
+
+      //! Invoke schedIn and dispatch the call
+      //!
+      void runCycle(void);
+
+      //! Run cycles until there is a command response
+      //!
+      void runUntilResponse(void);
+
+      //! Command the FileDownlink component to send a file
+      //! Run the downlink and assert a command response
       //!
       void sendFile(
           const char *const sourceFileName, //!< The source file name
@@ -254,6 +311,10 @@ namespace Svc {
       //!
       U32 sequenceIndex;
 
+      //! Whether from_bufferGetCaller returns a buffer
+      //!
+      bool buffersAvailable;
+
   };
 
 } // end namespace Svc
@@ -24,6 +24,7 @@ TEST_MODS= \
 	Os \
 	Fw/Obj \
 	Utils/Hash \
+	Utils/Lz \
 	CFDP/Checksum \
 	Fw/Types \
 	gtest
@@ -0,0 +1,6 @@
+# ---------------------------------------------------------------------- 
+# mod.mk
+# ---------------------------------------------------------------------- 
+
+SRC = FileIoRequestPortAi.xml \
+      FileIoCompletePortAi.xml
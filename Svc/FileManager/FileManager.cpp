@@ -12,6 +12,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "Svc/FileManager/FileManager.hpp"
 #include "Fw/Types/Assert.hpp"
@@ -29,7 +30,10 @@ namespace Svc {
     ) :
       FileManagerComponentBase(compName),
       commandCount(0),
-      errorCount(0)
+      errorCount(0),
+      workerStarted(false),
+      jobActive(false),
+      listBufferUsed(0)
   {
 
   }
@@ -49,6 +53,49 @@ namespace Svc {
 
   }
 
+  void FileManager ::
+    startWorker(
+        const NATIVE_INT_TYPE identifier,
+        const NATIVE_INT_TYPE priority,
+        const NATIVE_INT_TYPE stackSize
+    )
+  {
+    FW_ASSERT(!this->workerStarted);
+
+    char name[40];
+    (void) snprintf(name, sizeof(name), "FMWQ_%d", identifier);
+    // One job runs at a time, so the queue holds it and the stop token
+    const Os::Queue::QueueStatus qStat = this->workerQueue.create(
+        Fw::EightyCharString(name), 2, sizeof(NATIVE_UINT_TYPE)
+    );
+    FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+
+    (void) snprintf(name, sizeof(name), "FMWK_%d", identifier);
+    const Os::Task::TaskStatus tStat = this->workerTask.start(
+        Fw::EightyCharString(name), identifier, priority, stackSize,
+        FileManager::workerTaskEntry, this
+    );
+    FW_ASSERT(Os::Task::TASK_OK == tStat, tStat);
+    this->workerStarted = true;
+  }
+
+  void FileManager ::
+    stopWorker(void)
+  {
+    if (!this->workerStarted) {
+      return;
+    }
+    const NATIVE_UINT_TYPE stop = WORKER_STOP;
+    const Os::Queue::QueueStatus qStat = this->workerQueue.send(
+        reinterpret_cast<const U8*>(&stop), sizeof(stop), 0,
+        Os::Queue::QUEUE_NONBLOCKING
+    );
+    FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+    const Os::Task::TaskStatus tStat = this->workerTask.join(NULL);
+    FW_ASSERT(Os::Task::TASK_OK == tStat, tStat);
+    this->workerStarted = false;
+  }
+
   // ----------------------------------------------------------------------
   // Command handler implementations 
   // ----------------------------------------------------------------------
@@ -145,27 +192,66 @@ namespace Svc {
         const Fw::CmdStringArg& logFileName
     )
   {
-    NATIVE_INT_TYPE status = 
-      this->systemCall(command, logFileName);
-    Fw::LogStringArg logStringCommand(command.toChar());
-    if (status == 0) {
-      this->log_ACTIVITY_HI_ShellCommandSucceeded(
-          logStringCommand
-      );
+    if (!this->claimWorker(opCode, cmdSeq, "ShellCommand")) {
+      return;
     }
-    else {
-      this->log_WARNING_HI_ShellCommandFailed(
-          logStringCommand, status
-      );
+    this->job.type = JOB_SHELL_COMMAND;
+    this->job.name = command;
+    this->job.otherName = logFileName;
+    this->submitJob();
+  }
+
+  void FileManager ::
+    CopyFile_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName
+    )
+  {
+    if (!this->claimWorker(opCode, cmdSeq, "CopyFile")) {
+      return;
     }
-    this->emitTelemetry(
-        status == 0 ? Os::FileSystem::OP_OK : Os::FileSystem::OTHER_ERROR
-    );
-    this->sendCommandResponse(
-        opCode, 
-        cmdSeq, 
-        status == 0 ? Os::FileSystem::OP_OK : Os::FileSystem::OTHER_ERROR
-    );
+    this->job.type = JOB_COPY_FILE;
+    this->job.name = sourceFileName;
+    this->job.otherName = destFileName;
+    this->submitJob();
+  }
+
+  void FileManager ::
+    ListDirectory_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& dirName,
+        U32 startIndex,
+        U32 maxEntries
+    )
+  {
+    if (!this->claimWorker(opCode, cmdSeq, "ListDirectory")) {
+      return;
+    }
+    this->job.type = JOB_LIST_DIRECTORY;
+    this->job.name = dirName;
+    this->job.startIndex = startIndex;
+    this->job.maxEntries = maxEntries;
+    this->submitJob();
+  }
+
+  void FileManager ::
+    ListDirectoryToFile_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& dirName,
+        const Fw::CmdStringArg& listFileName
+    )
+  {
+    if (!this->claimWorker(opCode, cmdSeq, "ListDirectoryToFile")) {
+      return;
+    }
+    this->job.type = JOB_LIST_DIRECTORY_TO_FILE;
+    this->job.name = dirName;
+    this->job.otherName = listFileName;
+    this->submitJob();
   }
 
   void FileManager ::
@@ -177,10 +263,322 @@ namespace Svc {
       // return key
       this->pingOut_out(0,key);
   }
+
+  // ----------------------------------------------------------------------
+  // Internal interface handler implementations
+  // ----------------------------------------------------------------------
+
+  void FileManager ::
+    jobDone_internalInterfaceHandler(I32 status)
+  {
+    this->finishJob(status);
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods 
   // ----------------------------------------------------------------------
 
+  bool FileManager ::
+    claimWorker(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const char *const commandName
+    )
+  {
+    if (this->jobActive) {
+      Fw::LogStringArg logStringCommand(commandName);
+      this->log_WARNING_LO_WorkerBusy(logStringCommand);
+      ++this->errorCount;
+      this->tlmWrite_Errors(this->errorCount);
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_BUSY);
+      return false;
+    }
+    this->jobActive = true;
+    this->job.opCode = opCode;
+    this->job.cmdSeq = cmdSeq;
+    this->job.startIndex = 0;
+    this->job.maxEntries = 0;
+    this->job.count = 0;
+    this->job.total = 0;
+    this->job.fileStatus = Os::File::OP_OK;
+    return true;
+  }
+
+  void FileManager ::
+    submitJob(void)
+  {
+    if (this->workerStarted) {
+      const NATIVE_UINT_TYPE run = WORKER_RUN;
+      const Os::Queue::QueueStatus qStat = this->workerQueue.send(
+          reinterpret_cast<const U8*>(&run), sizeof(run), 0,
+          Os::Queue::QUEUE_NONBLOCKING
+      );
+      FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+    }
+    else {
+      this->finishJob(this->runJob());
+    }
+  }
+
+  I32 FileManager ::
+    runJob(void)
+  {
+    I32 status = 0;
+    switch (this->job.type) {
+      case JOB_SHELL_COMMAND:
+        status = this->systemCall(this->job.name, this->job.otherName);
+        break;
+      case JOB_COPY_FILE:
+        this->tlmWrite_BytesCopied(0);
+        status = Os::FileSystem::copyFile(
+            this->job.name.toChar(),
+            this->job.otherName.toChar(),
+            FileManager::copyProgress,
+            this
+        );
+        break;
+      case JOB_LIST_DIRECTORY:
+        status = this->listDirectory();
+        break;
+      case JOB_LIST_DIRECTORY_TO_FILE:
+        status = this->listDirectoryToFile();
+        break;
+      default:
+        FW_ASSERT(0, this->job.type);
+        break;
+    }
+    return status;
+  }
+
+  void FileManager ::
+    finishJob(const I32 status)
+  {
+    FW_ASSERT(this->jobActive);
+    Os::FileSystem::Status fileSystemStatus =
+      static_cast<Os::FileSystem::Status>(status);
+    Fw::LogStringArg logStringName(this->job.name.toChar());
+    Fw::LogStringArg logStringOtherName(this->job.otherName.toChar());
+    switch (this->job.type) {
+      case JOB_SHELL_COMMAND:
+        if (status == 0) {
+          this->log_ACTIVITY_HI_ShellCommandSucceeded(logStringName);
+          fileSystemStatus = Os::FileSystem::OP_OK;
+        }
+        else {
+          this->log_WARNING_HI_ShellCommandFailed(logStringName, status);
+          fileSystemStatus = Os::FileSystem::OTHER_ERROR;
+        }
+        break;
+      case JOB_COPY_FILE:
+        if (fileSystemStatus != Os::FileSystem::OP_OK) {
+          this->log_WARNING_HI_FileCopyError(
+              logStringName, logStringOtherName, fileSystemStatus
+          );
+        }
+        break;
+      case JOB_LIST_DIRECTORY:
+        if (fileSystemStatus != Os::FileSystem::OP_OK) {
+          this->log_WARNING_HI_DirectoryListError(
+              logStringName, fileSystemStatus
+          );
+        }
+        else {
+          this->log_ACTIVITY_HI_DirectoryListed(
+              logStringName,
+              this->job.count,
+              this->job.startIndex,
+              this->job.total
+          );
+        }
+        break;
+      case JOB_LIST_DIRECTORY_TO_FILE:
+        if (fileSystemStatus != Os::FileSystem::OP_OK) {
+          this->log_WARNING_HI_DirectoryListError(
+              logStringName, fileSystemStatus
+          );
+        }
+        else if (this->job.fileStatus != Os::File::OP_OK) {
+          this->log_WARNING_HI_ListFileError(
+              logStringOtherName, this->job.fileStatus
+          );
+          fileSystemStatus = Os::FileSystem::OTHER_ERROR;
+        }
+        else {
+          this->log_ACTIVITY_HI_DirectoryListedToFile(
+              logStringName, logStringOtherName, this->job.total
+          );
+        }
+        break;
+      default:
+        FW_ASSERT(0, this->job.type);
+        break;
+    }
+    this->emitTelemetry(fileSystemStatus);
+    this->sendCommandResponse(
+        this->job.opCode, this->job.cmdSeq, fileSystemStatus
+    );
+    this->jobActive = false;
+  }
+
+  Os::FileSystem::Status FileManager ::
+    listDirectory(void)
+  {
+    Os::FileSystem::Status status =
+      this->directory.open(this->job.name.toChar());
+    if (status != Os::FileSystem::OP_OK) {
+      return status;
+    }
+    // Cap the page, so one command cannot flood the event log
+    const U32 maxEntries =
+      (this->job.maxEntries < FILEMANAGER_MAX_LIST_EVENTS) ?
+      this->job.maxEntries : static_cast<U32>(FILEMANAGER_MAX_LIST_EVENTS);
+    // Read to the end, so the total tells the ground how many pages
+    // there are
+    U32 index = 0;
+    while (true) {
+      const char* name = NULL;
+      Os::FileSystem::EntryType type = Os::FileSystem::ENTRY_OTHER;
+      status = this->directory.next(name, type);
+      if (status != Os::FileSystem::OP_OK || name == NULL) {
+        break;
+      }
+      if (index >= this->job.startIndex && this->job.count < maxEntries) {
+        Fw::LogStringArg logStringEntry(name);
+        if (type == Os::FileSystem::ENTRY_DIRECTORY) {
+          logStringEntry += "/";
+        }
+        this->log_ACTIVITY_LO_DirectoryEntry(index, logStringEntry);
+        ++this->job.count;
+      }
+      ++index;
+      if (index % FILEMANAGER_LIST_PROGRESS_ENTRIES == 0) {
+        this->tlmWrite_EntriesListed(index);
+      }
+    }
+    this->directory.close();
+    this->job.total = index;
+    this->tlmWrite_EntriesListed(index);
+    return status;
+  }
+
+  Os::FileSystem::Status FileManager ::
+    listDirectoryToFile(void)
+  {
+    Os::FileSystem::Status status =
+      this->directory.open(this->job.name.toChar());
+    if (status != Os::FileSystem::OP_OK) {
+      return status;
+    }
+    this->job.fileStatus = this->listFile.open(
+        this->job.otherName.toChar(),
+        Os::File::OPEN_CREATE
+    );
+    if (this->job.fileStatus != Os::File::OP_OK) {
+      this->directory.close();
+      return status;
+    }
+    this->listBufferUsed = 0;
+    U32 index = 0;
+    while (true) {
+      const char* name = NULL;
+      Os::FileSystem::EntryType type = Os::FileSystem::ENTRY_OTHER;
+      status = this->directory.next(name, type);
+      if (status != Os::FileSystem::OP_OK || name == NULL) {
+        break;
+      }
+      // Each line is the name, a / for a directory, and a newline
+      const U32 length = strlen(name);
+      const bool isDirectory = (type == Os::FileSystem::ENTRY_DIRECTORY);
+      const U32 lineSize = length + (isDirectory ? 2 : 1);
+      FW_ASSERT(lineSize <= sizeof(this->listBuffer), lineSize);
+      if (this->listBufferUsed + lineSize > sizeof(this->listBuffer) &&
+          !this->writeListBuffer()) {
+        break;
+      }
+      char *const line = &this->listBuffer[this->listBufferUsed];
+      memcpy(line, name, length);
+      if (isDirectory) {
+        line[length] = '/';
+      }
+      line[lineSize - 1] = '\n';
+      this->listBufferUsed += lineSize;
+      ++index;
+      if (index % FILEMANAGER_LIST_PROGRESS_ENTRIES == 0) {
+        this->tlmWrite_EntriesListed(index);
+      }
+    }
+    if (this->job.fileStatus == Os::File::OP_OK) {
+      (void) this->writeListBuffer();
+    }
+    this->listFile.close();
+    this->directory.close();
+    this->job.total = index;
+    this->tlmWrite_EntriesListed(index);
+    return status;
+  }
+
+  bool FileManager ::
+    writeListBuffer(void)
+  {
+    if (this->listBufferUsed == 0) {
+      return true;
+    }
+    NATIVE_INT_TYPE size = this->listBufferUsed;
+    const Os::File::Status fileStatus =
+      this->listFile.write(this->listBuffer, size, true);
+    const bool complete = (size == static_cast<NATIVE_INT_TYPE>(this->listBufferUsed));
+    this->listBufferUsed = 0;
+    if (fileStatus != Os::File::OP_OK) {
+      this->job.fileStatus = fileStatus;
+      return false;
+    }
+    if (!complete) {
+      this->job.fileStatus = Os::File::NO_SPACE;
+      return false;
+    }
+    return true;
+  }
+
+  void FileManager ::
+    copyProgress(
+        void* context,
+        U64 bytesCopied,
+        U64 totalBytes
+    )
+  {
+    FW_ASSERT(context != NULL);
+    static_cast<FileManager*>(context)->tlmWrite_BytesCopied(bytesCopied);
+  }
+
+  void FileManager ::
+    workerTaskEntry(void* ptr)
+  {
+    FW_ASSERT(ptr != NULL);
+    static_cast<FileManager*>(ptr)->runWorker();
+  }
+
+  void FileManager ::
+    runWorker(void)
+  {
+    while (true) {
+      NATIVE_UINT_TYPE token = WORKER_STOP;
+      NATIVE_INT_TYPE size = 0;
+      NATIVE_INT_TYPE priority = 0;
+      const Os::Queue::QueueStatus qStat = this->workerQueue.receive(
+          reinterpret_cast<U8*>(&token), sizeof(token), size, priority,
+          Os::Queue::QUEUE_BLOCKING
+      );
+      FW_ASSERT(Os::Queue::QUEUE_OK == qStat, qStat);
+      if (token == WORKER_STOP) {
+        break;
+      }
+      FW_ASSERT(token == WORKER_RUN, token);
+      // The component thread reports the result, so the counters and
+      // the command response stay on one thread
+      this->jobDone_internalInterfaceInvoke(this->runJob());
+    }
+  }
+
   NATIVE_INT_TYPE FileManager ::
     systemCall(
         const Fw::CmdStringArg& command,
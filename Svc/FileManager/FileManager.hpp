@@ -15,6 +15,10 @@
 
 #include "Svc/FileManager/FileManagerComponentAc.hpp"
 #include "Os/FileSystem.hpp"
+#include "Os/File.hpp"
+#include "Os/Queue.hpp"
+#include "Os/Task.hpp"
+#include "Svc/FileManager/FileManagerCfg.hpp"
 
 namespace Svc {
 
@@ -45,6 +49,22 @@ namespace Svc {
       //!
       ~FileManager(void);
 
+      //! Start the worker task. ShellCommand, CopyFile, and the listing
+      //! commands then run on it, so the command queue keeps being
+      //! serviced while they run. Without the worker they run in the
+      //! command handler
+      //!
+      void startWorker(
+          const NATIVE_INT_TYPE identifier, //!< The identifier for the worker task
+          const NATIVE_INT_TYPE priority, //!< The worker task priority
+          const NATIVE_INT_TYPE stackSize //!< The worker task stack size
+      );
+
+      //! Stop the worker task, after the operation in progress finishes.
+      //! Call after the component thread has exited
+      //!
+      void stopWorker(void);
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -93,6 +113,34 @@ namespace Svc {
           const Fw::CmdStringArg& logFileName //!< The name of the log file
       );
 
+      //! Implementation for CopyFile command handler
+      //!
+      void CopyFile_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& sourceFileName, //!< The source file name
+          const Fw::CmdStringArg& destFileName //!< The destination file name
+      );
+
+      //! Implementation for ListDirectory command handler
+      //!
+      void ListDirectory_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& dirName, //!< The directory to list
+          U32 startIndex, //!< The index of the first entry to list
+          U32 maxEntries //!< The most entries to list
+      );
+
+      //! Implementation for ListDirectoryToFile command handler
+      //!
+      void ListDirectoryToFile_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          const Fw::CmdStringArg& dirName, //!< The directory to list
+          const Fw::CmdStringArg& listFileName //!< The file to write the listing to
+      );
+
       //! Handler implementation for pingIn
       //!
       void pingIn_handler(
@@ -100,6 +148,56 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Internal interface handler implementations
+      // ----------------------------------------------------------------------
+
+      //! Handler implementation for jobDone
+      //!
+      void jobDone_internalInterfaceHandler(
+          I32 status //!< The status of the operation
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Types
+      // ----------------------------------------------------------------------
+
+      //! The operations that run on the worker
+      //!
+      typedef enum {
+        JOB_SHELL_COMMAND,
+        JOB_COPY_FILE,
+        JOB_LIST_DIRECTORY,
+        JOB_LIST_DIRECTORY_TO_FILE
+      } JobType;
+
+      //! The tokens sent to the worker
+      //!
+      typedef enum {
+        WORKER_RUN,
+        WORKER_STOP
+      } WorkerToken;
+
+      //! An operation for the worker. The worker only touches it between
+      //! the command handler that starts it and jobDone
+      //!
+      struct Job {
+        JobType type; //!< The operation
+        FwOpcodeType opCode; //!< The opcode of the command
+        U32 cmdSeq; //!< The sequence number of the command
+        Fw::CmdStringArg name; //!< The command, source file, or directory
+        Fw::CmdStringArg otherName; //!< The log, destination, or listing file
+        U32 startIndex; //!< The index of the first entry to list
+        U32 maxEntries; //!< The most entries to list
+        U32 count; //!< The entries listed
+        U32 total; //!< The entries in the directory
+        Os::File::Status fileStatus; //!< The status of the listing file
+      };
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -113,6 +211,62 @@ namespace Svc {
           const Fw::CmdStringArg& logFileName //!< The log file name
       ) const;
 
+      //! Claim the worker for a command
+      //! \return Whether the worker was free. If not, the command is
+      //! rejected
+      //!
+      bool claimWorker(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence value
+          const char *const commandName //!< The command name
+      );
+
+      //! Run the job on the worker, or here if there is no worker
+      //!
+      void submitJob(void);
+
+      //! Run the job
+      //! \return The status of the operation
+      //!
+      I32 runJob(void);
+
+      //! Report the result of the job and respond to its command
+      //!
+      void finishJob(
+          const I32 status //!< The status of the operation
+      );
+
+      //! List a page of the job directory as events
+      //!
+      Os::FileSystem::Status listDirectory(void);
+
+      //! List the job directory to the job listing file
+      //!
+      Os::FileSystem::Status listDirectoryToFile(void);
+
+      //! Write the collected listing lines to the listing file
+      //! \return Whether the write succeeded
+      //!
+      bool writeListBuffer(void);
+
+      //! Report copyFile progress as telemetry
+      //!
+      static void copyProgress(
+          void* context, //!< The FileManager
+          U64 bytesCopied, //!< The bytes copied
+          U64 totalBytes //!< The size of the file
+      );
+
+      //! The worker task entry point
+      //!
+      static void workerTaskEntry(
+          void* ptr //!< The FileManager
+      );
+
+      //! Run jobs until the worker is stopped
+      //!
+      void runWorker(void);
+
       //! Emit telemetry based on status
       //!
       void emitTelemetry(
@@ -141,6 +295,41 @@ namespace Svc {
       //!
       U32 errorCount;
 
+      //! The queue of worker tokens
+      //!
+      Os::Queue workerQueue;
+
+      //! The worker task
+      //!
+      Os::Task workerTask;
+
+      //! Whether the worker task is running
+      //!
+      bool workerStarted;
+
+      //! Whether a job is in progress
+      //!
+      bool jobActive;
+
+      //! The job in progress
+      //!
+      Job job;
+
+      //! The directory being listed
+      //!
+      Os::FileSystem::DirectoryIterator directory;
+
+      //! The listing file
+      //!
+      Os::File listFile;
+
+      //! The listing lines waiting to be written
+      //!
+      char listBuffer[FILEMANAGER_LIST_BUFFER_SIZE];
+
+      //! The bytes used in listBuffer
+      //!
+      U32 listBufferUsed;
 
   };
 
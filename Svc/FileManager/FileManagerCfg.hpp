@@ -0,0 +1,21 @@
+/*
+ * FileManagerCfg.hpp
+ *
+ *  Configuration for the FileManager component
+ */
+
+#ifndef FILEMANAGER_FILEMANAGERCFG_HPP_
+#define FILEMANAGER_FILEMANAGERCFG_HPP_
+
+// Anonymous namespace for configuration parameters
+namespace {
+
+    enum {
+        FILEMANAGER_MAX_LIST_EVENTS = 100, // !< Most DirectoryEntry events emitted by one ListDirectory command
+        FILEMANAGER_LIST_PROGRESS_ENTRIES = 1000, // !< Directory entries read between EntriesListed updates
+        FILEMANAGER_LIST_BUFFER_SIZE = 4096 // !< Size of the buffer lines are collected in by ListDirectoryToFile
+    };
+
+}
+
+#endif /* FILEMANAGER_FILEMANAGERCFG_HPP_ */
@@ -15,6 +15,6 @@
 
 SRC = FileManagerComponentAi.xml FileManager.cpp
 
-HDR = FileManager.hpp
+HDR = FileManager.hpp FileManagerCfg.hpp
 
 SUBDIRS = test
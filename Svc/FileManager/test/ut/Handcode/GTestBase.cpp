@@ -232,6 +232,106 @@ namespace Svc {
       << "  Actual:   " << e.arg << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Channel: BytesCopied
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertTlm_BytesCopied_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BytesCopied->size(), size)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BytesCopied\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BytesCopied->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertTlm_BytesCopied(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U64& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_BytesCopied->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BytesCopied\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BytesCopied->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_BytesCopied& e =
+      this->tlmHistory_BytesCopied->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel BytesCopied\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: EntriesListed
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertTlm_EntriesListed_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_EntriesListed->size(), size)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel EntriesListed\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_EntriesListed->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertTlm_EntriesListed(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_EntriesListed->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel EntriesListed\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_EntriesListed->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_EntriesListed& e =
+      this->tlmHistory_EntriesListed->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel EntriesListed\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // Events
   // ----------------------------------------------------------------------
@@ -606,4 +706,447 @@ namespace Svc {
       << "  Actual:   " << e.command.toChar() << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Event: FileCopyError
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertEvents_FileCopyError_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileCopyError->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileCopyError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileCopyError->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertEvents_FileCopyError(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const char *const sourceFileName,
+        const char *const destFileName,
+        const U32 status
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileCopyError->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileCopyError\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileCopyError->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileCopyError& e =
+      this->eventHistory_FileCopyError->at(index);
+    ASSERT_STREQ(sourceFileName, e.sourceFileName.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument sourceFileName at index "
+      << index
+      << " in history of event FileCopyError\n"
+      << "  Expected: " << sourceFileName << "\n"
+      << "  Actual:   " << e.sourceFileName.toChar() << "\n";
+    ASSERT_STREQ(destFileName, e.destFileName.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument destFileName at index "
+      << index
+      << " in history of event FileCopyError\n"
+      << "  Expected: " << destFileName << "\n"
+      << "  Actual:   " << e.destFileName.toChar() << "\n";
+    ASSERT_EQ(status, e.status)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument status at index "
+      << index
+      << " in history of event FileCopyError\n"
+      << "  Expected: " << status << "\n"
+      << "  Actual:   " << e.status << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryListError
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryListError_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_DirectoryListError->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DirectoryListError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_DirectoryListError->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryListError(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const char *const dirName,
+        const U32 status
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_DirectoryListError->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event DirectoryListError\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_DirectoryListError->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_DirectoryListError& e =
+      this->eventHistory_DirectoryListError->at(index);
+    ASSERT_STREQ(dirName, e.dirName.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument dirName at index "
+      << index
+      << " in history of event DirectoryListError\n"
+      << "  Expected: " << dirName << "\n"
+      << "  Actual:   " << e.dirName.toChar() << "\n";
+    ASSERT_EQ(status, e.status)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument status at index "
+      << index
+      << " in history of event DirectoryListError\n"
+      << "  Expected: " << status << "\n"
+      << "  Actual:   " << e.status << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: ListFileError
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertEvents_ListFileError_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_ListFileError->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event ListFileError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_ListFileError->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertEvents_ListFileError(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const char *const fileName,
+        const U32 status
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_ListFileError->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event ListFileError\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_ListFileError->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_ListFileError& e =
+      this->eventHistory_ListFileError->at(index);
+    ASSERT_STREQ(fileName, e.fileName.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileName at index "
+      << index
+      << " in history of event ListFileError\n"
+      << "  Expected: " << fileName << "\n"
+      << "  Actual:   " << e.fileName.toChar() << "\n";
+    ASSERT_EQ(status, e.status)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument status at index "
+      << index
+      << " in history of event ListFileError\n"
+      << "  Expected: " << status << "\n"
+      << "  Actual:   " << e.status << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryEntry
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryEntry_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_DirectoryEntry->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DirectoryEntry\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_DirectoryEntry->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryEntry(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32 index,
+        const char *const name
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_DirectoryEntry->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event DirectoryEntry\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_DirectoryEntry->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_DirectoryEntry& e =
+      this->eventHistory_DirectoryEntry->at(index);
+    ASSERT_EQ(index, e.index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument index at index "
+      << index
+      << " in history of event DirectoryEntry\n"
+      << "  Expected: " << index << "\n"
+      << "  Actual:   " << e.index << "\n";
+    ASSERT_STREQ(name, e.name.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument name at index "
+      << index
+      << " in history of event DirectoryEntry\n"
+      << "  Expected: " << name << "\n"
+      << "  Actual:   " << e.name.toChar() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryListed
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryListed_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_DirectoryListed->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DirectoryListed\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_DirectoryListed->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryListed(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const char *const dirName,
+        const U32 count,
+        const U32 startIndex,
+        const U32 total
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_DirectoryListed->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event DirectoryListed\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_DirectoryListed->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_DirectoryListed& e =
+      this->eventHistory_DirectoryListed->at(index);
+    ASSERT_STREQ(dirName, e.dirName.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument dirName at index "
+      << index
+      << " in history of event DirectoryListed\n"
+      << "  Expected: " << dirName << "\n"
+      << "  Actual:   " << e.dirName.toChar() << "\n";
+    ASSERT_EQ(count, e.count)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument count at index "
+      << index
+      << " in history of event DirectoryListed\n"
+      << "  Expected: " << count << "\n"
+      << "  Actual:   " << e.count << "\n";
+    ASSERT_EQ(startIndex, e.startIndex)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument startIndex at index "
+      << index
+      << " in history of event DirectoryListed\n"
+      << "  Expected: " << startIndex << "\n"
+      << "  Actual:   " << e.startIndex << "\n";
+    ASSERT_EQ(total, e.total)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument total at index "
+      << index
+      << " in history of event DirectoryListed\n"
+      << "  Expected: " << total << "\n"
+      << "  Actual:   " << e.total << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryListedToFile
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryListedToFile_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_DirectoryListedToFile->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DirectoryListedToFile\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_DirectoryListedToFile->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertEvents_DirectoryListedToFile(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const char *const dirName,
+        const char *const fileName,
+        const U32 total
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_DirectoryListedToFile->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event DirectoryListedToFile\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_DirectoryListedToFile->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_DirectoryListedToFile& e =
+      this->eventHistory_DirectoryListedToFile->at(index);
+    ASSERT_STREQ(dirName, e.dirName.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument dirName at index "
+      << index
+      << " in history of event DirectoryListedToFile\n"
+      << "  Expected: " << dirName << "\n"
+      << "  Actual:   " << e.dirName.toChar() << "\n";
+    ASSERT_STREQ(fileName, e.fileName.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileName at index "
+      << index
+      << " in history of event DirectoryListedToFile\n"
+      << "  Expected: " << fileName << "\n"
+      << "  Actual:   " << e.fileName.toChar() << "\n";
+    ASSERT_EQ(total, e.total)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument total at index "
+      << index
+      << " in history of event DirectoryListedToFile\n"
+      << "  Expected: " << total << "\n"
+      << "  Actual:   " << e.total << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: WorkerBusy
+  // ----------------------------------------------------------------------
+
+  void FileManagerGTestBase ::
+    assertEvents_WorkerBusy_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_WorkerBusy->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event WorkerBusy\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_WorkerBusy->size() << "\n";
+  }
+
+  void FileManagerGTestBase ::
+    assertEvents_WorkerBusy(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const char *const command
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_WorkerBusy->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event WorkerBusy\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_WorkerBusy->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_WorkerBusy& e =
+      this->eventHistory_WorkerBusy->at(index);
+    ASSERT_STREQ(command, e.command.toChar())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument command at index "
+      << index
+      << " in history of event WorkerBusy\n"
+      << "  Expected: " << command << "\n"
+      << "  Actual:   " << e.command.toChar() << "\n";
+  }
+
 } // end namespace Svc
@@ -45,6 +45,18 @@
 #define ASSERT_TLM_Errors(index, value) \
   this->assertTlm_Errors(__FILE__, __LINE__, index, value)
 
+#define ASSERT_TLM_BytesCopied_SIZE(size) \
+  this->assertTlm_BytesCopied_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BytesCopied(index, value) \
+  this->assertTlm_BytesCopied(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_EntriesListed_SIZE(size) \
+  this->assertTlm_EntriesListed_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_EntriesListed(index, value) \
+  this->assertTlm_EntriesListed(__FILE__, __LINE__, index, value)
+
 // ----------------------------------------------------------------------
 // Macros for event history assertions 
 // ----------------------------------------------------------------------
@@ -88,6 +100,48 @@
 #define ASSERT_EVENTS_ShellCommandSucceeded(index, _command) \
   this->assertEvents_ShellCommandSucceeded(__FILE__, __LINE__, index, _command)
 
+#define ASSERT_EVENTS_FileCopyError_SIZE(size) \
+  this->assertEvents_FileCopyError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileCopyError(index, _sourceFileName, _destFileName, _status) \
+  this->assertEvents_FileCopyError(__FILE__, __LINE__, index, _sourceFileName, _destFileName, _status)
+
+#define ASSERT_EVENTS_DirectoryListError_SIZE(size) \
+  this->assertEvents_DirectoryListError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DirectoryListError(index, _dirName, _status) \
+  this->assertEvents_DirectoryListError(__FILE__, __LINE__, index, _dirName, _status)
+
+#define ASSERT_EVENTS_ListFileError_SIZE(size) \
+  this->assertEvents_ListFileError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_ListFileError(index, _fileName, _status) \
+  this->assertEvents_ListFileError(__FILE__, __LINE__, index, _fileName, _status)
+
+#define ASSERT_EVENTS_DirectoryEntry_SIZE(size) \
+  this->assertEvents_DirectoryEntry_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DirectoryEntry(index, _index, _name) \
+  this->assertEvents_DirectoryEntry(__FILE__, __LINE__, index, _index, _name)
+
+#define ASSERT_EVENTS_DirectoryListed_SIZE(size) \
+  this->assertEvents_DirectoryListed_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DirectoryListed(index, _dirName, _count, _startIndex, _total) \
+  this->assertEvents_DirectoryListed(__FILE__, __LINE__, index, _dirName, _count, _startIndex, _total)
+
+#define ASSERT_EVENTS_DirectoryListedToFile_SIZE(size) \
+  this->assertEvents_DirectoryListedToFile_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DirectoryListedToFile(index, _dirName, _fileName, _total) \
+  this->assertEvents_DirectoryListedToFile(__FILE__, __LINE__, index, _dirName, _fileName, _total)
+
+#define ASSERT_EVENTS_WorkerBusy_SIZE(size) \
+  this->assertEvents_WorkerBusy_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_WorkerBusy(index, _command) \
+  this->assertEvents_WorkerBusy(__FILE__, __LINE__, index, _command)
+
 namespace Svc {
 
   //! \class FileManagerGTestBase
@@ -199,6 +253,48 @@ namespace Svc {
           const U32& val /*!< The channel value*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BytesCopied
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BytesCopied_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BytesCopied(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U64& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: EntriesListed
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_EntriesListed_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_EntriesListed(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -331,6 +427,149 @@ namespace Svc {
           const char *const command /*!< The command string*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileCopyError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileCopyError_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileCopyError(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const sourceFileName, /*!< The name of the source file*/
+          const char *const destFileName, /*!< The name of the destination file*/
+          const U32 status /*!< The error status*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryListError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DirectoryListError_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_DirectoryListError(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const dirName, /*!< The name of the directory*/
+          const U32 status /*!< The error status*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: ListFileError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_ListFileError_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_ListFileError(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const fileName, /*!< The name of the listing file*/
+          const U32 status /*!< The error status*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryEntry
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DirectoryEntry_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_DirectoryEntry(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32 index, /*!< The index of the entry*/
+          const char *const name /*!< The name of the entry, ending in / for a directory*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryListed
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DirectoryListed_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_DirectoryListed(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const dirName, /*!< The name of the directory*/
+          const U32 count, /*!< The number of entries listed*/
+          const U32 startIndex, /*!< The index of the first entry listed*/
+          const U32 total /*!< The number of entries in the directory*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryListedToFile
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DirectoryListedToFile_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_DirectoryListedToFile(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const dirName, /*!< The name of the directory*/
+          const char *const fileName, /*!< The name of the listing file*/
+          const U32 total /*!< The number of entries in the directory*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: WorkerBusy
+      // ----------------------------------------------------------------------
+
+      void assertEvents_WorkerBusy_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_WorkerBusy(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const command /*!< The command that was rejected*/
+      ) const;
+
   };
 
 } // end namespace Svc
@@ -42,6 +42,10 @@ namespace Svc {
       new History<TlmEntry_CommandsExecuted>(maxHistorySize);
     this->tlmHistory_Errors = 
       new History<TlmEntry_Errors>(maxHistorySize);
+    this->tlmHistory_BytesCopied = 
+      new History<TlmEntry_BytesCopied>(maxHistorySize);
+    this->tlmHistory_EntriesListed = 
+      new History<TlmEntry_EntriesListed>(maxHistorySize);
     // Initialize event histories
 #if FW_ENABLE_TEXT_LOGGING
     this->textLogHistory = new History<TextLogEntry>(maxHistorySize);
@@ -58,6 +62,20 @@ namespace Svc {
       new History<EventEntry_ShellCommandFailed>(maxHistorySize);
     this->eventHistory_ShellCommandSucceeded =
       new History<EventEntry_ShellCommandSucceeded>(maxHistorySize);
+    this->eventHistory_FileCopyError =
+      new History<EventEntry_FileCopyError>(maxHistorySize);
+    this->eventHistory_DirectoryListError =
+      new History<EventEntry_DirectoryListError>(maxHistorySize);
+    this->eventHistory_ListFileError =
+      new History<EventEntry_ListFileError>(maxHistorySize);
+    this->eventHistory_DirectoryEntry =
+      new History<EventEntry_DirectoryEntry>(maxHistorySize);
+    this->eventHistory_DirectoryListed =
+      new History<EventEntry_DirectoryListed>(maxHistorySize);
+    this->eventHistory_DirectoryListedToFile =
+      new History<EventEntry_DirectoryListedToFile>(maxHistorySize);
+    this->eventHistory_WorkerBusy =
+      new History<EventEntry_WorkerBusy>(maxHistorySize);
     // Clear history
     this->clearHistory();
   }
@@ -70,6 +88,8 @@ namespace Svc {
     // Destroy telemetry histories
     delete this->tlmHistory_CommandsExecuted;
     delete this->tlmHistory_Errors;
+    delete this->tlmHistory_BytesCopied;
+    delete this->tlmHistory_EntriesListed;
     // Destroy event histories
 #if FW_ENABLE_TEXT_LOGGING
     delete this->textLogHistory;
@@ -80,6 +100,13 @@ namespace Svc {
     delete this->eventHistory_FileRemoveError;
     delete this->eventHistory_ShellCommandFailed;
     delete this->eventHistory_ShellCommandSucceeded;
+    delete this->eventHistory_FileCopyError;
+    delete this->eventHistory_DirectoryListError;
+    delete this->eventHistory_ListFileError;
+    delete this->eventHistory_DirectoryEntry;
+    delete this->eventHistory_DirectoryListed;
+    delete this->eventHistory_DirectoryListedToFile;
+    delete this->eventHistory_WorkerBusy;
   }
 
   void FileManagerTesterBase ::
@@ -689,6 +716,132 @@ namespace Svc {
 
   }
 
+  // ---------------------------------------------------------------------- 
+  // Command: CopyFile
+  // ---------------------------------------------------------------------- 
+
+  void FileManagerTesterBase ::
+    sendCmd_CopyFile(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& sourceFileName,
+        const Fw::CmdStringArg& destFileName
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize(sourceFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(destFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = FileManagerComponentBase::OPCODE_COPYFILE + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Command: ListDirectory
+  // ---------------------------------------------------------------------- 
+
+  void FileManagerTesterBase ::
+    sendCmd_ListDirectory(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& dirName,
+        const U32 startIndex,
+        const U32 maxEntries
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize(dirName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(startIndex);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(maxEntries);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = FileManagerComponentBase::OPCODE_LISTDIRECTORY + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Command: ListDirectoryToFile
+  // ---------------------------------------------------------------------- 
+
+  void FileManagerTesterBase ::
+    sendCmd_ListDirectoryToFile(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        const Fw::CmdStringArg& dirName,
+        const Fw::CmdStringArg& listFileName
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize(dirName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+    _status = buff.serialize(listFileName);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = FileManagerComponentBase::OPCODE_LISTDIRECTORYTOFILE + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
   
   void FileManagerTesterBase ::
     sendRawCmd(FwOpcodeType opcode, U32 cmdSeq, Fw::CmdArgBuffer& args) {
@@ -774,6 +927,30 @@ namespace Svc {
         break;
       }
 
+      case FileManagerComponentBase::CHANNELID_BYTESCOPIED:
+      {
+        U64 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BytesCopied: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BytesCopied(timeTag, arg);
+        break;
+      }
+
+      case FileManagerComponentBase::CHANNELID_ENTRIESLISTED:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing EntriesListed: %d\n", _status);
+          return;
+        }
+        this->tlmInput_EntriesListed(timeTag, arg);
+        break;
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -789,6 +966,8 @@ namespace Svc {
     this->tlmSize = 0;
     this->tlmHistory_CommandsExecuted->clear();
     this->tlmHistory_Errors->clear();
+    this->tlmHistory_BytesCopied->clear();
+    this->tlmHistory_EntriesListed->clear();
   }
 
   // ---------------------------------------------------------------------- 
@@ -821,6 +1000,36 @@ namespace Svc {
     ++this->tlmSize;
   }
 
+  // ---------------------------------------------------------------------- 
+  // Channel: BytesCopied
+  // ---------------------------------------------------------------------- 
+
+  void FileManagerTesterBase ::
+    tlmInput_BytesCopied(
+        const Fw::Time& timeTag,
+        const U64& val
+    )
+  {
+    TlmEntry_BytesCopied e = { timeTag, val };
+    this->tlmHistory_BytesCopied->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: EntriesListed
+  // ---------------------------------------------------------------------- 
+
+  void FileManagerTesterBase ::
+    tlmInput_EntriesListed(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_EntriesListed e = { timeTag, val };
+    this->tlmHistory_EntriesListed->push_back(e);
+    ++this->tlmSize;
+  }
+
   // ----------------------------------------------------------------------
   // Event dispatch
   // ----------------------------------------------------------------------
@@ -984,6 +1193,195 @@ namespace Svc {
 
       }
 
+      case FileManagerComponentBase::EVENTID_FILECOPYERROR: 
+      {
+
+        Fw::SerializeStatus _status;
+        Fw::LogStringArg sourceFileName;
+        _status = args.deserialize(sourceFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        Fw::LogStringArg destFileName;
+        _status = args.deserialize(destFileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 status;
+        _status = args.deserialize(status);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileCopyError(sourceFileName, destFileName, status);
+
+        break;
+
+      }
+
+      case FileManagerComponentBase::EVENTID_DIRECTORYLISTERROR: 
+      {
+
+        Fw::SerializeStatus _status;
+        Fw::LogStringArg dirName;
+        _status = args.deserialize(dirName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 status;
+        _status = args.deserialize(status);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_DirectoryListError(dirName, status);
+
+        break;
+
+      }
+
+      case FileManagerComponentBase::EVENTID_LISTFILEERROR: 
+      {
+
+        Fw::SerializeStatus _status;
+        Fw::LogStringArg fileName;
+        _status = args.deserialize(fileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 status;
+        _status = args.deserialize(status);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_ListFileError(fileName, status);
+
+        break;
+
+      }
+
+      case FileManagerComponentBase::EVENTID_DIRECTORYENTRY: 
+      {
+
+        Fw::SerializeStatus _status;
+        U32 index;
+        _status = args.deserialize(index);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        Fw::LogStringArg name;
+        _status = args.deserialize(name);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_LO_DirectoryEntry(index, name);
+
+        break;
+
+      }
+
+      case FileManagerComponentBase::EVENTID_DIRECTORYLISTED: 
+      {
+
+        Fw::SerializeStatus _status;
+        Fw::LogStringArg dirName;
+        _status = args.deserialize(dirName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 count;
+        _status = args.deserialize(count);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 startIndex;
+        _status = args.deserialize(startIndex);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 total;
+        _status = args.deserialize(total);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_HI_DirectoryListed(dirName, count, startIndex, total);
+
+        break;
+
+      }
+
+      case FileManagerComponentBase::EVENTID_DIRECTORYLISTEDTOFILE: 
+      {
+
+        Fw::SerializeStatus _status;
+        Fw::LogStringArg dirName;
+        _status = args.deserialize(dirName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        Fw::LogStringArg fileName;
+        _status = args.deserialize(fileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 total;
+        _status = args.deserialize(total);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_HI_DirectoryListedToFile(dirName, fileName, total);
+
+        break;
+
+      }
+
+      case FileManagerComponentBase::EVENTID_WORKERBUSY: 
+      {
+
+        Fw::SerializeStatus _status;
+        Fw::LogStringArg command;
+        _status = args.deserialize(command);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_LO_WorkerBusy(command);
+
+        break;
+
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -1003,6 +1401,13 @@ namespace Svc {
     this->eventHistory_FileRemoveError->clear();
     this->eventHistory_ShellCommandFailed->clear();
     this->eventHistory_ShellCommandSucceeded->clear();
+    this->eventHistory_FileCopyError->clear();
+    this->eventHistory_DirectoryListError->clear();
+    this->eventHistory_ListFileError->clear();
+    this->eventHistory_DirectoryEntry->clear();
+    this->eventHistory_DirectoryListed->clear();
+    this->eventHistory_DirectoryListedToFile->clear();
+    this->eventHistory_WorkerBusy->clear();
   }
 
 #if FW_ENABLE_TEXT_LOGGING
@@ -1185,4 +1590,126 @@ namespace Svc {
     ++this->eventsSize;
   }
 
+  // ----------------------------------------------------------------------
+  // Event: FileCopyError 
+  // ----------------------------------------------------------------------
+
+  void FileManagerTesterBase ::
+    logIn_WARNING_HI_FileCopyError(
+        Fw::LogStringArg& sourceFileName,
+        Fw::LogStringArg& destFileName,
+        U32 status
+    )
+  {
+    EventEntry_FileCopyError e = {
+      sourceFileName, destFileName, status
+    };
+    eventHistory_FileCopyError->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryListError 
+  // ----------------------------------------------------------------------
+
+  void FileManagerTesterBase ::
+    logIn_WARNING_HI_DirectoryListError(
+        Fw::LogStringArg& dirName,
+        U32 status
+    )
+  {
+    EventEntry_DirectoryListError e = {
+      dirName, status
+    };
+    eventHistory_DirectoryListError->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: ListFileError 
+  // ----------------------------------------------------------------------
+
+  void FileManagerTesterBase ::
+    logIn_WARNING_HI_ListFileError(
+        Fw::LogStringArg& fileName,
+        U32 status
+    )
+  {
+    EventEntry_ListFileError e = {
+      fileName, status
+    };
+    eventHistory_ListFileError->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryEntry 
+  // ----------------------------------------------------------------------
+
+  void FileManagerTesterBase ::
+    logIn_ACTIVITY_LO_DirectoryEntry(
+        U32 index,
+        Fw::LogStringArg& name
+    )
+  {
+    EventEntry_DirectoryEntry e = {
+      index, name
+    };
+    eventHistory_DirectoryEntry->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryListed 
+  // ----------------------------------------------------------------------
+
+  void FileManagerTesterBase ::
+    logIn_ACTIVITY_HI_DirectoryListed(
+        Fw::LogStringArg& dirName,
+        U32 count,
+        U32 startIndex,
+        U32 total
+    )
+  {
+    EventEntry_DirectoryListed e = {
+      dirName, count, startIndex, total
+    };
+    eventHistory_DirectoryListed->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DirectoryListedToFile 
+  // ----------------------------------------------------------------------
+
+  void FileManagerTesterBase ::
+    logIn_ACTIVITY_HI_DirectoryListedToFile(
+        Fw::LogStringArg& dirName,
+        Fw::LogStringArg& fileName,
+        U32 total
+    )
+  {
+    EventEntry_DirectoryListedToFile e = {
+      dirName, fileName, total
+    };
+    eventHistory_DirectoryListedToFile->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: WorkerBusy 
+  // ----------------------------------------------------------------------
+
+  void FileManagerTesterBase ::
+    logIn_WARNING_LO_WorkerBusy(
+        Fw::LogStringArg& command
+    )
+  {
+    EventEntry_WorkerBusy e = {
+      command
+    };
+    eventHistory_WorkerBusy->push_back(e);
+    ++this->eventsSize;
+  }
+
 } // end namespace Svc
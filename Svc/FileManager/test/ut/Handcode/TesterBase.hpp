@@ -327,6 +327,34 @@ namespace Svc {
           const Fw::CmdStringArg& logFileName /*!< The name of the log file*/
       );
 
+      //! Send a CopyFile command
+      //!
+      void sendCmd_CopyFile(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CmdStringArg& sourceFileName, /*!< The source file name*/
+          const Fw::CmdStringArg& destFileName /*!< The destination file name*/
+      );
+
+      //! Send a ListDirectory command
+      //!
+      void sendCmd_ListDirectory(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CmdStringArg& dirName, /*!< The directory to list*/
+          const U32 startIndex, /*!< The index of the first entry to list*/
+          const U32 maxEntries /*!< The most entries to list*/
+      );
+
+      //! Send a ListDirectoryToFile command
+      //!
+      void sendCmd_ListDirectoryToFile(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CmdStringArg& dirName, /*!< The directory to list*/
+          const Fw::CmdStringArg& listFileName /*!< The file to write the listing to*/
+      );
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -569,6 +597,187 @@ namespace Svc {
       History<EventEntry_ShellCommandSucceeded> 
         *eventHistory_ShellCommandSucceeded;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileCopyError
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileCopyError
+      //!
+      virtual void logIn_WARNING_HI_FileCopyError(
+          Fw::LogStringArg& sourceFileName, /*!< The name of the source file*/
+          Fw::LogStringArg& destFileName, /*!< The name of the destination file*/
+          U32 status /*!< The error status*/
+      );
+
+      //! A history entry for event FileCopyError
+      //!
+      typedef struct {
+        Fw::LogStringArg sourceFileName;
+        Fw::LogStringArg destFileName;
+        U32 status;
+      } EventEntry_FileCopyError;
+
+      //! The history of FileCopyError events
+      //!
+      History<EventEntry_FileCopyError> 
+        *eventHistory_FileCopyError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryListError
+      // ----------------------------------------------------------------------
+
+      //! Handle event DirectoryListError
+      //!
+      virtual void logIn_WARNING_HI_DirectoryListError(
+          Fw::LogStringArg& dirName, /*!< The name of the directory*/
+          U32 status /*!< The error status*/
+      );
+
+      //! A history entry for event DirectoryListError
+      //!
+      typedef struct {
+        Fw::LogStringArg dirName;
+        U32 status;
+      } EventEntry_DirectoryListError;
+
+      //! The history of DirectoryListError events
+      //!
+      History<EventEntry_DirectoryListError> 
+        *eventHistory_DirectoryListError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: ListFileError
+      // ----------------------------------------------------------------------
+
+      //! Handle event ListFileError
+      //!
+      virtual void logIn_WARNING_HI_ListFileError(
+          Fw::LogStringArg& fileName, /*!< The name of the listing file*/
+          U32 status /*!< The error status*/
+      );
+
+      //! A history entry for event ListFileError
+      //!
+      typedef struct {
+        Fw::LogStringArg fileName;
+        U32 status;
+      } EventEntry_ListFileError;
+
+      //! The history of ListFileError events
+      //!
+      History<EventEntry_ListFileError> 
+        *eventHistory_ListFileError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryEntry
+      // ----------------------------------------------------------------------
+
+      //! Handle event DirectoryEntry
+      //!
+      virtual void logIn_ACTIVITY_LO_DirectoryEntry(
+          U32 index, /*!< The index of the entry*/
+          Fw::LogStringArg& name /*!< The name of the entry, ending in / for a directory*/
+      );
+
+      //! A history entry for event DirectoryEntry
+      //!
+      typedef struct {
+        U32 index;
+        Fw::LogStringArg name;
+      } EventEntry_DirectoryEntry;
+
+      //! The history of DirectoryEntry events
+      //!
+      History<EventEntry_DirectoryEntry> 
+        *eventHistory_DirectoryEntry;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryListed
+      // ----------------------------------------------------------------------
+
+      //! Handle event DirectoryListed
+      //!
+      virtual void logIn_ACTIVITY_HI_DirectoryListed(
+          Fw::LogStringArg& dirName, /*!< The name of the directory*/
+          U32 count, /*!< The number of entries listed*/
+          U32 startIndex, /*!< The index of the first entry listed*/
+          U32 total /*!< The number of entries in the directory*/
+      );
+
+      //! A history entry for event DirectoryListed
+      //!
+      typedef struct {
+        Fw::LogStringArg dirName;
+        U32 count;
+        U32 startIndex;
+        U32 total;
+      } EventEntry_DirectoryListed;
+
+      //! The history of DirectoryListed events
+      //!
+      History<EventEntry_DirectoryListed> 
+        *eventHistory_DirectoryListed;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DirectoryListedToFile
+      // ----------------------------------------------------------------------
+
+      //! Handle event DirectoryListedToFile
+      //!
+      virtual void logIn_ACTIVITY_HI_DirectoryListedToFile(
+          Fw::LogStringArg& dirName, /*!< The name of the directory*/
+          Fw::LogStringArg& fileName, /*!< The name of the listing file*/
+          U32 total /*!< The number of entries in the directory*/
+      );
+
+      //! A history entry for event DirectoryListedToFile
+      //!
+      typedef struct {
+        Fw::LogStringArg dirName;
+        Fw::LogStringArg fileName;
+        U32 total;
+      } EventEntry_DirectoryListedToFile;
+
+      //! The history of DirectoryListedToFile events
+      //!
+      History<EventEntry_DirectoryListedToFile> 
+        *eventHistory_DirectoryListedToFile;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: WorkerBusy
+      // ----------------------------------------------------------------------
+
+      //! Handle event WorkerBusy
+      //!
+      virtual void logIn_WARNING_LO_WorkerBusy(
+          Fw::LogStringArg& command /*!< The command that was rejected*/
+      );
+
+      //! A history entry for event WorkerBusy
+      //!
+      typedef struct {
+        Fw::LogStringArg command;
+      } EventEntry_WorkerBusy;
+
+      //! The history of WorkerBusy events
+      //!
+      History<EventEntry_WorkerBusy> 
+        *eventHistory_WorkerBusy;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -641,6 +850,56 @@ namespace Svc {
       History<TlmEntry_Errors> 
         *tlmHistory_Errors;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BytesCopied
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BytesCopied
+      //!
+      virtual void tlmInput_BytesCopied(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U64& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BytesCopied
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U64 arg;
+      } TlmEntry_BytesCopied;
+
+      //! The history of BytesCopied values
+      //!
+      History<TlmEntry_BytesCopied> 
+        *tlmHistory_BytesCopied;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: EntriesListed
+      // ----------------------------------------------------------------------
+
+      //! Handle channel EntriesListed
+      //!
+      virtual void tlmInput_EntriesListed(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel EntriesListed
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_EntriesListed;
+
+      //! The history of EntriesListed values
+      //!
+      History<TlmEntry_EntriesListed> 
+        *tlmHistory_EntriesListed;
+
     protected:
 
       // ----------------------------------------------------------------------
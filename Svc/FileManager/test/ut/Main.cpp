@@ -54,6 +54,36 @@ TEST(Test, shellCommandFail) {
   tester.shellCommandFail();
 }
 
+TEST(Test, copyFileSucceed) {
+  Svc::Tester tester;
+  tester.copyFileSucceed();
+}
+
+TEST(Test, copyFileFail) {
+  Svc::Tester tester;
+  tester.copyFileFail();
+}
+
+TEST(Test, listDirectory) {
+  Svc::Tester tester;
+  tester.listDirectory();
+}
+
+TEST(Test, listDirectoryFail) {
+  Svc::Tester tester;
+  tester.listDirectoryFail();
+}
+
+TEST(Test, listDirectoryToFile) {
+  Svc::Tester tester;
+  tester.listDirectoryToFile();
+}
+
+TEST(Test, workerBusy) {
+  Svc::Tester tester;
+  tester.workerBusy();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
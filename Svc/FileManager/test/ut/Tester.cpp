@@ -12,11 +12,16 @@
 
 #include "Tester.hpp"
 
+#include <string.h>
+
 #define INSTANCE 0
 #define CMD_SEQ 0
 #define MAX_HISTORY_SIZE 10
 #define QUEUE_DEPTH 10
 #define LOG_FILE "log.txt"
+#define LIST_DIR "list_dir"
+#define LIST_DIR_ENTRIES 6
+#define LIST_FILE "list.txt"
 
 namespace Svc {
 
@@ -293,6 +298,266 @@ namespace Svc {
 
   }
 
+  void Tester ::
+    copyFileSucceed(void) 
+  {
+
+    // Create file1 and remove file2, if it exists
+    this->system("rm -rf file1 file2");
+    this->system("printf 'copy file test' > file1");
+
+    // Copy file1 to file2
+    this->copyFile("file1", "file2");
+
+    // Assert success. BytesCopied starts at zero and reports the copy
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileManager::OPCODE_COPYFILE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_TLM_CommandsExecuted_SIZE(1);
+    ASSERT_TLM_CommandsExecuted(0, 1);
+    ASSERT_TLM_BytesCopied_SIZE(2);
+    ASSERT_TLM_BytesCopied(0, 0);
+    ASSERT_TLM_BytesCopied(1, 14);
+
+    // Check that the copy matches
+    this->system("cmp file1 file2");
+
+    // Clean up
+    this->system("rm file1 file2");
+
+  }
+
+  void Tester ::
+    copyFileFail(void) 
+  {
+
+    // Remove file1, if it exists
+    this->system("rm -rf file1");
+
+    // Attempt to copy file1 (should fail)
+    this->copyFile("file1", "file2");
+
+    // Assert failure
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileManager::OPCODE_COPYFILE,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileCopyError(
+        0,
+        "file1",
+        "file2",
+        Os::FileSystem::INVALID_PATH
+    );
+    ASSERT_TLM_Errors_SIZE(1);
+    ASSERT_TLM_Errors(0, 1);
+
+  }
+
+  void Tester ::
+    listDirectory(void) 
+  {
+
+    this->createListDirectory();
+
+    // List a page from the middle of the directory
+    this->listDirectory(LIST_DIR, 1, 3);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileManager::OPCODE_LISTDIRECTORY,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_SIZE(4);
+    ASSERT_EVENTS_DirectoryEntry_SIZE(3);
+    for (U32 i = 0; i < 3; ++i) {
+      const EventEntry_DirectoryEntry& e =
+        this->eventHistory_DirectoryEntry->at(i);
+      ASSERT_EQ(i + 1, e.index);
+    }
+    ASSERT_EVENTS_DirectoryListed_SIZE(1);
+    ASSERT_EVENTS_DirectoryListed(0, LIST_DIR, 3, 1, LIST_DIR_ENTRIES);
+    ASSERT_TLM_EntriesListed_SIZE(1);
+    ASSERT_TLM_EntriesListed(0, LIST_DIR_ENTRIES);
+
+    // List the whole directory. The subdirectory ends in a slash
+    this->clearHistory();
+    this->listDirectory(LIST_DIR, 0, 100);
+    ASSERT_EVENTS_DirectoryEntry_SIZE(LIST_DIR_ENTRIES);
+    U32 files = 0;
+    U32 dirs = 0;
+    for (U32 i = 0; i < LIST_DIR_ENTRIES; ++i) {
+      const EventEntry_DirectoryEntry& e =
+        this->eventHistory_DirectoryEntry->at(i);
+      ASSERT_EQ(i, e.index);
+      if (strcmp(e.name.toChar(), "subdir/") == 0) {
+        ++dirs;
+      }
+      else if (strncmp(e.name.toChar(), "file", 4) == 0) {
+        ++files;
+      }
+    }
+    ASSERT_EQ(static_cast<U32>(LIST_DIR_ENTRIES - 1), files);
+    ASSERT_EQ(static_cast<U32>(1), dirs);
+    ASSERT_EVENTS_DirectoryListed(0, LIST_DIR, LIST_DIR_ENTRIES, 0, LIST_DIR_ENTRIES);
+
+    // Listing past the end gives no entries
+    this->clearHistory();
+    this->listDirectory(LIST_DIR, LIST_DIR_ENTRIES, 10);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_DirectoryListed(0, LIST_DIR, 0, LIST_DIR_ENTRIES, LIST_DIR_ENTRIES);
+
+    // Clean up
+    this->system("rm -rf " LIST_DIR);
+
+  }
+
+  void Tester ::
+    listDirectoryFail(void) 
+  {
+
+    // Remove list_dir, if it exists
+    this->system("rm -rf " LIST_DIR);
+
+    // Attempt to list list_dir (should fail)
+    this->listDirectory(LIST_DIR, 0, 10);
+
+    // Assert failure
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileManager::OPCODE_LISTDIRECTORY,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_DirectoryListError(
+        0,
+        LIST_DIR,
+        Os::FileSystem::INVALID_PATH
+    );
+    ASSERT_TLM_Errors_SIZE(1);
+    ASSERT_TLM_Errors(0, 1);
+
+  }
+
+  void Tester ::
+    listDirectoryToFile(void) 
+  {
+
+    this->createListDirectory();
+    this->system("rm -rf " LIST_FILE);
+
+    // List list_dir to list.txt
+    this->listDirectoryToFile(LIST_DIR, LIST_FILE);
+
+    // Assert success
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileManager::OPCODE_LISTDIRECTORYTOFILE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_DirectoryListedToFile(0, LIST_DIR, LIST_FILE, LIST_DIR_ENTRIES);
+    ASSERT_TLM_CommandsExecuted_SIZE(1);
+    ASSERT_TLM_EntriesListed(0, LIST_DIR_ENTRIES);
+
+    // Check that each entry has a line
+    this->system("test `wc -l < " LIST_FILE "` -eq 6");
+    this->system("grep -qx subdir/ " LIST_FILE);
+    this->system("grep -qx file0 " LIST_FILE);
+
+    // A listing file that cannot be created is an error
+    this->clearHistory();
+    this->listDirectoryToFile(LIST_DIR, "missing_dir/" LIST_FILE);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileManager::OPCODE_LISTDIRECTORYTOFILE,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_ListFileError_SIZE(1);
+
+    // Clean up
+    this->system("rm -rf " LIST_DIR " " LIST_FILE);
+
+  }
+
+  void Tester ::
+    workerBusy(void) 
+  {
+
+    this->createListDirectory();
+    this->component.startWorker(0, 0, 0);
+
+    // Start a shell command on the worker
+    this->shellCommand("sleep 1", LOG_FILE);
+    ASSERT_CMD_RESPONSE_SIZE(0);
+
+    // A second long command is rejected while it runs
+    this->listDirectory(LIST_DIR, 0, 10);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileManager::OPCODE_LISTDIRECTORY,
+        CMD_SEQ,
+        Fw::COMMAND_BUSY
+    );
+    ASSERT_EVENTS_WorkerBusy_SIZE(1);
+    ASSERT_EVENTS_WorkerBusy(0, "ListDirectory");
+
+    // Short commands still run
+    this->system("rm -rf test_dir");
+    this->createDirectory("test_dir");
+    ASSERT_CMD_RESPONSE_SIZE(2);
+    ASSERT_CMD_RESPONSE(
+        1,
+        FileManager::OPCODE_CREATEDIRECTORY,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    // The worker reports back through the component queue
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(3);
+    ASSERT_CMD_RESPONSE(
+        2,
+        FileManager::OPCODE_SHELLCOMMAND,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_ShellCommandSucceeded(0, "sleep 1");
+
+    // Then long commands run again
+    this->listDirectory(LIST_DIR, 0, 1);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(4);
+    ASSERT_CMD_RESPONSE(
+        3,
+        FileManager::OPCODE_LISTDIRECTORY,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    this->component.stopWorker();
+
+    // Clean up
+    this->system("rm -rf test_dir " LIST_DIR);
+
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods 
   // ----------------------------------------------------------------------
@@ -432,6 +697,67 @@ namespace Svc {
     this->component.doDispatch();
   }
 
+  void Tester ::
+    copyFile(
+        const char *const sourceFileName,
+        const char *const destFileName
+    ) 
+  {
+    Fw::CmdStringArg cmdStringSource(sourceFileName);
+    Fw::CmdStringArg cmdStringDest(destFileName);
+    this->sendCmd_CopyFile(
+        INSTANCE,
+        CMD_SEQ,
+        cmdStringSource,
+        cmdStringDest
+    );
+    this->component.doDispatch();
+  }
+
+  void Tester ::
+    listDirectory(
+        const char *const dirName,
+        const U32 startIndex,
+        const U32 maxEntries
+    ) 
+  {
+    Fw::CmdStringArg cmdStringDir(dirName);
+    this->sendCmd_ListDirectory(
+        INSTANCE,
+        CMD_SEQ,
+        cmdStringDir,
+        startIndex,
+        maxEntries
+    );
+    this->component.doDispatch();
+  }
+
+  void Tester ::
+    listDirectoryToFile(
+        const char *const dirName,
+        const char *const listFileName
+    ) 
+  {
+    Fw::CmdStringArg cmdStringDir(dirName);
+    Fw::CmdStringArg cmdStringListFile(listFileName);
+    this->sendCmd_ListDirectoryToFile(
+        INSTANCE,
+        CMD_SEQ,
+        cmdStringDir,
+        cmdStringListFile
+    );
+    this->component.doDispatch();
+  }
+
+  void Tester ::
+    createListDirectory(void) 
+  {
+    system("rm -rf " LIST_DIR);
+    system("mkdir -p " LIST_DIR "/subdir");
+    system("touch " LIST_DIR "/file0 " LIST_DIR "/file1 " LIST_DIR "/file2 "
+        LIST_DIR "/file3 " LIST_DIR "/file4");
+  }
+
   void Tester ::
     assertSuccess(
         const FwOpcodeType opcode,
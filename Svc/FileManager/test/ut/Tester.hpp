@@ -82,6 +82,30 @@ namespace Svc {
       //!
       void shellCommandFail(void);
 
+      //! Copy file (succeed)
+      //!
+      void copyFileSucceed(void);
+
+      //! Copy file (fail)
+      //!
+      void copyFileFail(void);
+
+      //! List directory in pages of events
+      //!
+      void listDirectory(void);
+
+      //! List directory (fail)
+      //!
+      void listDirectoryFail(void);
+
+      //! List directory to a file
+      //!
+      void listDirectoryToFile(void);
+
+      //! Reject a long command while the worker is busy
+      //!
+      void workerBusy(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -127,6 +151,28 @@ namespace Svc {
           const char *const logFileName
       );
 
+      //! Copy a file
+      void copyFile(
+          const char *const sourceFileName,
+          const char *const destFileName
+      );
+
+      //! List a page of a directory
+      void listDirectory(
+          const char *const dirName,
+          const U32 startIndex,
+          const U32 maxEntries
+      );
+
+      //! List a directory to a file
+      void listDirectoryToFile(
+          const char *const dirName,
+          const char *const listFileName
+      );
+
+      //! Create a directory of test files and a subdirectory
+      static void createListDirectory(void);
+
       //! Assert successful command execution
       void assertSuccess(
           const FwOpcodeType opcode,
@@ -0,0 +1,101 @@
+// ====================================================================== 
+// \title  Decompressor.cpp
+// \brief  cpp file for FileUplink::Decompressor
+//
+// \copyright
+// Copyright 2009-2016, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileUplink/FileUplink.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Os/FileSystem.hpp>
+#include <stdio.h>
+#include <string.h>
+
+namespace Svc {
+
+  bool FileUplink::Decompressor ::
+    open(
+        const char *const stagedPath,
+        const char *const path,
+        const Fw::LogStringArg& name
+    )
+  {
+    FW_ASSERT(not this->busy);
+    (void) snprintf(this->stagedPath, sizeof(this->stagedPath), "%s", stagedPath);
+    (void) snprintf(this->path, sizeof(this->path), "%s", path);
+    this->name = name;
+    this->busy = true;
+    if (this->compressed.open(this->stagedPath, Os::File::OPEN_READ) != Os::File::OP_OK) {
+      return false;
+    }
+    if (this->file.open(this->path, Os::File::OPEN_CREATE) != Os::File::OP_OK) {
+      return false;
+    }
+    this->decoder.init();
+    return true;
+  }
+
+  FileUplink::Decompressor::Status FileUplink::Decompressor ::
+    decompressChunk(void)
+  {
+    FW_ASSERT(this->busy);
+    // A read that waits for a full chunk loses the last partial chunk
+    NATIVE_INT_TYPE size = sizeof(this->data);
+    if (this->compressed.read(this->data, size, false) != Os::File::OP_OK) {
+      return DECOMPRESS_ERROR;
+    }
+    if (size == 0) {
+      // The stream must end on a frame boundary
+      return this->decoder.isIdle() ? DECOMPRESS_DONE : DECOMPRESS_ERROR;
+    }
+    // Write each frame as it is decoded
+    U32 offset = 0;
+    while (offset < static_cast<U32>(size)) {
+      U32 used = 0;
+      const Utils::LzDecoder::Status status = this->decoder.update(
+          &this->data[offset],
+          size - offset,
+          used
+      );
+      offset += used;
+      if (status == Utils::LzDecoder::BAD_FRAME) {
+        return DECOMPRESS_ERROR;
+      }
+      if (status == Utils::LzDecoder::FRAME_READY) {
+        const U32 frameSize = this->decoder.getSize();
+        NATIVE_INT_TYPE writeSize = frameSize;
+        if (
+            this->file.write(this->decoder.getData(), writeSize) != Os::File::OP_OK or
+            static_cast<U32>(writeSize) != frameSize
+        ) {
+          return DECOMPRESS_ERROR;
+        }
+      }
+    }
+    return DECOMPRESS_MORE;
+  }
+
+  void FileUplink::Decompressor ::
+    close(void)
+  {
+    this->file.close();
+    this->compressed.close();
+    // The stream is removed whether or not it was decompressed, so that
+    // the file can be sent again
+    (void) Os::FileSystem::removeFile(this->stagedPath);
+    this->busy = false;
+  }
+
+  bool FileUplink::Decompressor ::
+    hasPath(const Fw::FilePacket::PathName& pathName) const
+  {
+    return
+      strlen(this->path) == pathName.length and
+      memcmp(this->path, pathName.value, pathName.length) == 0;
+  }
+
+}
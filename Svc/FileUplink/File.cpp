@@ -12,6 +12,8 @@
 
 #include <Svc/FileUplink/FileUplink.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <stdio.h>
+#include <string.h>
 
 namespace Svc {
 
@@ -19,15 +21,68 @@ namespace Svc {
     open(const Fw::FilePacket::StartPacket& startPacket)
   {
     const U32 length = startPacket.destinationPath.length;
-    char path[length + 1];
-    memcpy(path, startPacket.destinationPath.value, length);
-    path[length] = 0;
+    memcpy(this->path, startPacket.destinationPath.value, length);
+    this->path[length] = 0;
     this->size = startPacket.fileSize;
-    Fw::LogStringArg logStringArg(path);
+    Fw::LogStringArg logStringArg(this->path);
     this->name = logStringArg;
     CFDP::Checksum checksum;
     this->checksum = checksum;
-    return this->osFile.open(path, Os::File::OPEN_WRITE);
+    this->bufferOffset = 0;
+    this->bufferSize = 0;
+    this->compressed = 
+      (startPacket.flags & Fw::FilePacket::StartPacket::FLAG_COMPRESSED) != 0;
+    if (this->compressed) {
+      (void) snprintf(
+          this->stagedPath,
+          sizeof(this->stagedPath),
+          "%s%s",
+          this->path,
+          FILEUPLINK_STAGED_SUFFIX
+      );
+      // Never write over a file that has the staged name
+      return this->osFile.open(this->stagedPath, Os::File::OPEN_CREATE_EXCLUSIVE);
+    }
+    return this->osFile.open(this->path, Os::File::OPEN_WRITE);
+  }
+
+  bool FileUplink::File ::
+    canBuffer(
+        const U32 byteOffset,
+        const U32 length
+    ) const
+  {
+    if (this->bufferSize == 0) {
+      return length <= FILEUPLINK_WRITE_BUFFER_SIZE;
+    }
+    return
+      byteOffset == this->bufferOffset + this->bufferSize and
+      this->bufferSize + length <= FILEUPLINK_WRITE_BUFFER_SIZE;
+  }
+
+  void FileUplink::File ::
+    buffer(
+        const U8 *const data,
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+    FW_ASSERT(this->canBuffer(byteOffset, length), byteOffset, length);
+    if (this->bufferSize == 0) {
+      this->bufferOffset = byteOffset;
+    }
+    memcpy(&this->writeBuffer[this->bufferSize], data, length);
+    this->bufferSize += length;
+  }
+
+  Os::File::Status FileUplink::File ::
+    flush(void)
+  {
+    if (this->bufferSize == 0)
+      return Os::File::OP_OK;
+    const U32 length = this->bufferSize;
+    this->bufferSize = 0;
+    return this->write(this->writeBuffer, this->bufferOffset, length);
   }
 
   Os::File::Status FileUplink::File ::
@@ -38,13 +93,9 @@ namespace Svc {
     )
   {
 
-    Os::File::Status status;
-    status = this->osFile.seek(byteOffset);
-    if (status != Os::File::OP_OK)
-      return status;
-
     NATIVE_INT_TYPE intLength = length;
-    status = this->osFile.write(data, intLength);
+    const Os::File::Status status = 
+      this->osFile.writeAt(data, intLength, byteOffset);
     if (status != Os::File::OP_OK)
       return status;
 
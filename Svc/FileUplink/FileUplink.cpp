@@ -13,6 +13,7 @@
 #include <Svc/FileUplink/FileUplink.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/BasicTypes.hpp>
+#include <Os/FileSystem.hpp>
 
 namespace Svc {
 
@@ -25,6 +26,8 @@ namespace Svc {
       FileUplinkComponentBase(name),
       receiveMode(START),
       lastSequenceIndex(0),
+      decompressPending(false),
+      endReceived(false),
       filesReceived(this),
       packetsReceived(this),
       warnings(this)
@@ -79,6 +82,8 @@ namespace Svc {
         break;
     }
     this->bufferSendOut_out(0, buffer);
+    // Resume a decompression whose step was dropped from a full queue
+    this->scheduleDecompression();
   }
 
   void FileUplink ::
@@ -91,6 +96,42 @@ namespace Svc {
       this->pingOut_out(0,key);
   }
 
+  // ----------------------------------------------------------------------
+  // Internal interface handler implementations
+  // ----------------------------------------------------------------------
+
+  void FileUplink ::
+    decompressStep_internalInterfaceHandler(void)
+  {
+    this->decompressPending = false;
+    // The file may have been finished while this message was queued
+    if (not this->decompressor.isBusy()) {
+      return;
+    }
+    if (this->decompressChunk()) {
+      this->scheduleDecompression();
+    }
+  }
+
+  // ----------------------------------------------------------------------
+  // Command handler implementations 
+  // ----------------------------------------------------------------------
+
+  void FileUplink ::
+    FileUplink_ReportMissing_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq
+    )
+  {
+    if (this->receiveMode != DATA) {
+      // No file is being received
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+      return;
+    }
+    this->reportMissing();
+    this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
+  }
+
   // ----------------------------------------------------------------------
   // Private helper functions 
   // ----------------------------------------------------------------------
@@ -100,15 +141,30 @@ namespace Svc {
   {
     this->packetsReceived.packetReceived();
     if (this->receiveMode != START) {
+      this->flushFile();
       this->file.osFile.close();
+      this->discardStagedFile();
       this->warnings.invalidReceiveMode(Fw::FilePacket::T_START);
     }
+    // A file sent again to the same destination replaces the file
+    // being decompressed, so finish that one first
+    if (
+        this->decompressor.isBusy() and
+        this->decompressor.hasPath(startPacket.destinationPath)
+    ) {
+      this->finishDecompression();
+    }
     const Os::File::Status status = this->file.open(startPacket);
     if (status == Os::File::OP_OK) {
       this->goToDataMode();
     }
     else {
-      this->warnings.fileOpen(this->file.name);
+      if (status == Os::File::FILE_EXISTS) {
+        this->warnings.stagedFileExists();
+      }
+      else {
+        this->warnings.fileOpen(this->file.name);
+      }
       this->goToStartMode();
     }
   }
@@ -122,20 +178,26 @@ namespace Svc {
       return;
     }
     const U32 sequenceIndex = dataPacket.header.sequenceIndex;
-    this->checkSequenceIndex(sequenceIndex);
+    if (not this->endReceived) {
+      // Packets sent again after the END packet are out of order
+      // by design
+      this->checkSequenceIndex(sequenceIndex);
+    }
     const U32 byteOffset = dataPacket.byteOffset;
     const U32 dataSize = dataPacket.dataSize;
     if (byteOffset + dataSize > this->file.size) {
       this->warnings.packetOutOfBounds(sequenceIndex, this->file.name);
       return;
     }
-    const Os::File::Status status = this->file.write(
-        dataPacket.data,
-        byteOffset,
-        dataSize
-    );
-    if (status != Os::File::OP_OK) {
-      this->warnings.fileWrite(this->file.name);
+    this->writeData(dataPacket);
+    if (this->isDataComplete()) {
+      this->flushFile();
+      if (
+          this->endReceived and
+          this->receivedRanges.isComplete(this->file.size)
+      ) {
+        this->finishFile();
+      }
     }
   }
 
@@ -143,16 +205,23 @@ namespace Svc {
     handleEndPacket(const Fw::FilePacket::EndPacket& endPacket)
   {
     this->packetsReceived.packetReceived();
-    if (this->receiveMode == DATA) {
-      this->filesReceived.fileReceived();
-      this->checkSequenceIndex(endPacket.header.sequenceIndex);
-      this->compareChecksums(endPacket);
-      this->log_ACTIVITY_HI_FileUplink_FileReceived(this->file.name);
+    if (this->receiveMode != DATA) {
+      this->warnings.invalidReceiveMode(Fw::FilePacket::T_END);
+      this->goToStartMode();
+      return;
+    }
+    this->checkSequenceIndex(endPacket.header.sequenceIndex);
+    this->flushFile();
+    endPacket.getChecksum(this->endChecksum);
+    this->endReceived = true;
+    if (this->receivedRanges.isComplete(this->file.size)) {
+      this->finishFile();
     }
     else {
-      this->warnings.invalidReceiveMode(Fw::FilePacket::T_END);
+      // Keep the file open for the missing data
+      const U32 missingRanges = this->reportMissing();
+      this->warnings.fileIncomplete(missingRanges);
     }
-    this->goToStartMode();
   }
 
   void FileUplink ::
@@ -160,12 +229,21 @@ namespace Svc {
   {
     this->packetsReceived.packetReceived();
     this->log_ACTIVITY_HI_FileUplink_UplinkCanceled();
+    if (this->receiveMode == DATA) {
+      this->flushFile();
+      this->discardStagedFile();
+    }
     this->goToStartMode();
   }
 
   void FileUplink ::
     checkSequenceIndex(const U32 sequenceIndex)
   {
+    // A packet that arrives late fills a gap and is not a warning.
+    // A packet that skips ahead may mean that packets were lost.
+    if (sequenceIndex <= this->lastSequenceIndex) {
+      return;
+    }
     if (sequenceIndex != this->lastSequenceIndex + 1) {
       this->warnings.packetOutOfOrder(
           sequenceIndex,
@@ -176,15 +254,204 @@ namespace Svc {
   }
 
   void FileUplink ::
-    compareChecksums(const Fw::FilePacket::EndPacket& endPacket)
+    writeData(const Fw::FilePacket::DataPacket& dataPacket)
+  {
+    // Write only the bytes that have not been received, so that
+    // duplicate packets do not change the file or the checksum
+    const U32 byteOffset = dataPacket.byteOffset;
+    const U32 end = byteOffset + dataPacket.dataSize;
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    U32 offset = byteOffset;
+    while (this->receivedRanges.nextGap(offset, end, gapStart, gapEnd)) {
+      const U8 *const data = &dataPacket.data[gapStart - byteOffset];
+      const U32 length = gapEnd - gapStart;
+      U32 bufferOffset = 0;
+      U32 bufferSize = 0;
+      this->file.getBufferRange(bufferOffset, bufferSize);
+      if (bufferSize > 0 and not this->file.canBuffer(gapStart, length)) {
+        // Write out the buffered bytes, then find the gap again:
+        // it may include them
+        this->flushFile();
+        continue;
+      }
+      // No range is recorded while bytes are buffered, so the whole
+      // buffer fits in the range table if its first bytes do
+      if (
+          bufferSize == 0 and
+          not this->receivedRanges.canAdd(gapStart, gapEnd)
+      ) {
+        this->warnings.tooManyRanges(dataPacket.header.sequenceIndex);
+        return;
+      }
+      if (this->file.canBuffer(gapStart, length)) {
+        this->file.buffer(data, gapStart, length);
+      }
+      else {
+        const Os::File::Status status = 
+          this->file.write(data, gapStart, length);
+        if (status != Os::File::OP_OK) {
+          this->warnings.fileWrite(this->file.name);
+          return;
+        }
+        const bool added = this->receivedRanges.add(gapStart, gapEnd);
+        FW_ASSERT(added, gapStart, gapEnd);
+      }
+      offset = gapEnd;
+    }
+  }
+
+  void FileUplink ::
+    flushFile(void)
+  {
+    U32 bufferOffset = 0;
+    U32 bufferSize = 0;
+    this->file.getBufferRange(bufferOffset, bufferSize);
+    const Os::File::Status status = this->file.flush();
+    if (status != Os::File::OP_OK) {
+      // The dropped bytes stay missing
+      this->warnings.fileWrite(this->file.name);
+      return;
+    }
+    if (bufferSize > 0) {
+      const bool added = this->receivedRanges.add(
+          bufferOffset,
+          bufferOffset + bufferSize
+      );
+      FW_ASSERT(added, bufferOffset, bufferSize);
+    }
+  }
+
+  bool FileUplink ::
+    isDataComplete(void) const
+  {
+    U32 bufferOffset = 0;
+    U32 bufferSize = 0;
+    this->file.getBufferRange(bufferOffset, bufferSize);
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    U32 offset = 0;
+    while (this->receivedRanges.nextGap(offset, this->file.size, gapStart, gapEnd)) {
+      if (gapStart < bufferOffset or gapEnd > bufferOffset + bufferSize) {
+        return false;
+      }
+      offset = gapEnd;
+    }
+    return true;
+  }
+
+  void FileUplink ::
+    finishFile(void)
+  {
+    this->filesReceived.fileReceived();
+    this->compareChecksums();
+    if (this->file.compressed) {
+      // FileReceived is logged when the file is decompressed
+      this->startDecompression();
+    }
+    else {
+      this->log_ACTIVITY_HI_FileUplink_FileReceived(this->file.name);
+    }
+    this->goToStartMode();
+  }
+
+  void FileUplink ::
+    startDecompression(void)
+  {
+    this->file.osFile.close();
+    if (this->decompressor.isBusy()) {
+      // Files are decompressed one at a time, in the order received
+      this->finishDecompression();
+    }
+    const bool opened = this->decompressor.open(
+        this->file.stagedPath,
+        this->file.path,
+        this->file.name
+    );
+    if (not opened) {
+      this->warnings.decompress(this->decompressor.getName());
+      this->log_ACTIVITY_HI_FileUplink_FileReceived(this->decompressor.getName());
+      this->decompressor.close();
+      return;
+    }
+    this->scheduleDecompression();
+  }
+
+  void FileUplink ::
+    scheduleDecompression(void)
+  {
+    if (not this->decompressor.isBusy() or this->decompressPending) {
+      return;
+    }
+    // A message that does not fit in the queue is dropped. The next
+    // packet schedules the step again.
+    const NATIVE_INT_TYPE dropped = this->getNumMsgsDropped();
+    this->decompressStep_internalInterfaceInvoke();
+    this->decompressPending = (this->getNumMsgsDropped() == dropped);
+  }
+
+  bool FileUplink ::
+    decompressChunk(void)
+  {
+    const Decompressor::Status status = this->decompressor.decompressChunk();
+    if (status == Decompressor::DECOMPRESS_MORE) {
+      return true;
+    }
+    if (status == Decompressor::DECOMPRESS_ERROR) {
+      this->warnings.decompress(this->decompressor.getName());
+    }
+    this->log_ACTIVITY_HI_FileUplink_FileReceived(this->decompressor.getName());
+    this->decompressor.close();
+    return false;
+  }
+
+  void FileUplink ::
+    finishDecompression(void)
+  {
+    while (this->decompressor.isBusy()) {
+      (void) this->decompressChunk();
+    }
+  }
+
+  void FileUplink ::
+    discardStagedFile(void)
+  {
+    if (this->file.compressed) {
+      this->file.osFile.close();
+      (void) Os::FileSystem::removeFile(this->file.stagedPath);
+    }
+  }
+
+  U32 FileUplink ::
+    reportMissing(void)
+  {
+    U32 missingRanges = 0;
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    U32 offset = 0;
+    while (this->receivedRanges.nextGap(offset, this->file.size, gapStart, gapEnd)) {
+      if (missingRanges < FILEUPLINK_MAX_MISSING_EVENTS) {
+        this->log_ACTIVITY_HI_FileUplink_MissingRange(
+            this->file.name,
+            gapStart,
+            gapEnd - gapStart
+        );
+      }
+      ++missingRanges;
+      offset = gapEnd;
+    }
+    return missingRanges;
+  }
+
+  void FileUplink ::
+    compareChecksums(void)
   {
-    CFDP::Checksum computed, stored;
+    CFDP::Checksum computed;
     this->file.getChecksum(computed);
-    endPacket.getChecksum(stored);
-    if (computed != stored) {
+    if (computed != this->endChecksum) {
       this->warnings.badChecksum(
           computed.getValue(), 
-          stored.getValue()
+          this->endChecksum.getValue()
       );
     }
   }
@@ -195,6 +462,7 @@ namespace Svc {
     this->file.osFile.close();
     this->receiveMode = START;
     this->lastSequenceIndex = 0;
+    this->endReceived = false;
   }
 
   void FileUplink ::
@@ -202,6 +470,8 @@ namespace Svc {
   {
     this->receiveMode = DATA;
     this->lastSequenceIndex = 0;
+    this->receivedRanges.clear();
+    this->endReceived = false;
   }
 
 }
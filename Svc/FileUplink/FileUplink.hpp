@@ -14,8 +14,10 @@
 #define Svc_FileUplink_HPP
 
 #include <Svc/FileUplink/FileUplinkComponentAc.hpp>
+#include <Svc/FileUplink/FileUplinkCfg.hpp>
 #include <Fw/FilePacket/FilePacket.hpp>
 #include <Os/File.hpp>
+#include <Utils/Lz/LzDecoder.hpp>
 
 namespace Svc {
 
@@ -35,6 +37,19 @@ namespace Svc {
       //! An object representing an incoming file
       class File {
 
+        public:
+
+          //! Constructor
+          File() :
+            size(0),
+            compressed(false),
+            bufferOffset(0),
+            bufferSize(0)
+          { 
+            this->path[0] = 0;
+            this->stagedPath[0] = 0;
+          }
+
         public:
           
           //! The file size
@@ -46,18 +61,69 @@ namespace Svc {
           //! The underlying OS file
           Os::File osFile;
 
+          //! Whether the file data is a compressed stream. The stream is
+          //! received into the staged file and decompressed at the end
+          bool compressed;
+
+          //! The destination path
+          char path[Fw::FilePacket::PathName::MAX_LENGTH + 1];
+
+          //! The path of the staged file that receives a compressed stream.
+          //! It is the destination path with FILEUPLINK_STAGED_SUFFIX
+          char stagedPath[Fw::FilePacket::PathName::MAX_LENGTH + sizeof(FILEUPLINK_STAGED_SUFFIX)];
+
         PRIVATE:
 
           //! The checksum for the file
           ::CFDP::Checksum checksum;
 
+          //! The write buffer
+          U8 writeBuffer[FILEUPLINK_WRITE_BUFFER_SIZE];
+
+          //! The file offset of the first byte in the write buffer
+          U32 bufferOffset;
+
+          //! The number of bytes in the write buffer
+          U32 bufferSize;
+
         public:
 
-          //! Open the OS file for writing and initialize the checksum
+          //! Open the OS file for writing and initialize the checksum.
+          //! A compressed file is written to the staged file, which must
+          //! not exist; if it does, FILE_EXISTS is returned.
           Os::File::Status open(
               const Fw::FilePacket::StartPacket& startPacket
           );
 
+          //! Check whether bytes can be added to the write buffer.
+          //! They can if they fit, and the buffer is empty or they
+          //! continue the bytes in it.
+          bool canBuffer(
+              const U32 byteOffset,
+              const U32 length
+          ) const;
+
+          //! Add bytes to the write buffer. The bytes must satisfy
+          //! canBuffer.
+          void buffer(
+              const U8 *const data,
+              const U32 byteOffset,
+              const U32 length
+          );
+
+          //! Get the byte range held in the write buffer
+          void getBufferRange(
+              U32& byteOffset, //!< The file offset of the first byte
+              U32& length //!< The number of bytes; zero if the buffer is empty
+          ) const {
+            byteOffset = this->bufferOffset;
+            length = this->bufferSize;
+          }
+
+          //! Write the write buffer into the OS file and empty it.
+          //! If the write fails, the buffered bytes are dropped.
+          Os::File::Status flush(void);
+
           //! Write bytes into the OS file and update the checksum
           Os::File::Status write(
               const U8 *const data,
@@ -65,6 +131,7 @@ namespace Svc {
               const U32 length
           );
 
+
           //! Get the checksum
           void getChecksum(::CFDP::Checksum& checksum) {
             checksum = this->checksum;
@@ -72,6 +139,145 @@ namespace Svc {
 
       };
 
+      //! The byte ranges of a file that have been received
+      class ReceivedRanges {
+
+        public:
+
+          //! Construct a ReceivedRanges object
+          ReceivedRanges(void) : count(0) { }
+
+        public:
+
+          //! Forget all ranges
+          void clear(void) {
+            this->count = 0;
+          }
+
+          //! Find the first part of a byte range that has not been received
+          //! \return Whether any part of the byte range is missing
+          bool nextGap(
+              const U32 start, //!< The start of the byte range
+              const U32 end, //!< The end of the byte range (exclusive)
+              U32& gapStart, //!< The start of the missing part
+              U32& gapEnd //!< The end of the missing part (exclusive)
+          ) const;
+
+          //! Record a byte range as received, merging it with the
+          //! ranges that overlap or touch it
+          //! \return false if there is no room for a new range
+          bool add(
+              const U32 start, //!< The start of the byte range
+              const U32 end //!< The end of the byte range (exclusive)
+          );
+
+          //! Check whether add would succeed for a byte range
+          bool canAdd(
+              const U32 start, //!< The start of the byte range
+              const U32 end //!< The end of the byte range (exclusive)
+          ) const;
+
+          //! Check whether a file has been received completely
+          //! \return Whether all bytes from 0 to fileSize have been received
+          bool isComplete(const U32 fileSize) const;
+
+        PRIVATE:
+
+          //! A received byte range
+          struct Range {
+            U32 start; //!< The first byte
+            U32 end; //!< One past the last byte
+          };
+
+          //! The ranges, sorted by offset. Ranges do not overlap or touch.
+          Range ranges[FILEUPLINK_MAX_RANGES];
+
+          //! The number of ranges
+          U32 count;
+
+      };
+
+      //! Object to decompress a received file, a chunk at a time.
+      //! It works independently of the file being received, so the next
+      //! file can arrive while it runs.
+      class Decompressor {
+
+        public:
+
+          //! The status of a decompression step
+          typedef enum {
+            DECOMPRESS_MORE, //!< More of the stream remains
+            DECOMPRESS_DONE, //!< The file is decompressed
+            DECOMPRESS_ERROR //!< The stream could not be read, decoded, or written
+          } Status;
+
+        public:
+
+          //! Constructor
+          Decompressor(void) : busy(false) {
+            this->path[0] = 0;
+            this->stagedPath[0] = 0;
+          }
+
+        public:
+
+          //! Open a staged Utils::Lz stream and create the file it
+          //! decompresses to
+          //! \return Whether both files were opened
+          bool open(
+              const char *const stagedPath, //!< The staged stream
+              const char *const path, //!< The file to write
+              const Fw::LogStringArg& name //!< The file name for events
+          );
+
+          //! Decompress the next FILEUPLINK_DECOMPRESS_CHUNK_SIZE bytes
+          //! of the stream into the file
+          Status decompressChunk(void);
+
+          //! Close the files and remove the staged stream
+          void close(void);
+
+          //! Check whether a file is being decompressed
+          bool isBusy(void) const {
+            return this->busy;
+          }
+
+          //! Check whether the file being decompressed has a path
+          bool hasPath(const Fw::FilePacket::PathName& pathName) const;
+
+          //! Get the file name for events
+          Fw::LogStringArg& getName(void) {
+            return this->name;
+          }
+
+        PRIVATE:
+
+          //! Whether a file is being decompressed
+          bool busy;
+
+          //! The file name for events
+          Fw::LogStringArg name;
+
+          //! The destination path
+          char path[Fw::FilePacket::PathName::MAX_LENGTH + 1];
+
+          //! The path of the staged stream
+          char stagedPath[Fw::FilePacket::PathName::MAX_LENGTH + sizeof(FILEUPLINK_STAGED_SUFFIX)];
+
+          //! The staged stream
+          Os::File compressed;
+
+          //! The destination file
+          Os::File file;
+
+          //! The decoder
+          Utils::LzDecoder decoder;
+
+          //! A chunk of the stream
+          U8 data[FILEUPLINK_DECOMPRESS_CHUNK_SIZE];
+
+      };
+
       //! Object to record files received
       class FilesReceived {
 
@@ -167,6 +373,18 @@ namespace Svc {
               const U32 read
           );
 
+          //! Record a File Incomplete warning
+          void fileIncomplete(const U32 missingRanges);
+
+          //! Record a Too Many Ranges warning
+          void tooManyRanges(const U32 sequenceIndex);
+
+          //! Record a Decompress warning
+          void decompress(Fw::LogStringArg& fileName);
+
+          //! Record a Staged File Exists warning
+          void stagedFileExists(void);
+
         PRIVATE:
 
           //! Record a warning
@@ -228,6 +446,28 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Internal interface handler implementations
+      // ----------------------------------------------------------------------
+
+      //! Handler implementation for decompressStep
+      //!
+      void decompressStep_internalInterfaceHandler(void);
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Command handler implementations 
+      // ----------------------------------------------------------------------
+
+      //! Implementation for FileUplink_ReportMissing command handler
+      //! Report the byte ranges that have not arrived
+      void FileUplink_ReportMissing_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq //!< The command sequence number
+      );
 
     PRIVATE:
 
@@ -250,8 +490,46 @@ namespace Svc {
       //! Check sequence index
       void checkSequenceIndex(const U32 sequenceIndex);
 
+      //! Write the bytes of a data packet that have not been received.
+      //! A byte range is recorded as received once it is in the file.
+      void writeData(const Fw::FilePacket::DataPacket& dataPacket);
+
+      //! Write the write buffer into the file and record its bytes
+      //! as received
+      void flushFile(void);
+
+      //! Check whether all the file data is received or in the
+      //! write buffer
+      bool isDataComplete(void) const;
+
+      //! Finish a file whose data and END packet have all been received
+      void finishFile(void);
+
+      //! Issue an event for each missing range, up to
+      //! FILEUPLINK_MAX_MISSING_EVENTS
+      //! \return The number of missing ranges
+      U32 reportMissing(void);
+
       //! Compare checksums
-      void compareChecksums(const Fw::FilePacket::EndPacket& endPacket);
+      void compareChecksums(void);
+
+      //! Start decompressing a received compressed file. A file that is
+      //! still being decompressed is finished first.
+      void startDecompression(void);
+
+      //! Queue a decompressStep message if none is queued
+      void scheduleDecompression(void);
+
+      //! Decompress the next chunk of the file being decompressed
+      //! \return Whether more of the file remains
+      bool decompressChunk(void);
+
+      //! Decompress the rest of the file being decompressed
+      void finishDecompression(void);
+
+      //! Close a compressed file that will not be finished and
+      //! remove its staged file
+      void discardStagedFile(void);
 
       //! Go to START mode
       void goToStartMode(void);
@@ -274,6 +552,21 @@ namespace Svc {
       //! The file being assembled
       File file;
 
+      //! The decompressor for compressed files
+      Decompressor decompressor;
+
+      //! Whether a decompressStep message is queued
+      bool decompressPending;
+
+      //! The byte ranges of the file that have been received
+      ReceivedRanges receivedRanges;
+
+      //! Whether the END packet of the file has been received
+      bool endReceived;
+
+      //! The checksum in the END packet
+      ::CFDP::Checksum endChecksum;
+
       //! The total number of files received
       FilesReceived filesReceived;
 
@@ -0,0 +1,24 @@
+/*
+ * FileUplinkCfg.hpp
+ *
+ *  Configuration for the FileUplink component
+ */
+
+#ifndef FILEUPLINK_FILEUPLINKCFG_HPP_
+#define FILEUPLINK_FILEUPLINKCFG_HPP_
+
+// Anonymous namespace for configuration parameters
+namespace {
+
+    enum {
+        FILEUPLINK_MAX_RANGES = 32, // !< Number of disjoint byte ranges of a file that can be received before packets are dropped
+        FILEUPLINK_WRITE_BUFFER_SIZE = 4096, // !< Size of the buffer that merges contiguous data packets into one write
+        FILEUPLINK_MAX_MISSING_EVENTS = 10, // !< Number of missing ranges reported by each missing range report
+        FILEUPLINK_DECOMPRESS_CHUNK_SIZE = 4096 // !< Bytes of a compressed stream decompressed by each decompressStep message
+    };
+
+    const char FILEUPLINK_STAGED_SUFFIX[] = ".lz.tmp"; // !< Appended to the destination path to get the staged file that receives a compressed file
+
+}
+
+#endif /* FILEUPLINK_FILEUPLINKCFG_HPP_ */
@@ -0,0 +1,119 @@
+// ====================================================================== 
+// \title  ReceivedRanges.cpp
+// \brief  cpp file for FileUplink::ReceivedRanges
+//
+// \copyright
+// Copyright 2009-2016, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileUplink/FileUplink.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+  bool FileUplink::ReceivedRanges ::
+    nextGap(
+        const U32 start,
+        const U32 end,
+        U32& gapStart,
+        U32& gapEnd
+    ) const
+  {
+    U32 cursor = start;
+    for (U32 i = 0; i < this->count and cursor < end; ++i) {
+      const Range& range = this->ranges[i];
+      if (range.end <= cursor) {
+        continue;
+      }
+      if (range.start > cursor) {
+        gapStart = cursor;
+        gapEnd = (range.start < end) ? range.start : end;
+        return true;
+      }
+      cursor = range.end;
+    }
+    if (cursor < end) {
+      gapStart = cursor;
+      gapEnd = end;
+      return true;
+    }
+    return false;
+  }
+
+  bool FileUplink::ReceivedRanges ::
+    add(
+        const U32 start,
+        const U32 end
+    )
+  {
+    FW_ASSERT(start <= end, start, end);
+
+    // Find the ranges that overlap or touch [start, end)
+    U32 first = 0;
+    while (first < this->count and this->ranges[first].end < start) {
+      ++first;
+    }
+    U32 last = first;
+    while (last < this->count and this->ranges[last].start <= end) {
+      ++last;
+    }
+
+    if (first == last) {
+      // Insert a new range
+      if (this->count == FILEUPLINK_MAX_RANGES) {
+        return false;
+      }
+      for (U32 i = this->count; i > first; --i) {
+        this->ranges[i] = this->ranges[i-1];
+      }
+      this->ranges[first].start = start;
+      this->ranges[first].end = end;
+      ++this->count;
+      return true;
+    }
+
+    // Merge the ranges into the first one
+    Range& merged = this->ranges[first];
+    if (start < merged.start) {
+      merged.start = start;
+    }
+    merged.end = (end > this->ranges[last-1].end) ? 
+      end : this->ranges[last-1].end;
+    const U32 removed = last - first - 1;
+    for (U32 i = last; i < this->count; ++i) {
+      this->ranges[i - removed] = this->ranges[i];
+    }
+    this->count -= removed;
+    return true;
+  }
+
+  bool FileUplink::ReceivedRanges ::
+    canAdd(
+        const U32 start,
+        const U32 end
+    ) const
+  {
+    if (this->count < FILEUPLINK_MAX_RANGES) {
+      return true;
+    }
+    // A range that overlaps or touches a recorded range is merged into it
+    for (U32 i = 0; i < this->count; ++i) {
+      if (this->ranges[i].start <= end and this->ranges[i].end >= start) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool FileUplink::ReceivedRanges ::
+    isComplete(const U32 fileSize) const
+  {
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    return not this->nextGap(0, fileSize, gapStart, gapEnd);
+  }
+
+}
@@ -78,4 +78,41 @@ namespace Svc {
     this->warning();
   }
 
+  void FileUplink::Warnings ::
+    fileIncomplete(const U32 missingRanges)
+  {
+    this->fileUplink->log_WARNING_HI_FileUplink_FileIncomplete(
+        this->fileUplink->file.name,
+        missingRanges
+    );
+    this->warning();
+  }
+
+  void FileUplink::Warnings ::
+    tooManyRanges(const U32 sequenceIndex)
+  {
+    this->fileUplink->log_WARNING_HI_FileUplink_TooManyRanges(
+        sequenceIndex,
+        this->fileUplink->file.name
+    );
+    this->warning();
+  }
+
+  void FileUplink::Warnings ::
+    decompress(Fw::LogStringArg& fileName)
+  {
+    this->fileUplink->log_WARNING_HI_FileUplink_DecompressError(fileName);
+    this->warning();
+  }
+
+  void FileUplink::Warnings ::
+    stagedFileExists(void)
+  {
+    Fw::LogStringArg stagedLogStringArg(this->fileUplink->file.stagedPath);
+    this->fileUplink->log_WARNING_HI_FileUplink_StagedFileExists(
+        stagedLogStringArg
+    );
+    this->warning();
+  }
+
 }
@@ -4,10 +4,13 @@
 
 SRC = \
 			FileUplinkComponentAi.xml \
+			Decompressor.cpp \
 			File.cpp \
 			FileUplink.cpp \
+			ReceivedRanges.cpp \
 			Warnings.cpp
 
-HDR = FileUplink.hpp
+HDR = FileUplink.hpp \
+      FileUplinkCfg.hpp
 
 SUBDIRS = test
@@ -43,6 +43,75 @@ namespace Svc {
 
   }
 
+  // ----------------------------------------------------------------------
+  // Commands
+  // ----------------------------------------------------------------------
+
+  void FileUplinkGTestBase ::
+    assertCmdResponse_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ((unsigned long) size, this->cmdResponseHistory->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of command response history\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->cmdResponseHistory->size() << "\n";
+  }
+
+  void FileUplinkGTestBase ::
+    assertCmdResponse(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CommandResponse response
+    )
+    const
+  {
+    ASSERT_LT(index, this->cmdResponseHistory->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into command response history\n"
+      << "  Expected: Less than size of command response history (" 
+      << this->cmdResponseHistory->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const CmdResponse& e = this->cmdResponseHistory->at(index);
+    ASSERT_EQ(opCode, e.opCode)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Opcode at index "
+      << index
+      << " in command response history\n"
+      << "  Expected: " << opCode << "\n"
+      << "  Actual:   " << e.opCode << "\n";
+    ASSERT_EQ(cmdSeq, e.cmdSeq)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Command sequence number at index "
+      << index
+      << " in command response history\n"
+      << "  Expected: " << cmdSeq << "\n"
+      << "  Actual:   " << e.cmdSeq << "\n";
+    ASSERT_EQ(response, e.response)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Command response at index "
+      << index
+      << " in command response history\n"
+      << "  Expected: " << response << "\n"
+      << "  Actual:   " << e.response << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // Telemetry
   // ----------------------------------------------------------------------
@@ -646,6 +715,291 @@ namespace Svc {
       << "  Actual:   " << this->eventsSize_FileUplink_UplinkCanceled << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_MissingRange
+  // ----------------------------------------------------------------------
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_MissingRange_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileUplink_MissingRange->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileUplink_MissingRange\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileUplink_MissingRange->size() << "\n";
+  }
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_MissingRange(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const fileName,
+        const U32 byteOffset,
+        const U32 length
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileUplink_MissingRange->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileUplink_MissingRange\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileUplink_MissingRange->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileUplink_MissingRange& e =
+      this->eventHistory_FileUplink_MissingRange->at(index);
+    ASSERT_STREQ(fileName, e.fileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileName at index "
+      << index
+      << " in history of event FileUplink_MissingRange\n"
+      << "  Expected: " << fileName << "\n"
+      << "  Actual:   " << e.fileName.toChar() << "\n";
+    ASSERT_EQ(byteOffset, e.byteOffset)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument byteOffset at index "
+      << index
+      << " in history of event FileUplink_MissingRange\n"
+      << "  Expected: " << byteOffset << "\n"
+      << "  Actual:   " << e.byteOffset << "\n";
+    ASSERT_EQ(length, e.length)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument length at index "
+      << index
+      << " in history of event FileUplink_MissingRange\n"
+      << "  Expected: " << length << "\n"
+      << "  Actual:   " << e.length << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_FileIncomplete
+  // ----------------------------------------------------------------------
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_FileIncomplete_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileUplink_FileIncomplete->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileUplink_FileIncomplete\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileUplink_FileIncomplete->size() << "\n";
+  }
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_FileIncomplete(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const fileName,
+        const U32 missingRanges
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileUplink_FileIncomplete->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileUplink_FileIncomplete\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileUplink_FileIncomplete->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileUplink_FileIncomplete& e =
+      this->eventHistory_FileUplink_FileIncomplete->at(index);
+    ASSERT_STREQ(fileName, e.fileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileName at index "
+      << index
+      << " in history of event FileUplink_FileIncomplete\n"
+      << "  Expected: " << fileName << "\n"
+      << "  Actual:   " << e.fileName.toChar() << "\n";
+    ASSERT_EQ(missingRanges, e.missingRanges)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument missingRanges at index "
+      << index
+      << " in history of event FileUplink_FileIncomplete\n"
+      << "  Expected: " << missingRanges << "\n"
+      << "  Actual:   " << e.missingRanges << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_TooManyRanges
+  // ----------------------------------------------------------------------
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_TooManyRanges_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileUplink_TooManyRanges->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileUplink_TooManyRanges\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileUplink_TooManyRanges->size() << "\n";
+  }
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_TooManyRanges(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32 packetIndex,
+        const char *const fileName
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileUplink_TooManyRanges->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileUplink_TooManyRanges\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileUplink_TooManyRanges->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileUplink_TooManyRanges& e =
+      this->eventHistory_FileUplink_TooManyRanges->at(index);
+    ASSERT_EQ(packetIndex, e.packetIndex)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument packetIndex at index "
+      << index
+      << " in history of event FileUplink_TooManyRanges\n"
+      << "  Expected: " << packetIndex << "\n"
+      << "  Actual:   " << e.packetIndex << "\n";
+    ASSERT_STREQ(fileName, e.fileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileName at index "
+      << index
+      << " in history of event FileUplink_TooManyRanges\n"
+      << "  Expected: " << fileName << "\n"
+      << "  Actual:   " << e.fileName.toChar() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_DecompressError
+  // ----------------------------------------------------------------------
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_DecompressError_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileUplink_DecompressError->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileUplink_DecompressError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileUplink_DecompressError->size() << "\n";
+  }
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_DecompressError(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const fileName
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileUplink_DecompressError->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileUplink_DecompressError\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileUplink_DecompressError->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileUplink_DecompressError& e =
+      this->eventHistory_FileUplink_DecompressError->at(index);
+    ASSERT_STREQ(fileName, e.fileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileName at index "
+      << index
+      << " in history of event FileUplink_DecompressError\n"
+      << "  Expected: " << fileName << "\n"
+      << "  Actual:   " << e.fileName.toChar() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_StagedFileExists
+  // ----------------------------------------------------------------------
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_StagedFileExists_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_FileUplink_StagedFileExists->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event FileUplink_StagedFileExists\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_FileUplink_StagedFileExists->size() << "\n";
+  }
+
+  void FileUplinkGTestBase ::
+    assertEvents_FileUplink_StagedFileExists(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const char *const fileName
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_FileUplink_StagedFileExists->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event FileUplink_StagedFileExists\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_FileUplink_StagedFileExists->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_FileUplink_StagedFileExists& e =
+      this->eventHistory_FileUplink_StagedFileExists->at(index);
+    ASSERT_STREQ(fileName, e.fileName.toChar())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument fileName at index "
+      << index
+      << " in history of event FileUplink_StagedFileExists\n"
+      << "  Expected: " << fileName << "\n"
+      << "  Actual:   " << e.fileName.toChar() << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // From ports
   // ----------------------------------------------------------------------
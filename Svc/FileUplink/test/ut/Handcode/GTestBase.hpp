@@ -16,6 +16,16 @@
 #include "TesterBase.hpp"
 #include "gtest/gtest.h"
 
+// ----------------------------------------------------------------------
+// Macros for command history assertions
+// ----------------------------------------------------------------------
+
+#define ASSERT_CMD_RESPONSE_SIZE(size) \
+  this->assertCmdResponse_size(__FILE__, __LINE__, size)
+
+#define ASSERT_CMD_RESPONSE(index, opCode, cmdSeq, response) \
+  this->assertCmdResponse(__FILE__, __LINE__, index, opCode, cmdSeq, response)
+
 // ----------------------------------------------------------------------
 // Macros for telemetry history assertions
 // ----------------------------------------------------------------------
@@ -93,6 +103,36 @@
 #define ASSERT_EVENTS_FileUplink_UplinkCanceled_SIZE(size) \
   this->assertEvents_FileUplink_UplinkCanceled_size(__FILE__, __LINE__, size)
 
+#define ASSERT_EVENTS_FileUplink_MissingRange_SIZE(size) \
+  this->assertEvents_FileUplink_MissingRange_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileUplink_MissingRange(index, _fileName, _byteOffset, _length) \
+  this->assertEvents_FileUplink_MissingRange(__FILE__, __LINE__, index, _fileName, _byteOffset, _length)
+
+#define ASSERT_EVENTS_FileUplink_FileIncomplete_SIZE(size) \
+  this->assertEvents_FileUplink_FileIncomplete_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileUplink_FileIncomplete(index, _fileName, _missingRanges) \
+  this->assertEvents_FileUplink_FileIncomplete(__FILE__, __LINE__, index, _fileName, _missingRanges)
+
+#define ASSERT_EVENTS_FileUplink_TooManyRanges_SIZE(size) \
+  this->assertEvents_FileUplink_TooManyRanges_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileUplink_TooManyRanges(index, _packetIndex, _fileName) \
+  this->assertEvents_FileUplink_TooManyRanges(__FILE__, __LINE__, index, _packetIndex, _fileName)
+
+#define ASSERT_EVENTS_FileUplink_DecompressError_SIZE(size) \
+  this->assertEvents_FileUplink_DecompressError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileUplink_DecompressError(index, _fileName) \
+  this->assertEvents_FileUplink_DecompressError(__FILE__, __LINE__, index, _fileName)
+
+#define ASSERT_EVENTS_FileUplink_StagedFileExists_SIZE(size) \
+  this->assertEvents_FileUplink_StagedFileExists_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_FileUplink_StagedFileExists(index, _fileName) \
+  this->assertEvents_FileUplink_StagedFileExists(__FILE__, __LINE__, index, _fileName)
+
 // ----------------------------------------------------------------------
 // Macros for typed user from port history assertions
 // ----------------------------------------------------------------------
@@ -182,6 +222,31 @@ namespace Svc {
       //!
       virtual ~FileUplinkGTestBase(void);
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Commands
+      // ----------------------------------------------------------------------
+
+      //! Assert size of command response history
+      //!
+      void assertCmdResponse_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      //! Assert command response in history at index
+      //!
+      void assertCmdResponse(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const FwOpcodeType opCode, /*!< The opcode*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CommandResponse response /*!< The command response*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -421,6 +486,105 @@ namespace Svc {
           const U32 size /*!< The asserted size*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_MissingRange
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileUplink_MissingRange_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileUplink_MissingRange(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const fileName, /*!< The file name*/
+          const U32 byteOffset, /*!< The offset of the first missing byte*/
+          const U32 length /*!< The number of missing bytes*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_FileIncomplete
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileUplink_FileIncomplete_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileUplink_FileIncomplete(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const fileName, /*!< The file name*/
+          const U32 missingRanges /*!< The number of missing ranges*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_TooManyRanges
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileUplink_TooManyRanges_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileUplink_TooManyRanges(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32 packetIndex, /*!< The sequence index of the packet*/
+          const char *const fileName /*!< The name of the file*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_DecompressError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileUplink_DecompressError_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileUplink_DecompressError(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const fileName /*!< The name of the file*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_StagedFileExists
+      // ----------------------------------------------------------------------
+
+      void assertEvents_FileUplink_StagedFileExists_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_FileUplink_StagedFileExists(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const char *const fileName /*!< The name of the staged file*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -35,6 +35,8 @@ namespace Svc {
       Fw::PassiveComponentBase()
 #endif
   {
+    // Initialize command history
+    this->cmdResponseHistory = new History<CmdResponse>(maxHistorySize);
     // Initialize telemetry histories
     this->tlmHistory_FileUplink_FilesReceived = 
       new History<TlmEntry_FileUplink_FilesReceived>(maxHistorySize);
@@ -60,6 +62,16 @@ namespace Svc {
       new History<EventEntry_FileUplink_PacketOutOfBounds>(maxHistorySize);
     this->eventHistory_FileUplink_PacketOutOfOrder =
       new History<EventEntry_FileUplink_PacketOutOfOrder>(maxHistorySize);
+    this->eventHistory_FileUplink_MissingRange =
+      new History<EventEntry_FileUplink_MissingRange>(maxHistorySize);
+    this->eventHistory_FileUplink_FileIncomplete =
+      new History<EventEntry_FileUplink_FileIncomplete>(maxHistorySize);
+    this->eventHistory_FileUplink_TooManyRanges =
+      new History<EventEntry_FileUplink_TooManyRanges>(maxHistorySize);
+    this->eventHistory_FileUplink_DecompressError =
+      new History<EventEntry_FileUplink_DecompressError>(maxHistorySize);
+    this->eventHistory_FileUplink_StagedFileExists =
+      new History<EventEntry_FileUplink_StagedFileExists>(maxHistorySize);
     // Initialize histories for typed user output ports
     this->fromPortHistory_bufferSendOut =
       new History<FromPortEntry_bufferSendOut>(maxHistorySize);
@@ -72,6 +84,8 @@ namespace Svc {
   FileUplinkTesterBase ::
     ~FileUplinkTesterBase(void) 
   {
+    // Destroy command history
+    delete this->cmdResponseHistory;
     // Destroy telemetry histories
     delete this->tlmHistory_FileUplink_FilesReceived;
     delete this->tlmHistory_FileUplink_PacketsReceived;
@@ -87,6 +101,11 @@ namespace Svc {
     delete this->eventHistory_FileUplink_InvalidReceiveMode;
     delete this->eventHistory_FileUplink_PacketOutOfBounds;
     delete this->eventHistory_FileUplink_PacketOutOfOrder;
+    delete this->eventHistory_FileUplink_MissingRange;
+    delete this->eventHistory_FileUplink_FileIncomplete;
+    delete this->eventHistory_FileUplink_TooManyRanges;
+    delete this->eventHistory_FileUplink_DecompressError;
+    delete this->eventHistory_FileUplink_StagedFileExists;
   }
 
   void FileUplinkTesterBase ::
@@ -215,6 +234,64 @@ namespace Svc {
 
     }
 
+    // Attach input port cmdResponseOut
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_cmdResponseOut();
+        ++_port
+    ) {
+
+      this->m_from_cmdResponseOut[_port].init();
+      this->m_from_cmdResponseOut[_port].addCallComp(
+          this,
+          from_cmdResponseOut_static
+      );
+      this->m_from_cmdResponseOut[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_cmdResponseOut[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_cmdResponseOut[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port cmdRegOut
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_cmdRegOut();
+        ++_port
+    ) {
+
+      this->m_from_cmdRegOut[_port].init();
+      this->m_from_cmdRegOut[_port].addCallComp(
+          this,
+          from_cmdRegOut_static
+      );
+      this->m_from_cmdRegOut[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_cmdRegOut[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_cmdRegOut[_port].setObjName(_portName);
+#endif
+
+    }
+
     // Attach input port pingOut
 
     for (
@@ -298,6 +375,29 @@ namespace Svc {
 
     }
 
+    // Initialize output port cmdIn
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_to_cmdIn();
+        ++_port
+    ) {
+      this->m_to_cmdIn[_port].init();
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_to_cmdIn[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_to_cmdIn[_port].setObjName(_portName);
+#endif
+
+    }
+
     // Initialize output port pingIn
 
     for (
@@ -357,6 +457,24 @@ namespace Svc {
     return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_eventOut);
   }
 
+  NATIVE_INT_TYPE FileUplinkTesterBase ::
+    getNum_to_cmdIn(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_to_cmdIn);
+  }
+
+  NATIVE_INT_TYPE FileUplinkTesterBase ::
+    getNum_from_cmdResponseOut(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_cmdResponseOut);
+  }
+
+  NATIVE_INT_TYPE FileUplinkTesterBase ::
+    getNum_from_cmdRegOut(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_cmdRegOut);
+  }
+
   NATIVE_INT_TYPE FileUplinkTesterBase ::
     getNum_to_pingIn(void) const
   {
@@ -391,6 +509,16 @@ namespace Svc {
     this->m_to_bufferSendIn[portNum].addCallPort(bufferSendIn);
   }
 
+  void FileUplinkTesterBase ::
+    connect_to_cmdIn(
+        const NATIVE_INT_TYPE portNum,
+        Fw::InputCmdPort *const cmdIn
+    ) 
+  {
+    FW_ASSERT(portNum < this->getNum_to_cmdIn(),static_cast<AssertArg>(portNum));
+    this->m_to_cmdIn[portNum].addCallPort(cmdIn);
+  }
+
   void FileUplinkTesterBase ::
     connect_to_pingIn(
         const NATIVE_INT_TYPE portNum,
@@ -443,6 +571,13 @@ namespace Svc {
     return this->m_to_bufferSendIn[portNum].isConnected();
   }
 
+  bool FileUplinkTesterBase ::
+    isConnected_to_cmdIn(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_to_cmdIn(), static_cast<AssertArg>(portNum));
+    return this->m_to_cmdIn[portNum].isConnected();
+  }
+
   bool FileUplinkTesterBase ::
     isConnected_to_pingIn(const NATIVE_INT_TYPE portNum)
   {
@@ -482,6 +617,20 @@ namespace Svc {
     return &this->m_from_eventOut[portNum];
   }
 
+  Fw::InputCmdResponsePort *FileUplinkTesterBase ::
+    get_from_cmdResponseOut(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_cmdResponseOut(),static_cast<AssertArg>(portNum));
+    return &this->m_from_cmdResponseOut[portNum];
+  }
+
+  Fw::InputCmdRegPort *FileUplinkTesterBase ::
+    get_from_cmdRegOut(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_cmdRegOut(),static_cast<AssertArg>(portNum));
+    return &this->m_from_cmdRegOut[portNum];
+  }
+
   Svc::InputPingPort *FileUplinkTesterBase ::
     get_from_pingOut(const NATIVE_INT_TYPE portNum)
   {
@@ -534,6 +683,30 @@ namespace Svc {
     );
   }
 
+  void FileUplinkTesterBase ::
+    from_cmdResponseOut_static(
+        Fw::PassiveComponentBase *const component,
+        const NATIVE_INT_TYPE portNum,
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CommandResponse response
+    )
+  {
+    FileUplinkTesterBase* _testerBase =
+      static_cast<FileUplinkTesterBase*>(component);
+    _testerBase->cmdResponseIn(opCode, cmdSeq, response);
+  }
+
+  void FileUplinkTesterBase ::
+    from_cmdRegOut_static(
+        Fw::PassiveComponentBase *const component,
+        const NATIVE_INT_TYPE portNum,
+        const FwOpcodeType opCode
+    )
+  {
+
+  }
+
   void FileUplinkTesterBase ::
     from_tlmOut_static(
         Fw::PassiveComponentBase *const component,
@@ -666,6 +839,73 @@ namespace Svc {
     );
   }
 
+  // ----------------------------------------------------------------------
+  // Command response handling
+  // ----------------------------------------------------------------------
+
+  void FileUplinkTesterBase ::
+    cmdResponseIn(
+        const FwOpcodeType opCode,
+        const U32 seq,
+        const Fw::CommandResponse response
+    )
+  {
+    CmdResponse e = { opCode, seq, response };
+    this->cmdResponseHistory->push_back(e);
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Command: FileUplink_ReportMissing
+  // ---------------------------------------------------------------------- 
+
+  void FileUplinkTesterBase ::
+    sendCmd_FileUplink_ReportMissing(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = FileUplinkComponentBase::OPCODE_FILEUPLINK_REPORTMISSING + idBase;
+
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+  
+  void FileUplinkTesterBase ::
+    sendRawCmd(FwOpcodeType opcode, U32 cmdSeq, Fw::CmdArgBuffer& args) {
+       
+    const U32 idBase = this->getIdBase();   
+    FwOpcodeType _opcode = opcode + idBase;
+    if (this->m_to_cmdIn[0].isConnected()) {
+      this->m_to_cmdIn[0].invoke(
+          _opcode,
+          cmdSeq,
+          args
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+        
+  }
+
   // ----------------------------------------------------------------------
   // History 
   // ----------------------------------------------------------------------
@@ -673,6 +913,7 @@ namespace Svc {
   void FileUplinkTesterBase ::
     clearHistory()
   {
+    this->cmdResponseHistory->clear();
     this->clearTlm();
     this->textLogHistory->clear();
     this->clearEvents();
@@ -1167,6 +1408,227 @@ namespace Svc {
 
       }
 
+      case FileUplinkComponentBase::EVENTID_FILEUPLINK_MISSINGRANGE: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 3,_numArgs,3);
+        
+#endif    
+        Fw::LogStringArg fileName;
+        _status = args.deserialize(fileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 byteOffset;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(byteOffset);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 length;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(length);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_HI_FileUplink_MissingRange(fileName, byteOffset, length);
+
+        break;
+
+      }
+
+      case FileUplinkComponentBase::EVENTID_FILEUPLINK_FILEINCOMPLETE: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 2,_numArgs,2);
+        
+#endif    
+        Fw::LogStringArg fileName;
+        _status = args.deserialize(fileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        U32 missingRanges;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(missingRanges);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileUplink_FileIncomplete(fileName, missingRanges);
+
+        break;
+
+      }
+
+      case FileUplinkComponentBase::EVENTID_FILEUPLINK_TOOMANYRANGES: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 2,_numArgs,2);
+        
+#endif    
+        U32 packetIndex;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif      
+        _status = args.deserialize(packetIndex);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        Fw::LogStringArg fileName;
+        _status = args.deserialize(fileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileUplink_TooManyRanges(packetIndex, fileName);
+
+        break;
+
+      }
+
+      case FileUplinkComponentBase::EVENTID_FILEUPLINK_DECOMPRESSERROR: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+        
+#endif    
+        Fw::LogStringArg fileName;
+        _status = args.deserialize(fileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileUplink_DecompressError(fileName);
+
+        break;
+
+      }
+
+      case FileUplinkComponentBase::EVENTID_FILEUPLINK_STAGEDFILEEXISTS: 
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+        
+#endif    
+        Fw::LogStringArg fileName;
+        _status = args.deserialize(fileName);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_FileUplink_StagedFileExists(fileName);
+
+        break;
+
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -1188,6 +1650,11 @@ namespace Svc {
     this->eventHistory_FileUplink_PacketOutOfBounds->clear();
     this->eventHistory_FileUplink_PacketOutOfOrder->clear();
     this->eventsSize_FileUplink_UplinkCanceled = 0;
+    this->eventHistory_FileUplink_MissingRange->clear();
+    this->eventHistory_FileUplink_FileIncomplete->clear();
+    this->eventHistory_FileUplink_TooManyRanges->clear();
+    this->eventHistory_FileUplink_DecompressError->clear();
+    this->eventHistory_FileUplink_StagedFileExists->clear();
   }
 
 #if FW_ENABLE_TEXT_LOGGING
@@ -1398,4 +1865,88 @@ namespace Svc {
     ++this->eventsSize;
   }
 
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_MissingRange 
+  // ----------------------------------------------------------------------
+
+  void FileUplinkTesterBase ::
+    logIn_ACTIVITY_HI_FileUplink_MissingRange(
+        Fw::LogStringArg& fileName,
+        U32 byteOffset,
+        U32 length
+    )
+  {
+    EventEntry_FileUplink_MissingRange e = {
+      fileName, byteOffset, length
+    };
+    eventHistory_FileUplink_MissingRange->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_FileIncomplete 
+  // ----------------------------------------------------------------------
+
+  void FileUplinkTesterBase ::
+    logIn_WARNING_HI_FileUplink_FileIncomplete(
+        Fw::LogStringArg& fileName,
+        U32 missingRanges
+    )
+  {
+    EventEntry_FileUplink_FileIncomplete e = {
+      fileName, missingRanges
+    };
+    eventHistory_FileUplink_FileIncomplete->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_TooManyRanges 
+  // ----------------------------------------------------------------------
+
+  void FileUplinkTesterBase ::
+    logIn_WARNING_HI_FileUplink_TooManyRanges(
+        U32 packetIndex,
+        Fw::LogStringArg& fileName
+    )
+  {
+    EventEntry_FileUplink_TooManyRanges e = {
+      packetIndex, fileName
+    };
+    eventHistory_FileUplink_TooManyRanges->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_DecompressError 
+  // ----------------------------------------------------------------------
+
+  void FileUplinkTesterBase ::
+    logIn_WARNING_HI_FileUplink_DecompressError(
+        Fw::LogStringArg& fileName
+    )
+  {
+    EventEntry_FileUplink_DecompressError e = {
+      fileName
+    };
+    eventHistory_FileUplink_DecompressError->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: FileUplink_StagedFileExists 
+  // ----------------------------------------------------------------------
+
+  void FileUplinkTesterBase ::
+    logIn_WARNING_HI_FileUplink_StagedFileExists(
+        Fw::LogStringArg& fileName
+    )
+  {
+    EventEntry_FileUplink_StagedFileExists e = {
+      fileName
+    };
+    eventHistory_FileUplink_StagedFileExists->push_back(e);
+    ++this->eventsSize;
+  }
+
 } // end namespace Svc
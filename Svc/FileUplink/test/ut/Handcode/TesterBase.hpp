@@ -54,6 +54,13 @@ namespace Svc {
           Fw::InputBufferSendPort *const bufferSendIn /*!< The port*/
       );
 
+      //! Connect cmdIn to to_cmdIn[portNum]
+      //!
+      void connect_to_cmdIn(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::InputCmdPort *const cmdIn /*!< The port*/
+      );
+
       //! Connect pingIn to to_pingIn[portNum]
       //!
       void connect_to_pingIn(
@@ -100,6 +107,22 @@ namespace Svc {
           const NATIVE_INT_TYPE portNum /*!< The port number*/
       );
 
+      //! Get the port that receives input from cmdResponseOut
+      //!
+      //! \return from_cmdResponseOut[portNum]
+      //!
+      Fw::InputCmdResponsePort* get_from_cmdResponseOut(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from cmdRegOut
+      //!
+      //! \return from_cmdRegOut[portNum]
+      //!
+      Fw::InputCmdRegPort* get_from_cmdRegOut(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
       //! Get the port that receives input from pingOut
       //!
       //! \return from_pingOut[portNum]
@@ -355,6 +378,24 @@ namespace Svc {
       //!
       NATIVE_INT_TYPE getNum_from_eventOut(void) const;
 
+      //! Get the number of to_cmdIn ports
+      //!
+      //! \return The number of to_cmdIn ports
+      //!
+      NATIVE_INT_TYPE getNum_to_cmdIn(void) const;
+
+      //! Get the number of from_cmdResponseOut ports
+      //!
+      //! \return The number of from_cmdResponseOut ports
+      //!
+      NATIVE_INT_TYPE getNum_from_cmdResponseOut(void) const;
+
+      //! Get the number of from_cmdRegOut ports
+      //!
+      //! \return The number of from_cmdRegOut ports
+      //!
+      NATIVE_INT_TYPE getNum_from_cmdRegOut(void) const;
+
       //! Get the number of to_pingIn ports
       //!
       //! \return The number of to_pingIn ports
@@ -389,6 +430,14 @@ namespace Svc {
           const NATIVE_INT_TYPE portNum /*!< The port number*/
       );
 
+      //! Check whether port is connected
+      //!
+      //! Whether to_cmdIn[portNum] is connected
+      //!
+      bool isConnected_to_cmdIn(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
       //! Check whether port is connected
       //!
       //! Whether to_pingIn[portNum] is connected
@@ -397,6 +446,48 @@ namespace Svc {
           const NATIVE_INT_TYPE portNum /*!< The port number*/
       );
 
+      // ----------------------------------------------------------------------
+      // Functions for sending commands
+      // ----------------------------------------------------------------------
+
+    protected:
+    
+      // send command buffers directly - used for intentional command encoding errors
+      void sendRawCmd(FwOpcodeType opcode, U32 cmdSeq, Fw::CmdArgBuffer& args); 
+
+      //! Send a FileUplink_ReportMissing command
+      //!
+      void sendCmd_FileUplink_ReportMissing(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq /*!< The command sequence number*/
+      );
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Command response handling
+      // ----------------------------------------------------------------------
+
+      //! Handle a command response
+      //!
+      virtual void cmdResponseIn(
+          const FwOpcodeType opCode, /*!< The opcode*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CommandResponse response /*!< The command response*/
+      );
+
+      //! A type representing a command response
+      //!
+      typedef struct {
+        FwOpcodeType opCode;
+        U32 cmdSeq;
+        Fw::CommandResponse response;
+      } CmdResponse;
+
+      //! The command response history
+      //!
+      History<CmdResponse> *cmdResponseHistory;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -650,6 +741,129 @@ namespace Svc {
       //!
       U32 eventsSize_FileUplink_UplinkCanceled;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_MissingRange
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileUplink_MissingRange
+      //!
+      virtual void logIn_ACTIVITY_HI_FileUplink_MissingRange(
+          Fw::LogStringArg& fileName, /*!< The name of the file*/
+          U32 byteOffset, /*!< The offset of the first missing byte*/
+          U32 length /*!< The number of missing bytes*/
+      );
+
+      //! A history entry for event FileUplink_MissingRange
+      //!
+      typedef struct {
+        Fw::LogStringArg fileName;
+        U32 byteOffset;
+        U32 length;
+      } EventEntry_FileUplink_MissingRange;
+
+      //! The history of FileUplink_MissingRange events
+      //!
+      History<EventEntry_FileUplink_MissingRange> 
+        *eventHistory_FileUplink_MissingRange;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_FileIncomplete
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileUplink_FileIncomplete
+      //!
+      virtual void logIn_WARNING_HI_FileUplink_FileIncomplete(
+          Fw::LogStringArg& fileName, /*!< The name of the file*/
+          U32 missingRanges /*!< The number of missing byte ranges*/
+      );
+
+      //! A history entry for event FileUplink_FileIncomplete
+      //!
+      typedef struct {
+        Fw::LogStringArg fileName;
+        U32 missingRanges;
+      } EventEntry_FileUplink_FileIncomplete;
+
+      //! The history of FileUplink_FileIncomplete events
+      //!
+      History<EventEntry_FileUplink_FileIncomplete> 
+        *eventHistory_FileUplink_FileIncomplete;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_TooManyRanges
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileUplink_TooManyRanges
+      //!
+      virtual void logIn_WARNING_HI_FileUplink_TooManyRanges(
+          U32 packetIndex, /*!< The sequence index of the packet*/
+          Fw::LogStringArg& fileName /*!< The name of the file*/
+      );
+
+      //! A history entry for event FileUplink_TooManyRanges
+      //!
+      typedef struct {
+        U32 packetIndex;
+        Fw::LogStringArg fileName;
+      } EventEntry_FileUplink_TooManyRanges;
+
+      //! The history of FileUplink_TooManyRanges events
+      //!
+      History<EventEntry_FileUplink_TooManyRanges> 
+        *eventHistory_FileUplink_TooManyRanges;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_DecompressError
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileUplink_DecompressError
+      //!
+      virtual void logIn_WARNING_HI_FileUplink_DecompressError(
+          Fw::LogStringArg& fileName /*!< The name of the file*/
+      );
+
+      //! A history entry for event FileUplink_DecompressError
+      //!
+      typedef struct {
+        Fw::LogStringArg fileName;
+      } EventEntry_FileUplink_DecompressError;
+
+      //! The history of FileUplink_DecompressError events
+      //!
+      History<EventEntry_FileUplink_DecompressError> 
+        *eventHistory_FileUplink_DecompressError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: FileUplink_StagedFileExists
+      // ----------------------------------------------------------------------
+
+      //! Handle event FileUplink_StagedFileExists
+      //!
+      virtual void logIn_WARNING_HI_FileUplink_StagedFileExists(
+          Fw::LogStringArg& fileName /*!< The name of the staged file*/
+      );
+
+      //! A history entry for event FileUplink_StagedFileExists
+      //!
+      typedef struct {
+        Fw::LogStringArg fileName;
+      } EventEntry_FileUplink_StagedFileExists;
+
+      //! The history of FileUplink_StagedFileExists events
+      //!
+      History<EventEntry_FileUplink_StagedFileExists> 
+        *eventHistory_FileUplink_StagedFileExists;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -769,6 +983,10 @@ namespace Svc {
       //!
       Fw::OutputBufferSendPort m_to_bufferSendIn[1];
 
+      //! To port connected to cmdIn
+      //!
+      Fw::OutputCmdPort m_to_cmdIn[1];
+
       //! To port connected to pingIn
       //!
       Svc::OutputPingPort m_to_pingIn[1];
@@ -795,6 +1013,14 @@ namespace Svc {
       //!
       Fw::InputLogPort m_from_eventOut[1];
 
+      //! From port connected to cmdResponseOut
+      //!
+      Fw::InputCmdResponsePort m_from_cmdResponseOut[1];
+
+      //! From port connected to cmdRegOut
+      //!
+      Fw::InputCmdRegPort m_from_cmdRegOut[1];
+
       //! From port connected to pingOut
       //!
       Svc::InputPingPort m_from_pingOut[1];
@@ -848,6 +1074,24 @@ namespace Svc {
           Fw::LogBuffer &args /*!< Buffer containing serialized log entry*/
       );
 
+      //! Static function for port from_cmdResponseOut
+      //!
+      static void from_cmdResponseOut_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          FwOpcodeType opCode, /*!< Command Op Code*/
+          U32 cmdSeq, /*!< Command Sequence*/
+          Fw::CommandResponse response /*!< The command response argument*/
+      );
+
+      //! Static function for port from_cmdRegOut
+      //!
+      static void from_cmdRegOut_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          FwOpcodeType opCode /*!< Command Op Code*/
+      );
+
       //! Static function for port from_pingOut
       //!
       static void from_pingOut_static(
@@ -49,6 +49,31 @@ TEST(FileUplink, PacketOutOfOrder) {
   tester.packetOutOfOrder();
 }
 
+TEST(FileUplink, PacketsReordered) {
+  Svc::Tester tester;
+  tester.packetsReordered();
+}
+
+TEST(FileUplink, MissingRanges) {
+  Svc::Tester tester;
+  tester.missingRanges();
+}
+
+TEST(FileUplink, WriteErrorMissing) {
+  Svc::Tester tester;
+  tester.writeErrorMissing();
+}
+
+TEST(FileUplink, ReportMissingInStartMode) {
+  Svc::Tester tester;
+  tester.reportMissingInStartMode();
+}
+
+TEST(FileUplink, TooManyRanges) {
+  Svc::Tester tester;
+  tester.tooManyRanges();
+}
+
 TEST(FileUplink, CancelPacketInStartMode) {
   Svc::Tester tester;
   tester.cancelPacketInStartMode();
@@ -59,6 +84,11 @@ TEST(FileUplink, CancelPacketInDataMode) {
   tester.cancelPacketInDataMode();
 }
 
+TEST(FileUplink, ReceiveCompressed) {
+  Svc::Tester tester;
+  tester.receiveCompressed();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
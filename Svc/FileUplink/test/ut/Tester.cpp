@@ -14,10 +14,12 @@
 #include <string.h>
 
 #include "Tester.hpp"
+#include "Utils/Lz/LzEncoder.hpp"
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
 #define QUEUE_DEPTH 10
+#define CMD_SEQ 0
 
 namespace Svc {
 
@@ -193,7 +195,7 @@ namespace Svc {
     const char *const sourcePath = "source.bin";
     const char *const destPath = "dest.bin";
     U8 packetData[] = { 0, 1, 2, 3, 4 };
-    const size_t fileSize = 2 * PACKET_SIZE;
+    const size_t fileSize = PACKET_SIZE;
 
     // Send the start packet (packet 0)
     this->sendStartPacket(sourcePath, destPath, fileSize);
@@ -207,8 +209,9 @@ namespace Svc {
     // Close the file so writing will fail
     this->component.file.osFile.close();
 
-    // Send the data packet (packet 1)
-    const size_t byteOffset = PACKET_SIZE;
+    // Send the data packet (packet 1). It completes the file,
+    // so the buffered data is written out
+    const size_t byteOffset = 0;
     this->sendDataPacket(byteOffset, packetData);
     ASSERT_TLM_SIZE(2);
     ASSERT_TLM_FileUplink_PacketsReceived(
@@ -377,6 +380,243 @@ namespace Svc {
 
   }
 
+  void Tester ::
+    packetsReordered(void) 
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = 2;
+    U8 packetData[numPackets][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 }, 
+      { 5, 6, 7, 8, 9 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    // Send the start packet (packet 0)
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send packet 2 ahead of packet 1
+    this->sequenceIndex = 2;
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_PacketOutOfOrder(0, 2, 0);
+
+    // Packet 1 arrives late and fills the gap without a warning
+    this->sequenceIndex = 1;
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+
+    // A duplicate of packet 1 leaves the file unchanged
+    this->sequenceIndex = 1;
+    U8 duplicateData[PACKET_SIZE] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    this->sendDataPacket(0, duplicateData);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send the end packet (packet 3)
+    this->sequenceIndex = 3;
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileReceived(0, destPath);
+    ASSERT_EQ(FileUplink::START, this->component.receiveMode);
+
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+    this->removeFile(destPath);
+
+  }
+
+  void Tester ::
+    missingRanges(void) 
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 }, 
+      { 5, 6, 7, 8, 9 },
+      { 10, 11, 12, 13, 14 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    // Send the start packet (packet 0) and data packet 1
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Simulate dropping of packet 2
+    ++this->sequenceIndex;
+
+    // Send data packet 3 and the end packet (packet 4)
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_PacketOutOfOrder(0, 3, 1);
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+
+    // The file stays open and the gap is reported
+    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_FileUplink_Warnings(0, 2);
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_FileUplink_MissingRange_SIZE(1);
+    ASSERT_EVENTS_FileUplink_MissingRange(0, destPath, PACKET_SIZE, PACKET_SIZE);
+    ASSERT_EVENTS_FileUplink_FileIncomplete_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileIncomplete(0, destPath, 1);
+    ASSERT_EQ(FileUplink::DATA, this->component.receiveMode);
+
+    // Ask for the gap again
+    this->clearHistory();
+    this->sendCmd_FileUplink_ReportMissing(INSTANCE, CMD_SEQ);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileUplink::OPCODE_FILEUPLINK_REPORTMISSING,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_MissingRange(0, destPath, PACKET_SIZE, PACKET_SIZE);
+
+    // Resend the dropped data. This completes the file
+    this->sequenceIndex = 2;
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    ASSERT_TLM_FileUplink_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileReceived(0, destPath);
+    ASSERT_EQ(FileUplink::START, this->component.receiveMode);
+
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+    this->removeFile(destPath);
+
+  }
+
+  void Tester ::
+    writeErrorMissing(void) 
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = 2;
+    U8 packetData[numPackets][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 }, 
+      { 5, 6, 7, 8, 9 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    // Send the start packet (packet 0) and data packet 1.
+    // The data stays in the write buffer
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Close the file so writing will fail
+    this->component.file.osFile.close();
+
+    // Simulate dropping of packet 2 and send the end packet (packet 3).
+    // Writing out the buffered data fails, so it is reported missing
+    ++this->sequenceIndex;
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_EVENTS_SIZE(4);
+    ASSERT_EVENTS_FileUplink_PacketOutOfOrder_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileWriteError_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileWriteError(0, destPath);
+    ASSERT_EVENTS_FileUplink_MissingRange_SIZE(1);
+    ASSERT_EVENTS_FileUplink_MissingRange(0, destPath, 0, fileSize);
+    ASSERT_EVENTS_FileUplink_FileIncomplete_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileIncomplete(0, destPath, 1);
+    ASSERT_EQ(FileUplink::DATA, this->component.receiveMode);
+
+    // Ask for the missing data again
+    this->clearHistory();
+    this->sendCmd_FileUplink_ReportMissing(INSTANCE, CMD_SEQ);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileUplink::OPCODE_FILEUPLINK_REPORTMISSING,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_MissingRange(0, destPath, 0, fileSize);
+
+    // Reopen the file and resend the data. This completes the file
+    // with a good checksum
+    ASSERT_EQ(
+        Os::File::OP_OK,
+        this->component.file.osFile.open(destPath, Os::File::OPEN_WRITE)
+    );
+    this->sequenceIndex = 1;
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    ASSERT_TLM_FileUplink_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileReceived(0, destPath);
+    ASSERT_EQ(FileUplink::START, this->component.receiveMode);
+
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+    this->removeFile(destPath);
+
+  }
+
+  void Tester ::
+    reportMissingInStartMode(void) 
+  {
+    this->sendCmd_FileUplink_ReportMissing(INSTANCE, CMD_SEQ);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileUplink::OPCODE_FILEUPLINK_REPORTMISSING,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+    ASSERT_EVENTS_SIZE(0);
+  }
+
+  void Tester ::
+    tooManyRanges(void) 
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = FILEUPLINK_MAX_RANGES + 1;
+    const size_t fileSize = 2 * numPackets * PACKET_SIZE;
+    U8 packetData[PACKET_SIZE] = { 0, 1, 2, 3, 4 };
+
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+
+    // Every other packet starts a new range
+    for (U32 i = 0; i < numPackets - 1; ++i) {
+      this->sendDataPacket(2 * i * PACKET_SIZE, packetData);
+      ASSERT_EVENTS_SIZE(0);
+    }
+
+    // The range table is full
+    this->sendDataPacket(2 * (numPackets - 1) * PACKET_SIZE, packetData);
+    ASSERT_TLM_FileUplink_Warnings(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_TooManyRanges(0, numPackets, destPath);
+
+    // A packet that extends an existing range is still accepted
+    this->sendDataPacket(PACKET_SIZE, packetData);
+    ASSERT_EVENTS_SIZE(0);
+
+    this->removeFile(destPath);
+
+  }
+
   void Tester ::
     cancelPacketInStartMode(void) 
   {
@@ -459,6 +699,134 @@ namespace Svc {
     this->removeFile("test.bin");
 
   }
+
+  void Tester ::
+    receiveCompressed(void) 
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const char *const stagedPath = "dest.bin.lz.tmp";
+    U8 fileData[40];
+    for (U32 i = 0; i < sizeof(fileData); ++i) {
+      fileData[i] = static_cast<U8>(i % 4);
+    }
+    Utils::LzEncoder encoder;
+    U8 stream[Utils::LzEncoder::bound(sizeof(fileData))];
+    const U32 streamSize = encoder.encode(fileData, sizeof(fileData), stream);
+    ASSERT_LT(streamSize, sizeof(fileData));
+    CFDP::Checksum checksum;
+    checksum.update(stream, 0, streamSize);
+
+    // Send the compressed stream
+    this->sendStartPacket(
+        sourcePath,
+        destPath,
+        streamSize,
+        Fw::FilePacket::StartPacket::FLAG_COMPRESSED
+    );
+    this->sendDataPacket(0, stream, streamSize);
+    this->sendEndPacket(checksum);
+    ASSERT_EQ(FileUplink::START, this->component.receiveMode);
+
+    // The file is decompressed by decompressStep messages
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_TRUE(this->component.decompressor.isBusy());
+    this->dispatchDecompression();
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileReceived(0, destPath);
+    ASSERT_FALSE(this->component.decompressor.isBusy());
+
+    // The file is decompressed and the staged stream is removed
+    this->verifyFileData(destPath, fileData, sizeof(fileData));
+    Os::File file;
+    ASSERT_NE(Os::File::OP_OK, file.open(stagedPath, Os::File::OPEN_READ));
+    this->removeFile(destPath);
+
+    // Send the stream to the same destination twice. The second START
+    // packet finishes the first decompression.
+    this->sendStartPacket(
+        sourcePath,
+        destPath,
+        streamSize,
+        Fw::FilePacket::StartPacket::FLAG_COMPRESSED
+    );
+    this->sendDataPacket(0, stream, streamSize);
+    this->sendEndPacket(checksum);
+    this->sendStartPacket(
+        sourcePath,
+        destPath,
+        streamSize,
+        Fw::FilePacket::StartPacket::FLAG_COMPRESSED
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileReceived(0, destPath);
+    ASSERT_EQ(FileUplink::DATA, this->component.receiveMode);
+    this->verifyFileData(destPath, fileData, sizeof(fileData));
+    this->sendDataPacket(0, stream, streamSize);
+    this->sendEndPacket(checksum);
+    this->dispatchDecompression();
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_FileReceived(0, destPath);
+    this->verifyFileData(destPath, fileData, sizeof(fileData));
+    this->removeFile(destPath);
+
+    // Send a stream with a bad frame header
+    stream[0] = 0;
+    stream[1] = 0;
+    CFDP::Checksum badChecksum;
+    badChecksum.update(stream, 0, streamSize);
+    this->sendStartPacket(
+        sourcePath,
+        destPath,
+        streamSize,
+        Fw::FilePacket::StartPacket::FLAG_COMPRESSED
+    );
+    this->sendDataPacket(0, stream, streamSize);
+    this->sendEndPacket(badChecksum);
+    this->dispatchDecompression();
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_FileUplink_DecompressError(0, destPath);
+    ASSERT_EVENTS_FileUplink_FileReceived(0, destPath);
+    ASSERT_TLM_FileUplink_Warnings(0, 1);
+
+    // The staged stream is removed, so the file can be sent again
+    ASSERT_NE(Os::File::OP_OK, file.open(stagedPath, Os::File::OPEN_READ));
+    this->removeFile(destPath);
+
+    // A canceled compressed file leaves no staged stream
+    this->sendStartPacket(
+        sourcePath,
+        destPath,
+        streamSize,
+        Fw::FilePacket::StartPacket::FLAG_COMPRESSED
+    );
+    this->sendDataPacket(0, stream, streamSize / 2);
+    this->sendCancelPacket();
+    ASSERT_NE(Os::File::OP_OK, file.open(stagedPath, Os::File::OPEN_READ));
+    ASSERT_FALSE(this->component.decompressor.isBusy());
+
+    // A file that has the staged name is not written over
+    ASSERT_EQ(
+        Os::File::OP_OK,
+        file.open(stagedPath, Os::File::OPEN_CREATE)
+    );
+    NATIVE_INT_TYPE writeSize = streamSize;
+    ASSERT_EQ(Os::File::OP_OK, file.write(stream, writeSize));
+    file.close();
+    this->sendStartPacket(
+        sourcePath,
+        destPath,
+        streamSize,
+        Fw::FilePacket::StartPacket::FLAG_COMPRESSED
+    );
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileUplink_StagedFileExists(0, stagedPath);
+    ASSERT_EQ(FileUplink::START, this->component.receiveMode);
+    this->verifyFileData(stagedPath, stream, streamSize);
+    this->removeFile(stagedPath);
+
+  }
     
   // ----------------------------------------------------------------------
   // Handlers for from ports
@@ -490,6 +858,24 @@ namespace Svc {
     connectPorts(void) 
   {
 
+    // cmdIn
+    this->connect_to_cmdIn(
+        0,
+        this->component.get_cmdIn_InputPort(0)
+    );
+
+    // cmdResponseOut
+    this->component.set_cmdResponseOut_OutputPort(
+        0, 
+        this->get_from_cmdResponseOut(0)
+    );
+
+    // cmdRegOut
+    this->component.set_cmdRegOut_OutputPort(
+        0, 
+        this->get_from_cmdRegOut(0)
+    );
+
     // bufferSendIn
     this->connect_to_bufferSendIn(
         0,
@@ -561,7 +947,10 @@ namespace Svc {
     ASSERT_EQ(Fw::FW_SERIALIZE_OK, status);
 
     this->invoke_to_bufferSendIn(0, buffer);
-    this->component.doDispatch();
+    // Decompression steps queued ahead of the packet run first
+    while (this->fromPortHistory_bufferSendOut->size() == 0) {
+      this->component.doDispatch();
+    }
 
     ASSERT_from_bufferSendOut_SIZE(1);
     ASSERT_from_bufferSendOut(0, buffer);
@@ -572,11 +961,12 @@ namespace Svc {
     sendStartPacket(
         const char *const sourcePath,
         const char *const destPath,
-        const size_t fileSize
+        const size_t fileSize,
+        const U8 flags
     )
   {
     Fw::FilePacket::StartPacket startPacket;
-    startPacket.initialize(fileSize, sourcePath, destPath);
+    startPacket.initialize(fileSize, sourcePath, destPath, flags);
     Fw::FilePacket filePacket;
     filePacket.fromStartPacket(startPacket);
     this->sendFilePacket(filePacket);
@@ -586,13 +976,14 @@ namespace Svc {
   void Tester ::
     sendDataPacket(
         const size_t byteOffset,
-        U8 *const packetData
+        U8 *const packetData,
+        const U32 dataSize
     )
   {
     const Fw::FilePacket::DataPacket dataPacket = {
       { Fw::FilePacket::T_DATA, this->sequenceIndex++ },
       static_cast<U32>(byteOffset),
-      PACKET_SIZE,
+      static_cast<U16>(dataSize),
       packetData
     };
     Fw::FilePacket filePacket;
@@ -628,6 +1019,14 @@ namespace Svc {
     this->sendFilePacket(filePacket);
   }
 
+  void Tester ::
+    dispatchDecompression(void)
+  {
+    while (this->component.decompressPending) {
+      this->component.doDispatch();
+    }
+  }
+
   void Tester ::
     verifyFileData(
         const char *const path,
@@ -80,6 +80,28 @@ namespace Svc {
       //!
       void packetOutOfOrder(void);
 
+      //! Send data packets out of order and twice
+      //!
+      void packetsReordered(void);
+
+      //! Send a file with a missing packet and fill the gap after
+      //! the END packet
+      //!
+      void missingRanges(void);
+
+      //! Fail a write and report the bytes that were not written
+      //! as missing
+      //!
+      void writeErrorMissing(void);
+
+      //! Send the ReportMissing command in START mode
+      //!
+      void reportMissingInStartMode(void);
+
+      //! Fill the received range table
+      //!
+      void tooManyRanges(void);
+
       //! Send a CANCEL packet in START mode
       //!
       void cancelPacketInStartMode(void);
@@ -88,6 +110,12 @@ namespace Svc {
       //!
       void cancelPacketInDataMode(void);
 
+      //! Send a compressed file, the same file twice in a row, a
+      //! compressed file that does not decompress, a canceled compressed
+      //! file, and a compressed file whose staged name is taken
+      //!
+      void receiveCompressed(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -133,14 +161,16 @@ namespace Svc {
       void sendStartPacket(
           const char *const sourcePath, //!< The source path
           const char *const destPath, //!< The destination path
-          const size_t fileSize //!< The file size
+          const size_t fileSize, //!< The file size
+          const U8 flags = 0 //!< The start packet flags
       );
 
       //! Send a DataPacket
       //!
       void sendDataPacket(
           const size_t byteOffset,
-          U8 *const packetData
+          U8 *const packetData,
+          const U32 dataSize = PACKET_SIZE
       );
 
       //! Send an EndPacket
@@ -151,6 +181,10 @@ namespace Svc {
       //!
       void sendCancelPacket(void);
 
+      //! Dispatch messages until no decompressStep message is queued
+      //!
+      void dispatchDecompression(void);
+
       //! Verify file data
       //!
       void verifyFileData(
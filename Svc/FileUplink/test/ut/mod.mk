@@ -19,6 +19,7 @@ TEST_MODS= \
 	Fw/Tlm \
 	Fw/Types \
 	Utils/Hash \
+	Utils/Lz \
 	Os \
 	Svc/FileUplink \
 	gtest
@@ -9,37 +9,116 @@
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/BasicTypes.hpp>
 
+#include <new>
+
+// Full memory barrier for the lock-free read path
+#define POLYDB_BARRIER() __sync_synchronize()
+
 namespace Svc {
 #if FW_OBJECT_NAMES == 1
     PolyDbImpl::PolyDbImpl(const char* name) : PolyDbComponentBase(name) {
 #else
     PolyDbImpl::PolyDbImpl() {
 #endif
-        // initialize all entries to stale
-        for (NATIVE_INT_TYPE entry = 0; entry < POLYDB_NUM_DB_ENTRIES; entry++) {
-            this->m_db[entry].status = MEASUREMENT_STALE;
-        }
+        this->m_allocatorId = 0;
+        this->m_allocation = NULL;
+        this->setDb(this->m_defaultDb,POLYDB_NUM_DB_ENTRIES);
     }
 
     void PolyDbImpl::init(NATIVE_INT_TYPE instance) {
         PolyDbComponentBase::init(instance);
     }
 
-    // If ports are no longer guarded, these accesses need to be protected from each other
-    // If there are a lot of accesses, perhaps an interrupt lock could be used instead of guarded ports
+    void PolyDbImpl::allocateDb(NATIVE_INT_TYPE identifier, Fw::MemAllocator& allocator, NATIVE_UINT_TYPE numEntries) {
+        FW_ASSERT(NULL == this->m_allocation);
+        FW_ASSERT(numEntries > 0);
+        void* mem = allocator.allocate(identifier,numEntries*sizeof(t_dbStruct));
+        FW_ASSERT(mem != NULL);
+        t_dbStruct* db = static_cast<t_dbStruct*>(mem);
+        for (NATIVE_UINT_TYPE entry = 0; entry < numEntries; entry++) {
+            new (&db[entry]) t_dbStruct();
+        }
+        this->m_allocatorId = identifier;
+        this->m_allocation = mem;
+        this->setDb(db,numEntries);
+    }
+
+    void PolyDbImpl::deallocateDb(Fw::MemAllocator& allocator) {
+        FW_ASSERT(this->m_allocation != NULL);
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_dbSize; entry++) {
+            this->m_db[entry].~t_dbStruct();
+        }
+        void* mem = this->m_allocation;
+        this->m_allocation = NULL;
+        this->setDb(this->m_defaultDb,POLYDB_NUM_DB_ENTRIES);
+        allocator.deallocate(this->m_allocatorId,mem);
+    }
+
+    void PolyDbImpl::setDb(t_dbStruct* db, NATIVE_UINT_TYPE dbSize) {
+        this->m_db = db;
+        this->m_dbSize = dbSize;
+        // initialize all entries to stale
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_dbSize; entry++) {
+            this->m_db[entry].seq = 0;
+            this->m_db[entry].status = MEASUREMENT_STALE;
+        }
+    }
+
+    // Readers don't take the lock. Each entry has a sequence number that the writer
+    // makes odd while it updates the entry, and readers retry if the number was odd
+    // or changed while they copied the entry. setValue stays guarded so that writers
+    // are serialized with each other.
+
+    void PolyDbImpl::readEntry(U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val) {
+        FW_ASSERT(entry < this->m_dbSize,entry);
+        t_dbStruct& dbEntry = this->m_db[entry];
+        for (NATIVE_INT_TYPE attempt = 0; attempt < POLYDB_READ_RETRIES; attempt++) {
+            const U32 seq = dbEntry.seq;
+            if (seq & 1) {
+                // update in progress
+                continue;
+            }
+            POLYDB_BARRIER();
+            status = dbEntry.status;
+            time = dbEntry.time;
+            val = dbEntry.val;
+            POLYDB_BARRIER();
+            if (dbEntry.seq == seq) {
+                return;
+            }
+        }
+        // kept losing to updates; wait for the writer
+        this->lock();
+        status = dbEntry.status;
+        time = dbEntry.time;
+        val = dbEntry.val;
+        this->unLock();
+    }
 
     void PolyDbImpl::getValue_handler(NATIVE_INT_TYPE portNum, U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val) {
-        FW_ASSERT(entry < POLYDB_NUM_DB_ENTRIES,entry);
-        status = this->m_db[entry].status;
-        time = this->m_db[entry].time;
-        val = this->m_db[entry].val;
+        this->readEntry(entry,status,time,val);
+    }
+
+    void PolyDbImpl::getBatch_handler(NATIVE_INT_TYPE portNum, Svc::PolyEntries &entries) {
+        MeasurementStatus status;
+        Fw::Time time;
+        Fw::PolyType val;
+        for (NATIVE_UINT_TYPE index = 0; index < entries.getNumEntries(); index++) {
+            this->readEntry(entries.getEntry(index),status,time,val);
+            entries.setValue(index,status,time,val);
+        }
     }
 
     void PolyDbImpl::setValue_handler(NATIVE_INT_TYPE portNum, U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val) {
-        FW_ASSERT(entry < POLYDB_NUM_DB_ENTRIES,entry);
-        this->m_db[entry].status = status;
-        this->m_db[entry].time = time;
-        this->m_db[entry].val = val;
+        FW_ASSERT(entry < this->m_dbSize,entry);
+        t_dbStruct& dbEntry = this->m_db[entry];
+        dbEntry.seq = dbEntry.seq + 1;
+        POLYDB_BARRIER();
+        dbEntry.status = status;
+        dbEntry.time = time;
+        dbEntry.val = val;
+        POLYDB_BARRIER();
+        dbEntry.seq = dbEntry.seq + 1;
     }
 
     PolyDbImpl::~PolyDbImpl() {
@@ -15,6 +15,7 @@
 #include <Svc/PolyDb/PolyDbComponentAc.hpp>
 #include <Fw/Types/PolyType.hpp>
 #include <Svc/PolyDb/PolyDbImplCfg.hpp>
+#include <Fw/Types/MemAllocator.hpp>
 
 namespace Svc {
 
@@ -30,6 +31,9 @@ namespace Svc {
 
     class PolyDbImpl : public PolyDbComponentBase {
         public:
+
+            friend class PolyDbImplTester;
+
             //!  \brief PolyDbImpl constructor
             //!
             //!  The constructor initializes the database to "MEASUREMENT_STALE."
@@ -50,6 +54,26 @@ namespace Svc {
 
             void init(NATIVE_INT_TYPE instance);
 
+            //!  \brief PolyDbImpl database allocation
+            //!
+            //!  Replaces the built-in table of POLYDB_NUM_DB_ENTRIES entries with
+            //!  a table allocated from the allocator. Call it before any values
+            //!  are read or written. All entries start out MEASUREMENT_STALE.
+            //!
+            //!  \param identifier the memory segment identifier
+            //!  \param allocator the memory allocator
+            //!  \param numEntries the number of entries in the table
+
+            void allocateDb(NATIVE_INT_TYPE identifier, Fw::MemAllocator& allocator, NATIVE_UINT_TYPE numEntries);
+
+            //!  \brief PolyDbImpl database deallocation
+            //!
+            //!  Returns the table allocated by allocateDb(). Call it before the destructor.
+            //!
+            //!  \param allocator the memory allocator
+
+            void deallocateDb(Fw::MemAllocator& allocator);
+
             //!  \brief PolyDbImpl destructor
             //!
             //!  The destructor is empty.
@@ -84,6 +108,18 @@ namespace Svc {
 
             void setValue_handler(NATIVE_INT_TYPE portNum, U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val);
 
+            //!  \brief The batch getter port handler
+            //!
+            //!  The batch getter port handler looks up each entry in the
+            //!  batch and fills in its status, time, and value. Each entry
+            //!  is read consistently, but the batch is not a snapshot taken
+            //!  at a single instant.
+            //!
+            //!  \param portNum port number of request (always 0)
+            //!  \param entries the entries to look up
+
+            void getBatch_handler(NATIVE_INT_TYPE portNum, Svc::PolyEntries &entries);
+
             //! \struct t_dbStruct
             //! \brief PolyDb database structure
             //!
@@ -92,10 +128,39 @@ namespace Svc {
             //!
 
             struct t_dbStruct {
+                volatile U32 seq; //!< incremented before and after each update; odd while updating
                 MeasurementStatus status; //!< last status of measurement
                 Fw::PolyType val; //!< the last value of the measurement
                 Fw::Time time; //!< the timetag of the last measurement
-            } m_db[POLYDB_NUM_DB_ENTRIES];
+            };
+
+            //!  \brief Use a table for the database
+            //!
+            //!  \param db the table
+            //!  \param dbSize the number of entries in the table
+
+            void setDb(t_dbStruct* db, NATIVE_UINT_TYPE dbSize);
+
+            //!  \brief Read an entry
+            //!
+            //!  Reads without the lock, retrying if the entry is updated during
+            //!  the read. After POLYDB_READ_RETRIES attempts it takes the lock,
+            //!  so an update stalled by a lower-priority writer can't starve it.
+            //!
+            //!  \param entry the entry to read
+            //!  \param status last status of retrieved measurement
+            //!  \param time time tag of latest measurement
+            //!  \param val value of latest measurement
+
+            void readEntry(U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val);
+
+            t_dbStruct* m_db; //!< the table
+            NATIVE_UINT_TYPE m_dbSize; //!< the number of entries in the table
+
+            t_dbStruct m_defaultDb[POLYDB_NUM_DB_ENTRIES]; //!< the built-in table
+
+            NATIVE_INT_TYPE m_allocatorId; //!< the identifier of the allocated table
+            void* m_allocation; //!< the memory of the allocated table, or NULL
 
     };
 }
@@ -11,7 +11,8 @@
 namespace {
 
     enum {
-        POLYDB_NUM_DB_ENTRIES = 25
+        POLYDB_NUM_DB_ENTRIES = 25, // !< Number of entries in the built-in database
+        POLYDB_READ_RETRIES = 4 // !< Number of lock-free attempts a read makes before it takes the lock
     };
 
 }
@@ -18,6 +18,11 @@ namespace Svc {
         this->m_setValue_OutputPort[portNum].addCallPort(port);
     }
 
+    void PolyDbTesterComponentBase::set_getBatch_OutputPort(NATIVE_INT_TYPE portNum, Svc::InputPolyBatchPort* port) {
+        FW_ASSERT(portNum < this->getNum_getBatch_OutputPorts());
+        this->m_getBatch_OutputPort[portNum].addCallPort(port);
+    }
+
 // protected methods
 #if FW_OBJECT_NAMES == 1
     PolyDbTesterComponentBase::PolyDbTesterComponentBase(const char* compName) : Fw::PassiveComponentBase(compName) {
@@ -56,6 +61,15 @@ namespace Svc {
 #endif      
         }
                 
+        for (NATIVE_INT_TYPE port = 0; port < this->getNum_getBatch_OutputPorts(); port++) {
+            this->m_getBatch_OutputPort[port].init();
+#if FW_OBJECT_NAMES == 1
+            char portName[80];
+            snprintf(portName, sizeof(portName), "%s_getBatch_OutputPort[%d]", this->m_objName, port);
+            this->m_getBatch_OutputPort[port].setObjName(portName);
+#endif
+        }
+
 
 
 	}
@@ -71,12 +85,20 @@ namespace Svc {
         this->m_setValue_OutputPort[portNum].invoke(entry, status, time, val);
     }
 
+    void PolyDbTesterComponentBase::getBatch_out(NATIVE_INT_TYPE portNum, Svc::PolyEntries &entries) {
+        FW_ASSERT(portNum < this->getNum_getBatch_OutputPorts());
+        this->m_getBatch_OutputPort[portNum].invoke(entries);
+    }
+
     NATIVE_INT_TYPE PolyDbTesterComponentBase::getNum_getValue_OutputPorts(void) {
         return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_getValue_OutputPort);
     }
     NATIVE_INT_TYPE PolyDbTesterComponentBase::getNum_setValue_OutputPorts(void) {
         return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_setValue_OutputPort);
     }
+    NATIVE_INT_TYPE PolyDbTesterComponentBase::getNum_getBatch_OutputPorts(void) {
+        return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_getBatch_OutputPort);
+    }
     bool PolyDbTesterComponentBase::isConnected_getValue_OutputPort(NATIVE_INT_TYPE portNum) {
          FW_ASSERT(portNum < this->getNum_getValue_OutputPorts(),portNum);
          return this->m_getValue_OutputPort[portNum].isConnected();
@@ -85,6 +107,10 @@ namespace Svc {
          FW_ASSERT(portNum < this->getNum_setValue_OutputPorts(),portNum);
          return this->m_setValue_OutputPort[portNum].isConnected();
     }
+    bool PolyDbTesterComponentBase::isConnected_getBatch_OutputPort(NATIVE_INT_TYPE portNum) {
+         FW_ASSERT(portNum < this->getNum_getBatch_OutputPorts(),portNum);
+         return this->m_getBatch_OutputPort[portNum].isConnected();
+    }
 
 
 // private methods
@@ -17,6 +17,7 @@
 
 // port includes
 #include <Svc/PolyIf/PolyPortAc.hpp>
+#include <Svc/PolyIf/PolyBatchPortAc.hpp>
 
 // serializable includes
 
@@ -28,6 +29,7 @@ namespace Svc {
         
         void set_getValue_OutputPort(NATIVE_INT_TYPE portNum, Svc::InputPolyPort *port);
         void set_setValue_OutputPort(NATIVE_INT_TYPE portNum, Svc::InputPolyPort *port);
+        void set_getBatch_OutputPort(NATIVE_INT_TYPE portNum, Svc::InputPolyBatchPort *port);
     protected:
         // Only called by derived class
 #if FW_OBJECT_NAMES == 1
@@ -42,8 +44,10 @@ namespace Svc {
         // upcalls for output ports
         void getValue_out(NATIVE_INT_TYPE portNum, U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val);
         void setValue_out(NATIVE_INT_TYPE portNum, U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val);
+        void getBatch_out(NATIVE_INT_TYPE portNum, Svc::PolyEntries &entries);
         NATIVE_INT_TYPE getNum_getValue_OutputPorts(void);
         NATIVE_INT_TYPE getNum_setValue_OutputPorts(void);
+        NATIVE_INT_TYPE getNum_getBatch_OutputPorts(void);
 
         // check to see if output port is connected
 
@@ -51,11 +55,14 @@ namespace Svc {
 
         bool isConnected_setValue_OutputPort(NATIVE_INT_TYPE portNum);
 
+        bool isConnected_getBatch_OutputPort(NATIVE_INT_TYPE portNum);
+
              
     private:
         // output ports
         Svc::OutputPolyPort m_getValue_OutputPort[1];
         Svc::OutputPolyPort m_setValue_OutputPort[1];
+        Svc::OutputPolyBatchPort m_getBatch_OutputPort[1];
 
         // input ports
 
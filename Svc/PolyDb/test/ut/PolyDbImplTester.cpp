@@ -90,5 +90,98 @@ namespace Svc {
 
     }
 
+    void PolyDbImplTester::runBatchRead(void) {
+
+        Fw::Time ts(TB_NONE,8,9);
+
+        // write a value to each entry
+        for (U32 entry = 0; entry < POLYDB_NUM_DB_ENTRIES; entry++) {
+            MeasurementStatus mstat = MEASUREMENT_OK;
+            Fw::PolyType val(entry*10);
+            this->setValue_out(0,entry,mstat,ts,val);
+        }
+
+        // read a batch in a different order
+        Svc::PolyEntries entries;
+        for (U32 entry = 0; entry < Svc::PolyEntries::MAX_ENTRIES; entry++) {
+            ASSERT_TRUE(entries.addEntry((entry*7)%POLYDB_NUM_DB_ENTRIES));
+        }
+        ASSERT_FALSE(entries.addEntry(0));
+
+        this->getBatch_out(0,entries);
+
+        ASSERT_EQ(static_cast<NATIVE_UINT_TYPE>(Svc::PolyEntries::MAX_ENTRIES),entries.getNumEntries());
+        for (NATIVE_UINT_TYPE index = 0; index < entries.getNumEntries(); index++) {
+            MeasurementStatus checkStat;
+            Fw::Time checkTs;
+            Fw::PolyType check;
+            entries.getValue(index,checkStat,checkTs,check);
+            ASSERT_EQ(MEASUREMENT_OK,checkStat);
+            ASSERT_EQ(ts,checkTs);
+            ASSERT_EQ(Fw::PolyType(entries.getEntry(index)*10),check);
+        }
+
+    }
+
+    void PolyDbImplTester::runReadDuringUpdate(void) {
+
+        Fw::Time ts(TB_NONE,1,2);
+        MeasurementStatus mstat = MEASUREMENT_FAILURE;
+        Fw::PolyType val(static_cast<U32>(42));
+        this->setValue_out(0,3,mstat,ts,val);
+
+        // make it look like an update is in progress; the read falls back to the lock
+        const U32 seq = this->m_impl.m_db[3].seq;
+        ASSERT_EQ(0U,seq & 1);
+        this->m_impl.m_db[3].seq = seq + 1;
+
+        MeasurementStatus checkStat;
+        Fw::Time checkTs;
+        Fw::PolyType check;
+        this->getValue_out(0,3,checkStat,checkTs,check);
+        ASSERT_EQ(MEASUREMENT_FAILURE,checkStat);
+        ASSERT_EQ(ts,checkTs);
+        ASSERT_EQ(val,check);
+
+        this->m_impl.m_db[3].seq = seq;
+
+    }
+
+    void PolyDbImplTester::runAllocatedDb(void) {
+
+        enum {
+            NUM_ENTRIES = 3*POLYDB_NUM_DB_ENTRIES
+        };
+
+        Fw::MallocAllocator allocator;
+        this->m_impl.allocateDb(0,allocator,NUM_ENTRIES);
+
+        Fw::Time ts(TB_NONE,3,4);
+        for (U32 entry = 0; entry < NUM_ENTRIES; entry++) {
+            // new entries start out stale
+            MeasurementStatus checkStat;
+            Fw::Time checkTs;
+            Fw::PolyType check;
+            this->getValue_out(0,entry,checkStat,checkTs,check);
+            ASSERT_EQ(MEASUREMENT_STALE,checkStat);
+
+            MeasurementStatus mstat = MEASUREMENT_OK;
+            Fw::PolyType val(entry);
+            this->setValue_out(0,entry,mstat,ts,val);
+        }
+
+        for (U32 entry = 0; entry < NUM_ENTRIES; entry++) {
+            MeasurementStatus checkStat;
+            Fw::Time checkTs;
+            Fw::PolyType check;
+            this->getValue_out(0,entry,checkStat,checkTs,check);
+            ASSERT_EQ(MEASUREMENT_OK,checkStat);
+            ASSERT_EQ(Fw::PolyType(entry),check);
+        }
+
+        this->m_impl.deallocateDb(allocator);
+
+    }
+
 
 } /* namespace Svc */
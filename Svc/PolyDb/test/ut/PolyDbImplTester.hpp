@@ -10,6 +10,7 @@
 
 #include <Svc/PolyDb/test/ut/PolyDbComponentTestAc.hpp>
 #include <Svc/PolyDb/PolyDbImpl.hpp>
+#include <Fw/Types/MallocAllocator.hpp>
 
 namespace Svc {
 
@@ -21,6 +22,9 @@ namespace Svc {
             void init(NATIVE_INT_TYPE instance = 0);
 
             void runNominalReadWrite(void);
+            void runBatchRead(void);
+            void runReadDuringUpdate(void);
+            void runAllocatedDb(void);
 
         private:
             Svc::PolyDbImpl& m_impl;
@@ -18,6 +18,7 @@ void connectPorts(Svc::PolyDbImpl& impl, Svc::PolyDbImplTester& tester) {
     // command ports
     tester.set_getValue_OutputPort(0,impl.get_getValue_InputPort(0));
     tester.set_setValue_OutputPort(0,impl.get_setValue_InputPort(0));
+    tester.set_getBatch_OutputPort(0,impl.get_getBatch_InputPort(0));
 
 #if FW_PORT_TRACING
     //Fw::PortBase::setTrace(true);
@@ -51,6 +52,75 @@ TEST(CmdDispTestNominal,NominalReadWrite) {
 
 }
 
+TEST(CmdDispTestNominal,BatchRead) {
+
+    TEST_CASE(104.1.2, "PolyDb Batch Read Test");
+
+    COMMENT(
+            "Read several values from the database in one call."
+            );
+
+    Svc::PolyDbImpl impl("PolyDbImpl");
+
+    impl.init(0);
+
+    Svc::PolyDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runBatchRead();
+
+}
+
+TEST(CmdDispTestNominal,ReadDuringUpdate) {
+
+    TEST_CASE(104.1.3, "PolyDb Read During Update Test");
+
+    COMMENT(
+            "Read a value while an update appears to be in progress."
+            );
+
+    Svc::PolyDbImpl impl("PolyDbImpl");
+
+    impl.init(0);
+
+    Svc::PolyDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runReadDuringUpdate();
+
+}
+
+TEST(CmdDispTestNominal,AllocatedDb) {
+
+    TEST_CASE(104.1.4, "PolyDb Allocated Database Test");
+
+    COMMENT(
+            "Read and write values in a database larger than the built-in one."
+            );
+
+    Svc::PolyDbImpl impl("PolyDbImpl");
+
+    impl.init(0);
+
+    Svc::PolyDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runAllocatedDb();
+
+}
+
 
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
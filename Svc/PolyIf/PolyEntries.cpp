@@ -0,0 +1,105 @@
+/*
+ * PolyEntries.cpp
+ *
+ *  Batch of entries read from PolyDb in one port call
+ */
+
+#include <Svc/PolyIf/PolyEntries.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+    PolyEntries::PolyEntries() : Fw::Serializable() {
+        this->clear();
+    }
+
+    void PolyEntries::clear(void) {
+        this->m_numEntries = 0;
+    }
+
+    bool PolyEntries::addEntry(U32 entry) {
+        if (this->m_numEntries >= MAX_ENTRIES) {
+            return false;
+        }
+        t_entry& e = this->m_entries[this->m_numEntries++];
+        e.entry = entry;
+        e.status = MEASUREMENT_STALE;
+        return true;
+    }
+
+    NATIVE_UINT_TYPE PolyEntries::getNumEntries(void) const {
+        return this->m_numEntries;
+    }
+
+    U32 PolyEntries::getEntry(NATIVE_UINT_TYPE index) const {
+        FW_ASSERT(index < this->m_numEntries,index);
+        return this->m_entries[index].entry;
+    }
+
+    void PolyEntries::setValue(NATIVE_UINT_TYPE index, MeasurementStatus status, const Fw::Time& time, const Fw::PolyType& val) {
+        FW_ASSERT(index < this->m_numEntries,index);
+        this->m_entries[index].status = status;
+        this->m_entries[index].time = time;
+        this->m_entries[index].val = val;
+    }
+
+    void PolyEntries::getValue(NATIVE_UINT_TYPE index, MeasurementStatus& status, Fw::Time& time, Fw::PolyType& val) const {
+        FW_ASSERT(index < this->m_numEntries,index);
+        status = this->m_entries[index].status;
+        time = this->m_entries[index].time;
+        val = this->m_entries[index].val;
+    }
+
+    Fw::SerializeStatus PolyEntries::serialize(Fw::SerializeBufferBase& buffer) const {
+        Fw::SerializeStatus stat = buffer.serialize(this->m_numEntries);
+        for (U32 index = 0; index < this->m_numEntries and Fw::FW_SERIALIZE_OK == stat; index++) {
+            const t_entry& e = this->m_entries[index];
+            stat = buffer.serialize(e.entry);
+            if (stat != Fw::FW_SERIALIZE_OK) {
+                return stat;
+            }
+            stat = buffer.serialize(static_cast<FwEnumStoreType>(e.status));
+            if (stat != Fw::FW_SERIALIZE_OK) {
+                return stat;
+            }
+            stat = buffer.serialize(e.time);
+            if (stat != Fw::FW_SERIALIZE_OK) {
+                return stat;
+            }
+            stat = buffer.serialize(e.val);
+        }
+        return stat;
+    }
+
+    Fw::SerializeStatus PolyEntries::deserialize(Fw::SerializeBufferBase& buffer) {
+        U32 numEntries = 0;
+        Fw::SerializeStatus stat = buffer.deserialize(numEntries);
+        if (stat != Fw::FW_SERIALIZE_OK) {
+            return stat;
+        }
+        if (numEntries > MAX_ENTRIES) {
+            return Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        this->m_numEntries = numEntries;
+        for (U32 index = 0; index < this->m_numEntries and Fw::FW_SERIALIZE_OK == stat; index++) {
+            t_entry& e = this->m_entries[index];
+            stat = buffer.deserialize(e.entry);
+            if (stat != Fw::FW_SERIALIZE_OK) {
+                return stat;
+            }
+            FwEnumStoreType status = 0;
+            stat = buffer.deserialize(status);
+            if (stat != Fw::FW_SERIALIZE_OK) {
+                return stat;
+            }
+            e.status = static_cast<MeasurementStatus>(status);
+            stat = buffer.deserialize(e.time);
+            if (stat != Fw::FW_SERIALIZE_OK) {
+                return stat;
+            }
+            stat = buffer.deserialize(e.val);
+        }
+        return stat;
+    }
+
+} /* namespace Svc */
@@ -0,0 +1,120 @@
+/*
+ * PolyEntries.hpp
+ *
+ *  Batch of entries read from PolyDb in one port call
+ */
+
+#ifndef POLYENTRIES_HPP_
+#define POLYENTRIES_HPP_
+
+#include <Fw/Types/Serializable.hpp>
+#include <Fw/Types/PolyType.hpp>
+#include <Fw/Time/Time.hpp>
+#include <Svc/PolyIf/PolyPortAc.hpp>
+
+namespace Svc {
+
+    //! \class PolyEntries
+    //! \brief Serializable class for carrying a batch of PolyDb entries
+    //!
+    //! The caller adds the entry numbers it wants, and the database
+    //! fills in the status, time tag, and value of each one. It is
+    //! meant to be passed through the PolyBatch port so that several
+    //! values are read in one call.
+
+    class PolyEntries: public Fw::Serializable {
+        public:
+
+            enum {
+                MAX_ENTRIES = 16, //!< maximum number of entries in a batch
+                ENTRY_SERIALIZED_SIZE =
+                    sizeof(U32) +
+                    sizeof(FwEnumStoreType) +
+                    Fw::Time::SERIALIZED_SIZE +
+                    Fw::PolyType::SERIALIZED_SIZE, //!< serialized size of one entry
+                SERIALIZED_SIZE = sizeof(U32) + MAX_ENTRIES*ENTRY_SERIALIZED_SIZE //!< size of PolyEntries private members
+            };
+
+            PolyEntries(); //!< Default constructor
+
+            //!  \brief Destructor
+            //!
+            //!  Does nothing
+            //!
+
+            virtual ~PolyEntries() {}
+
+            //!  \brief Serialization function
+            //!
+            //!  Serializes the entries
+            //!
+            //!  \param buffer destination buffer for serialization data
+
+            Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const; //!< serialize contents
+
+            //!  \brief Deserialization function
+            //!
+            //!  Deserializes the entries
+            //!
+            //!  \param buffer source buffer for serialization data
+
+            Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer); //!< deserialize to contents
+
+            //!  \brief Remove all entries
+            //!
+
+            void clear(void);
+
+            //!  \brief Add an entry to the batch
+            //!
+            //!  The status of the new entry is MEASUREMENT_STALE until it is filled in.
+            //!
+            //!  \param entry the database entry to read
+            //!  \return false if the batch is full
+
+            bool addEntry(U32 entry);
+
+            //!  \brief Get the number of entries in the batch
+            //!
+
+            NATIVE_UINT_TYPE getNumEntries(void) const;
+
+            //!  \brief Get the database entry at a position in the batch
+            //!
+            //!  \param index position in the batch
+
+            U32 getEntry(NATIVE_UINT_TYPE index) const;
+
+            //!  \brief Fill in the value at a position in the batch
+            //!
+            //!  \param index position in the batch
+            //!  \param status status of the measurement
+            //!  \param time time tag of the measurement
+            //!  \param val value of the measurement
+
+            void setValue(NATIVE_UINT_TYPE index, MeasurementStatus status, const Fw::Time& time, const Fw::PolyType& val);
+
+            //!  \brief Get the value at a position in the batch
+            //!
+            //!  \param index position in the batch
+            //!  \param status status of the measurement
+            //!  \param time time tag of the measurement
+            //!  \param val value of the measurement
+
+            void getValue(NATIVE_UINT_TYPE index, MeasurementStatus& status, Fw::Time& time, Fw::PolyType& val) const;
+
+        PRIVATE:
+
+            struct t_entry {
+                U32 entry; //!< the database entry
+                MeasurementStatus status; //!< status of measurement
+                Fw::Time time; //!< time tag of measurement
+                Fw::PolyType val; //!< value of measurement
+            } m_entries[MAX_ENTRIES];
+
+            U32 m_numEntries; //!< number of entries in use
+    };
+
+} /* namespace Svc */
+
+#endif /* POLYENTRIES_HPP_ */
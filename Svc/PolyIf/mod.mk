@@ -13,6 +13,8 @@
 
 # There are some standard files that are included for reference
 
-SRC = PolyPortAi.xml
+SRC = PolyPortAi.xml PolyBatchPortAi.xml PolyEntries.cpp
+
+HDR = PolyEntries.hpp
 		
 		
@@ -10,10 +10,15 @@
 #include <Fw/Types/EightyCharString.hpp>
 
 #include <Os/File.hpp>
+#include <Os/FileSystem.hpp>
 
 #include <cstring>
+#include <new>
 #include <stdio.h>
 
+// Full memory barrier for the lock-free getPrm path
+#define PRMDB_BARRIER() __sync_synchronize()
+
 namespace Svc {
 
     // anonymous namespace for buffer declaration
@@ -45,38 +50,170 @@ namespace Svc {
 #else
     PrmDbImpl::PrmDbImpl(const char* file) {
 #endif
-        this->clearDb();
+        this->m_allocatorId = 0;
+        this->m_allocation = NULL;
+        this->m_writeSeq = 0;
+        const NATIVE_UINT_TYPE bits = indexBits(PRMDB_NUM_DB_ENTRIES);
+        FW_ASSERT((1U << bits) <= PRMDB_DEFAULT_INDEX_SIZE,bits);
+        this->setDb(this->m_defaultDb,PRMDB_NUM_DB_ENTRIES,this->m_defaultIndex,bits,this->m_defaultSaveBuffer);
         this->m_fileName = file;
+        (void) snprintf(this->m_tmpFileName,sizeof(this->m_tmpFileName),"%s%s",
+                this->m_fileName.toChar(),PRMDB_TEMP_FILE_SUFFIX);
     }
 
     void PrmDbImpl::init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance) {
         PrmDbComponentBase::init(queueDepth,instance);
     }
 
+    void PrmDbImpl::allocateDb(NATIVE_INT_TYPE identifier, Fw::MemAllocator& allocator, NATIVE_UINT_TYPE numEntries) {
+        FW_ASSERT(NULL == this->m_allocation);
+        FW_ASSERT(numEntries > 0);
+        const NATIVE_UINT_TYPE bits = indexBits(numEntries);
+        // the table, the index, and the save buffer share one allocation
+        const NATIVE_UINT_TYPE bytes =
+            numEntries*sizeof(t_dbStruct) + (1U << bits)*sizeof(NATIVE_INT_TYPE) +
+            numEntries*RECORD_MAX_SIZE;
+        void* mem = allocator.allocate(identifier,bytes);
+        FW_ASSERT(mem != NULL);
+        t_dbStruct* db = static_cast<t_dbStruct*>(mem);
+        for (NATIVE_UINT_TYPE entry = 0; entry < numEntries; entry++) {
+            new (&db[entry]) t_dbStruct();
+        }
+        NATIVE_INT_TYPE* index = reinterpret_cast<NATIVE_INT_TYPE*>(&db[numEntries]);
+        U8* saveBuffer = reinterpret_cast<U8*>(&index[1U << bits]);
+        this->m_allocatorId = identifier;
+        this->m_allocation = mem;
+        this->setDb(db,numEntries,index,bits,saveBuffer);
+    }
+
+    void PrmDbImpl::deallocateDb(Fw::MemAllocator& allocator) {
+        FW_ASSERT(this->m_allocation != NULL);
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_dbSize; entry++) {
+            this->m_db[entry].~t_dbStruct();
+        }
+        void* mem = this->m_allocation;
+        this->m_allocation = NULL;
+        this->setDb(this->m_defaultDb,PRMDB_NUM_DB_ENTRIES,this->m_defaultIndex,indexBits(PRMDB_NUM_DB_ENTRIES),this->m_defaultSaveBuffer);
+        allocator.deallocate(this->m_allocatorId,mem);
+    }
+
+    void PrmDbImpl::setDb(t_dbStruct* db, NATIVE_UINT_TYPE dbSize, NATIVE_INT_TYPE* index, NATIVE_UINT_TYPE indexBits, U8* saveBuffer) {
+        this->beginWrite();
+        this->m_db = db;
+        this->m_dbSize = dbSize;
+        this->m_index = index;
+        this->m_indexBits = indexBits;
+        this->m_saveBuffer = saveBuffer;
+        this->endWrite();
+        this->clearDb();
+    }
+
+    NATIVE_UINT_TYPE PrmDbImpl::indexBits(NATIVE_UINT_TYPE dbSize) {
+        NATIVE_UINT_TYPE bits = 1;
+        while ((1U << bits) < 2*dbSize) {
+            bits++;
+        }
+        return bits;
+    }
+
     void PrmDbImpl::clearDb(void) {
-        for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
+        this->beginWrite();
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_dbSize; entry++) {
             this->m_db[entry].used = false;
             this->m_db[entry].id = 0;
         }
+        for (NATIVE_UINT_TYPE slot = 0; slot < (1U << this->m_indexBits); slot++) {
+            this->m_index[slot] = -1;
+        }
+        this->m_numEntries = 0;
+        this->endWrite();
     }
 
-    // If ports are no longer guarded, these accesses need to be protected from each other
-    // If there are a lot of accesses, perhaps an interrupt lock could be used instead of guarded ports
+    NATIVE_UINT_TYPE PrmDbImpl::findSlot(FwPrmIdType id) const {
+        const NATIVE_UINT_TYPE mask = (1U << this->m_indexBits) - 1;
+        // multiplicative hash; spreads runs of consecutive IDs across the index
+        NATIVE_UINT_TYPE slot = (static_cast<U32>(id) * 0x9E3779B1U) >> (32 - this->m_indexBits);
+        // linear probe. The index is at most half full, so there is always an empty slot
+        for (NATIVE_UINT_TYPE probe = 0; probe <= mask; probe++) {
+            const NATIVE_INT_TYPE entry = this->m_index[slot];
+            if ((entry < 0) or (this->m_db[entry].id == id)) {
+                return slot;
+            }
+            slot = (slot + 1) & mask;
+        }
+        FW_ASSERT(0,id);
+        return 0;
+    }
+
+    Fw::ParamValid PrmDbImpl::readEntry(FwPrmIdType id, Fw::ParamBuffer &val) const {
+        const NATIVE_INT_TYPE entry = this->m_index[this->findSlot(id)];
+        if (entry < 0) {
+            return Fw::PARAM_INVALID;
+        }
+        val = this->m_db[entry].val;
+        return Fw::PARAM_VALID;
+    }
+
+    bool PrmDbImpl::writeEntry(FwPrmIdType id, const Fw::ParamBuffer &val, bool& existingEntry) {
+        const NATIVE_UINT_TYPE slot = this->findSlot(id);
+        NATIVE_INT_TYPE entry = this->m_index[slot];
+        if (entry >= 0) {
+            this->m_db[entry].val = val;
+            existingEntry = true;
+            return true;
+        }
+        existingEntry = false;
+        if (this->m_numEntries >= this->m_dbSize) {
+            return false;
+        }
+        entry = this->m_numEntries;
+        this->m_db[entry].val = val;
+        this->m_db[entry].id = id;
+        this->m_db[entry].used = true;
+        this->m_index[slot] = entry;
+        this->m_numEntries++;
+        return true;
+    }
+
+    void PrmDbImpl::beginWrite(void) {
+        this->m_writeLock.lock();
+        this->m_writeSeq = this->m_writeSeq + 1;
+        PRMDB_BARRIER();
+    }
+
+    void PrmDbImpl::endWrite(void) {
+        PRMDB_BARRIER();
+        this->m_writeSeq = this->m_writeSeq + 1;
+        this->m_writeLock.unLock();
+    }
+
+    // Only the PrmDb thread changes the table. A getPrm call that reads the same even
+    // write sequence number before and after its lookup did not overlap a change, so it
+    // does not need the lock. If a change keeps getting in the way, it waits for the lock.
 
     Fw::ParamValid PrmDbImpl::getPrm_handler(NATIVE_INT_TYPE portNum, FwPrmIdType id, Fw::ParamBuffer &val) {
         // search for entry
         Fw::ParamValid stat = Fw::PARAM_INVALID;
-
-        for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if (this->m_db[entry].used) {
-                if (this->m_db[entry].id == id) {
-                    val = this->m_db[entry].val;
-                    stat = Fw::PARAM_VALID;
-                    break;
+        bool done = false;
+
+        if (PRMDB_LOCKLESS_GET) {
+            for (NATIVE_UINT_TYPE attempt = 0; (attempt < PRMDB_GET_RETRIES) and (not done); attempt++) {
+                const U32 seq = this->m_writeSeq;
+                PRMDB_BARRIER();
+                if ((seq & 1) == 0) {
+                    stat = this->readEntry(id,val);
+                    PRMDB_BARRIER();
+                    done = (seq == this->m_writeSeq);
                 }
             }
         }
 
+        if (not done) {
+            this->m_writeLock.lock();
+            stat = this->readEntry(id,val);
+            this->m_writeLock.unLock();
+        }
+
         // if unable to find parameter, send error message
         if (Fw::PARAM_INVALID == stat) {
             this->log_WARNING_LO_PrmIdNotFound(id);
@@ -87,39 +224,18 @@ namespace Svc {
 
     void PrmDbImpl::setPrm_handler(NATIVE_INT_TYPE portNum, FwPrmIdType id, Fw::ParamBuffer &val) {
 
-        this->lock();
+        this->beginWrite();
 
-        // search for existing entry
+        // update the existing entry, or add one if there is room
 
         bool existingEntry = false;
-        bool noSlots = true;
+        const bool stored = this->writeEntry(id,val,existingEntry);
 
-        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if ((this->m_db[entry].used) && (id == this->m_db[entry].id)) {
-                this->m_db[entry].val = val;
-                existingEntry = true;
-                break;
-            }
-        }
-
-        // if there is no existing entry, add one
-        if (!existingEntry) {
-            for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-                if (!(this->m_db[entry].used)) {
-                    this->m_db[entry].val = val;
-                    this->m_db[entry].id = id;
-                    this->m_db[entry].used = true;
-                    noSlots = false;
-                    break;
-                }
-            }
-        }
-
-        this->unLock();
+        this->endWrite();
 
         if (existingEntry) {
             this->log_ACTIVITY_HI_PrmIdUpdated(id);
-        } else if (noSlots) {
+        } else if (not stored) {
             this->log_FATAL_PrmDbFull(id);
         } else {
             this->log_ACTIVITY_HI_PrmIdAdded(id);
@@ -127,113 +243,87 @@ namespace Svc {
 
     }
 
-    void PrmDbImpl::PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    NATIVE_UINT_TYPE PrmDbImpl::snapshotDb(U32& numRecords) {
 
-        Os::File paramFile;
-        WorkingBuffer buff;
+        Fw::ExternalSerializeBuffer buff(this->m_saveBuffer,this->m_dbSize*RECORD_MAX_SIZE);
+        numRecords = 0;
 
-        Os::File::Status stat = paramFile.open(this->m_fileName.toChar(),Os::File::OPEN_WRITE);
-        if (stat != Os::File::OP_OK) {
-            this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_OPEN,0,stat);
-            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-            return;
-        }
+        this->m_writeLock.lock();
 
-        this->lock();
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            if (this->m_db[entry].used) {
+                const NATIVE_UINT_TYPE valSize = this->m_db[entry].val.getBuffLength();
+                // record size = id field + data
+                const U32 recordSize = sizeof(FwPrmIdType) + valSize;
+                // the buffer holds a maximum-size record per entry, so these should always work
+                Fw::SerializeStatus serStat = buff.serialize(static_cast<U8>(PRMDB_ENTRY_DELIMETER));
+                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+                serStat = buff.serialize(recordSize);
+                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+                serStat = buff.serialize(this->m_db[entry].id);
+                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+                serStat = buff.serialize(this->m_db[entry].val.getBuffAddr(),valSize,true);
+                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+                numRecords++;
+            }
+        }
 
-        // Traverse the parameter list, saving each entry
+        this->m_writeLock.unLock();
 
-        U32 numRecords = 0;
+        return buff.getBuffLength();
+    }
 
-        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_db); entry++) {
-            if (this->m_db[entry].used) {
-                // write delimeter
-                static const U8 delim = PRMDB_ENTRY_DELIMETER;
-                NATIVE_INT_TYPE writeSize = sizeof(delim);
-                stat = paramFile.write(&delim,writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_DELIMETER,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != sizeof(delim)) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_DELIMETER_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                // serialize record size = id field + data
-                U32 recordSize = sizeof(FwPrmIdType) + this->m_db[entry].val.getBuffLength();
+    void PrmDbImpl::saveFailed(FwOpcodeType opCode, U32 cmdSeq, PrmWriteError stage, I32 record, I32 error) {
+        // leave the previous file in place; the partial one is of no use
+        (void) Os::FileSystem::removeFile(this->m_tmpFileName);
+        this->log_WARNING_HI_PrmFileWriteError(stage,record,error);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+    }
 
-                // reset buffer
-                buff.resetSer();
-                Fw::SerializeStatus serStat = buff.serialize(recordSize);
-                // should always work
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+    void PrmDbImpl::PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
 
-                // write record size
-                writeSize = buff.getBuffLength();
-                stat = paramFile.write(buff.getBuffAddr(),writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_RECORD_SIZE,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != sizeof(writeSize)) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_RECORD_SIZE_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
+        // Build the whole file image first, so the lock is only held for the copy.
+        // The image is written to a temporary file that is renamed over the old one
+        // once it is on disk, so a reset during the save leaves a complete file.
 
-                // reset buffer
-                buff.resetSer();
+        U32 numRecords = 0;
+        const NATIVE_UINT_TYPE imageSize = this->snapshotDb(numRecords);
 
-                // serialize parameter id
+        Os::File paramFile;
 
-                serStat = buff.serialize(this->m_db[entry].id);
-                // should always work
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat,(NATIVE_INT_TYPE)serStat);
+        Os::File::Status stat = paramFile.open(this->m_tmpFileName,Os::File::OPEN_WRITE);
+        if (stat != Os::File::OP_OK) {
+            this->saveFailed(opCode,cmdSeq,PRM_WRITE_OPEN,0,stat);
+            return;
+        }
 
-                // write parameter ID
-                writeSize = buff.getBuffLength();
-                stat = paramFile.write(buff.getBuffAddr(),writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_ID,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != (NATIVE_INT_TYPE)buff.getBuffLength()) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_ID_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
+        NATIVE_INT_TYPE writeSize = imageSize;
+        stat = paramFile.write(this->m_saveBuffer,writeSize,true);
+        if (stat != Os::File::OP_OK) {
+            paramFile.close();
+            this->saveFailed(opCode,cmdSeq,PRM_WRITE_DATA,numRecords,stat);
+            return;
+        }
+        if (writeSize != static_cast<NATIVE_INT_TYPE>(imageSize)) {
+            paramFile.close();
+            this->saveFailed(opCode,cmdSeq,PRM_WRITE_DATA_SIZE,numRecords,writeSize);
+            return;
+        }
 
-                // write serialized parameter value
+        stat = paramFile.flush();
+        paramFile.close();
+        if (stat != Os::File::OP_OK) {
+            this->saveFailed(opCode,cmdSeq,PRM_WRITE_SYNC,numRecords,stat);
+            return;
+        }
 
-                writeSize = this->m_db[entry].val.getBuffLength();
-                stat = paramFile.write(this->m_db[entry].val.getBuffAddr(),writeSize,true);
-                if (stat != Os::File::OP_OK) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_VALUE,numRecords,stat);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                if (writeSize != (NATIVE_INT_TYPE)this->m_db[entry].val.getBuffLength()) {
-                    this->unLock();
-                    this->log_WARNING_HI_PrmFileWriteError(PRM_WRITE_PARAMETER_VALUE_SIZE,numRecords,writeSize);
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
-                    return;
-                }
-                numRecords++;
-            } // end if record in use
-        } // end for each record
+        const Os::FileSystem::Status fsStat =
+            Os::FileSystem::moveFile(this->m_tmpFileName,this->m_fileName.toChar());
+        if (fsStat != Os::FileSystem::OP_OK) {
+            this->saveFailed(opCode,cmdSeq,PRM_WRITE_RENAME,numRecords,fsStat);
+            return;
+        }
 
-        this->unLock();
         this->log_ACTIVITY_HI_PrmFileSaveComplete(numRecords);
         this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
 
@@ -258,7 +348,7 @@ namespace Svc {
 
         this->clearDb();
 
-        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++)  {
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_dbSize; entry++)  {
 
             U8 delimeter;
             NATIVE_INT_TYPE readSize = sizeof(delimeter);
@@ -338,12 +428,11 @@ namespace Svc {
             // deserialize, since parameter ID is serialized in file
             FW_ASSERT(Fw::FW_SERIALIZE_OK == buff.deserialize(parameterId));
 
-            // copy parameter
-            this->m_db[entry].used = true;
-            this->m_db[entry].id = parameterId;
+            // read parameter
+            Fw::ParamBuffer value;
             readSize = recordSize-sizeof(parameterId);
 
-            fStat = paramFile.read(this->m_db[entry].val.getBuffAddr(),readSize);
+            fStat = paramFile.read(value.getBuffAddr(),readSize);
 
             if (fStat != Os::File::OP_OK) {
                 this->log_WARNING_HI_PrmFileReadError(PRM_READ_PARAMETER_VALUE,recordNum,fStat);
@@ -355,9 +444,16 @@ namespace Svc {
             }
 
             // set serialized size to read size
-            desStat = this->m_db[entry].val.setBuffLen(readSize);
+            desStat = value.setBuffLen(readSize);
             // should never fail
             FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,(NATIVE_INT_TYPE)desStat);
+
+            // copy parameter. There are no more records than entries, so it always fits
+            bool existingEntry = false;
+            this->beginWrite();
+            const bool stored = this->writeEntry(parameterId,value,existingEntry);
+            this->endWrite();
+            FW_ASSERT(stored,parameterId);
             recordNum++;
 
         }
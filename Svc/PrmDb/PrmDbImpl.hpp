@@ -16,6 +16,7 @@
 #include <Svc/PrmDb/PrmDbComponentAc.hpp>
 #include <Svc/PrmDb/PrmDbImplCfg.hpp>
 #include <Fw/Types/EightyCharString.hpp>
+#include <Fw/Types/MemAllocator.hpp>
 #include <Os/Mutex.hpp>
 
 namespace Svc {
@@ -55,6 +56,25 @@ namespace Svc {
 
             void init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance);
 
+            //!  \brief PrmDb database allocation function
+            //!
+            //!  Replaces the built-in table of PRMDB_NUM_DB_ENTRIES entries with a table
+            //!  allocated from the allocator. Size it from the number of parameters in the
+            //!  topology dictionary. Call it before readParamFile(). Any values in the
+            //!  built-in table are discarded.
+            //!
+            //!  \param identifier the memory segment identifier
+            //!  \param allocator the memory allocator
+            //!  \param numEntries the number of parameters the table can hold
+            void allocateDb(NATIVE_INT_TYPE identifier, Fw::MemAllocator& allocator, NATIVE_UINT_TYPE numEntries);
+
+            //!  \brief PrmDb database deallocation function
+            //!
+            //!  Returns the table allocated by allocateDb(). Call it before the destructor.
+            //!
+            //!  \param allocator the memory allocator
+            void deallocateDb(Fw::MemAllocator& allocator);
+
             //!  \brief PrmDb file read function
             //!
             //!  The readFile function reads the set of parameters from the file passed in to
@@ -113,13 +133,105 @@ namespace Svc {
 
             void clearDb(void); //!< clear the parameter database
 
-            Fw::EightyCharString m_fileName; //!< filename for parameter storage
+            enum {
+                //! The largest serialized size of a parameter file record
+                RECORD_MAX_SIZE = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + FW_PARAM_BUFFER_MAX_SIZE
+            };
 
             struct t_dbStruct {
                 bool used; //!< whether slot is being used
                 FwPrmIdType id; //!< the id being stored in the slot
                 Fw::ParamBuffer val; //!< the serialized value of the parameter
-            } m_db[PRMDB_NUM_DB_ENTRIES];
+            };
+
+            //!  \brief Use a table and index for the database
+            //!
+            //!  \param db the table
+            //!  \param dbSize the number of entries in the table
+            //!  \param index the index
+            //!  \param indexBits log2 of the number of index slots
+            //!  \param saveBuffer buffer for the file image; dbSize*RECORD_MAX_SIZE bytes
+            void setDb(t_dbStruct* db, NATIVE_UINT_TYPE dbSize, NATIVE_INT_TYPE* index, NATIVE_UINT_TYPE indexBits, U8* saveBuffer);
+
+            //!  \brief Compute the number of index bits for a table size
+            //!
+            //!  The index has at least twice as many slots as the table has entries, so
+            //!  probe sequences stay short and always end at an empty slot.
+            //!
+            //!  \param dbSize the number of entries in the table
+            //!  \return log2 of the number of index slots
+            static NATIVE_UINT_TYPE indexBits(NATIVE_UINT_TYPE dbSize);
+
+            //!  \brief Find the index slot for a parameter ID
+            //!
+            //!  \param id the parameter ID
+            //!  \return the slot holding the ID, or the empty slot where it would go
+            NATIVE_UINT_TYPE findSlot(FwPrmIdType id) const;
+
+            //!  \brief Copy a parameter value out of the table
+            //!
+            //!  \param id the parameter ID
+            //!  \param val buffer where value is placed
+            //!  \return PARAM_VALID if the parameter was found, otherwise PARAM_INVALID
+            Fw::ParamValid readEntry(FwPrmIdType id, Fw::ParamBuffer &val) const;
+
+            //!  \brief Add or update a parameter value
+            //!
+            //!  \param id the parameter ID
+            //!  \param val the serialized value
+            //!  \param existingEntry set to whether the ID was already in the table
+            //!  \return whether the value was stored; false if the table is full
+            bool writeEntry(FwPrmIdType id, const Fw::ParamBuffer &val, bool& existingEntry);
+
+            //!  \brief Start a change to the table
+            //!
+            //!  Takes the write lock and makes the write sequence number odd, so that
+            //!  lock-free readers retry.
+            void beginWrite(void);
+
+            //!  \brief Finish a change to the table
+            void endWrite(void);
+
+            //!  \brief Serialize the table into the save buffer
+            //!
+            //!  Holds the write lock only while the records are copied, so the file
+            //!  itself is written without blocking changes or lock-taking readers.
+            //!
+            //!  \param numRecords set to the number of records serialized
+            //!  \return the number of bytes in the file image
+            NATIVE_UINT_TYPE snapshotDb(U32& numRecords);
+
+            //!  \brief Report a failed save
+            //!
+            //!  Removes the partial temporary file, then sends the error event and the
+            //!  command response.
+            //!
+            //!  \param opCode the opcode of the save command
+            //!  \param cmdSeq the sequence number of the save command
+            //!  \param stage the stage that failed
+            //!  \param record the record number reported in the event
+            //!  \param error the error code reported in the event
+            void saveFailed(FwOpcodeType opCode, U32 cmdSeq, PrmWriteError stage, I32 record, I32 error);
+
+            Fw::EightyCharString m_fileName; //!< filename for parameter storage
+            char m_tmpFileName[Fw::EightyCharString::STRING_SIZE + sizeof(PRMDB_TEMP_FILE_SUFFIX)]; //!< file a save is written to before it is renamed; sized so any file name takes the whole suffix
+
+            t_dbStruct* m_db; //!< the table, in order of insertion
+            NATIVE_UINT_TYPE m_dbSize; //!< the number of entries in the table
+            NATIVE_UINT_TYPE m_numEntries; //!< the number of entries in use
+            NATIVE_INT_TYPE* m_index; //!< hash index from parameter ID to table entry; -1 if empty
+            NATIVE_UINT_TYPE m_indexBits; //!< log2 of the number of index slots
+            U8* m_saveBuffer; //!< where the file image is built for a save
+
+            t_dbStruct m_defaultDb[PRMDB_NUM_DB_ENTRIES]; //!< the built-in table
+            NATIVE_INT_TYPE m_defaultIndex[PRMDB_DEFAULT_INDEX_SIZE]; //!< the built-in index
+            U8 m_defaultSaveBuffer[PRMDB_NUM_DB_ENTRIES*RECORD_MAX_SIZE]; //!< the built-in save buffer
+
+            NATIVE_INT_TYPE m_allocatorId; //!< the identifier of the allocated table
+            void* m_allocation; //!< the memory of the allocated table, or NULL
+
+            Os::Mutex m_writeLock; //!< held while the table changes
+            volatile U32 m_writeSeq; //!< incremented before and after each change; odd while changing
 
     };
 }
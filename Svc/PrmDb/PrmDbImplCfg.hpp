@@ -13,9 +13,14 @@ namespace {
 
     enum {
         PRMDB_NUM_DB_ENTRIES = 25, // !< Number of entries in the parameter database
+        PRMDB_DEFAULT_INDEX_SIZE = 64, // !< Number of hash index slots for the built-in database. Power of two, at least 2*PRMDB_NUM_DB_ENTRIES
+        PRMDB_LOCKLESS_GET = 1, // !< Whether getPrm reads without taking the database lock, retrying if a change is in progress
+        PRMDB_GET_RETRIES = 4, // !< Number of lock-free attempts a getPrm call makes before it takes the lock
         PRMDB_ENTRY_DELIMETER = 0xA5 // !< Byte value that should precede each parameter in file; sanity check against file integrity. Should match ground system.
     };
 
+    const char PRMDB_TEMP_FILE_SUFFIX[] = ".tmp"; // !< Appended to the parameter file name to get the file a save is written to before it is renamed into place
+
 }
 
 
@@ -339,6 +339,117 @@ namespace Svc {
 
     }
 
+    void PrmDbImplTester::runFailedSaveKeepsFile(void) {
+
+        // save a good file
+        this->runNominalSaveFile();
+
+        // change a value
+        Fw::ParamBuffer pBuff;
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.serialize((U32)0x40));
+        this->invoke_to_setPrm(0,0x21,pBuff);
+        this->m_impl.doDispatch();
+
+        // fail the save of the new value
+        this->clearEvents();
+        this->clearHistory();
+        Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
+        this->m_writesToWait = 0;
+        this->m_testWriteStatus = Os::File::NO_SPACE;
+        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
+        this->sendCmd_PRM_SAVE_FILE(0,13);
+        this->m_impl.doDispatch();
+        Os::clearWriteInterceptor();
+        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_DATA,2,Os::File::NO_SPACE);
+        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,13,Fw::COMMAND_EXECUTION_ERROR);
+
+        // the partial file is gone
+        U64 size = 0;
+        EXPECT_NE(Os::FileSystem::OP_OK,Os::FileSystem::getFileSize("TestFile.prm.tmp",size));
+
+        // the old file still holds the old value
+        this->runNominalLoadFile();
+
+    }
+
+    void PrmDbImplTester::runAllocatedDb(void) {
+
+        Fw::MallocAllocator allocator;
+        this->m_impl.allocateDb(PRMDB_IMPL_TESTER_ALLOCATOR_ID,allocator,PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES);
+
+        // fill the table. IDs are spaced so they share low bits.
+        // Events are checked per entry to stay within the history size.
+        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES; entry++) {
+            Fw::ParamBuffer pBuff;
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.serialize((U32)entry));
+            this->clearEvents();
+            this->invoke_to_setPrm(0,(FwPrmIdType)(entry << 8),pBuff);
+            this->m_impl.doDispatch();
+            ASSERT_EVENTS_SIZE(1);
+            ASSERT_EVENTS_PrmIdAdded(0,entry << 8);
+        }
+
+        // one more doesn't fit
+        {
+            Fw::ParamBuffer pBuff;
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.serialize((U32)0));
+            this->clearEvents();
+            this->invoke_to_setPrm(0,(FwPrmIdType)(PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES << 8),pBuff);
+            this->m_impl.doDispatch();
+            ASSERT_EVENTS_SIZE(1);
+            ASSERT_EVENTS_PrmDbFull_SIZE(1);
+        }
+        ASSERT_EVENTS_PrmDbFull(0,PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES << 8);
+
+        // save, clear, and load
+        this->clearEvents();
+        this->clearHistory();
+        this->sendCmd_PRM_SAVE_FILE(0,12);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_OK);
+        ASSERT_EVENTS_PrmFileSaveComplete(0,PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES);
+        this->m_impl.clearDb();
+        this->clearEvents();
+        this->m_impl.readParamFile();
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileLoadComplete(0,PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES);
+
+        // read every value back
+        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES; entry++) {
+            Fw::ParamBuffer pBuff;
+            U32 testVal = 0;
+            EXPECT_EQ(Fw::PARAM_VALID,this->invoke_to_getPrm(0,(FwPrmIdType)(entry << 8),pBuff));
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.deserialize(testVal));
+            EXPECT_EQ((U32)entry,testVal);
+        }
+
+        // going back to the built-in table empties it
+        this->m_impl.deallocateDb(allocator);
+        this->clearEvents();
+        Fw::ParamBuffer pBuff;
+        EXPECT_EQ(Fw::PARAM_INVALID,this->invoke_to_getPrm(0,0,pBuff));
+        ASSERT_EVENTS_PrmIdNotFound_SIZE(1);
+
+    }
+
+    void PrmDbImplTester::runGetDuringChange(void) {
+
+        this->runNominalPopulate();
+
+        // make it look like a change is in progress; the read falls back to the lock
+        const U32 seq = this->m_impl.m_writeSeq;
+        this->m_impl.m_writeSeq = seq + 1;
+
+        Fw::ParamBuffer pBuff;
+        U32 testVal = 0;
+        EXPECT_EQ(Fw::PARAM_VALID,this->invoke_to_getPrm(0,0x21,pBuff));
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.deserialize(testVal));
+        EXPECT_EQ((U32)0x15,testVal);
+
+        this->m_impl.m_writeSeq = seq;
+
+    }
+
     void PrmDbImplTester::init(NATIVE_INT_TYPE instance) {
         PrmDbGTestBase::init();
     }
@@ -585,35 +696,7 @@ void PrmDbImplTester::runFileReadError(void) {
 
         Os::clearOpenInterceptor();
 
-        // Test delimiter write error
-
-        // populate file again
-        this->runNominalPopulate();
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // delimiter is first read
-        this->m_writesToWait = 0;
-        // set read status to bad
-        this->m_testWriteStatus = Os::File::NOT_OPENED;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-
-        // send command to save file
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_DELIMETER,0,Os::File::NOT_OPENED);
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
-
-        // Test delimiter write size error
+        // Test data write error
 
         // populate file again
         this->runNominalPopulate();
@@ -621,66 +704,13 @@ void PrmDbImplTester::runFileReadError(void) {
         this->clearEvents();
         this->clearHistory();
         Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // delimiter is first read
+        // the whole file is one write
         this->m_writesToWait = 0;
-        // set write status to okay
-        this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of byte + 1
-        this->m_writeSize = sizeof(U8)+1;
-        // send command to save file
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_DELIMETER_SIZE,0,sizeof(U8)+1);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-
-        Os::clearWriteInterceptor();
-
-        // Test record size write error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // size is second write
-        this->m_writesToWait = 1;
         // set write status to bad
         this->m_testWriteStatus = Os::File::NOT_OPENED;
         // set test type to write error
         this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-        // send command to save file
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_RECORD_SIZE,0,Os::File::NOT_OPENED);
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
 
-        // Test record size write size error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // size is second read
-        this->m_writesToWait = 1;
-        // set read status to okay
-        this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of U32 + 1
-        this->m_writeSize = sizeof(U32)+1;
         // send command to save file
         this->sendCmd_PRM_SAVE_FILE(0,12);
         stat = this->m_impl.doDispatch();
@@ -688,52 +718,24 @@ void PrmDbImplTester::runFileReadError(void) {
         // check for failed event
         ASSERT_EVENTS_SIZE(1);
         ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_RECORD_SIZE_SIZE,0,sizeof(U32)+1);
-
+        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_DATA,2,Os::File::NOT_OPENED);
         // check command status
         ASSERT_CMD_RESPONSE_SIZE(1);
         ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-
         Os::clearWriteInterceptor();
 
-        // Test parameter ID write error
+        // Test data write size error
 
         this->clearEvents();
         this->clearHistory();
         Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // ID is third read
-        this->m_writesToWait = 2;
-        // set write status to bad
-        this->m_testWriteStatus = Os::File::NOT_OPENED;
-        // set test type to write error
-        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_ID,0,Os::File::NOT_OPENED);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-
-        Os::clearWriteInterceptor();
-
-        // Test parameter ID write size error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // size is second read
-        this->m_writesToWait = 2;
-        // set read status to okay
+        this->m_writesToWait = 0;
+        // set write status to okay
         this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
+        // set test type to size error
         this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of byte + 1
-        this->m_writeSize = sizeof(FwPrmIdType)+1;
+        // short write
+        this->m_writeSize = 1;
         // send command to save file
         this->sendCmd_PRM_SAVE_FILE(0,12);
         stat = this->m_impl.doDispatch();
@@ -741,7 +743,7 @@ void PrmDbImplTester::runFileReadError(void) {
         // check for failed event
         ASSERT_EVENTS_SIZE(1);
         ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_ID_SIZE,0,sizeof(FwPrmIdType)+1);
+        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_DATA_SIZE,2,1);
 
         // check command status
         ASSERT_CMD_RESPONSE_SIZE(1);
@@ -749,57 +751,6 @@ void PrmDbImplTester::runFileReadError(void) {
 
         Os::clearWriteInterceptor();
 
-        // Test parameter value write error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // record is fourth read
-        this->m_writesToWait = 3;
-        // set read status to bad
-        this->m_testWriteStatus = Os::File::NOT_OPENED;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_WRITE_ERROR;
-        // send write command
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_VALUE,0,Os::File::NOT_OPENED);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
-
-        // Test parameter value write size error
-
-        this->clearEvents();
-        this->clearHistory();
-        Os::registerWriteInterceptor(this->WriteIntercepter,static_cast<void*>(this));
-        // record is fourth read
-        this->m_writesToWait = 3;
-        // set read status to okay
-        this->m_testWriteStatus = Os::File::OP_OK;
-        // set test type to read error
-        this->m_writeTestType = FILE_WRITE_SIZE_ERROR;
-        // set size to size of U32 + 1, which is nominal populate test value
-        this->m_writeSize = sizeof(U32)+1;
-        // send command
-        this->sendCmd_PRM_SAVE_FILE(0,12);
-        stat = this->m_impl.doDispatch();
-        EXPECT_EQ(stat,Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        // check for failed event
-        ASSERT_EVENTS_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-        ASSERT_EVENTS_PrmFileWriteError(0,PrmDbImpl::PRM_WRITE_PARAMETER_VALUE_SIZE,0,sizeof(U32)+1);
-
-        // check command status
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_EXECUTION_ERROR);
-        Os::clearWriteInterceptor();
 
     }
 
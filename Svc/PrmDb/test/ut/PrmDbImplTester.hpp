@@ -12,6 +12,8 @@
 #include <Svc/PrmDb/test/ut/PrmDbImplTesterCfg.hpp>
 #include <Svc/PrmDb/PrmDbImpl.hpp>
 #include <Os/File.hpp>
+#include <Os/FileSystem.hpp>
+#include <Fw/Types/MallocAllocator.hpp>
 
 namespace Svc {
 
@@ -26,6 +28,9 @@ namespace Svc {
             void runMissingExtraParams(void);
             void runFileReadError(void);
             void runFileWriteError(void);
+            void runFailedSaveKeepsFile(void);
+            void runAllocatedDb(void);
+            void runGetDuringChange(void);
 
             void runRefPrmFile(void);
 
@@ -9,7 +9,9 @@
 #define PRMDB_TEST_UT_PRMDBIMPLTESTERCFG_HPP_
 
 enum {
-    PRMDB_IMPL_TESTER_MAX_READ_BUFFER = 256
+    PRMDB_IMPL_TESTER_MAX_READ_BUFFER = 256,
+    PRMDB_IMPL_TESTER_ALLOCATED_ENTRIES = 300, // more than PRMDB_NUM_DB_ENTRIES
+    PRMDB_IMPL_TESTER_ALLOCATOR_ID = 1
 };
 
 
@@ -12,6 +12,9 @@
 #include <gtest/gtest.h>
 
 #include <Fw/Test/UnitTest.hpp>
+#include <Os/FileSystem.hpp>
+
+#include <string.h>
 
 #if FW_OBJECT_REGISTRATION == 1
 static Fw::SimpleObjRegistry simpleReg;
@@ -183,6 +186,97 @@ TEST(ParameterDbTest,PrmFileWriteError) {
 
 }
 
+TEST(ParameterDbTest,FailedSaveTest) {
+
+    TEST_CASE(105.2.4,"Failed save test");
+    COMMENT("Fail a save and check the previous file is still intact");
+
+    Svc::PrmDbImpl impl("PrmDbImpl","TestFile.prm");
+
+    impl.init(10,0);
+
+    Svc::PrmDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run failed save test
+    tester.runFailedSaveKeepsFile();
+
+}
+
+TEST(ParameterDbTest,AllocatedDbTest) {
+
+    TEST_CASE(105.1.4,"Allocated database test");
+    COMMENT("Store, save, and load more parameters than the built-in table holds");
+
+    Svc::PrmDbImpl impl("PrmDbImpl","TestFile.prm");
+
+    impl.init(10,0);
+
+    Svc::PrmDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run allocated database test
+    tester.runAllocatedDb();
+
+}
+
+TEST(ParameterDbTest,GetDuringChangeTest) {
+
+    TEST_CASE(105.1.5,"Get during change test");
+    COMMENT("Read a parameter while a change appears to be in progress");
+
+    Svc::PrmDbImpl impl("PrmDbImpl","TestFile.prm");
+
+    impl.init(10,0);
+
+    Svc::PrmDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run get during change test
+    tester.runGetDuringChange();
+
+}
+
+TEST(ParameterDbTest,LongFileNameTest) {
+
+    TEST_CASE(105.1.6,"Long file name test");
+    COMMENT("Save and load a file whose name fills the file name string");
+
+    // 79 characters: the longest name the file name string holds
+    const char fileName[] =
+        "LongTestFileName___________________________________________________________.prm";
+    ASSERT_EQ(Fw::EightyCharString::STRING_SIZE - 1, strlen(fileName));
+
+    Svc::PrmDbImpl impl("PrmDbImpl",fileName);
+
+    impl.init(10,0);
+
+    Svc::PrmDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // the temporary file takes the whole suffix, so the save works
+    tester.runNominalSaveFile();
+    tester.runNominalLoadFile();
+
+    (void) Os::FileSystem::removeFile(fileName);
+
+}
 
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
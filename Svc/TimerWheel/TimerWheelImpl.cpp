@@ -0,0 +1,274 @@
+// ====================================================================== 
+// \title  TimerWheelImpl.cpp
+// \brief  cpp file for TimerWheel component implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include "Svc/TimerWheel/TimerWheelImpl.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/BasicTypes.hpp"
+
+namespace Svc {
+
+  // ----------------------------------------------------------------------
+  // Construction, initialization, and destruction 
+  // ----------------------------------------------------------------------
+
+  TimerWheelImpl ::
+    TimerWheelImpl(
+#if FW_OBJECT_NAMES == 1
+        const char* compName
+#else
+        void
+#endif
+    ) :
+#if FW_OBJECT_NAMES == 1
+      TimerWheelComponentBase(compName),
+#else
+      TimerWheelComponentBase(),
+#endif
+      m_now(0),
+      m_tickUSeconds(0)
+  {
+    for (NATIVE_UINT_TYPE level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+      for (NATIVE_UINT_TYPE slot = 0; slot < SLOTS; ++slot) {
+        this->m_slots[level][slot] = NULL;
+      }
+    }
+  }
+
+  void TimerWheelImpl ::
+    init(const NATIVE_INT_TYPE instance)
+  {
+    TimerWheelComponentBase::init(instance);
+  }
+
+  void TimerWheelImpl ::
+    configure(const U32 tickUSeconds)
+  {
+    FW_ASSERT(tickUSeconds > 0);
+    this->m_tickUSeconds = tickUSeconds;
+  }
+
+  TimerWheelImpl ::
+    ~TimerWheelImpl(void)
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Handler implementations for input ports
+  // ----------------------------------------------------------------------
+
+  void TimerWheelImpl ::
+    deadlineSet_handler(
+        const NATIVE_INT_TYPE portNum,
+        U32 key,
+        Fw::Time &deadline
+    )
+  {
+    Timer* timer = this->find(portNum, key);
+    if (timer != NULL) {
+      this->unlink(*timer);
+    }
+    else {
+      timer = this->findFree();
+      if (timer == NULL) {
+        this->log_WARNING_HI_TW_TooManyDeadlines(portNum, key);
+        return;
+      }
+      timer->m_inUse = true;
+      timer->m_client = portNum;
+      timer->m_key = key;
+    }
+    timer->m_expires = this->m_now + this->ticksUntil(deadline);
+    this->insert(*timer);
+  }
+
+  void TimerWheelImpl ::
+    deadlineCancel_handler(
+        const NATIVE_INT_TYPE portNum,
+        U32 key
+    )
+  {
+    Timer *const timer = this->find(portNum, key);
+    if (timer != NULL) {
+      this->unlink(*timer);
+      timer->m_inUse = false;
+    }
+  }
+
+  void TimerWheelImpl ::
+    tick_handler(
+        const NATIVE_INT_TYPE portNum,
+        Svc::TimerVal &cycleStart
+    )
+  {
+    // Clients are called outside the lock, since they may set
+    // the next deadline from the timeout handler
+    NATIVE_INT_TYPE clients[TIMER_WHEEL_MAX_TIMERS];
+    U32 keys[TIMER_WHEEL_MAX_TIMERS];
+    NATIVE_UINT_TYPE numExpired = 0;
+
+    this->lock();
+    const U64 now = ++this->m_now;
+    // Move timers down from each level that wrapped
+    for (NATIVE_UINT_TYPE level = 1; level < TIMER_WHEEL_LEVELS; ++level) {
+      const U64 mask = (static_cast<U64>(1) << (TIMER_WHEEL_SLOT_BITS * level)) - 1;
+      if ((now & mask) != 0) {
+        break;
+      }
+      const NATIVE_UINT_TYPE slot = static_cast<NATIVE_UINT_TYPE>(
+          (now >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK
+      );
+      this->cascade(level, slot);
+    }
+    // Expire the level 0 slot
+    const NATIVE_UINT_TYPE slot = static_cast<NATIVE_UINT_TYPE>(now & SLOT_MASK);
+    Timer* timer = this->m_slots[0][slot];
+    this->m_slots[0][slot] = NULL;
+    while (timer != NULL) {
+      Timer *const next = timer->m_next;
+      timer->m_prev = NULL;
+      timer->m_next = NULL;
+      if (timer->m_expires <= now) {
+        FW_ASSERT(numExpired < TIMER_WHEEL_MAX_TIMERS, numExpired);
+        clients[numExpired] = timer->m_client;
+        keys[numExpired] = timer->m_key;
+        ++numExpired;
+        timer->m_inUse = false;
+      }
+      else {
+        this->insert(*timer);
+      }
+      timer = next;
+    }
+    this->unLock();
+
+    for (NATIVE_UINT_TYPE i = 0; i < numExpired; ++i) {
+      if (this->isConnected_timeout_OutputPort(clients[i])) {
+        this->timeout_out(clients[i], keys[i]);
+      }
+    }
+  }
+
+  // ----------------------------------------------------------------------
+  // Private helper methods
+  // ----------------------------------------------------------------------
+
+  U64 TimerWheelImpl ::
+    ticksUntil(const Fw::Time& deadline)
+  {
+    FW_ASSERT(this->m_tickUSeconds > 0);
+    const Fw::Time currentTime = this->getTime();
+    const U64 deadlineUSeconds =
+      static_cast<U64>(deadline.getSeconds()) * 1000000 + deadline.getUSeconds();
+    const U64 currentUSeconds =
+      static_cast<U64>(currentTime.getSeconds()) * 1000000 + currentTime.getUSeconds();
+    if (deadlineUSeconds <= currentUSeconds) {
+      return 1;
+    }
+    const U64 delta = deadlineUSeconds - currentUSeconds;
+    const U64 ticks = (delta + this->m_tickUSeconds - 1) / this->m_tickUSeconds;
+    return (ticks > 0) ? ticks : 1;
+  }
+
+  TimerWheelImpl::Timer* TimerWheelImpl ::
+    find(
+        const NATIVE_INT_TYPE client,
+        const U32 key
+    )
+  {
+    for (NATIVE_UINT_TYPE i = 0; i < TIMER_WHEEL_MAX_TIMERS; ++i) {
+      Timer& timer = this->m_timers[i];
+      if (timer.m_inUse and timer.m_client == client and timer.m_key == key) {
+        return &timer;
+      }
+    }
+    return NULL;
+  }
+
+  TimerWheelImpl::Timer* TimerWheelImpl ::
+    findFree(void)
+  {
+    for (NATIVE_UINT_TYPE i = 0; i < TIMER_WHEEL_MAX_TIMERS; ++i) {
+      if (not this->m_timers[i].m_inUse) {
+        return &this->m_timers[i];
+      }
+    }
+    return NULL;
+  }
+
+  void TimerWheelImpl ::
+    insert(Timer& timer)
+  {
+    // Timers beyond the span of the wheel wait in the top level
+    // and are placed again each time their slot comes around
+    const U64 span =
+      static_cast<U64>(1) << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS);
+    U64 expires = timer.m_expires;
+    if (expires < this->m_now) {
+      expires = this->m_now;
+    }
+    if (expires - this->m_now >= span) {
+      expires = this->m_now + span - 1;
+    }
+    const U64 delta = expires - this->m_now;
+    NATIVE_UINT_TYPE level = 0;
+    while (
+        level < TIMER_WHEEL_LEVELS - 1 and
+        delta >= (static_cast<U64>(1) << (TIMER_WHEEL_SLOT_BITS * (level + 1)))
+    ) {
+      ++level;
+    }
+    const NATIVE_UINT_TYPE slot = static_cast<NATIVE_UINT_TYPE>(
+        (expires >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK
+    );
+    timer.m_level = level;
+    timer.m_slot = slot;
+    timer.m_prev = NULL;
+    timer.m_next = this->m_slots[level][slot];
+    if (timer.m_next != NULL) {
+      timer.m_next->m_prev = &timer;
+    }
+    this->m_slots[level][slot] = &timer;
+  }
+
+  void TimerWheelImpl ::
+    unlink(Timer& timer)
+  {
+    if (timer.m_prev != NULL) {
+      timer.m_prev->m_next = timer.m_next;
+    }
+    else {
+      FW_ASSERT(this->m_slots[timer.m_level][timer.m_slot] == &timer);
+      this->m_slots[timer.m_level][timer.m_slot] = timer.m_next;
+    }
+    if (timer.m_next != NULL) {
+      timer.m_next->m_prev = timer.m_prev;
+    }
+    timer.m_prev = NULL;
+    timer.m_next = NULL;
+  }
+
+  void TimerWheelImpl ::
+    cascade(
+        const NATIVE_UINT_TYPE level,
+        const NATIVE_UINT_TYPE slot
+    )
+  {
+    Timer* timer = this->m_slots[level][slot];
+    this->m_slots[level][slot] = NULL;
+    while (timer != NULL) {
+      Timer *const next = timer->m_next;
+      this->insert(*timer);
+      timer = next;
+    }
+  }
+
+}
@@ -0,0 +1,208 @@
+// ====================================================================== 
+// \title  TimerWheelImpl.hpp
+// \brief  hpp file for TimerWheel component implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef Svc_TimerWheelImpl_HPP
+#define Svc_TimerWheelImpl_HPP
+
+#include "Svc/TimerWheel/TimerWheelComponentAc.hpp"
+#include "Svc/TimerWheel/TimerWheelImplCfg.hpp"
+
+namespace Svc {
+
+  //! \class TimerWheelImpl
+  //! \brief A hierarchical timer wheel
+  //!
+  //! Clients set deadlines on the deadlineSet port and are called back on
+  //! the timeout port with the same port number when a deadline expires.
+  //! The wheel advances one tick per call to the tick port. Each level
+  //! has 2^TIMER_WHEEL_SLOT_BITS slots; a timer is kept in the lowest
+  //! level whose span covers its remaining ticks and moves down a level
+  //! when the level below wraps. Setting, canceling, and advancing take
+  //! constant time apart from the search for a client's key, so a tick
+  //! with nothing due costs one slot lookup.
+  class TimerWheelImpl :
+    public TimerWheelComponentBase
+  {
+
+    PRIVATE:
+
+      enum Constants {
+        //! The number of slots in each level
+        SLOTS = 1 << TIMER_WHEEL_SLOT_BITS,
+        //! The slot index mask
+        SLOT_MASK = SLOTS - 1
+      };
+
+      //! \class Timer
+      //! \brief A deadline in the wheel
+      class Timer {
+
+        public:
+
+          //! Construct a Timer
+          Timer(void) :
+            m_inUse(false),
+            m_client(0),
+            m_key(0),
+            m_expires(0),
+            m_level(0),
+            m_slot(0),
+            m_prev(NULL),
+            m_next(NULL)
+          {
+
+          }
+
+        public:
+
+          //! Whether the timer is set
+          bool m_inUse;
+
+          //! The client port number
+          NATIVE_INT_TYPE m_client;
+
+          //! The client key
+          U32 m_key;
+
+          //! The tick at which the timer expires
+          U64 m_expires;
+
+          //! The level holding the timer
+          NATIVE_UINT_TYPE m_level;
+
+          //! The slot holding the timer
+          NATIVE_UINT_TYPE m_slot;
+
+          //! The previous timer in the slot
+          Timer* m_prev;
+
+          //! The next timer in the slot
+          Timer* m_next;
+
+      };
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Construction, initialization, and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct a TimerWheel
+      TimerWheelImpl(
+#if FW_OBJECT_NAMES == 1
+          const char* compName //!< The component name
+#else
+          void
+#endif
+      );
+
+      //! Initialize a TimerWheel
+      void init(
+          const NATIVE_INT_TYPE instance = 0 //!< The instance number
+      );
+
+      //! Set the tick period.
+      //! Call this before the first tick. Deadlines are rounded up to
+      //! a whole number of ticks.
+      void configure(
+          const U32 tickUSeconds //!< The tick period in microseconds
+      );
+
+      //! Destroy a TimerWheel
+      ~TimerWheelImpl(void);
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Handler implementations for input ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for input port deadlineSet
+      void deadlineSet_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          U32 key, //!< The key
+          Fw::Time &deadline //!< The time of the deadline
+      );
+
+      //! Handler for input port deadlineCancel
+      void deadlineCancel_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          U32 key //!< The key
+      );
+
+      //! Handler for input port tick
+      void tick_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          Svc::TimerVal &cycleStart //!< Cycle start timestamp
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Private helper methods
+      // ----------------------------------------------------------------------
+
+      //! Convert a deadline to a number of ticks from now, at least one
+      //! \return The number of ticks
+      U64 ticksUntil(
+          const Fw::Time& deadline //!< The deadline
+      );
+
+      //! Find the timer for a client key
+      //! \return The timer, or NULL if there is none
+      Timer* find(
+          const NATIVE_INT_TYPE client, //!< The client port number
+          const U32 key //!< The key
+      );
+
+      //! Find an unused timer
+      //! \return The timer, or NULL if there is none
+      Timer* findFree(void);
+
+      //! Put a timer in the slot for its expiration tick
+      void insert(
+          Timer& timer //!< The timer
+      );
+
+      //! Take a timer out of its slot
+      void unlink(
+          Timer& timer //!< The timer
+      );
+
+      //! Move the timers in a slot down to lower levels
+      void cascade(
+          const NATIVE_UINT_TYPE level, //!< The level
+          const NATIVE_UINT_TYPE slot //!< The slot
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Private member variables
+      // ----------------------------------------------------------------------
+
+      //! The timers
+      Timer m_timers[TIMER_WHEEL_MAX_TIMERS];
+
+      //! The slot lists, by level
+      Timer* m_slots[TIMER_WHEEL_LEVELS][SLOTS];
+
+      //! The current tick
+      U64 m_now;
+
+      //! The tick period in microseconds
+      U32 m_tickUSeconds;
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,18 @@
+/*
+ * TimerWheelImplCfg.hpp
+ *
+ *  Configuration for the TimerWheel component
+ */
+
+#ifndef TIMERWHEEL_TIMERWHEELIMPLCFG_HPP_
+#define TIMERWHEEL_TIMERWHEELIMPLCFG_HPP_
+
+// Define configuration values for the timer wheel
+
+enum {
+    TIMER_WHEEL_MAX_TIMERS = 32, // !< The number of deadlines that can be set at once, across all clients
+    TIMER_WHEEL_LEVELS = 4, // !< The number of wheel levels
+    TIMER_WHEEL_SLOT_BITS = 6, // !< log2 of the number of slots in each level
+};
+
+#endif /* TIMERWHEEL_TIMERWHEELIMPLCFG_HPP_ */
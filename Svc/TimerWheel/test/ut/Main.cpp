@@ -0,0 +1,40 @@
+// ----------------------------------------------------------------------
+// Main.cpp 
+// ----------------------------------------------------------------------
+
+#include "Tester.hpp"
+
+TEST(Test, expire) {
+  Svc::Tester tester;
+  tester.expire();
+}
+
+TEST(Test, cancel) {
+  Svc::Tester tester;
+  tester.cancel();
+}
+
+TEST(Test, move) {
+  Svc::Tester tester;
+  tester.move();
+}
+
+TEST(Test, cascade) {
+  Svc::Tester tester;
+  tester.cascade();
+}
+
+TEST(Test, past) {
+  Svc::Tester tester;
+  tester.past();
+}
+
+TEST(Test, tooMany) {
+  Svc::Tester tester;
+  tester.tooMany();
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
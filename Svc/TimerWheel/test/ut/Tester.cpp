@@ -0,0 +1,273 @@
+// ====================================================================== 
+// \title  Tester.cpp
+// \brief  cpp file for TimerWheel test harness implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include "Tester.hpp"
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 10
+#define TICK_USECONDS 1000
+
+namespace Svc {
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction 
+  // ----------------------------------------------------------------------
+
+  Tester ::
+    Tester(void) : 
+#if FW_OBJECT_NAMES == 1
+      TimerWheelGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("TimerWheel"),
+#else
+      TimerWheelGTestBase(MAX_HISTORY_SIZE),
+      component(),
+#endif
+      m_uSeconds(0),
+      m_lastClient(-1)
+  {
+    this->connectPorts();
+    this->initComponents();
+    this->component.configure(TICK_USECONDS);
+    this->setTestTime(Fw::Time(TB_NONE, 0, 0));
+  }
+
+  Tester ::
+    ~Tester(void) 
+  {
+    
+  }
+
+  // ----------------------------------------------------------------------
+  // Tests 
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    expire(void) 
+  {
+    this->setDeadline(1, 7, 5 * TICK_USECONDS);
+    this->tick(4);
+    ASSERT_from_timeout_SIZE(0);
+    this->tick(1);
+    ASSERT_from_timeout_SIZE(1);
+    ASSERT_from_timeout(0, 7);
+    ASSERT_EQ(1, this->m_lastClient);
+    // A deadline between ticks rounds up
+    this->clearHistory();
+    this->setDeadline(2, 3, TICK_USECONDS / 2);
+    this->tick(1);
+    ASSERT_from_timeout_SIZE(1);
+    ASSERT_from_timeout(0, 3);
+    ASSERT_EQ(2, this->m_lastClient);
+    // Timers are not periodic
+    this->clearHistory();
+    this->tick(100);
+    ASSERT_from_timeout_SIZE(0);
+  }
+
+  void Tester ::
+    cancel(void) 
+  {
+    this->setDeadline(0, 1, 3 * TICK_USECONDS);
+    this->setDeadline(0, 2, 3 * TICK_USECONDS);
+    this->invoke_to_deadlineCancel(0, 1);
+    // Canceling an unknown key has no effect
+    this->invoke_to_deadlineCancel(1, 2);
+    this->tick(3);
+    ASSERT_from_timeout_SIZE(1);
+    ASSERT_from_timeout(0, 2);
+  }
+
+  void Tester ::
+    move(void) 
+  {
+    this->setDeadline(0, 1, 3 * TICK_USECONDS);
+    this->setDeadline(0, 1, 10 * TICK_USECONDS);
+    this->tick(9);
+    ASSERT_from_timeout_SIZE(0);
+    this->tick(1);
+    ASSERT_from_timeout_SIZE(1);
+    ASSERT_from_timeout(0, 1);
+    // The same key on another client is a different deadline
+    this->clearHistory();
+    this->setDeadline(0, 1, 2 * TICK_USECONDS);
+    this->setDeadline(1, 1, 4 * TICK_USECONDS);
+    this->tick(2);
+    ASSERT_from_timeout_SIZE(1);
+    ASSERT_EQ(0, this->m_lastClient);
+    this->tick(2);
+    ASSERT_from_timeout_SIZE(2);
+    ASSERT_EQ(1, this->m_lastClient);
+  }
+
+  void Tester ::
+    cascade(void) 
+  {
+    // Start away from a level boundary
+    this->tick(17);
+    const U32 level1 = 64 + 5;
+    const U32 level2 = 64 * 64 * 2 + 33;
+    this->setDeadline(0, 1, level1 * TICK_USECONDS);
+    this->setDeadline(0, 2, level2 * TICK_USECONDS);
+    this->tick(level1 - 1);
+    ASSERT_from_timeout_SIZE(0);
+    this->tick(1);
+    ASSERT_from_timeout_SIZE(1);
+    ASSERT_from_timeout(0, 1);
+    this->tick(level2 - level1 - 1);
+    ASSERT_from_timeout_SIZE(1);
+    this->tick(1);
+    ASSERT_from_timeout_SIZE(2);
+    ASSERT_from_timeout(1, 2);
+  }
+
+  void Tester ::
+    past(void) 
+  {
+    this->tick(10);
+    const Fw::Time deadline(TB_NONE, 0, 0);
+    Fw::Time deadlineArg = deadline;
+    this->invoke_to_deadlineSet(0, 4, deadlineArg);
+    this->tick(1);
+    ASSERT_from_timeout_SIZE(1);
+    ASSERT_from_timeout(0, 4);
+  }
+
+  void Tester ::
+    tooMany(void) 
+  {
+    for (U32 key = 0; key < TIMER_WHEEL_MAX_TIMERS; ++key) {
+      this->setDeadline(0, key, (key + 1) * TICK_USECONDS);
+    }
+    ASSERT_EVENTS_SIZE(0);
+    this->setDeadline(1, 0, TICK_USECONDS);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_TW_TooManyDeadlines(0, 1, 0);
+    // Expired timers are free again
+    this->tick(1);
+    ASSERT_from_timeout_SIZE(1);
+    this->setDeadline(1, 0, TICK_USECONDS);
+    ASSERT_EVENTS_SIZE(1);
+  }
+
+  // ----------------------------------------------------------------------
+  // Handlers for typed from ports
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    from_timeout_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    this->pushFromPortEntry_timeout(context);
+    this->m_lastClient = portNum;
+  }
+
+  // ----------------------------------------------------------------------
+  // Helper methods 
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    connectPorts(void) 
+  {
+
+    // deadlineSet
+    for (NATIVE_INT_TYPE i = 0; i < 5; ++i) {
+      this->connect_to_deadlineSet(
+          i,
+          this->component.get_deadlineSet_InputPort(i)
+      );
+    }
+
+    // deadlineCancel
+    for (NATIVE_INT_TYPE i = 0; i < 5; ++i) {
+      this->connect_to_deadlineCancel(
+          i,
+          this->component.get_deadlineCancel_InputPort(i)
+      );
+    }
+
+    // tick
+    this->connect_to_tick(
+        0,
+        this->component.get_tick_InputPort(0)
+    );
+
+    // timeout
+    for (NATIVE_INT_TYPE i = 0; i < 5; ++i) {
+      this->component.set_timeout_OutputPort(
+          i, 
+          this->get_from_timeout(i)
+      );
+    }
+
+    // timeCaller
+    this->component.set_timeCaller_OutputPort(
+        0, 
+        this->get_from_timeCaller(0)
+    );
+
+    // logOut
+    this->component.set_logOut_OutputPort(
+        0, 
+        this->get_from_logOut(0)
+    );
+
+    // LogText
+    this->component.set_LogText_OutputPort(
+        0, 
+        this->get_from_LogText(0)
+    );
+
+  }
+
+  void Tester ::
+    initComponents(void) 
+  {
+    this->init();
+    this->component.init(
+        INSTANCE
+    );
+  }
+
+  void Tester ::
+    setDeadline(
+        const NATIVE_INT_TYPE client,
+        const U32 key,
+        const U32 uSeconds
+    )
+  {
+    const U64 deadlineUSeconds = this->m_uSeconds + uSeconds;
+    Fw::Time deadline(
+        TB_NONE,
+        static_cast<U32>(deadlineUSeconds / 1000000),
+        static_cast<U32>(deadlineUSeconds % 1000000)
+    );
+    this->invoke_to_deadlineSet(client, key, deadline);
+  }
+
+  void Tester ::
+    tick(const U32 ticks)
+  {
+    for (U32 i = 0; i < ticks; ++i) {
+      this->m_uSeconds += TICK_USECONDS;
+      const Fw::Time time(
+          TB_NONE,
+          static_cast<U32>(this->m_uSeconds / 1000000),
+          static_cast<U32>(this->m_uSeconds % 1000000)
+      );
+      this->setTestTime(time);
+      Svc::TimerVal cycleStart;
+      this->invoke_to_tick(0, cycleStart);
+    }
+  }
+
+} // end namespace Svc
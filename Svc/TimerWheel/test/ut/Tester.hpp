@@ -0,0 +1,131 @@
+// ====================================================================== 
+// \title  TimerWheel/test/ut/Tester.hpp
+// \brief  hpp file for TimerWheel test harness implementation class
+//
+// \copyright
+// Copyright (C) 2009-2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "GTestBase.hpp"
+#include "Svc/TimerWheel/TimerWheelImpl.hpp"
+
+namespace Svc {
+
+  class Tester :
+    public TimerWheelGTestBase
+  {
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object Tester
+      //!
+      Tester(void);
+
+      //! Destroy object Tester
+      //!
+      ~Tester(void);
+
+    public:
+
+      // ---------------------------------------------------------------------- 
+      // Tests
+      // ---------------------------------------------------------------------- 
+
+      //! A deadline expires on the tick that covers it
+      //!
+      void expire(void);
+
+      //! A canceled deadline does not expire
+      //!
+      void cancel(void);
+
+      //! Setting a key again moves its deadline
+      //!
+      void move(void);
+
+      //! Deadlines in the upper levels expire on time
+      //!
+      void cascade(void);
+
+      //! A deadline in the past expires on the next tick
+      //!
+      void past(void);
+
+      //! Setting too many deadlines fails
+      //!
+      void tooMany(void);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Handlers for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for from_timeout
+      //!
+      void from_timeout_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Connect ports
+      //!
+      void connectPorts(void);
+
+      //! Initialize components
+      //!
+      void initComponents(void);
+
+      //! Set a deadline some number of microseconds after the test time
+      //!
+      void setDeadline(
+          const NATIVE_INT_TYPE client, //!< The client
+          const U32 key, //!< The key
+          const U32 uSeconds //!< The microseconds from now
+      );
+
+      //! Advance the wheel and the test time by some ticks
+      //!
+      void tick(
+          const U32 ticks //!< The number of ticks
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The component under test
+      //!
+      TimerWheelImpl component;
+
+      //! The test time in microseconds
+      //!
+      U64 m_uSeconds;
+
+      //! The port number of the last timeout
+      //!
+      NATIVE_INT_TYPE m_lastClient;
+
+  };
+
+} // end namespace Svc
+
+#endif
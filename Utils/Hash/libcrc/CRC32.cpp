@@ -11,6 +11,7 @@
 // ====================================================================== 
 
 #include <Utils/Hash/Hash.hpp>
+#include <Utils/Hash/libcrc/CRC32Update.hpp>
 
 namespace Utils {
 
@@ -31,11 +32,12 @@ namespace Utils {
         HASH_HANDLE_TYPE local_hash_handle;
         local_hash_handle = 0xffffffffL;
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = ((char*)data)[index];
-            local_hash_handle = update_crc_32(local_hash_handle, c); 
-        }
+        FW_ASSERT(len >= 0, len);
+        local_hash_handle = crc32Update(
+            local_hash_handle,
+            static_cast<const U8*>(data),
+            static_cast<U32>(len)
+        );
         HashBuffer bufferOut;
         // For CRC32 we need to return the one's compliment of the result:
         Fw::SerializeStatus status = bufferOut.serialize(~(local_hash_handle));
@@ -53,11 +55,12 @@ namespace Utils {
         update(const void *const data, NATIVE_INT_TYPE len)
     {
         FW_ASSERT(data);
-        char c;
-        for(int index = 0; index < len; index++) {
-            c = ((char*)data)[index];
-            this->hash_handle = update_crc_32(this->hash_handle, c);
-        }
+        FW_ASSERT(len >= 0, len);
+        this->hash_handle = crc32Update(
+            this->hash_handle,
+            static_cast<const U8*>(data),
+            static_cast<U32>(len)
+        );
     }
     
     void Hash :: 
@@ -0,0 +1,46 @@
+// ====================================================================== 
+// \title  CRC32Update.hpp
+// \brief  hpp file for table-driven and hardware CRC32 updates
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#ifndef UTILS_CRC32_UPDATE_HPP
+#define UTILS_CRC32_UPDATE_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+
+//! Set to 0 to always use the table-driven update, even on CPUs
+//! with CRC32 support
+#ifndef UTILS_HASH_CRC32_HW_ACCEL
+#define UTILS_HASH_CRC32_HW_ACCEL 1
+#endif
+
+namespace Utils {
+
+  //! Update a CRC32 register with data. The result is the same as
+  //! calling update_crc_32 from lib_crc once per byte. The hardware
+  //! path is used when the CPU supports it.
+  //! \return The updated CRC register
+  U32 crc32Update(
+      const U32 crc, //!< The CRC register
+      const U8 *const data, //!< The data
+      const U32 length //!< The length of the data in bytes
+  );
+
+  //! Update a CRC32 register with data using the slicing-by-8 tables
+  //! only
+  //! \return The updated CRC register
+  U32 crc32UpdateSoftware(
+      const U32 crc, //!< The CRC register
+      const U8 *const data, //!< The data
+      const U32 length //!< The length of the data in bytes
+  );
+
+}
+
+#endif
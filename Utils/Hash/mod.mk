@@ -14,10 +14,14 @@
 # There are some standard files that are included for reference
 
 SRC = libcrc/CRC32.cpp \
+      libcrc/CRC32Update.cpp \
       libcrc/lib_crc.c \
       HashBufferCommon.cpp \
       HashCommon.cpp
 
 HDR = libcrc/CRC32.hpp \
+      libcrc/CRC32Update.hpp \
       Hash.hpp \
       HashBuffer.hpp
+
+SUBDIRS = test
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------
+// Main.cpp
+// ----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <Utils/Hash/libcrc/CRC32Update.hpp>
+
+extern "C" {
+  #include <Utils/Hash/libcrc/lib_crc.h>
+}
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace Utils {
+
+  namespace {
+
+    enum {
+      MAX_LENGTH = 4096,
+      MAX_ALIGNMENT = 16
+    };
+
+    //! Update a CRC register one byte at a time with lib_crc
+    U32 referenceUpdate(U32 crc, const U8 *const data, const U32 length) {
+      for (U32 i = 0; i < length; ++i) {
+        crc = static_cast<U32>(
+            update_crc_32(crc, static_cast<char>(data[i]))
+        );
+      }
+      return crc;
+    }
+
+    //! Fill a buffer with random bytes
+    void fillRandom(U8 *const data, const U32 size) {
+      for (U32 i = 0; i < size; ++i) {
+        data[i] = static_cast<U8>(rand());
+      }
+    }
+
+    //! Get a random length. Half the lengths are short, to cover the
+    //! paths for data too short to fold
+    U32 randomLength(void) {
+      return (rand() % 2) ? rand() % 128 : rand() % (MAX_LENGTH + 1);
+    }
+
+  }
+
+  TEST(CRC32, CheckValue) {
+    const char *const check = "123456789";
+    const U8 *const data = reinterpret_cast<const U8*>(check);
+    const U32 length = strlen(check);
+    EXPECT_EQ(0xCBF43926U, ~referenceUpdate(0xFFFFFFFFU, data, length));
+    EXPECT_EQ(0xCBF43926U, ~crc32Update(0xFFFFFFFFU, data, length));
+    EXPECT_EQ(0xCBF43926U, ~crc32UpdateSoftware(0xFFFFFFFFU, data, length));
+  }
+
+  TEST(CRC32, RandomLengthsAndAlignments) {
+    // crc32Update takes the hardware path when the CPU has one, so each
+    // path is compared with lib_crc on the machine that runs the test
+    U8* data = new U8[MAX_LENGTH + MAX_ALIGNMENT];
+    srand(1);
+    for (U32 iteration = 0; iteration < 2000; ++iteration) {
+      const U32 alignment = rand() % MAX_ALIGNMENT;
+      const U32 length = randomLength();
+      fillRandom(&data[alignment], length);
+      const U32 crc = static_cast<U32>(rand());
+      const U32 expected = referenceUpdate(crc, &data[alignment], length);
+      ASSERT_EQ(expected, crc32Update(crc, &data[alignment], length))
+        << "alignment " << alignment << ", length " << length;
+      ASSERT_EQ(expected, crc32UpdateSoftware(crc, &data[alignment], length))
+        << "alignment " << alignment << ", length " << length;
+    }
+    delete[] data;
+  }
+
+  TEST(CRC32, SplitUpdates) {
+    U8* data = new U8[MAX_LENGTH];
+    srand(2);
+    fillRandom(data, MAX_LENGTH);
+    const U32 expected = referenceUpdate(0xFFFFFFFFU, data, MAX_LENGTH);
+    for (U32 iteration = 0; iteration < 200; ++iteration) {
+      U32 hardware = 0xFFFFFFFFU;
+      U32 software = 0xFFFFFFFFU;
+      U32 offset = 0;
+      while (offset < MAX_LENGTH) {
+        U32 length = randomLength();
+        if (offset + length > MAX_LENGTH) {
+          length = MAX_LENGTH - offset;
+        }
+        hardware = crc32Update(hardware, &data[offset], length);
+        software = crc32UpdateSoftware(software, &data[offset], length);
+        offset += length;
+      }
+      ASSERT_EQ(expected, hardware);
+      ASSERT_EQ(expected, software);
+    }
+    delete[] data;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
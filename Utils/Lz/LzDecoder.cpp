@@ -0,0 +1,240 @@
+// ======================================================================
+// \title  LzDecoder.cpp
+// \brief  cpp file for LzDecoder class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Utils/Lz/LzDecoder.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <string.h>
+
+namespace Utils {
+
+  namespace {
+
+    //! Read a length that does not fit in a token nibble
+    //! \return Whether the length ended before the end of the block
+    bool readLength(const U8*& ip, const U8 *const end, U32& length) {
+      U8 byte = 255;
+      while (byte == 255) {
+        if (ip >= end) {
+          return false;
+        }
+        byte = *ip++;
+        length += byte;
+      }
+      return true;
+    }
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction
+  // ----------------------------------------------------------------------
+
+  LzDecoder ::
+    LzDecoder()
+  {
+    this->init();
+  }
+
+  LzDecoder ::
+    ~LzDecoder()
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Public static methods
+  // ----------------------------------------------------------------------
+
+  bool LzDecoder ::
+    decodeBlock(
+        const U8 *const block,
+        const U32 blockSize,
+        U8 *const out,
+        const U32 size
+    )
+  {
+    const U8* ip = block;
+    const U8 *const end = block + blockSize;
+    U8* op = out;
+    U8 *const outEnd = out + size;
+
+    while (ip < end) {
+      const U8 token = *ip++;
+
+      // Copy the literals
+      U32 literals = token >> 4;
+      if (literals == 15 && !readLength(ip, end, literals)) {
+        return false;
+      }
+      if (literals > static_cast<U32>(end - ip) ||
+          literals > static_cast<U32>(outEnd - op)) {
+        return false;
+      }
+      memcpy(op, ip, literals);
+      ip += literals;
+      op += literals;
+
+      // The last sequence has no match
+      if (ip == end) {
+        break;
+      }
+
+      // Copy the match. It may overlap the bytes it produces
+      if (static_cast<U32>(end - ip) < sizeof(U16)) {
+        return false;
+      }
+      const U32 offset = ip[0] | (ip[1] << 8);
+      ip += sizeof(U16);
+      if (offset == 0 || offset > static_cast<U32>(op - out)) {
+        return false;
+      }
+      U32 matchLength = token & 0x0F;
+      if (matchLength == 15 && !readLength(ip, end, matchLength)) {
+        return false;
+      }
+      matchLength += Lz::LZ_MIN_MATCH;
+      if (matchLength > static_cast<U32>(outEnd - op)) {
+        return false;
+      }
+      const U8* ref = op - offset;
+      if (offset >= matchLength) {
+        memcpy(op, ref, matchLength);
+        op += matchLength;
+      }
+      else {
+        for (U32 i = 0; i < matchLength; ++i) {
+          *op++ = *ref++;
+        }
+      }
+    }
+
+    return op == outEnd;
+  }
+
+  // ----------------------------------------------------------------------
+  // Public instance methods
+  // ----------------------------------------------------------------------
+
+  void LzDecoder ::
+    init(void)
+  {
+    this->headerUsed = 0;
+    this->dataSize = 0;
+    this->payloadSize = 0;
+    this->stored = false;
+    this->payloadUsed = 0;
+    this->outputData = this->output;
+    this->outputSize = 0;
+  }
+
+  LzDecoder::Status LzDecoder ::
+    update(
+        const U8 *const data,
+        const U32 size,
+        U32& used
+    )
+  {
+    FW_ASSERT(data != NULL || size == 0);
+    used = 0;
+
+    // Collect the header
+    while (this->headerUsed < Lz::LZ_FRAME_HEADER_SIZE) {
+      if (used == size) {
+        return NEED_INPUT;
+      }
+      this->header[this->headerUsed++] = data[used++];
+      if (this->headerUsed == Lz::LZ_FRAME_HEADER_SIZE && !this->readHeader()) {
+        return BAD_FRAME;
+      }
+    }
+
+    // Decode a payload that is all in the input where it lies
+    const U32 available = size - used;
+    if (this->payloadUsed == 0 && available >= this->payloadSize) {
+      const U8 *const payload = &data[used];
+      used += this->payloadSize;
+      return this->decodePayload(payload);
+    }
+
+    // Otherwise collect it
+    const U32 needed = this->payloadSize - this->payloadUsed;
+    const U32 copy = (available < needed) ? available : needed;
+    memcpy(&this->payload[this->payloadUsed], &data[used], copy);
+    this->payloadUsed += copy;
+    used += copy;
+    if (this->payloadUsed < this->payloadSize) {
+      return NEED_INPUT;
+    }
+    return this->decodePayload(this->payload);
+  }
+
+  const U8* LzDecoder ::
+    getData(void) const
+  {
+    return this->outputData;
+  }
+
+  U32 LzDecoder ::
+    getSize(void) const
+  {
+    return this->outputSize;
+  }
+
+  bool LzDecoder ::
+    isIdle(void) const
+  {
+    return this->headerUsed == 0;
+  }
+
+  // ----------------------------------------------------------------------
+  // Private instance methods
+  // ----------------------------------------------------------------------
+
+  bool LzDecoder ::
+    readHeader(void)
+  {
+    this->dataSize = (this->header[0] << 8) | this->header[1];
+    const U32 payloadField = (this->header[2] << 8) | this->header[3];
+    this->stored = (payloadField & Lz::LZ_FRAME_STORED) != 0;
+    this->payloadSize = payloadField & ~static_cast<U32>(Lz::LZ_FRAME_STORED);
+    this->payloadUsed = 0;
+    if (this->dataSize == 0 || this->dataSize > Lz::LZ_FRAME_DATA_SIZE) {
+      return false;
+    }
+    // The encoder stores data that does not get smaller
+    return this->stored ?
+      (this->payloadSize == this->dataSize) :
+      (this->payloadSize > 0 && this->payloadSize < this->dataSize);
+  }
+
+  LzDecoder::Status LzDecoder ::
+    decodePayload(const U8 *const payload)
+  {
+    // The next update starts a new frame
+    this->headerUsed = 0;
+    this->payloadUsed = 0;
+    this->outputSize = 0;
+    if (this->stored) {
+      // Stored data is handed back where it lies
+      this->outputData = payload;
+    }
+    else {
+      if (!decodeBlock(payload, this->payloadSize, this->output, this->dataSize)) {
+        return BAD_FRAME;
+      }
+      this->outputData = this->output;
+    }
+    this->outputSize = this->dataSize;
+    return FRAME_READY;
+  }
+
+}
@@ -0,0 +1,170 @@
+// ======================================================================
+// \title  LzDecoder.hpp
+// \brief  hpp file for LzDecoder class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef UTILS_LZ_DECODER_HPP
+#define UTILS_LZ_DECODER_HPP
+
+#include "Fw/Types/BasicTypes.hpp"
+#include "Utils/Lz/LzFormat.hpp"
+
+namespace Utils {
+
+  //! \class LzDecoder
+  //! \brief Decompresses a stream of Utils::Lz frames
+  //!
+  //! The stream may be handed to update in pieces of any size. Each
+  //! frame is checked before it is decoded, so corrupt input gives
+  //! BAD_FRAME and never reads or writes out of bounds
+  //!
+  class LzDecoder {
+
+    public:
+
+      //! The result of update
+      typedef enum {
+        NEED_INPUT, //!< All the input was used without completing a frame
+        FRAME_READY, //!< A frame was decoded; get it with getData and getSize
+        BAD_FRAME //!< The input is not a valid stream
+      } Status;
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct an LzDecoder object
+      //!
+      LzDecoder();
+
+      //! Destroy an LzDecoder object
+      //!
+      ~LzDecoder();
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Public static methods
+      // ----------------------------------------------------------------------
+
+      //! Decode an LZ4 block
+      //! \return Whether the block was valid and decoded to exactly size bytes
+      //!
+      static bool decodeBlock(
+          const U8 *const block, //!< The block
+          const U32 blockSize, //!< The size of the block
+          U8 *const out, //!< The data
+          const U32 size //!< The size of the data
+      );
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Public instance methods
+      // ----------------------------------------------------------------------
+
+      //! Start a new stream
+      //!
+      void init(void);
+
+      //! Decode the stream until a frame is complete or the input is used up.
+      //! Call again with the rest of the input after FRAME_READY
+      //!
+      Status update(
+          const U8 *const data, //!< The next bytes of the stream
+          const U32 size, //!< The number of bytes
+          U32& used //!< The number of bytes used
+      );
+
+      //! Get the data of the last frame decoded. A stored frame may point
+      //! into the input, so the data is valid until the input is released
+      //! or update is called again
+      //!
+      const U8* getData(void) const;
+
+      //! Get the size of the last frame decoded
+      //!
+      U32 getSize(void) const;
+
+      //! Whether the input so far ends on a frame boundary, as a complete
+      //! stream does
+      //!
+      bool isIdle(void) const;
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Private instance methods
+      // ----------------------------------------------------------------------
+
+      //! Check the frame header and set the frame sizes
+      //! \return Whether the header is valid
+      //!
+      bool readHeader(void);
+
+      //! Decode a payload into the output buffer
+      //! \return FRAME_READY or BAD_FRAME
+      //!
+      Status decodePayload(
+          const U8 *const payload //!< The payload
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Private member variables
+      // ----------------------------------------------------------------------
+
+      //! The header of the current frame
+      //!
+      U8 header[Lz::LZ_FRAME_HEADER_SIZE];
+
+      //! The number of header bytes received
+      //!
+      U32 headerUsed;
+
+      //! The data size of the current frame
+      //!
+      U32 dataSize;
+
+      //! The payload size of the current frame
+      //!
+      U32 payloadSize;
+
+      //! Whether the current frame is stored as is
+      //!
+      bool stored;
+
+      //! The payload of the current frame, when it arrives in pieces
+      //!
+      U8 payload[Lz::LZ_FRAME_DATA_SIZE];
+
+      //! The number of payload bytes received
+      //!
+      U32 payloadUsed;
+
+      //! The last frame decoded
+      //!
+      U8 output[Lz::LZ_FRAME_DATA_SIZE];
+
+      //! The pointer to the data of the last frame decoded
+      //!
+      const U8* outputData;
+
+      //! The size of the last frame decoded
+      //!
+      U32 outputSize;
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,209 @@
+// ======================================================================
+// \title  LzEncoder.cpp
+// \brief  cpp file for LzEncoder class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Utils/Lz/LzEncoder.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <string.h>
+
+namespace Utils {
+
+  namespace {
+
+    //! Read four bytes at any alignment
+    U32 read32(const U8 *const p) {
+      U32 value;
+      memcpy(&value, p, sizeof(value));
+      return value;
+    }
+
+    //! Hash four bytes into the table
+    U32 hash32(const U32 value) {
+      return (value * 2654435761U) >> (32 - Lz::LZ_HASH_BITS);
+    }
+
+    //! Write a length that does not fit in a token nibble
+    U8* writeLength(U8* op, U32 length) {
+      while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+      }
+      *op++ = static_cast<U8>(length);
+      return op;
+    }
+
+    //! Get the bytes a length takes beyond its token nibble
+    U32 lengthSize(const U32 length) {
+      return (length >= 15) ? (length - 15) / 255 + 1 : 0;
+    }
+
+    //! Write a big-endian U16
+    void writeU16(U8 *const p, const U32 value) {
+      p[0] = static_cast<U8>(value >> 8);
+      p[1] = static_cast<U8>(value);
+    }
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction
+  // ----------------------------------------------------------------------
+
+  LzEncoder ::
+    LzEncoder()
+  {
+    memset(this->table, 0, sizeof(this->table));
+  }
+
+  LzEncoder ::
+    ~LzEncoder()
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Public static methods
+  // ----------------------------------------------------------------------
+
+  U32 LzEncoder ::
+    bound(const U32 size)
+  {
+    const U32 frames = (size + Lz::LZ_FRAME_DATA_SIZE - 1) / Lz::LZ_FRAME_DATA_SIZE;
+    return size + frames * Lz::LZ_FRAME_HEADER_SIZE;
+  }
+
+  // ----------------------------------------------------------------------
+  // Public instance methods
+  // ----------------------------------------------------------------------
+
+  U32 LzEncoder ::
+    encode(
+        const U8 *const data,
+        const U32 size,
+        U8 *const out
+    )
+  {
+    FW_ASSERT(data != NULL || size == 0);
+    FW_ASSERT(out != NULL);
+    U32 offset = 0;
+    U8* op = out;
+    while (offset < size) {
+      const U32 remaining = size - offset;
+      const U32 frameSize = (remaining < Lz::LZ_FRAME_DATA_SIZE) ?
+        remaining : static_cast<U32>(Lz::LZ_FRAME_DATA_SIZE);
+      U8 *const payload = op + Lz::LZ_FRAME_HEADER_SIZE;
+      U32 payloadSize = this->encodeBlock(&data[offset], frameSize, payload);
+      U32 payloadField = payloadSize;
+      if (payloadSize == 0) {
+        memcpy(payload, &data[offset], frameSize);
+        payloadSize = frameSize;
+        payloadField = frameSize | Lz::LZ_FRAME_STORED;
+      }
+      writeU16(op, frameSize);
+      writeU16(op + sizeof(U16), payloadField);
+      op = payload + payloadSize;
+      offset += frameSize;
+    }
+    return static_cast<U32>(op - out);
+  }
+
+  // ----------------------------------------------------------------------
+  // Private instance methods
+  // ----------------------------------------------------------------------
+
+  U32 LzEncoder ::
+    encodeBlock(
+        const U8 *const data,
+        const U32 size,
+        U8 *const out
+    )
+  {
+    FW_ASSERT(size <= Lz::LZ_FRAME_DATA_SIZE, size);
+    if (size <= Lz::LZ_MATCH_FIND_LIMIT) {
+      return 0;
+    }
+
+    // Positions are stored plus one, so zero means none. The table is
+    // cleared for each block, because blocks are decoded on their own
+    memset(this->table, 0, sizeof(this->table));
+
+    const U8 *const end = data + size;
+    const U8 *const matchLimit = end - Lz::LZ_LAST_LITERALS;
+    const U8 *const findLimit = end - Lz::LZ_MATCH_FIND_LIMIT;
+    U8 *const outEnd = out + size;
+    const U8* ip = data;
+    const U8* anchor = data;
+    U8* op = out;
+    U32 misses = 0;
+
+    while (ip < findLimit) {
+      const U32 value = read32(ip);
+      const U32 h = hash32(value);
+      const U32 candidate = this->table[h];
+      this->table[h] = static_cast<U16>(ip - data + 1);
+      const U8 *const ref = (candidate > 0) ? data + candidate - 1 : NULL;
+      if (ref == NULL ||
+          static_cast<U32>(ip - ref) > Lz::LZ_MAX_OFFSET ||
+          read32(ref) != value) {
+        // Step faster through data that does not match
+        ip += 1 + (misses++ >> 5);
+        continue;
+      }
+      misses = 0;
+
+      U32 matchLength = Lz::LZ_MIN_MATCH;
+      while (ip + matchLength < matchLimit && ref[matchLength] == ip[matchLength]) {
+        ++matchLength;
+      }
+
+      // Emit the literals and the match
+      const U32 literals = static_cast<U32>(ip - anchor);
+      const U32 matchCode = matchLength - Lz::LZ_MIN_MATCH;
+      const U32 needed = 1 + lengthSize(literals) + literals +
+        sizeof(U16) + lengthSize(matchCode);
+      if (op + needed >= outEnd) {
+        return 0;
+      }
+      U8 *const token = op++;
+      *token = static_cast<U8>(((literals < 15) ? literals : 15) << 4);
+      if (literals >= 15) {
+        op = writeLength(op, literals - 15);
+      }
+      memcpy(op, anchor, literals);
+      op += literals;
+      const U32 offset = static_cast<U32>(ip - ref);
+      *op++ = static_cast<U8>(offset);
+      *op++ = static_cast<U8>(offset >> 8);
+      *token |= static_cast<U8>((matchCode < 15) ? matchCode : 15);
+      if (matchCode >= 15) {
+        op = writeLength(op, matchCode - 15);
+      }
+
+      ip += matchLength;
+      anchor = ip;
+    }
+
+    // The block ends with the remaining literals
+    const U32 literals = static_cast<U32>(end - anchor);
+    if (op + 1 + lengthSize(literals) + literals >= outEnd) {
+      return 0;
+    }
+    U8 *const token = op++;
+    *token = static_cast<U8>(((literals < 15) ? literals : 15) << 4);
+    if (literals >= 15) {
+      op = writeLength(op, literals - 15);
+    }
+    memcpy(op, anchor, literals);
+    op += literals;
+    return static_cast<U32>(op - out);
+  }
+
+}
@@ -0,0 +1,101 @@
+// ======================================================================
+// \title  LzEncoder.hpp
+// \brief  hpp file for LzEncoder class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef UTILS_LZ_ENCODER_HPP
+#define UTILS_LZ_ENCODER_HPP
+
+#include "Fw/Types/BasicTypes.hpp"
+#include "Utils/Lz/LzFormat.hpp"
+
+namespace Utils {
+
+  //! \class LzEncoder
+  //! \brief Compresses data into frames of the Utils::Lz stream format
+  //!
+  //! Each call to encode writes whole frames, so data handed to one or
+  //! more calls in order decodes as one stream. An encoder holds its hash
+  //! table and is not shared between tasks
+  //!
+  class LzEncoder {
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct an LzEncoder object
+      //!
+      LzEncoder();
+
+      //! Destroy an LzEncoder object
+      //!
+      ~LzEncoder();
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Public static methods
+      // ----------------------------------------------------------------------
+
+      //! Get the most bytes that encode can write for size bytes of data.
+      //! Data that does not compress grows by one frame header per frame
+      //!
+      static U32 bound(
+          const U32 size //!< The size of the data
+      );
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Public instance methods
+      // ----------------------------------------------------------------------
+
+      //! Compress data into frames
+      //! \return The number of bytes written to out
+      //!
+      U32 encode(
+          const U8 *const data, //!< The data
+          const U32 size, //!< The size of the data
+          U8 *const out //!< The frames. Must hold bound(size) bytes
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Private instance methods
+      // ----------------------------------------------------------------------
+
+      //! Compress at most LZ_FRAME_DATA_SIZE bytes into an LZ4 block
+      //! \return The size of the block, or zero if it would not be
+      //!         smaller than the data
+      //!
+      U32 encodeBlock(
+          const U8 *const data, //!< The data
+          const U32 size, //!< The size of the data
+          U8 *const out //!< The block. Must hold size bytes
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Private member variables
+      // ----------------------------------------------------------------------
+
+      //! The most recent position plus one of each hashed four byte sequence
+      //!
+      U16 table[1 << Lz::LZ_HASH_BITS];
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,43 @@
+// ======================================================================
+// \title  LzFormat.hpp
+// \brief  Constants of the Utils::Lz stream format
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef UTILS_LZ_FORMAT_HPP
+#define UTILS_LZ_FORMAT_HPP
+
+#include "Fw/Types/BasicTypes.hpp"
+
+namespace Utils {
+
+  //! A compressed stream is a sequence of frames. Each frame holds up to
+  //! LZ_FRAME_DATA_SIZE bytes of data and starts with a header of two
+  //! big-endian U16 values: the size of the data, and the size of the
+  //! payload that follows. If LZ_FRAME_STORED is set in the payload size,
+  //! the payload is the data itself. Otherwise it is an LZ4 block.
+  //! Frames do not refer to each other, so a stream can be decoded frame
+  //! by frame with a fixed amount of memory
+  namespace Lz {
+
+    enum {
+      LZ_FRAME_DATA_SIZE = 8192, //!< The most data in one frame
+      LZ_FRAME_HEADER_SIZE = 2 * sizeof(U16), //!< The size of a frame header
+      LZ_FRAME_STORED = 0x8000, //!< Payload size flag for data stored as is
+      LZ_MIN_MATCH = 4, //!< The shortest match
+      LZ_LAST_LITERALS = 5, //!< A block ends with at least this many literals
+      LZ_MATCH_FIND_LIMIT = 12, //!< No match starts in this many bytes before the end of a block
+      LZ_MAX_OFFSET = 65535, //!< The farthest match
+      LZ_HASH_BITS = 12 //!< log2 of the number of entries in the encoder hash table
+    };
+
+  }
+
+}
+
+#endif
@@ -0,0 +1,15 @@
+#
+#   Copyright 2004-2008, by the California Institute of Technology.
+#   ALL RIGHTS RESERVED. United States Government Sponsorship
+#   acknowledged.
+#
+#
+
+SRC = LzDecoder.cpp \
+      LzEncoder.cpp
+
+HDR = LzDecoder.hpp \
+      LzEncoder.hpp \
+      LzFormat.hpp
+
+SUBDIRS = test
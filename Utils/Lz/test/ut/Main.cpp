@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------
+// Main.cpp
+// ----------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <Utils/Lz/LzEncoder.hpp>
+#include <Utils/Lz/LzDecoder.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace Utils {
+
+  namespace {
+
+    enum { TEST_SIZE = 3 * Lz::LZ_FRAME_DATA_SIZE + 100 };
+
+    //! Fill a buffer with records that look like logged telemetry: a
+    //! counter, a slowly changing value, and constant padding
+    void fillTelemetry(U8 *const data, const U32 size) {
+      for (U32 i = 0; i < size; ++i) {
+        const U32 record = i / 16;
+        switch (i % 16) {
+          case 0: data[i] = static_cast<U8>(record >> 8); break;
+          case 1: data[i] = static_cast<U8>(record); break;
+          case 2: data[i] = static_cast<U8>(record / 64); break;
+          default: data[i] = static_cast<U8>(0xA0 + i % 4); break;
+        }
+      }
+    }
+
+    //! Fill a buffer with bytes that do not compress
+    void fillRandom(U8 *const data, const U32 size) {
+      srand(1);
+      for (U32 i = 0; i < size; ++i) {
+        data[i] = static_cast<U8>(rand());
+      }
+    }
+
+    //! Decode a stream, handing it to the decoder in pieces of at most
+    //! chunk bytes
+    //! \return The number of bytes decoded, or -1 for a bad stream
+    I32 decode(
+        const U8 *const stream,
+        const U32 streamSize,
+        const U32 chunk,
+        U8 *const out,
+        const U32 outCapacity
+    ) {
+      LzDecoder decoder;
+      U32 offset = 0;
+      U32 outSize = 0;
+      while (offset < streamSize) {
+        const U32 remaining = streamSize - offset;
+        const U32 size = (remaining < chunk) ? remaining : chunk;
+        U32 used = 0;
+        const LzDecoder::Status status =
+          decoder.update(&stream[offset], size, used);
+        if (status == LzDecoder::BAD_FRAME) {
+          return -1;
+        }
+        EXPECT_LE(used, size);
+        offset += used;
+        if (status == LzDecoder::FRAME_READY) {
+          EXPECT_LE(outSize + decoder.getSize(), outCapacity);
+          memcpy(&out[outSize], decoder.getData(), decoder.getSize());
+          outSize += decoder.getSize();
+        }
+      }
+      return decoder.isIdle() ? static_cast<I32>(outSize) : -1;
+    }
+
+    //! Encode data, decode it in pieces of several sizes, and check that
+    //! it comes back
+    //! \return The size of the stream
+    U32 roundTrip(const U8 *const data, const U32 size) {
+      LzEncoder encoder;
+      U8* stream = new U8[LzEncoder::bound(size)];
+      const U32 streamSize = encoder.encode(data, size, stream);
+      EXPECT_LE(streamSize, LzEncoder::bound(size));
+      U8* out = new U8[size + 1];
+      const U32 chunks[] = { 1, 7, 4096, streamSize + 1 };
+      for (U32 i = 0; i < sizeof(chunks) / sizeof(chunks[0]); ++i) {
+        const I32 outSize = decode(stream, streamSize, chunks[i], out, size);
+        EXPECT_EQ(static_cast<I32>(size), outSize);
+        EXPECT_EQ(0, memcmp(data, out, size));
+      }
+      delete[] out;
+      delete[] stream;
+      return streamSize;
+    }
+
+  }
+
+  TEST(Lz, Telemetry) {
+    U8* data = new U8[TEST_SIZE];
+    fillTelemetry(data, TEST_SIZE);
+    const U32 streamSize = roundTrip(data, TEST_SIZE);
+    // Telemetry records share most of their bytes
+    EXPECT_LT(streamSize, TEST_SIZE / 2U);
+    delete[] data;
+  }
+
+  TEST(Lz, Incompressible) {
+    U8* data = new U8[TEST_SIZE];
+    fillRandom(data, TEST_SIZE);
+    const U32 streamSize = roundTrip(data, TEST_SIZE);
+    // Every frame is stored
+    EXPECT_EQ(LzEncoder::bound(TEST_SIZE), streamSize);
+    delete[] data;
+  }
+
+  TEST(Lz, Runs) {
+    // Long runs need extended lengths and overlapping matches
+    U8* data = new U8[TEST_SIZE];
+    memset(data, 0x55, TEST_SIZE);
+    for (U32 i = 0; i < TEST_SIZE; i += 1000) {
+      data[i] = static_cast<U8>(i);
+    }
+    roundTrip(data, TEST_SIZE);
+    delete[] data;
+  }
+
+  TEST(Lz, SmallSizes) {
+    U8 data[64];
+    fillTelemetry(data, sizeof(data));
+    for (U32 size = 0; size <= sizeof(data); ++size) {
+      roundTrip(data, size);
+    }
+    LzEncoder encoder;
+    U8 stream[8];
+    EXPECT_EQ(0U, encoder.encode(data, 0, stream));
+  }
+
+  TEST(Lz, Corrupt) {
+    U8* data = new U8[TEST_SIZE];
+    fillTelemetry(data, TEST_SIZE);
+    LzEncoder encoder;
+    U8* stream = new U8[LzEncoder::bound(TEST_SIZE)];
+    const U32 streamSize = encoder.encode(data, TEST_SIZE, stream);
+    U8* corrupt = new U8[streamSize];
+    U8* out = new U8[TEST_SIZE];
+    // Damaged bytes must never read or write out of bounds. Most give a
+    // bad frame; the rest decode to the wrong data
+    for (U32 i = 0; i < streamSize; i += 13) {
+      memcpy(corrupt, stream, streamSize);
+      corrupt[i] ^= 0x5A;
+      (void) decode(corrupt, streamSize, streamSize, out, TEST_SIZE);
+    }
+    // A frame header with no data is bad
+    const U8 empty[Lz::LZ_FRAME_HEADER_SIZE] = { 0, 0, 0, 0 };
+    EXPECT_EQ(-1, decode(empty, sizeof(empty), sizeof(empty), out, TEST_SIZE));
+    // A stream that ends inside a frame is incomplete
+    EXPECT_EQ(-1, decode(stream, streamSize - 1, streamSize, out, TEST_SIZE));
+    delete[] out;
+    delete[] corrupt;
+    delete[] stream;
+    delete[] data;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,5 @@
+TEST_SRC = Main.cpp
+
+TEST_MODS = Utils/Lz \
+Fw/Types \
+gtest
@@ -34,7 +34,8 @@ CFDP_GTEST_MODULES := \
 	CFDP/Checksum/GTest
 	
 UTILS_MODULES := \
-	Utils/Hash
+	Utils/Hash \
+	Utils/Lz
         
 SVC_MODULES := \
 	Svc/BufferAccumulator \
@@ -47,6 +48,10 @@ SVC_MODULES := \
 	Svc/ActiveRateGroup \
 	Svc/RateGroupDriver \
 	Svc/Sched \
+	Svc/Deadline \
+	Svc/TimerWheel \
+	Svc/FileIo \
+	Svc/AsyncFileIo \
 	Svc/ComLogger \
 	Svc/SocketGndIf \
 	Svc/BuffGndSockIf \